@@ -5,6 +5,7 @@ import { useManagedSourceSync } from './application/state/useManagedSourceSync';
 import { usePortForwardingAutoStart } from './application/state/usePortForwardingAutoStart';
 import { useSessionState } from './application/state/useSessionState';
 import { useSettingsState } from './application/state/useSettingsState';
+import { useTmuxControl } from './application/state/useTmuxControl';
 import { useUpdateCheck } from './application/state/useUpdateCheck';
 import { useVaultState } from './application/state/useVaultState';
 import { useWindowControls } from './application/state/useWindowControls';
@@ -23,6 +24,9 @@ import { ToastProvider, toast } from './components/ui/toast';
 import { VaultView, VaultSection } from './components/VaultView';
 import { KeyboardInteractiveModal, KeyboardInteractiveRequest } from './components/KeyboardInteractiveModal';
 import { PassphraseModal, PassphraseRequest } from './components/PassphraseModal';
+import { prewarmMonaco } from './lib/monacoLoader';
+import { isRenderProfilerEnabled, renderProfilerStore } from './lib/renderProfiler';
+import { withRenderProfiler } from './lib/useRenderTracker';
 import { cn } from './lib/utils';
 import { ConnectionLog, Host, HostProtocol, SerialConfig, TerminalTheme } from './types';
 import { LogView as LogViewType } from './application/state/useSessionState';
@@ -83,6 +87,7 @@ const LogViewWrapper: React.FC<LogViewWrapperProps> = ({ logView, defaultTermina
 
 const LazyLogView = lazy(() => import('./components/LogView'));
 const LazyProtocolSelectDialog = lazy(() => import('./components/ProtocolSelectDialog'));
+const LazyRenderProfilerOverlay = lazy(() => import('./components/RenderProfilerOverlay'));
 const LazyQuickSwitcher = lazy(() =>
   import('./components/QuickSwitcher').then((m) => ({ default: m.QuickSwitcher })),
 );
@@ -176,6 +181,7 @@ function App({ settings }: { settings: SettingsState }) {
     sessionLogsEnabled,
     sessionLogsDir,
     sessionLogsFormat,
+    sessionRestoreInBackground,
   } = settings;
 
   const {
@@ -200,6 +206,7 @@ function App({ settings }: { settings: SettingsState }) {
     addShellHistoryEntry,
     addConnectionLog,
     updateConnectionLog,
+    recordConnectTiming,
     toggleConnectionLogSaved,
     deleteConnectionLog,
     clearUnsavedConnectionLogs,
@@ -232,10 +239,13 @@ function App({ settings }: { settings: SettingsState }) {
     closeSession,
     closeWorkspace,
     updateSessionStatus,
+    activateRestoredSession,
     createWorkspaceFromSessions,
     addSessionToWorkspace,
     updateSplitSizes,
     splitSession,
+    syncTmuxWindow,
+    removeTmuxPanes,
     toggleWorkspaceViewMode,
     setWorkspaceFocusedSession,
     moveFocusInWorkspace,
@@ -318,6 +328,21 @@ function App({ settings }: { settings: SettingsState }) {
     keys: portForwardingKeys,
   });
 
+  // tmux control mode: remote panes as tabs and splits
+  const tmuxControl = useTmuxControl({ sessions, syncTmuxWindow, removeTmuxPanes });
+  const { splitPane: splitTmuxPane, attach: attachTmux } = tmuxControl;
+
+  // Splitting a tmux pane asks tmux to split; everything else opens a new connection
+  const handleSplitSession = useCallback((sessionId: string, direction: 'horizontal' | 'vertical') => {
+    if (!splitTmuxPane(sessionId, direction)) splitSession(sessionId, direction);
+  }, [splitTmuxPane, splitSession]);
+
+  const handleAttachTmux = useCallback((sessionId: string) => {
+    attachTmux(sessionId).catch((err) => {
+      toast.error(err instanceof Error ? err.message : String(err), t('terminal.tmux.attachFailed'));
+    });
+  }, [attachTmux, t]);
+
   // Keyboard-interactive authentication (2FA/MFA) event listener
   useEffect(() => {
     const bridge = netcattyBridge.get();
@@ -431,6 +456,20 @@ function App({ settings }: { settings: SettingsState }) {
     };
   }, []);
 
+  // SSH connect-time breakdowns from the main process go into the connection log
+  useEffect(() => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.onConnectTiming) return;
+
+    const unsubscribe = bridge.onConnectTiming(({ hostname, timing }) => {
+      recordConnectTiming(hostname, timing);
+    });
+
+    return () => {
+      unsubscribe?.();
+    };
+  }, [recordConnectTiming]);
+
   // Debounce ref for moveFocus to prevent double-triggering when focus switches
   const lastMoveFocusTimeRef = useRef<number>(0);
   const MOVE_FOCUS_DEBOUNCE_MS = 200;
@@ -549,7 +588,7 @@ function App({ settings }: { settings: SettingsState }) {
         const activeWs = workspaces.find(w => w.id === currentId);
         if (activeSession && !activeSession.workspaceId) {
           // Standalone session - split it
-          splitSession(activeSession.id, 'horizontal');
+          handleSplitSession(activeSession.id, 'horizontal');
         } else if (activeWs) {
           // In a workspace - need to determine focused session
           // For now, we'll need the terminal to handle this via context menu
@@ -564,7 +603,7 @@ function App({ settings }: { settings: SettingsState }) {
         const activeWs = workspaces.find(w => w.id === currentId);
         if (activeSession && !activeSession.workspaceId) {
           // Standalone session - split it
-          splitSession(activeSession.id, 'vertical');
+          handleSplitSession(activeSession.id, 'vertical');
         } else if (activeWs) {
           // In a workspace - need to determine focused session
           if (IS_DEV) console.log('[Hotkey] Split vertical in workspace - use context menu on specific terminal');
@@ -604,7 +643,7 @@ function App({ settings }: { settings: SettingsState }) {
         break;
       }
     }
-  }, [orderedTabs, sessions, workspaces, setActiveTabId, closeSession, closeWorkspace, createLocalTerminal, splitSession, moveFocusInWorkspace, toggleBroadcast]);
+  }, [orderedTabs, sessions, workspaces, setActiveTabId, closeSession, closeWorkspace, createLocalTerminal, handleSplitSession, moveFocusInWorkspace, toggleBroadcast]);
 
   // Callback for terminal to invoke app-level hotkey actions
   const handleHotkeyAction = useCallback((action: string, e: KeyboardEvent) => {
@@ -1038,9 +1077,12 @@ function App({ settings }: { settings: SettingsState }) {
           onSetDraggingSessionId={setDraggingSessionId}
           onToggleWorkspaceViewMode={toggleWorkspaceViewMode}
           onSetWorkspaceFocusedSession={setWorkspaceFocusedSession}
-          onSplitSession={splitSession}
+          onSplitSession={handleSplitSession}
+          onAttachTmux={handleAttachTmux}
           isBroadcastEnabled={isBroadcastEnabled}
           onToggleBroadcast={toggleBroadcast}
+          onActivateRestoredSession={activateRestoredSession}
+          restoreInBackground={sessionRestoreInBackground}
         />
 
         {/* Log Views - readonly terminal replays */}
@@ -1182,6 +1224,19 @@ function App({ settings }: { settings: SettingsState }) {
   );
 }
 
+const ProfiledApp = withRenderProfiler('App', App);
+
+// Only subscribes to the on/off flag, so profiler updates never re-render App
+const RenderProfilerOverlayMount: React.FC = () => {
+  const enabled = React.useSyncExternalStore(renderProfilerStore.subscribe, isRenderProfilerEnabled);
+  if (!enabled) return null;
+  return (
+    <Suspense fallback={null}>
+      <LazyRenderProfilerOverlay />
+    </Suspense>
+  );
+};
+
 function AppWithProviders() {
   const settings = useSettingsState();
 
@@ -1196,6 +1251,8 @@ function AppWithProviders() {
       }
       // Notify main process that renderer is ready
       netcattyBridge.get()?.rendererReady?.();
+      // Load the text editor runtime in idle time so the first open is instant
+      prewarmMonaco();
     } catch {
       // ignore
     }
@@ -1204,7 +1261,8 @@ function AppWithProviders() {
   return (
     <I18nProvider locale={settings.uiLanguage}>
       <ToastProvider>
-        <App settings={settings} />
+        <ProfiledApp settings={settings} />
+        <RenderProfilerOverlayMount />
       </ToastProvider>
     </I18nProvider>
   );
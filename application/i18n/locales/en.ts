@@ -63,8 +63,58 @@ const en: Messages = {
   'settings.tab.shortcuts': 'Shortcuts',
   'settings.tab.syncCloud': 'Sync & Cloud',
   'settings.tab.system': 'System',
+  'settings.tab.diagnostics': 'Diagnostics',
 
   // Settings > System
+  'settings.diagnostics.title': 'Diagnostics',
+  'settings.diagnostics.description': 'Performance data recorded by the app, for tracking down slow operations.',
+  'settings.diagnostics.ipc.title': 'IPC calls',
+  'settings.diagnostics.ipc.since': 'since {time}',
+  'settings.diagnostics.ipc.filter': 'Filter channels',
+  'settings.diagnostics.ipc.sort.total': 'Sort by total time',
+  'settings.diagnostics.ipc.sort.calls': 'Sort by calls',
+  'settings.diagnostics.ipc.sort.p99': 'Sort by p99 latency',
+  'settings.diagnostics.ipc.sort.max': 'Sort by max latency',
+  'settings.diagnostics.ipc.sort.response': 'Sort by largest response',
+  'settings.diagnostics.ipc.reset': 'Reset',
+  'settings.diagnostics.ipc.export': 'Export JSON',
+  'settings.diagnostics.ipc.channel': 'Channel',
+  'settings.diagnostics.ipc.calls': 'Calls',
+  'settings.diagnostics.ipc.errors': 'Errors',
+  'settings.diagnostics.ipc.inFlight': 'In flight / max',
+  'settings.diagnostics.ipc.max': 'Max',
+  'settings.diagnostics.ipc.request': 'Avg request',
+  'settings.diagnostics.ipc.response': 'Avg response',
+  'settings.diagnostics.ipc.empty': 'No IPC calls recorded yet.',
+  'settings.diagnostics.ipc.hint': 'Latency is measured in the main process from request to reply. Payload sizes are estimates; hover a size to see the largest one. Click a row to show its latency histogram.',
+  'settings.diagnostics.logs.title': 'Logs',
+  'settings.diagnostics.logs.level': 'Log level',
+  'settings.diagnostics.logs.levelDesc': 'Messages below this level are skipped without being formatted.',
+  'settings.diagnostics.logs.level.debug': 'Debug',
+  'settings.diagnostics.logs.level.info': 'Info',
+  'settings.diagnostics.logs.level.warn': 'Warning',
+  'settings.diagnostics.logs.level.error': 'Error',
+  'settings.diagnostics.logs.envOverride': 'NETCATTY_LOG is set, so some levels are controlled by the environment.',
+  'settings.diagnostics.logs.recent': 'Recent entries',
+  'settings.diagnostics.logs.empty': 'No log entries yet.',
+  'settings.diagnostics.logs.exportBundle': 'Export diagnostics bundle',
+  'settings.diagnostics.logs.exportBundleDesc': 'Saves recent logs from all processes together with IPC stats and memory counters to one JSON file.',
+  'settings.diagnostics.logs.exportFailed': 'Failed to export diagnostics bundle',
+  'settings.diagnostics.render.title': 'Render profiler',
+  'settings.diagnostics.render.overlay': 'Show render profiler overlay',
+  'settings.diagnostics.render.overlayDesc': 'Shows the components in the main window that render most often or take longest to commit, and which props triggered them.',
+  'renderProfiler.title': 'Render profiler',
+  'renderProfiler.reset': 'Reset',
+  'renderProfiler.close': 'Turn off',
+  'renderProfiler.sort.time': 'Commit time',
+  'renderProfiler.sort.renders': 'Renders',
+  'renderProfiler.sort.max': 'Slowest commit',
+  'renderProfiler.recent': 'Recent commits',
+  'renderProfiler.renders': '{count} renders',
+  'renderProfiler.maxLast': 'max {max} · last {last}',
+  'renderProfiler.syncOutput': 'Terminal sync: {frames} frames · {skipped} partial writes skipped · {timeouts} timeouts · held max {max}',
+  'renderProfiler.empty': 'Interact with the app to collect renders.',
+  'renderProfiler.noTimings': 'Commit times are only reported by development and profiling builds of React.',
   'settings.system.title': 'System',
   'settings.system.description': 'System information and temporary file management.',
   'settings.system.tempDirectory': 'Temporary Files',
@@ -96,6 +146,15 @@ const en: Messages = {
   'settings.sessionLogs.formatHtml': 'HTML (.html)',
   'settings.sessionLogs.hint': 'Session logs capture all terminal output for troubleshooting and auditing purposes.',
 
+  // Settings > Session Restore
+  'settings.sessionRestore.title': 'Session Restore',
+  'settings.sessionRestore.enable': 'Restore tabs on launch',
+  'settings.sessionRestore.enableDesc': 'Reopen the previous tabs and split layouts. Each tab connects when you switch to it.',
+  'settings.sessionRestore.background': 'Connect restored tabs in the background',
+  'settings.sessionRestore.backgroundDesc': 'Also connect the other restored tabs, two at a time, instead of waiting until they are opened.',
+  'settings.sessionRestore.screens': 'Restore screen contents',
+  'settings.sessionRestore.screensDesc': 'Keep the last screen and recent scrollback of each tab. This is stored unencrypted on this device and may contain sensitive output.',
+
   // Settings > Application
   'settings.application.checkUpdates': 'Check for updates',
   'settings.application.reportProblem': 'Report a problem',
@@ -197,6 +256,9 @@ const en: Messages = {
   'settings.terminal.behavior.scrollOnPaste': 'Scroll on paste',
   'settings.terminal.behavior.scrollOnPaste.desc':
     'Scroll terminal to bottom when pasting text',
+  'settings.terminal.behavior.pasteLineDelay': 'Paste line delay (ms)',
+  'settings.terminal.behavior.pasteLineDelay.desc':
+    'Pause after each pasted line, for serial consoles and devices that drop input. 0 sends as fast as the connection allows',
   'settings.terminal.behavior.linkModifier': 'Link modifier key',
   'settings.terminal.behavior.linkModifier.desc': 'Hold this key to click on links in terminal',
   'settings.terminal.behavior.linkModifier.none': 'None (click directly)',
@@ -329,6 +391,13 @@ const en: Messages = {
   'vault.managedSource.unmanage': 'Unmanage',
   'vault.managedSource.unmanageSuccess': 'Successfully unmanaged group',
 
+  'vault.reachability.scan': 'Check host reachability',
+  'vault.reachability.scanWithKeys': 'Check reachability and host keys',
+  'vault.reachability.cancelScan': 'Stop reachability check',
+  'vault.reachability.up': 'Reachable · {rtt} ms',
+  'vault.reachability.down': 'Unreachable: {error}',
+  'vault.reachability.lastSeen': 'Last seen {time}',
+  'vault.reachability.keyMismatch': 'Host key does not match the known host entry',
   'vault.hosts.header.entries': '{count} entries',
   'vault.hosts.header.live': '{count} live',
 
@@ -465,6 +534,8 @@ const en: Messages = {
   'pf.deleteActive.confirm': 'Stop and Delete',
   'pf.form.autoStart': 'Auto Start',
   'pf.form.autoStartDesc': 'Automatically start this rule when the app launches',
+  'pf.form.onDemand': 'Connect On Demand',
+  'pf.form.onDemandDesc': 'Listen right away, but only keep the SSH connection open while clients use the tunnel',
 
   // SFTP
   'sftp.newFolder': 'New Folder',
@@ -698,6 +769,18 @@ const en: Messages = {
 
   // Terminal
   'terminal.connectionErrorTitle': 'Connection Error',
+  'terminal.restoredScreenMarker': '── restored from previous session ──',
+  'terminal.restore.pending': 'Restored from last session. Connects when opened.',
+  'terminal.restore.hostUnavailable': 'This host is no longer in the vault.',
+  'terminal.restore.connect': 'Connect',
+  'terminal.paste.progress': 'Pasting {sent} of {total}',
+  'terminal.paste.cancel': 'Cancel paste',
+  'terminal.traffic.statusTitle': 'Received {received} · Sent {sent} this session',
+  'terminal.traffic.badgeTitle': 'In {in} · Out {out} · Echo RTT {rtt}',
+  'terminal.traffic.rttUnknown': 'n/a',
+  'terminal.traffic.rttHint': 'Keystroke echo round trip',
+  'terminal.inband.title': 'File transfer ({protocol})',
+  'terminal.inband.clear': 'Clear finished',
 
   // Protocol select dialog
   'protocolSelect.chooseProtocol': 'Choose protocol',
@@ -714,6 +797,8 @@ const en: Messages = {
   'hostDetails.sftp.sudo': 'Sudo Mode',
   'hostDetails.sftp.sudo.desc': 'Automatically acquire Root privileges using stored password',
   'hostDetails.sftp.sudo.passwordWarning': 'Sudo mode requires a password. Configure one above, or ensure the server allows passwordless sudo.',
+  'hostDetails.sftp.atomicUpload': 'Atomic Uploads',
+  'hostDetails.sftp.atomicUpload.desc': 'Upload to a temporary file, then rename it over the target. Replaces the file, so owner, hard links and ACLs are not kept.',
   'hostDetails.sftp.encoding': 'Filename Encoding',
   'hostDetails.sftp.encoding.desc': 'Select the encoding used to decode and send SFTP filenames.',
   'hostDetails.label.placeholder': 'Label (e.g., Production Server)',
@@ -742,6 +827,13 @@ const en: Messages = {
   'hostDetails.agentForwarding.agentNotRunning': 'SSH Agent is not running',
   'hostDetails.agentForwarding.agentNotRunningHint': 'Enable OpenSSH Authentication Agent service in Windows Services (services.msc) for agent forwarding to work.',
   'hostDetails.section.agentForwarding': 'SSH Agent',
+  'hostDetails.section.transport': 'Transport Tuning',
+  'hostDetails.transport.desc': 'Measure throughput with different ciphers, compression and window sizes, and use the fastest for SSH, SFTP and port forwards to this host.',
+  'hostDetails.transport.tune': 'Tune',
+  'hostDetails.transport.tuning': 'Testing...',
+  'hostDetails.transport.reset': 'Reset',
+  'hostDetails.transport.summary': '{cipher}, compression {compression}, {window} window ({speed}/s measured)',
+  'hostDetails.transport.failed': 'Tuning failed: {error}',
   'hostDetails.jumpHosts': 'Proxy via Hosts',
   'hostDetails.jumpHosts.hops': '{count} hop(s)',
   'hostDetails.jumpHosts.direct': 'Direct',
@@ -756,6 +848,13 @@ const en: Messages = {
   'hostDetails.proxyPanel.usernamePlaceholder': 'Username',
   'hostDetails.proxyPanel.passwordPlaceholder': 'Password',
   'hostDetails.proxyPanel.identities': 'Identities',
+  'hostDetails.proxy.wanBadge': '{latency} ms RTT',
+  'hostDetails.proxyPanel.wan.title': 'WAN emulation',
+  'hostDetails.proxyPanel.wan.desc': 'Test proxy: connects directly and adds latency, jitter, a bandwidth cap and packet loss, to reproduce slow links locally.',
+  'hostDetails.proxyPanel.wan.latency': 'Round-trip latency (ms)',
+  'hostDetails.proxyPanel.wan.jitter': 'Jitter (ms)',
+  'hostDetails.proxyPanel.wan.bandwidth': 'Bandwidth (kbit/s, 0 = unlimited)',
+  'hostDetails.proxyPanel.wan.loss': 'Packet loss (%)',
   'hostDetails.proxyPanel.remove': 'Remove Proxy',
   'hostDetails.envVars': 'Environment Variables',
   'hostDetails.envVars.add': 'Add Environment Variable',
@@ -833,6 +932,8 @@ const en: Messages = {
     'Your connection history will appear here when you connect to hosts or open local terminals.',
   'logs.loadMore': 'Load {count} more logs',
   'logs.ongoing': 'ongoing',
+  'logs.connectTime': 'connected in {total} ms',
+  'logs.connectTiming': 'DNS {dns} ms, TCP {tcp} ms, key exchange {kex} ms, auth {auth} ms',
   'logs.localTerminal': 'Local Terminal',
   'logs.action.save': 'Save',
   'logs.action.unsave': 'Unsave',
@@ -890,6 +991,8 @@ const en: Messages = {
   'terminal.menu.selectAll': 'Select All',
   'terminal.menu.splitHorizontal': 'Split Horizontal',
   'terminal.menu.splitVertical': 'Split Vertical',
+  'terminal.menu.attachTmux': 'Open tmux Session as Tabs',
+  'terminal.tmux.attachFailed': 'Could not attach to tmux',
   'terminal.menu.clearBuffer': 'Clear Buffer',
   'terminal.menu.closeTerminal': 'Close terminal',
   'terminal.auth.password': 'Password',
@@ -1025,6 +1128,8 @@ const en: Messages = {
   'cloudSync.changeKey.failed': 'Failed to change master key',
   'cloudSync.changeKey.desc': 'This will re-encrypt your vault. Make sure you remember the new key.',
   'cloudSync.changeKey.showKeys': 'Show keys',
+  'cloudSync.changeKey.useArgon2': 'Use Argon2id key derivation',
+  'cloudSync.changeKey.useArgon2Desc': 'Memory-hard and harder to brute-force than PBKDF2. Tuned to about one second on this device.',
   'cloudSync.changeKey.updatedToast': 'Master key updated',
   'cloudSync.changeKey.updateButton': 'Update Key',
   'cloudSync.unlock.title': 'Enter Master Key',
@@ -51,8 +51,58 @@ const zhCN: Messages = {
   'settings.tab.shortcuts': '快捷键',
   'settings.tab.syncCloud': '同步与云',
   'settings.tab.system': '系统',
+  'settings.tab.diagnostics': '诊断',
 
   // Settings > System
+  'settings.diagnostics.title': '诊断',
+  'settings.diagnostics.description': '应用记录的性能数据，用于排查缓慢的操作。',
+  'settings.diagnostics.ipc.title': 'IPC 调用',
+  'settings.diagnostics.ipc.since': '自 {time} 起',
+  'settings.diagnostics.ipc.filter': '筛选通道',
+  'settings.diagnostics.ipc.sort.total': '按总耗时排序',
+  'settings.diagnostics.ipc.sort.calls': '按调用次数排序',
+  'settings.diagnostics.ipc.sort.p99': '按 p99 延迟排序',
+  'settings.diagnostics.ipc.sort.max': '按最大延迟排序',
+  'settings.diagnostics.ipc.sort.response': '按最大响应排序',
+  'settings.diagnostics.ipc.reset': '重置',
+  'settings.diagnostics.ipc.export': '导出 JSON',
+  'settings.diagnostics.ipc.channel': '通道',
+  'settings.diagnostics.ipc.calls': '调用',
+  'settings.diagnostics.ipc.errors': '错误',
+  'settings.diagnostics.ipc.inFlight': '进行中 / 峰值',
+  'settings.diagnostics.ipc.max': '最大',
+  'settings.diagnostics.ipc.request': '平均请求',
+  'settings.diagnostics.ipc.response': '平均响应',
+  'settings.diagnostics.ipc.empty': '尚未记录任何 IPC 调用。',
+  'settings.diagnostics.ipc.hint': '延迟在主进程中从请求到回复进行测量。负载大小为估算值；将鼠标悬停在大小上可查看最大值。点击某行可查看其延迟分布。',
+  'settings.diagnostics.logs.title': '日志',
+  'settings.diagnostics.logs.level': '日志级别',
+  'settings.diagnostics.logs.levelDesc': '低于此级别的消息会被直接跳过，不会进行格式化。',
+  'settings.diagnostics.logs.level.debug': '调试',
+  'settings.diagnostics.logs.level.info': '信息',
+  'settings.diagnostics.logs.level.warn': '警告',
+  'settings.diagnostics.logs.level.error': '错误',
+  'settings.diagnostics.logs.envOverride': '已设置 NETCATTY_LOG，部分级别由环境变量控制。',
+  'settings.diagnostics.logs.recent': '最近条目',
+  'settings.diagnostics.logs.empty': '暂无日志条目。',
+  'settings.diagnostics.logs.exportBundle': '导出诊断包',
+  'settings.diagnostics.logs.exportBundleDesc': '将所有进程的最近日志连同 IPC 统计和内存计数器保存到一个 JSON 文件中。',
+  'settings.diagnostics.logs.exportFailed': '导出诊断包失败',
+  'settings.diagnostics.render.title': '渲染分析器',
+  'settings.diagnostics.render.overlay': '显示渲染分析浮层',
+  'settings.diagnostics.render.overlayDesc': '显示主窗口中渲染最频繁或提交耗时最长的组件，以及触发渲染的 props。',
+  'renderProfiler.title': '渲染分析器',
+  'renderProfiler.reset': '重置',
+  'renderProfiler.close': '关闭',
+  'renderProfiler.sort.time': '提交耗时',
+  'renderProfiler.sort.renders': '渲染次数',
+  'renderProfiler.sort.max': '最慢提交',
+  'renderProfiler.recent': '最近提交',
+  'renderProfiler.renders': '{count} 次渲染',
+  'renderProfiler.maxLast': '最大 {max} · 最近 {last}',
+  'renderProfiler.syncOutput': '终端同步输出：{frames} 帧 · 跳过 {skipped} 次中间写入 · {timeouts} 次超时 · 最长等待 {max}',
+  'renderProfiler.empty': '与应用交互以收集渲染数据。',
+  'renderProfiler.noTimings': '只有 React 的开发版或 profiling 版会报告提交耗时。',
   'settings.system.title': '系统',
   'settings.system.description': '系统信息与临时文件管理。',
   'settings.system.tempDirectory': '临时文件',
@@ -84,6 +134,15 @@ const zhCN: Messages = {
   'settings.sessionLogs.formatHtml': 'HTML (.html)',
   'settings.sessionLogs.hint': '会话日志用于记录终端输出，便于故障排查和审计。',
 
+  // Settings > Session Restore
+  'settings.sessionRestore.title': '会话恢复',
+  'settings.sessionRestore.enable': '启动时恢复标签页',
+  'settings.sessionRestore.enableDesc': '重新打开上次的标签页和分屏布局，切换到标签页时才会连接。',
+  'settings.sessionRestore.background': '在后台连接恢复的标签页',
+  'settings.sessionRestore.backgroundDesc': '同时在后台每次连接两个其余的恢复标签页，而不是等到打开时再连接。',
+  'settings.sessionRestore.screens': '恢复屏幕内容',
+  'settings.sessionRestore.screensDesc': '保留每个标签页的最后屏幕和近期回滚内容。这些内容以未加密形式保存在本设备上，可能包含敏感输出。',
+
   // Settings > Application
   'settings.application.checkUpdates': '检查更新',
   'settings.application.reportProblem': '反馈问题',
@@ -200,6 +259,13 @@ const zhCN: Messages = {
   'vault.managedSource.unmanage': '取消托管',
   'vault.managedSource.unmanageSuccess': '已取消托管分组',
 
+  'vault.reachability.scan': '检查主机可达性',
+  'vault.reachability.scanWithKeys': '检查可达性和主机密钥',
+  'vault.reachability.cancelScan': '停止可达性检查',
+  'vault.reachability.up': '可达 · {rtt} ms',
+  'vault.reachability.down': '不可达：{error}',
+  'vault.reachability.lastSeen': '上次在线 {time}',
+  'vault.reachability.keyMismatch': '主机密钥与已知主机记录不匹配',
   'vault.hosts.header.entries': '{count} 条',
   'vault.hosts.header.live': '{count} 个在线',
 
@@ -440,6 +506,8 @@ const zhCN: Messages = {
   'hostDetails.sftp.sudo': 'Sudo 提权模式',
   'hostDetails.sftp.sudo.desc': '使用保存的密码自动获取 Root 权限',
   'hostDetails.sftp.sudo.passwordWarning': 'Sudo 模式需要密码。请在上方配置密码，或确保服务器允许免密 sudo。',
+  'hostDetails.sftp.atomicUpload': '原子上传',
+  'hostDetails.sftp.atomicUpload.desc': '先上传到临时文件，再重命名覆盖目标。会替换原文件，属主、硬链接和 ACL 不会保留。',
   'hostDetails.sftp.encoding': '文件名编码',
   'hostDetails.sftp.encoding.desc': '选择用于解码和发送 SFTP 文件名的编码。',
   'hostDetails.label.placeholder': '名称（例如：Production Server）',
@@ -468,6 +536,13 @@ const zhCN: Messages = {
   'hostDetails.agentForwarding.agentNotRunning': 'SSH Agent 未运行',
   'hostDetails.agentForwarding.agentNotRunningHint': '请在 Windows 服务管理器 (services.msc) 中启用 OpenSSH Authentication Agent 服务。',
   'hostDetails.section.agentForwarding': 'SSH 代理',
+  'hostDetails.section.transport': '传输调优',
+  'hostDetails.transport.desc': '使用不同的加密算法、压缩和窗口大小测量吞吐量，并对此主机的 SSH、SFTP 和端口转发使用最快的配置。',
+  'hostDetails.transport.tune': '调优',
+  'hostDetails.transport.tuning': '测试中...',
+  'hostDetails.transport.reset': '重置',
+  'hostDetails.transport.summary': '{cipher}，压缩{compression}，窗口 {window}（实测 {speed}/s）',
+  'hostDetails.transport.failed': '调优失败：{error}',
   'hostDetails.jumpHosts': '通过主机代理',
   'hostDetails.jumpHosts.hops': '{count} 跳',
   'hostDetails.jumpHosts.direct': '直连',
@@ -530,6 +605,8 @@ const zhCN: Messages = {
   'logs.empty.desc': '当你连接主机或打开本地终端后，这里会显示连接历史。',
   'logs.loadMore': '加载更多 ({count} 条)',
   'logs.ongoing': '进行中',
+  'logs.connectTime': '连接耗时 {total} ms',
+  'logs.connectTiming': 'DNS {dns} ms，TCP {tcp} ms，密钥交换 {kex} ms，认证 {auth} ms',
   'logs.localTerminal': '本地终端',
   'logs.action.save': '收藏',
   'logs.action.unsave': '取消收藏',
@@ -587,6 +664,8 @@ const zhCN: Messages = {
   'terminal.menu.selectAll': '全选',
   'terminal.menu.splitHorizontal': '水平分屏',
   'terminal.menu.splitVertical': '垂直分屏',
+  'terminal.menu.attachTmux': '以标签页打开 tmux 会话',
+  'terminal.tmux.attachFailed': '无法连接 tmux',
   'terminal.menu.clearBuffer': '清空缓冲区',
   'terminal.menu.closeTerminal': '关闭终端',
   'terminal.auth.password': '密码',
@@ -602,6 +681,18 @@ const zhCN: Messages = {
   'terminal.auth.noKeysHint': '暂无密钥，请先在钥匙串中添加。',
   'terminal.auth.continueSave': '继续并保存',
   'terminal.connectionErrorTitle': '连接错误',
+  'terminal.restoredScreenMarker': '── 以上内容恢复自上次会话 ──',
+  'terminal.restore.pending': '已从上次会话恢复，打开时自动连接。',
+  'terminal.restore.hostUnavailable': '该主机已不在密钥库中。',
+  'terminal.restore.connect': '连接',
+  'terminal.paste.progress': '正在粘贴 {sent} / {total}',
+  'terminal.paste.cancel': '取消粘贴',
+  'terminal.traffic.statusTitle': '本次会话已接收 {received} · 已发送 {sent}',
+  'terminal.traffic.badgeTitle': '下行 {in} · 上行 {out} · 回显延迟 {rtt}',
+  'terminal.traffic.rttUnknown': '暂无',
+  'terminal.traffic.rttHint': '按键回显往返时间',
+  'terminal.inband.title': '文件传输（{protocol}）',
+  'terminal.inband.clear': '清除已完成',
   'terminal.progress.timeoutIn': '将在 {seconds}s 后超时',
   'terminal.progress.disconnected': '已断开',
   'terminal.progress.cancelling': '正在取消...',
@@ -722,6 +813,8 @@ const zhCN: Messages = {
   'cloudSync.changeKey.failed': '更改主密钥失败',
   'cloudSync.changeKey.desc': '这将重新加密 Vault，请务必记住新的主密钥。',
   'cloudSync.changeKey.showKeys': '显示主密钥',
+  'cloudSync.changeKey.useArgon2': '使用 Argon2id 密钥派生',
+  'cloudSync.changeKey.useArgon2Desc': '内存密集型算法，比 PBKDF2 更难暴力破解。会按本机性能调整到约一秒。',
   'cloudSync.changeKey.updatedToast': '主密钥已更新',
   'cloudSync.changeKey.updateButton': '更新主密钥',
   'cloudSync.unlock.title': '输入主密钥',
@@ -812,6 +905,8 @@ const zhCN: Messages = {
   'pf.deleteActive.confirm': '关闭并删除',
   'pf.form.autoStart': '自动启动',
   'pf.form.autoStartDesc': '应用启动时自动开启此规则',
+  'pf.form.onDemand': '按需连接',
+  'pf.form.onDemandDesc': '立即开始监听，但仅在有客户端使用隧道时保持 SSH 连接',
 
   // SFTP (pane + conflict)
   'sftp.pane.local': '本地',
@@ -988,6 +1083,8 @@ const zhCN: Messages = {
   'settings.terminal.behavior.scrollOnKeyPress.desc': '按键（例如 Enter）时将终端滚动到底部',
   'settings.terminal.behavior.scrollOnPaste': '粘贴时自动滚动',
   'settings.terminal.behavior.scrollOnPaste.desc': '粘贴文本时将终端滚动到底部',
+  'settings.terminal.behavior.pasteLineDelay': '粘贴行间延迟（毫秒）',
+  'settings.terminal.behavior.pasteLineDelay.desc': '每粘贴一行后暂停，适用于串口控制台和容易丢失输入的设备。0 表示按连接允许的最快速度发送',
   'settings.terminal.behavior.linkModifier': '链接修饰键',
   'settings.terminal.behavior.linkModifier.desc': '按住此键再点击终端中的链接',
   'settings.terminal.behavior.linkModifier.none': '无（直接点击）',
@@ -1049,6 +1146,13 @@ const zhCN: Messages = {
   'hostDetails.proxyPanel.usernamePlaceholder': 'Username',
   'hostDetails.proxyPanel.passwordPlaceholder': 'Password',
   'hostDetails.proxyPanel.identities': 'Identities',
+  'hostDetails.proxy.wanBadge': '{latency} ms 往返',
+  'hostDetails.proxyPanel.wan.title': 'WAN 模拟',
+  'hostDetails.proxyPanel.wan.desc': '测试代理：直接连接并添加延迟、抖动、带宽限制和丢包，用于在本地重现慢速链路。',
+  'hostDetails.proxyPanel.wan.latency': '往返延迟 (ms)',
+  'hostDetails.proxyPanel.wan.jitter': '抖动 (ms)',
+  'hostDetails.proxyPanel.wan.bandwidth': '带宽 (kbit/s，0 = 不限)',
+  'hostDetails.proxyPanel.wan.loss': '丢包率 (%)',
   'hostDetails.proxyPanel.remove': '移除 Proxy',
   'hostDetails.envVars.title': '环境变量',
   'hostDetails.envVars.desc': '为 {host} 设置环境变量。',
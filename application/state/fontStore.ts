@@ -1,6 +1,14 @@
 import { useSyncExternalStore } from 'react';
-import { TERMINAL_FONTS, type TerminalFont } from '../../infrastructure/config/fonts';
-import { getMonospaceFonts } from '../../lib/localFonts';
+import {
+  getPrimaryFontFamily,
+  TERMINAL_FONTS,
+  withMinimalFallback,
+  type FontMetrics,
+  type TerminalFont,
+} from '../../infrastructure/config/fonts';
+import { STORAGE_KEY_TERM_FONT_CATALOG } from '../../infrastructure/config/storageKeys';
+import { localStorageAdapter } from '../../infrastructure/persistence/localStorageAdapter';
+import { measureLocalFonts, queryLocalFontFamilies, toMonospaceTerminalFonts } from '../../lib/localFonts';
 
 /**
  * Global font store - singleton pattern using useSyncExternalStore
@@ -8,6 +16,15 @@ import { getMonospaceFonts } from '../../lib/localFonts';
  */
 type Listener = () => void;
 
+// Bump when measurement logic changes so stale metrics are re-measured
+const FONT_CATALOG_VERSION = 1;
+
+interface FontCatalog {
+  version: number;
+  families: string[];
+  metrics: Record<string, FontMetrics>;
+}
+
 interface FontStoreState {
   availableFonts: TerminalFont[];
   isLoading: boolean;
@@ -23,6 +40,7 @@ class FontStore {
     error: null,
   };
   private listeners = new Set<Listener>();
+  private warmedFonts = new Map<string, Promise<void>>();
 
   // Getters for individual state slices
   getAvailableFonts = (): TerminalFont[] => this.state.availableFonts;
@@ -49,7 +67,12 @@ class FontStore {
 
   /**
    * Initialize font loading - safe to call multiple times,
-   * will only load once
+   * will only load once.
+   *
+   * A persisted catalog (families + measured metrics) is applied immediately
+   * so the picker opens without waiting for enumeration. Enumeration then
+   * runs in the background and only families not measured before are sent
+   * to the metrics worker.
    */
   initialize = async (): Promise<void> => {
     // Already loaded or currently loading
@@ -57,33 +80,46 @@ class FontStore {
       return;
     }
 
-    this.setState({ isLoading: true, error: null });
+    const cached = localStorageAdapter.read<FontCatalog>(STORAGE_KEY_TERM_FONT_CATALOG);
+    const catalog = cached?.version === FONT_CATALOG_VERSION ? cached : null;
+    if (catalog) {
+      this.applyCatalog(catalog, { isLoading: true });
+    } else {
+      this.setState({ isLoading: true, error: null });
+    }
 
     try {
-      const localFonts = await getMonospaceFonts();
-      
-      // Combine default fonts with local fonts, deduplicate by id
-      const fontMap = new Map<string, TerminalFont>();
-
-      // Add default fonts first
-      TERMINAL_FONTS.forEach(font => fontMap.set(font.id, font));
-
-      // Add local fonts with a distinct ID namespace to avoid collisions
-      localFonts.forEach(font => {
-        const localId = font.id.startsWith('local-') ? font.id : `local-${font.id}`;
-        fontMap.set(localId, { ...font, id: localId });
+      const families = await queryLocalFontFamilies();
+      if (families.length === 0 && catalog) {
+        // Permission denied or API unavailable this time - keep the catalog
+        this.setState({ isLoading: false, isLoaded: true });
+        return;
+      }
+
+      const builtinFamilies = TERMINAL_FONTS.map(font => getPrimaryFontFamily(font.family));
+      const known = catalog?.metrics ?? {};
+      const toMeasure = Array.from(new Set([...builtinFamilies, ...families])).filter(f => !known[f]);
+      if (catalog && toMeasure.length === 0 && catalog.families.join('\n') === families.join('\n')) {
+        // Nothing installed or removed since the catalog was written
+        this.setState({ isLoading: false, isLoaded: true });
+        return;
+      }
+      const measured = await measureLocalFonts(toMeasure);
+
+      const metrics: Record<string, FontMetrics> = {};
+      [...builtinFamilies, ...families].forEach(family => {
+        const m = measured[family] ?? known[family];
+        if (m) metrics[family] = m;
       });
 
-      this.setState({
-        availableFonts: Array.from(fontMap.values()),
-        isLoading: false,
-        isLoaded: true,
-      });
+      const next: FontCatalog = { version: FONT_CATALOG_VERSION, families, metrics };
+      localStorageAdapter.write(STORAGE_KEY_TERM_FONT_CATALOG, next);
+      this.applyCatalog(next, { isLoading: false });
     } catch (error) {
       const errorMessage = error instanceof Error ? error.message : 'Failed to load local fonts';
       console.warn('Failed to fetch local fonts, using defaults:', error);
       this.setState({
-        availableFonts: TERMINAL_FONTS,
+        availableFonts: catalog ? this.state.availableFonts : TERMINAL_FONTS,
         isLoading: false,
         isLoaded: true,
         error: errorMessage,
@@ -91,6 +127,30 @@ class FontStore {
     }
   };
 
+  private applyCatalog = (catalog: FontCatalog, partial: Partial<FontStoreState>) => {
+    // Combine default fonts with local fonts, deduplicate by id
+    const fontMap = new Map<string, TerminalFont>();
+
+    // Add default fonts first, trimming the CJK chain where the font covers CJK
+    TERMINAL_FONTS.forEach(font => {
+      const metrics = catalog.metrics[getPrimaryFontFamily(font.family)];
+      fontMap.set(font.id, { ...font, family: withMinimalFallback(font.family, metrics) });
+    });
+
+    // Add local fonts with a distinct ID namespace to avoid collisions
+    toMonospaceTerminalFonts(catalog.families, catalog.metrics).forEach(font => {
+      const localId = font.id.startsWith('local-') ? font.id : `local-${font.id}`;
+      fontMap.set(localId, { ...font, id: localId });
+    });
+
+    this.setState({
+      ...partial,
+      availableFonts: Array.from(fontMap.values()),
+      isLoaded: true,
+      error: null,
+    });
+  };
+
   /**
    * Find a font by ID with fallback
    */
@@ -98,6 +158,30 @@ class FontStore {
     const fonts = this.state.availableFonts;
     return fonts.find(f => f.id === fontId) || fonts[0] || TERMINAL_FONTS[0];
   };
+
+  /**
+   * Load the font faces a terminal is about to use so xterm measures the real
+   * font instead of a fallback (which would force a second atlas rebuild).
+   * Resolves once per family/size/weight combination; never rejects.
+   */
+  warmFont = (family: string, fontSize: number, weights: Array<number | string> = [400, 700]): Promise<void> => {
+    if (typeof document === 'undefined' || !document.fonts?.load) {
+      return Promise.resolve();
+    }
+    const key = `${family}|${fontSize}|${weights.join(',')}`;
+    const existing = this.warmedFonts.get(key);
+    if (existing) return existing;
+
+    const pending = Promise.all(
+      weights.map(weight => document.fonts.load(`${weight} ${fontSize}px ${family}`)),
+    )
+      .then(() => undefined)
+      .catch((error) => {
+        console.warn('Failed to warm font:', family, error);
+      });
+    this.warmedFonts.set(key, pending);
+    return pending;
+  };
 }
 
 // Singleton instance
@@ -0,0 +1,217 @@
+import { useCallback, useSyncExternalStore } from 'react';
+import type { Terminal as XTerm } from '@xterm/xterm';
+import type { TerminalSettings } from '../../domain/models';
+import { netcattyBridge } from '../../infrastructure/services/netcattyBridge';
+import { createLogger } from '../../lib/logger';
+
+/**
+ * Paste engine - chunked, backpressured writes for large pastes
+ *
+ * Small pastes go out as a single write like before. Anything larger is split
+ * into chunks that are only sent once the transport drained the previous one
+ * (see writeToSessionDrained in terminalBridge), optionally pacing line by
+ * line for slow serial consoles and network gear. Bracketed paste markers wrap
+ * the whole paste, not each chunk, and the closing marker is still sent when
+ * the paste is cancelled so the shell does not stay in paste mode.
+ */
+type Listener = () => void;
+
+export interface PasteProgress {
+  sessionId: string;
+  sentChars: number;
+  totalChars: number;
+  startedAt: number;
+}
+
+export interface PasteOptions {
+  bracketed?: boolean;
+  // Delay after each line; 0 sends chunks as fast as the transport drains
+  lineDelayMs?: number;
+}
+
+// Largest payload written in one go; also the cut-off for the fast path
+export const PASTE_CHUNK_CHARS = 8 * 1024;
+// Pastes below this size finish too quickly to be worth a progress bar
+const PROGRESS_MIN_CHARS = 64 * 1024;
+const PROGRESS_NOTIFY_MS = 100;
+
+const BRACKET_START = '\x1b[200~';
+const BRACKET_END = '\x1b[201~';
+// eslint-disable-next-line no-control-regex
+const BRACKET_MARKERS = /\x1b\[20[01]~/g;
+
+const log = createLogger('PasteEngine');
+
+interface ActivePaste {
+  progress: PasteProgress;
+  cancelled: boolean;
+  visible: boolean;
+}
+
+const active = new Map<string, ActivePaste>();
+// Pastes into the same session run one after another
+const queues = new Map<string, Promise<void>>();
+const listeners = new Set<Listener>();
+const snapshots = new Map<string, PasteProgress | null>();
+let notifyTimer: ReturnType<typeof setTimeout> | null = null;
+
+const emitNow = () => {
+  if (notifyTimer) {
+    clearTimeout(notifyTimer);
+    notifyTimer = null;
+  }
+  snapshots.clear();
+  listeners.forEach((listener) => listener());
+};
+
+const scheduleEmit = () => {
+  if (notifyTimer) return;
+  notifyTimer = setTimeout(emitNow, PROGRESS_NOTIFY_MS);
+};
+
+const sleep = (ms: number) => new Promise<void>((resolve) => setTimeout(resolve, ms));
+
+/**
+ * Cut text into pieces of at most `size` UTF-16 units without splitting a
+ * surrogate pair (each half would reach the remote as U+FFFD)
+ */
+export const splitIntoChunks = (text: string, size: number): string[] => {
+  const chunks: string[] = [];
+  let start = 0;
+  while (start < text.length) {
+    let end = Math.min(start + size, text.length);
+    if (end < text.length) {
+      const code = text.charCodeAt(end - 1);
+      if (code >= 0xd800 && code <= 0xdbff && end - 1 > start) end--;
+    }
+    chunks.push(text.slice(start, end));
+    start = end;
+  }
+  return chunks;
+};
+
+/**
+ * Split into lines that keep their terminator, so pacing happens after each
+ * newline the remote would act on
+ */
+export const splitIntoLines = (text: string): string[] => text.match(/[^\r\n]*(?:\r\n|\r|\n)|[^\r\n]+$/g) || [];
+
+const writeDirect = (sessionId: string, data: string) => {
+  netcattyBridge.get()?.writeToSession?.(sessionId, data);
+};
+
+const writeDrained = async (sessionId: string, data: string): Promise<boolean> => {
+  const bridge = netcattyBridge.get();
+  if (bridge?.writeToSessionDrained) {
+    return bridge.writeToSessionDrained(sessionId, data);
+  }
+  bridge?.writeToSession?.(sessionId, data);
+  // No backpressure signal: at least let the renderer breathe between chunks
+  await sleep(0);
+  return !!bridge;
+};
+
+const runPaste = async (sessionId: string, text: string, options: PasteOptions) => {
+  const { bracketed = false, lineDelayMs = 0 } = options;
+  const body = bracketed ? text.replace(BRACKET_MARKERS, '') : text;
+
+  if (body.length <= PASTE_CHUNK_CHARS && lineDelayMs <= 0) {
+    writeDirect(sessionId, bracketed ? `${BRACKET_START}${body}${BRACKET_END}` : body);
+    return;
+  }
+
+  const pieces = lineDelayMs > 0
+    ? splitIntoLines(body).flatMap((line) => splitIntoChunks(line, PASTE_CHUNK_CHARS))
+    : splitIntoChunks(body, PASTE_CHUNK_CHARS);
+
+  const paste: ActivePaste = {
+    progress: { sessionId, sentChars: 0, totalChars: body.length, startedAt: Date.now() },
+    cancelled: false,
+    visible: body.length >= PROGRESS_MIN_CHARS || lineDelayMs > 0,
+  };
+  active.set(sessionId, paste);
+  if (paste.visible) emitNow();
+
+  try {
+    if (bracketed && !(await writeDrained(sessionId, BRACKET_START))) return;
+    for (const piece of pieces) {
+      if (paste.cancelled) break;
+      if (!(await writeDrained(sessionId, piece))) {
+        log.debug('Session closed during paste', sessionId);
+        return;
+      }
+      paste.progress = { ...paste.progress, sentChars: paste.progress.sentChars + piece.length };
+      if (paste.visible) scheduleEmit();
+      const endsLine = piece.endsWith('\n') || piece.endsWith('\r');
+      if (lineDelayMs > 0 && endsLine && !paste.cancelled) await sleep(lineDelayMs);
+    }
+    if (bracketed) await writeDrained(sessionId, BRACKET_END);
+  } finally {
+    if (active.get(sessionId) === paste) active.delete(sessionId);
+    if (paste.visible) emitNow();
+  }
+};
+
+/**
+ * Send pasted text to a session. Resolves when the last chunk was accepted,
+ * the paste was cancelled or the session went away.
+ */
+export function pasteToSession(sessionId: string, text: string, options: PasteOptions = {}): Promise<void> {
+  if (!text) return Promise.resolve();
+  const previous = queues.get(sessionId) ?? Promise.resolve();
+  const next = previous
+    .then(() => runPaste(sessionId, text, options))
+    .catch((err) => log.warn('Paste failed', sessionId, err));
+  queues.set(sessionId, next);
+  void next.finally(() => {
+    if (queues.get(sessionId) === next) queues.delete(sessionId);
+  });
+  return next;
+}
+
+/**
+ * Paste into the session behind an xterm instance, honouring the terminal's
+ * bracketed paste mode and the paste-related terminal settings
+ */
+export function pasteToTerminal(
+  term: XTerm,
+  sessionId: string,
+  text: string,
+  settings?: Pick<TerminalSettings, 'scrollOnPaste' | 'pasteLineDelay'>,
+): Promise<void> {
+  if (settings?.scrollOnPaste ?? true) term.scrollToBottom();
+  return pasteToSession(sessionId, text, {
+    bracketed: term.modes.bracketedPasteMode,
+    lineDelayMs: settings?.pasteLineDelay ?? 0,
+  });
+}
+
+/**
+ * Wrap text the way the terminal would for a single, unchunked write
+ * (used to mirror a paste to broadcast targets)
+ */
+export const wrapBracketedPaste = (text: string, bracketed: boolean) =>
+  bracketed ? `${BRACKET_START}${text.replace(BRACKET_MARKERS, '')}${BRACKET_END}` : text;
+
+export function cancelPaste(sessionId: string) {
+  const paste = active.get(sessionId);
+  if (!paste || paste.cancelled) return;
+  paste.cancelled = true;
+  emitNow();
+}
+
+const subscribe = (listener: Listener) => {
+  listeners.add(listener);
+  return () => listeners.delete(listener);
+};
+
+export const usePasteProgress = (sessionId: string) => {
+  const getSnapshot = useCallback(() => {
+    if (!snapshots.has(sessionId)) {
+      const paste = active.get(sessionId);
+      snapshots.set(sessionId, paste?.visible && !paste.cancelled ? paste.progress : null);
+    }
+    return snapshots.get(sessionId) ?? null;
+  }, [sessionId]);
+  return useSyncExternalStore(subscribe, getSnapshot);
+};
@@ -0,0 +1,170 @@
+import { useSyncExternalStore } from 'react';
+import { resolveHostAuth } from '../../domain/sshAuth';
+import type { Host, Identity, KnownHost, SSHKey } from '../../domain/models';
+import { netcattyBridge } from '../../infrastructure/services/netcattyBridge';
+
+/**
+ * Vault reachability store - singleton pattern using useSyncExternalStore
+ *
+ * Mirrors the main-process scanner results per host id. The main process
+ * batches updates, and each status dot subscribes to its own host entry so a
+ * batch only re-renders the dots whose result actually changed.
+ */
+type Listener = () => void;
+
+interface ScanOptions {
+  keys: SSHKey[];
+  identities: Identity[];
+  knownHosts: KnownHost[];
+  verifyHostKeys?: boolean;
+}
+
+// Known host entries hold a full key ("<type> <base64>" or the bare blob), a
+// SHA256 fingerprint, or a key cut short for display; only the first two can
+// be compared with the key a server offers
+const toKnownKey = (known: KnownHost): ReachabilityKnownKey | null => {
+  const value = (known.publicKey || '').trim();
+  if (!value || value.endsWith('...')) return null;
+  const parts = value.split(/\s+/);
+  const blob = parts.find((part) => part.startsWith('AAAA'));
+  if (blob) return { keyType: known.keyType || (parts.length > 1 ? parts[0] : undefined), blob };
+  const fingerprint = value.replace(/^SHA256:/i, '');
+  if (/^[A-Za-z0-9+/]{43}=?$/.test(fingerprint) || /^([0-9a-f]{2}:?){32}$/i.test(fingerprint)) {
+    return { keyType: known.keyType || undefined, fingerprint };
+  }
+  return null;
+};
+
+const isScannable = (host: Host) =>
+  (!host.protocol || host.protocol === 'ssh') && !!host.hostname;
+
+/**
+ * Build scanner targets for SSH hosts, including their proxy and jump chain
+ */
+export const buildReachabilityTargets = (hosts: Host[], options: ScanOptions): ReachabilityTarget[] => {
+  const hostsById = new Map(hosts.map((h) => [h.id, h]));
+  const knownKeysByAddress = new Map<string, ReachabilityKnownKey[]>();
+  for (const known of options.knownHosts) {
+    const knownKey = toKnownKey(known);
+    if (!knownKey) continue;
+    const address = `${known.hostname.toLowerCase()}:${known.port || 22}`;
+    const list = knownKeysByAddress.get(address) || [];
+    list.push(knownKey);
+    knownKeysByAddress.set(address, list);
+  }
+
+  return hosts.filter(isScannable).map((host) => {
+    const port = host.port || 22;
+    const chainHosts = (host.hostChain?.hostIds || [])
+      .map((id) => hostsById.get(id))
+      .filter((h): h is Host => !!h);
+    const jumpHosts = chainHosts.map<NetcattyJumpHost>((jumpHost) => {
+      const auth = resolveHostAuth({ host: jumpHost, keys: options.keys, identities: options.identities });
+      return {
+        hostname: jumpHost.hostname,
+        port: jumpHost.port || 22,
+        username: auth.username || 'root',
+        password: auth.password,
+        privateKey: auth.key?.privateKey,
+        passphrase: auth.passphrase || auth.key?.passphrase,
+        label: jumpHost.label,
+      };
+    });
+    return {
+      hostId: host.id,
+      hostname: host.hostname,
+      port,
+      proxy: host.proxyConfig
+        ? {
+          type: host.proxyConfig.type,
+          host: host.proxyConfig.host,
+          port: host.proxyConfig.port,
+          username: host.proxyConfig.username,
+          password: host.proxyConfig.password,
+          wan: host.proxyConfig.wan,
+        }
+        : undefined,
+      jumpHosts: jumpHosts.length > 0 ? jumpHosts : undefined,
+      knownKeys: knownKeysByAddress.get(`${host.hostname.toLowerCase()}:${port}`),
+    };
+  });
+};
+
+class ReachabilityStore {
+  private results = new Map<string, HostReachability>();
+  private scanning = false;
+  private listeners = new Set<Listener>();
+  private initialized = false;
+
+  getResult = (hostId: string): HostReachability | undefined => this.results.get(hostId);
+  getIsScanning = (): boolean => this.scanning;
+
+  private notify = () => {
+    this.listeners.forEach((listener) => listener());
+  };
+
+  subscribe = (listener: Listener): (() => void) => {
+    this.listeners.add(listener);
+    return () => this.listeners.delete(listener);
+  };
+
+  private applyResults = (results: HostReachability[]) => {
+    if (results.length === 0) return;
+    for (const result of results) {
+      this.results.set(result.hostId, result);
+    }
+    this.notify();
+  };
+
+  /**
+   * Load persisted results and listen for scanner updates. Safe to call
+   * multiple times.
+   */
+  initialize = () => {
+    if (this.initialized) return;
+    const bridge = netcattyBridge.get();
+    if (!bridge?.getReachabilityResults) return;
+    this.initialized = true;
+    bridge.onReachabilityEvent?.((event) => {
+      if (event.type === 'update') {
+        this.applyResults(event.results);
+      } else {
+        this.scanning = false;
+        this.notify();
+      }
+    });
+    bridge
+      .getReachabilityResults()
+      .then(this.applyResults)
+      .catch((err) => console.warn('[Reachability] Failed to load results', err));
+  };
+
+  scanHosts = async (hosts: Host[], options: ScanOptions) => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.startReachabilityScan) return;
+    this.initialize();
+    const targets = buildReachabilityTargets(hosts, options);
+    if (targets.length === 0) return;
+    this.scanning = true;
+    this.notify();
+    try {
+      await bridge.startReachabilityScan({ targets, verifyHostKeys: options.verifyHostKeys });
+    } catch (err) {
+      this.scanning = false;
+      this.notify();
+      throw err;
+    }
+  };
+
+  cancelScan = async () => {
+    await netcattyBridge.get()?.cancelReachabilityScan?.();
+  };
+}
+
+export const reachabilityStore = new ReachabilityStore();
+
+export const useHostReachability = (hostId: string): HostReachability | undefined =>
+  useSyncExternalStore(reachabilityStore.subscribe, () => reachabilityStore.getResult(hostId));
+
+export const useReachabilityScanning = (): boolean =>
+  useSyncExternalStore(reachabilityStore.subscribe, reachabilityStore.getIsScanning);
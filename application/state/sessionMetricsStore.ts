@@ -0,0 +1,84 @@
+import { useSyncExternalStore } from 'react';
+import { netcattyBridge } from '../../infrastructure/services/netcattyBridge';
+
+/**
+ * Session metrics store - singleton pattern using useSyncExternalStore
+ *
+ * Mirrors the main process traffic/latency accounting for this window's
+ * sessions. Each update replaces the whole set, so closed sessions drop out.
+ * Entries that did not change keep their object identity, and each badge
+ * subscribes to its own session, so an update only re-renders what moved.
+ */
+type Listener = () => void;
+
+const sameMetrics = (a: NetcattySessionMetrics, b: NetcattySessionMetrics) =>
+  a.bytesIn === b.bytesIn &&
+  a.bytesOut === b.bytesOut &&
+  a.rateIn === b.rateIn &&
+  a.rateOut === b.rateOut &&
+  a.rttMs === b.rttMs;
+
+class SessionMetricsStore {
+  private metrics = new Map<string, NetcattySessionMetrics>();
+  private listeners = new Set<Listener>();
+  private initialized = false;
+  private version = 0;
+
+  getMetrics = (sessionId: string): NetcattySessionMetrics | undefined => this.metrics.get(sessionId);
+  getVersion = (): number => this.version;
+
+  private apply = (list: NetcattySessionMetrics[]) => {
+    const next = new Map<string, NetcattySessionMetrics>();
+    for (const entry of list) {
+      const previous = this.metrics.get(entry.sessionId);
+      next.set(entry.sessionId, previous && sameMetrics(previous, entry) ? previous : entry);
+    }
+    this.metrics = next;
+    this.version++;
+    this.listeners.forEach((listener) => listener());
+  };
+
+  /**
+   * Start listening for updates. Safe to call multiple times.
+   */
+  initialize = () => {
+    if (this.initialized) return;
+    const bridge = netcattyBridge.get();
+    if (!bridge?.onSessionMetrics) return;
+    this.initialized = true;
+    bridge.onSessionMetrics(this.apply);
+    bridge
+      .getSessionMetrics?.()
+      .then(this.apply)
+      .catch((err) => console.warn('[SessionMetrics] Failed to load metrics', err));
+  };
+
+  subscribe = (listener: Listener): (() => void) => {
+    this.initialize();
+    this.listeners.add(listener);
+    return () => this.listeners.delete(listener);
+  };
+}
+
+export const sessionMetricsStore = new SessionMetricsStore();
+
+export const useSessionMetrics = (sessionId: string): NetcattySessionMetrics | undefined =>
+  useSyncExternalStore(sessionMetricsStore.subscribe, () => sessionMetricsStore.getMetrics(sessionId));
+
+/**
+ * Combined traffic of several sessions (a workspace tab), with the worst RTT
+ */
+export const useCombinedSessionMetrics = (sessionIds: string[]) => {
+  useSyncExternalStore(sessionMetricsStore.subscribe, sessionMetricsStore.getVersion);
+  let rateIn = 0;
+  let rateOut = 0;
+  let rttMs: number | null = null;
+  for (const id of sessionIds) {
+    const entry = sessionMetricsStore.getMetrics(id);
+    if (!entry) continue;
+    rateIn += entry.rateIn;
+    rateOut += entry.rateOut;
+    if (entry.rttMs !== null && (rttMs === null || entry.rttMs > rttMs)) rttMs = entry.rttMs;
+  }
+  return { rateIn, rateOut, rttMs };
+};
@@ -0,0 +1,310 @@
+import { useCallback, useSyncExternalStore } from 'react';
+import type { TerminalSession, Workspace } from '../../domain/models';
+import { collectSessionIds } from '../../domain/workspace';
+import {
+  STORAGE_KEY_SESSION_RESTORE_BACKGROUND,
+  STORAGE_KEY_SESSION_RESTORE_ENABLED,
+  STORAGE_KEY_SESSION_RESTORE_LAYOUT,
+  STORAGE_KEY_SESSION_RESTORE_SCREENS,
+  STORAGE_KEY_SESSION_RESTORE_SCREENS_ENABLED,
+} from '../../infrastructure/config/storageKeys';
+import { localStorageAdapter } from '../../infrastructure/persistence/localStorageAdapter';
+import { arrayBufferToBase64, base64ToUint8Array } from '../../infrastructure/services/EncryptionService';
+import { createLogger } from '../../lib/logger';
+
+/**
+ * Session restore store - tab layout and screen snapshots from the last run
+ *
+ * The layout (sessions, workspaces, tab order, active tab) is written
+ * synchronously on every change, so the next launch can recreate the tabs
+ * before anything connects. Restored sessions carry `restorePending` and only
+ * mount a terminal once they are shown (or the background queue picks them).
+ *
+ * Screen contents are opt-in, since scrollback can hold secrets and ends up
+ * in plaintext localStorage. They are serialized from live terminals,
+ * gzip-compressed and stored separately. Compression is async, so on unload
+ * the screens are written uncompressed instead. Sessions that never connected
+ * keep the snapshot they were restored with, so an untouched tab survives
+ * several restarts.
+ */
+type Listener = () => void;
+type ScreenSource = () => string | null;
+
+interface StoredLayout {
+  version: 1;
+  savedAt: number;
+  sessions: TerminalSession[];
+  workspaces: Workspace[];
+  tabOrder: string[];
+  activeTabId: string;
+}
+
+export interface RestoredLayout {
+  sessions: TerminalSession[];
+  workspaces: Workspace[];
+  tabOrder: string[];
+  activeTabId: string | null;
+}
+
+// Lines of scrollback kept per screen snapshot
+export const SCREEN_SNAPSHOT_SCROLLBACK = 200;
+// Combined budget for encoded snapshots; localStorage is shared with the vault
+const MAX_SCREENS_BYTES = 2 * 1024 * 1024;
+// Marks a snapshot stored as plain text (written on unload); never valid base64
+const RAW_SCREEN_PREFIX = 'raw:';
+
+const log = createLogger('SessionRestore');
+
+const canCompress = () =>
+  typeof CompressionStream !== 'undefined' && typeof DecompressionStream !== 'undefined';
+
+const gzipToBase64 = async (text: string): Promise<string> => {
+  const stream = new Blob([text]).stream().pipeThrough(new CompressionStream('gzip'));
+  return arrayBufferToBase64(await new Response(stream).arrayBuffer());
+};
+
+const gunzipFromBase64 = async (encoded: string): Promise<string> => {
+  const stream = new Blob([base64ToUint8Array(encoded)]).stream().pipeThrough(new DecompressionStream('gzip'));
+  return new Response(stream).text();
+};
+
+export const isSessionRestoreEnabled = () =>
+  localStorageAdapter.readBoolean(STORAGE_KEY_SESSION_RESTORE_ENABLED) ?? true;
+
+export const isScreenRestoreEnabled = () =>
+  localStorageAdapter.readBoolean(STORAGE_KEY_SESSION_RESTORE_SCREENS_ENABLED) ?? false;
+
+export const isBackgroundRestoreEnabled = () =>
+  localStorageAdapter.readBoolean(STORAGE_KEY_SESSION_RESTORE_BACKGROUND) ?? false;
+
+// Encoded snapshots as stored, keyed by session id
+let encodedScreens: Record<string, string> = {};
+// Decoded snapshots waiting for a placeholder or a terminal to pick them up
+const decodedScreens = new Map<string, string>();
+const screenSources = new Map<string, ScreenSource>();
+const listeners = new Set<Listener>();
+let persisting: Promise<void> | null = null;
+
+const emit = () => listeners.forEach((listener) => listener());
+
+const decodeScreens = async (sessionIds: string[]) => {
+  for (const sessionId of sessionIds) {
+    const encoded = encodedScreens[sessionId];
+    if (!encoded) continue;
+    if (encoded.startsWith(RAW_SCREEN_PREFIX)) {
+      decodedScreens.set(sessionId, encoded.slice(RAW_SCREEN_PREFIX.length));
+      continue;
+    }
+    if (!canCompress()) continue;
+    try {
+      decodedScreens.set(sessionId, await gunzipFromBase64(encoded));
+    } catch (err) {
+      log.warn('Failed to decode screen snapshot', sessionId, err);
+      delete encodedScreens[sessionId];
+    }
+  }
+  emit();
+};
+
+/**
+ * Read the layout saved by the previous run. Sessions come back as pending
+ * placeholders; workspaces that lost a pane and startup commands are dropped.
+ */
+export function loadRestoredLayout(): RestoredLayout | null {
+  if (!isSessionRestoreEnabled()) return null;
+  const stored = localStorageAdapter.read<StoredLayout>(STORAGE_KEY_SESSION_RESTORE_LAYOUT);
+  if (!stored || stored.version !== 1 || !Array.isArray(stored.sessions) || stored.sessions.length === 0) {
+    return null;
+  }
+
+  const sessionIds = new Set(stored.sessions.map((s) => s.id));
+  const workspaces = (stored.workspaces || []).filter((ws) =>
+    ws?.root && collectSessionIds(ws.root).every((id) => sessionIds.has(id)),
+  );
+  const workspaceIds = new Set(workspaces.map((ws) => ws.id));
+  const sessions = stored.sessions.map<TerminalSession>((session) => ({
+    ...session,
+    status: 'disconnected',
+    startupCommand: undefined,
+    workspaceId: session.workspaceId && workspaceIds.has(session.workspaceId) ? session.workspaceId : undefined,
+    restorePending: true,
+  }));
+  const tabIds = new Set([...sessions.filter((s) => !s.workspaceId).map((s) => s.id), ...workspaceIds]);
+
+  if (isScreenRestoreEnabled()) {
+    encodedScreens = localStorageAdapter.read<Record<string, string>>(STORAGE_KEY_SESSION_RESTORE_SCREENS) || {};
+    for (const id of Object.keys(encodedScreens)) {
+      if (!sessionIds.has(id)) delete encodedScreens[id];
+    }
+    void decodeScreens(sessions.map((s) => s.id));
+  } else {
+    clearScreens();
+  }
+
+  return {
+    sessions,
+    workspaces,
+    tabOrder: (stored.tabOrder || []).filter((id) => tabIds.has(id)),
+    activeTabId: tabIds.has(stored.activeTabId) ? stored.activeTabId : null,
+  };
+}
+
+/**
+ * Remember the current layout for the next launch
+ */
+export function saveRestoreLayout(
+  sessions: TerminalSession[],
+  workspaces: Workspace[],
+  tabOrder: string[],
+  activeTabId: string,
+) {
+  // tmux panes live on the server and come back by attaching again
+  const dropped = new Set(sessions.filter(s => s.tmux).map(s => s.id));
+  for (const ws of workspaces) {
+    if (collectSessionIds(ws.root).some(id => dropped.has(id))) dropped.add(ws.id);
+  }
+  const layout: StoredLayout = {
+    version: 1,
+    savedAt: Date.now(),
+    // Snippet runs are one-shot; a restored tab must not replay them
+    sessions: sessions
+      .filter(s => !dropped.has(s.id))
+      .map(({ startupCommand: _startupCommand, restorePending: _pending, ...session }) =>
+        session.workspaceId && dropped.has(session.workspaceId) ? { ...session, workspaceId: undefined } : session),
+    workspaces: workspaces.filter(ws => !dropped.has(ws.id)),
+    tabOrder: tabOrder.filter(id => !dropped.has(id)),
+    activeTabId: dropped.has(activeTabId) ? 'vault' : activeTabId,
+  };
+  try {
+    localStorageAdapter.write(STORAGE_KEY_SESSION_RESTORE_LAYOUT, layout);
+  } catch (err) {
+    log.warn('Failed to save session layout', err);
+  }
+}
+
+export function clearRestoreState() {
+  localStorageAdapter.remove(STORAGE_KEY_SESSION_RESTORE_LAYOUT);
+  clearScreens();
+}
+
+function clearScreens() {
+  localStorageAdapter.remove(STORAGE_KEY_SESSION_RESTORE_SCREENS);
+  encodedScreens = {};
+  decodedScreens.clear();
+  emit();
+}
+
+const writeScreens = (next: Record<string, string>) => {
+  encodedScreens = next;
+  try {
+    localStorageAdapter.write(STORAGE_KEY_SESSION_RESTORE_SCREENS, next);
+  } catch (err) {
+    log.warn('Failed to save screen snapshots', err);
+  }
+};
+
+/**
+ * Let a live terminal contribute its screen to the next snapshot
+ */
+export function registerScreenSource(sessionId: string, source: ScreenSource): () => void {
+  screenSources.set(sessionId, source);
+  return () => {
+    if (screenSources.get(sessionId) === source) screenSources.delete(sessionId);
+  };
+}
+
+/**
+ * Serialize and compress the screens of the given sessions. Sessions without
+ * a live terminal keep their previous snapshot. Concurrent calls share a run.
+ */
+export function persistScreens(sessionIds: string[]): Promise<void> {
+  if (!isScreenRestoreEnabled()) {
+    if (Object.keys(encodedScreens).length > 0 || localStorageAdapter.read(STORAGE_KEY_SESSION_RESTORE_SCREENS)) {
+      clearScreens();
+    }
+    return Promise.resolve();
+  }
+  if (!canCompress()) return Promise.resolve();
+  if (persisting) return persisting;
+  persisting = (async () => {
+    const next: Record<string, string> = {};
+    let totalBytes = 0;
+    for (const sessionId of sessionIds) {
+      let encoded = encodedScreens[sessionId];
+      const source = screenSources.get(sessionId);
+      if (source) {
+        try {
+          const screen = source();
+          encoded = screen ? await gzipToBase64(screen) : undefined;
+        } catch (err) {
+          log.debug('Failed to snapshot screen', sessionId, err);
+        }
+      }
+      if (!encoded || totalBytes + encoded.length > MAX_SCREENS_BYTES) continue;
+      totalBytes += encoded.length;
+      next[sessionId] = encoded;
+    }
+    writeScreens(next);
+  })().finally(() => {
+    persisting = null;
+  });
+  return persisting;
+}
+
+/**
+ * Synchronous variant for unload, when an async save would never finish.
+ * Live screens are stored uncompressed, so fewer fit in the budget.
+ */
+export function persistScreensSync(sessionIds: string[]) {
+  if (!isScreenRestoreEnabled()) return;
+  const next: Record<string, string> = {};
+  let totalBytes = 0;
+  for (const sessionId of sessionIds) {
+    let encoded = encodedScreens[sessionId];
+    const source = screenSources.get(sessionId);
+    if (source) {
+      try {
+        const screen = source();
+        encoded = screen ? RAW_SCREEN_PREFIX + screen : undefined;
+      } catch (err) {
+        log.debug('Failed to snapshot screen', sessionId, err);
+      }
+    }
+    if (!encoded || totalBytes + encoded.length > MAX_SCREENS_BYTES) continue;
+    totalBytes += encoded.length;
+    next[sessionId] = encoded;
+  }
+  writeScreens(next);
+}
+
+/**
+ * Hand the restored screen to the terminal that replaces the placeholder
+ */
+export function takeRestoredScreen(sessionId: string): string | null {
+  const screen = decodedScreens.get(sessionId) ?? null;
+  if (screen !== null) {
+    decodedScreens.delete(sessionId);
+    emit();
+  }
+  return screen;
+}
+
+const subscribe = (listener: Listener) => {
+  listeners.add(listener);
+  return () => listeners.delete(listener);
+};
+
+export const useRestoredScreen = (sessionId: string) => {
+  const getSnapshot = useCallback(() => decodedScreens.get(sessionId) ?? null, [sessionId]);
+  return useSyncExternalStore(subscribe, getSnapshot);
+};
+
+// CSI, OSC and two-byte escape sequences emitted by the serialize addon
+// eslint-disable-next-line no-control-regex
+const ANSI_PATTERN = /\x1b\[[0-?]*[ -/]*[@-~]|\x1b\][^\x07\x1b]*(?:\x07|\x1b\\)|\x1b[@-Z\\-_]/g;
+
+/**
+ * Plain-text rendering of a serialized screen for placeholders
+ */
+export const screenToPlainText = (screen: string) =>
+  screen.replace(ANSI_PATTERN, '').replace(/\r\n?/g, '\n');
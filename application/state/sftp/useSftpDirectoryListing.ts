@@ -4,14 +4,70 @@ import type { SftpFileEntry, SftpFilenameEncoding } from "../../../domain/models
 import { buildMockLocalFiles } from "./mockLocalFiles";
 import { formatFileSize, formatDate } from "./utils";
 
+export interface LocalListOptions {
+  /** Bypass the main-process listing cache */
+  force?: boolean;
+  /** Called with the entries read so far while a large directory streams in */
+  onPartial?: (files: SftpFileEntry[]) => void;
+}
+
+const LOCAL_KINDS = ["file", "directory", "symlink"] as const;
+const LOCAL_LINK_TARGETS = [null, "file", "directory"] as const;
+// A directory that changes between every page is listed as it comes after this
+const MAX_LISTING_RESTARTS = 3;
+
+const appendLocalDirPage = (files: SftpFileEntry[], page: LocalDirPage) => {
+  for (let i = 0; i < page.names.length; i++) {
+    const size = page.sizes[i];
+    const lastModified = page.mtimes[i];
+    const type = LOCAL_KINDS[page.kinds[i]] ?? "file";
+    files.push({
+      name: page.names[i],
+      type,
+      size,
+      sizeFormatted: formatFileSize(size),
+      lastModified,
+      lastModifiedFormatted: formatDate(lastModified),
+      linkTarget: type === "symlink" ? LOCAL_LINK_TARGETS[page.linkTargets[i]] ?? null : undefined,
+      hidden: page.hidden[i] === 1,
+    });
+  }
+};
+
 export const useSftpDirectoryListing = () => {
   const getMockLocalFiles = useCallback((path: string): SftpFileEntry[] => {
     return buildMockLocalFiles(path);
   }, []);
 
   const listLocalFiles = useCallback(
-    async (path: string): Promise<SftpFileEntry[]> => {
-      const rawFiles = await netcattyBridge.get()?.listLocalDir?.(path);
+    async (path: string, options?: LocalListOptions): Promise<SftpFileEntry[]> => {
+      const bridge = netcattyBridge.get();
+      if (bridge?.listLocalDirPage) {
+        let files: SftpFileEntry[] = [];
+        let offset: number | null = 0;
+        let generation: number | undefined;
+        let restarts = 0;
+        while (offset !== null) {
+          const force = options?.force && restarts === 0;
+          const page: LocalDirPage = await bridge.listLocalDirPage(path, offset, undefined, force, generation);
+          if (page.restart) {
+            // The directory changed between pages; start over on the new listing
+            files = [];
+            offset = 0;
+            generation = undefined;
+            restarts++;
+            continue;
+          }
+          appendLocalDirPage(files, page);
+          // Later pages must come from the same listing, unless the directory keeps changing
+          if (offset === 0 && restarts < MAX_LISTING_RESTARTS) generation = page.generation;
+          offset = page.nextOffset;
+          if (offset !== null) options?.onPartial?.(files.slice());
+        }
+        return files;
+      }
+
+      const rawFiles = await bridge?.listLocalDir?.(path);
       if (!rawFiles) {
         return getMockLocalFiles(path);
       }
@@ -25,6 +25,7 @@ export const useSftpHostCredentials = ({
             port: host.proxyConfig.port,
             username: host.proxyConfig.username,
             password: host.proxyConfig.password,
+            wan: host.proxyConfig.wan,
           }
         : undefined;
 
@@ -69,6 +70,8 @@ export const useSftpHostCredentials = ({
         proxy: proxyConfig,
         jumpHosts: jumpHosts && jumpHosts.length > 0 ? jumpHosts : undefined,
         sudo: host.sftpSudo,
+        atomicUpload: host.sftpAtomicUpload,
+        transportProfile: host.transportProfile,
       };
     },
     [hosts, identities, keys],
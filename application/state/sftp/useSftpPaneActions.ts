@@ -3,6 +3,7 @@ import type { Host, SftpFileEntry, SftpFilenameEncoding } from "../../../domain/
 import { netcattyBridge } from "../../../infrastructure/services/netcattyBridge";
 import { logger } from "../../../lib/logger";
 import { SftpPane } from "./types";
+import type { LocalListOptions } from "./useSftpDirectoryListing";
 import { getParentPath, isNavigableDirectory, isWindowsRoot, joinPath } from "./utils";
 
 interface UseSftpPaneActionsParams {
@@ -18,7 +19,7 @@ interface UseSftpPaneActionsParams {
   reconnectingRef: React.MutableRefObject<{ left: boolean; right: boolean }>;
   makeCacheKey: (connectionId: string, path: string, encoding?: SftpFilenameEncoding) => string;
   clearCacheForConnection: (connectionId: string) => void;
-  listLocalFiles: (path: string) => Promise<SftpFileEntry[]>;
+  listLocalFiles: (path: string, options?: LocalListOptions) => Promise<SftpFileEntry[]>;
   listRemoteFiles: (sftpId: string, path: string, encoding?: SftpFilenameEncoding) => Promise<SftpFileEntry[]>;
   handleSessionError: (side: "left" | "right", error: Error) => void;
   isSessionError: (err: unknown) => boolean;
@@ -118,7 +119,20 @@ export const useSftpPaneActions = ({
         let files: SftpFileEntry[];
 
         if (pane.connection.isLocal) {
-          files = await listLocalFiles(path);
+          files = await listLocalFiles(path, {
+            force: options?.force,
+            // Show the first pages of huge directories while the rest streams in
+            onPartial: (partial) => {
+              if (navSeqRef.current[side] !== requestId) return;
+              updateTab(side, activeTabId, (prev) => ({
+                ...prev,
+                connection: prev.connection
+                  ? { ...prev.connection, currentPath: path }
+                  : null,
+                files: partial,
+              }));
+            },
+          });
         } else {
           const sftpId = sftpSessionsRef.current.get(pane.connection.id);
           if (!sftpId) {
@@ -426,19 +440,25 @@ export const useSftpPaneActions = ({
       if (!pane?.connection) return;
 
       try {
-        for (const name of fileNames) {
-          const fullPath = joinPath(pane.connection.currentPath, name);
+        const fullPaths = fileNames.map((name) => joinPath(pane.connection!.currentPath, name));
 
-          if (pane.connection.isLocal) {
+        if (pane.connection.isLocal) {
+          for (const fullPath of fullPaths) {
             await netcattyBridge.get()?.deleteLocalFile?.(fullPath);
-          } else {
-            const sftpId = sftpSessionsRef.current.get(pane.connection.id);
-            if (!sftpId) {
-              handleSessionError(side, new Error("SFTP session not found"));
-              return;
-            }
-            await netcattyBridge.get()?.deleteSftp?.(sftpId, fullPath, pane.filenameEncoding);
           }
+        } else {
+          const sftpId = sftpSessionsRef.current.get(pane.connection.id);
+          if (!sftpId) {
+            handleSessionError(side, new Error("SFTP session not found"));
+            return;
+          }
+          // Issued together so the bridge sends them as one batched IPC message
+          const bridge = netcattyBridge.get();
+          const results = await Promise.allSettled(
+            fullPaths.map((fullPath) => bridge?.deleteSftp?.(sftpId, fullPath, pane.filenameEncoding)),
+          );
+          const failure = results.find((r): r is PromiseRejectedResult => r.status === "rejected");
+          if (failure) throw failure.reason;
         }
         await refresh(side);
       } catch (err) {
@@ -552,16 +552,15 @@ export const useSftpTransfers = ({
         ? null
         : sftpSessionsRef.current.get(sourcePane.connection.id);
 
-      const newTasks: TransferTask[] = [];
-
-      for (const file of sourceFiles) {
-        const direction: TransferDirection =
-          sourcePane.connection!.isLocal && !targetPane.connection!.isLocal
-            ? "upload"
-            : !sourcePane.connection!.isLocal && targetPane.connection!.isLocal
-              ? "download"
-              : "remote-to-remote";
-
+      const direction: TransferDirection =
+        sourcePane.connection.isLocal && !targetPane.connection.isLocal
+          ? "upload"
+          : !sourcePane.connection.isLocal && targetPane.connection.isLocal
+            ? "download"
+            : "remote-to-remote";
+
+      // Stat the whole selection at once so remote stats share one batched IPC message
+      const newTasks: TransferTask[] = await Promise.all(sourceFiles.map(async (file) => {
         let fileSize = 0;
         if (!file.isDirectory) {
           try {
@@ -570,11 +569,11 @@ export const useSftpTransfers = ({
               const stat = await netcattyBridge.get()?.statLocal?.(fullPath);
               if (stat) fileSize = stat.size;
             } else if (sourceSftpId) {
-            const stat = await netcattyBridge.get()?.statSftp?.(
-              sourceSftpId,
-              fullPath,
-              sourceEncoding,
-            );
+              const stat = await netcattyBridge.get()?.statSftp?.(
+                sourceSftpId,
+                fullPath,
+                sourceEncoding,
+              );
               if (stat) fileSize = stat.size;
             }
           } catch {
@@ -582,7 +581,7 @@ export const useSftpTransfers = ({
           }
         }
 
-        newTasks.push({
+        return {
           id: crypto.randomUUID(),
           fileName: file.name,
           sourcePath: joinPath(sourcePath, file.name),
@@ -596,8 +595,8 @@ export const useSftpTransfers = ({
           speed: 0,
           startTime: Date.now(),
           isDirectory: file.isDirectory,
-        });
-      }
+        };
+      }));
 
       setTransfers((prev) => [...prev, ...newTasks]);
 
@@ -157,6 +157,11 @@ export const useAutoSync = (config: AutoSyncConfig) => {
     
     try {
       console.log('[AutoSync] Checking remote version...');
+      // Metadata probe first; the full download + decrypt only runs on change
+      if (!(await sync.hasRemoteChanged(connectedProvider))) {
+        console.log('[AutoSync] Remote unchanged since last sync');
+        return;
+      }
       const remotePayload = await sync.downloadFromProvider(connectedProvider);
       
       if (remotePayload && remotePayload.syncedAt > state.localUpdatedAt) {
@@ -29,6 +29,7 @@ import {
 } from '../../infrastructure/services/CloudSyncManager';
 import { netcattyBridge } from '../../infrastructure/services/netcattyBridge';
 import type { DeviceFlowState } from '../../infrastructure/services/adapters/GitHubAdapter';
+import type { MasterKeyOptions } from '../../infrastructure/services/EncryptionService';
 
 // ============================================================================
 // Types
@@ -61,7 +62,7 @@ export interface CloudSyncHook {
   setupMasterKey: (password: string, confirmPassword: string) => Promise<void>;
   unlock: (password: string) => Promise<boolean>;
   lock: () => void;
-  changeMasterKey: (oldPassword: string, newPassword: string) => Promise<boolean>;
+  changeMasterKey: (oldPassword: string, newPassword: string, options?: MasterKeyOptions) => Promise<boolean>;
   verifyPassword: (password: string) => Promise<boolean>;
   
   // Provider Actions
@@ -87,6 +88,7 @@ export interface CloudSyncHook {
   syncNow: (payload: SyncPayload) => Promise<Map<CloudProvider, SyncResult>>;
   syncToProvider: (provider: CloudProvider, payload: SyncPayload) => Promise<SyncResult>;
   downloadFromProvider: (provider: CloudProvider) => Promise<SyncPayload | null>;
+  hasRemoteChanged: (provider: CloudProvider) => Promise<boolean>;
   resolveConflict: (resolution: ConflictResolution) => Promise<SyncPayload | null>;
   
   // Settings
@@ -234,9 +236,10 @@ export const useCloudSync = (): CloudSyncHook => {
   
   const changeMasterKey = useCallback(async (
     oldPassword: string,
-    newPassword: string
+    newPassword: string,
+    options?: MasterKeyOptions
   ): Promise<boolean> => {
-    const ok = await manager.changeMasterKey(oldPassword, newPassword);
+    const ok = await manager.changeMasterKey(oldPassword, newPassword, options);
     if (ok) {
       void netcattyBridge.get()?.cloudSyncSetSessionPassword?.(newPassword);
     }
@@ -416,6 +419,7 @@ export const useCloudSync = (): CloudSyncHook => {
     securityState: state.securityState,
     syncState: state.syncState,
     isUnlocked: state.securityState === 'UNLOCKED',
+    masterKeyKdf: state.masterKeyConfig?.kdf ?? null,
     isSyncing: state.syncState === 'SYNCING',
     providers: state.providers,
     currentConflict: state.currentConflict,
@@ -455,6 +459,7 @@ export const useCloudSync = (): CloudSyncHook => {
     syncNow: syncNowWithUnlock,
     syncToProvider: syncToProviderWithUnlock,
     downloadFromProvider: downloadFromProviderWithUnlock,
+    hasRemoteChanged: (provider: CloudProvider) => manager.hasRemoteChanged(provider),
     resolveConflict: resolveConflictWithUnlock,
     
     // Settings
@@ -22,6 +22,8 @@ export interface UsePortForwardingAutoStartOptions {
 
 /**
  * Auto-starts port forwarding rules that have autoStart enabled.
+ * Rules marked onDemand only bind their listener here; the SSH connection
+ * is made when the first client arrives.
  * This hook should be called at the App level to run on app launch.
  */
 export const usePortForwardingAutoStart = ({
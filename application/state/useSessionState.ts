@@ -1,18 +1,28 @@
-import { MouseEvent,useCallback,useMemo,useState } from 'react';
+import { MouseEvent,useCallback,useEffect,useMemo,useRef,useState } from 'react';
 import { ConnectionLog,Host,SerialConfig,Snippet,TerminalSession,Workspace,WorkspaceViewMode } from '../../domain/models';
 import {
 collectSessionIds,
 createWorkspaceFromSessions as createWorkspaceEntity,
 createWorkspaceFromSessionIds,
+createWorkspaceNodeFromTmuxLayout,
 FocusDirection,
 getNextFocusSessionId,
 insertPaneIntoWorkspace,
+isSameTmuxLayoutShape,
 pruneWorkspaceNode,
 SplitDirection,
 SplitHint,
 updateWorkspaceSplitSizes,
 } from '../../domain/workspace';
 import { activeTabStore } from './activeTabStore';
+import {
+clearRestoreState,
+isSessionRestoreEnabled,
+loadRestoredLayout,
+persistScreens,
+persistScreensSync,
+saveRestoreLayout,
+} from './sessionRestoreStore';
 
 // LogView represents an open log replay tab
 export interface LogView {
@@ -21,9 +31,25 @@ export interface LogView {
   log: ConnectionLog;
 }
 
+// Layout writes are cheap but tab drags produce bursts of updates
+const LAYOUT_SAVE_DELAY_MS = 500;
+// Screen snapshots may be this stale if the app is killed
+const SCREEN_SAVE_INTERVAL_MS = 30_000;
+
+const tmuxWorkspaceId = (controlId: string, windowId: string) => `tmux-ws-${controlId}-${windowId.replace('@', '')}`;
+
+const collectTmuxLayoutSessionIds = (node: NetcattyTmuxLayoutNode): string[] =>
+  node.type === 'pane' ? [node.sessionId] : node.children.flatMap(collectTmuxLayoutSessionIds);
+
 export const useSessionState = () => {
-  const [sessions, setSessions] = useState<TerminalSession[]>([]);
-  const [workspaces, setWorkspaces] = useState<Workspace[]>([]);
+  // Read once; the tabs from the previous run come back as pending placeholders
+  const [restored] = useState(() => {
+    const layout = loadRestoredLayout();
+    if (layout?.activeTabId) activeTabStore.setActiveTabId(layout.activeTabId);
+    return layout;
+  });
+  const [sessions, setSessions] = useState<TerminalSession[]>(() => restored?.sessions ?? []);
+  const [workspaces, setWorkspaces] = useState<Workspace[]>(() => restored?.workspaces ?? []);
   // activeTabId is now managed by external store - components subscribe directly
   const setActiveTabId = activeTabStore.setActiveTabId;
   const [draggingSessionId, setDraggingSessionId] = useState<string | null>(null);
@@ -32,7 +58,7 @@ export const useSessionState = () => {
   const [workspaceRenameTarget, setWorkspaceRenameTarget] = useState<Workspace | null>(null);
   const [workspaceRenameValue, setWorkspaceRenameValue] = useState('');
   // Tab order: stores ordered list of tab IDs (orphan session IDs and workspace IDs)
-  const [tabOrder, setTabOrder] = useState<string[]>([]);
+  const [tabOrder, setTabOrder] = useState<string[]>(() => restored?.tabOrder ?? []);
   // Broadcast mode: stores workspace IDs that have broadcast enabled
   const [broadcastWorkspaceIds, setBroadcastWorkspaceIds] = useState<Set<string>>(new Set());
   // Log views: stores open log replay tabs
@@ -123,6 +149,13 @@ export const useSessionState = () => {
     setSessions(prev => prev.map(s => s.id === sessionId ? { ...s, status } : s));
   }, []);
 
+  // Mount the terminal of a restored tab, which starts its connection
+  const activateRestoredSession = useCallback((sessionId: string) => {
+    setSessions(prev => prev.map(s => s.id === sessionId && s.restorePending
+      ? { ...s, restorePending: false, status: 'connecting' }
+      : s));
+  }, []);
+
   const closeSession = useCallback((sessionId: string, e?: MouseEvent) => {
     e?.stopPropagation();
     
@@ -418,6 +451,96 @@ export const useSessionState = () => {
 	    });
 	  }, [setActiveTabId]);
 
+  // Mirror a tmux window: one pane is a plain tab, several panes a workspace
+  // laid out like the remote window. The tree is only rebuilt when the pane
+  // structure changes, so resizes coming back from tmux don't fight the user.
+  const syncTmuxWindow = useCallback((
+    controlId: string,
+    owner: TerminalSession,
+    tmuxWindow: NetcattyTmuxWindow,
+    activate = false
+  ) => {
+    const paneIds = collectTmuxLayoutSessionIds(tmuxWindow.layout);
+    const workspaceId = paneIds.length > 1 ? tmuxWorkspaceId(controlId, tmuxWindow.windowId) : undefined;
+    const paneRefs = new Map<string, string>();
+    const collectPaneRefs = (node: NetcattyTmuxLayoutNode) => {
+      if (node.type === 'pane') paneRefs.set(node.sessionId, node.paneId);
+      else node.children.forEach(collectPaneRefs);
+    };
+    collectPaneRefs(tmuxWindow.layout);
+
+    setSessions(prevSessions => {
+      const known = new Set(prevSessions.map(s => s.id));
+      const next = prevSessions
+        .filter(s => !(s.tmux?.controlId === controlId && s.tmux.windowId === tmuxWindow.windowId && !paneRefs.has(s.id)))
+        .map(s => paneRefs.has(s.id) && s.tmux
+          ? { ...s, workspaceId, tmux: { ...s.tmux, windowId: tmuxWindow.windowId } }
+          : s);
+      for (const [sessionId, paneId] of paneRefs) {
+        if (known.has(sessionId)) continue;
+        next.push({
+          id: sessionId,
+          hostId: owner.hostId,
+          hostLabel: owner.hostLabel,
+          hostname: owner.hostname,
+          username: owner.username,
+          status: 'connecting',
+          workspaceId,
+          protocol: owner.protocol,
+          port: owner.port,
+          tmux: { controlId, windowId: tmuxWindow.windowId, paneId, ownerSessionId: owner.id },
+        });
+      }
+      return next;
+    });
+
+    const wsId = tmuxWorkspaceId(controlId, tmuxWindow.windowId);
+    setWorkspaces(prevWorkspaces => {
+      const existing = prevWorkspaces.find(w => w.id === wsId);
+      const currentActiveTabId = activeTabStore.getActiveTabId();
+      if (!workspaceId) {
+        if (currentActiveTabId === wsId || activate) setActiveTabId(paneIds[0]);
+        return existing ? prevWorkspaces.filter(w => w.id !== wsId) : prevWorkspaces;
+      }
+      if (activate || paneIds.includes(currentActiveTabId)) setActiveTabId(wsId);
+      if (!existing) {
+        return [...prevWorkspaces, {
+          id: wsId,
+          title: tmuxWindow.name,
+          root: createWorkspaceNodeFromTmuxLayout(tmuxWindow.layout),
+        }];
+      }
+      if (isSameTmuxLayoutShape(existing.root, tmuxWindow.layout) && existing.title === tmuxWindow.name) {
+        return prevWorkspaces;
+      }
+      return prevWorkspaces.map(w => w.id !== wsId ? w : {
+        ...w,
+        title: tmuxWindow.name,
+        root: isSameTmuxLayoutShape(w.root, tmuxWindow.layout) ? w.root : createWorkspaceNodeFromTmuxLayout(tmuxWindow.layout),
+      });
+    });
+  }, [setActiveTabId]);
+
+  // Drop the tabs of a closed tmux window, or of every window when windowId is omitted
+  const removeTmuxPanes = useCallback((controlId: string, windowId?: string) => {
+    const matches = (s: TerminalSession) => s.tmux?.controlId === controlId
+      && (windowId === undefined || s.tmux.windowId === windowId);
+    setSessions(prevSessions => {
+      const removed = prevSessions.filter(matches);
+      if (removed.length === 0) return prevSessions;
+      const removedIds = new Set(removed.map(s => s.id));
+      const removedWorkspaceIds = new Set(removed.map(s => s.workspaceId).filter(Boolean));
+      setWorkspaces(prev => prev.filter(w => !removedWorkspaceIds.has(w.id)));
+
+      const currentActiveTabId = activeTabStore.getActiveTabId();
+      if (removedIds.has(currentActiveTabId) || removedWorkspaceIds.has(currentActiveTabId)) {
+        const ownerId = removed[0].tmux?.ownerSessionId;
+        setActiveTabId(ownerId && prevSessions.some(s => s.id === ownerId) ? ownerId : 'vault');
+      }
+      return prevSessions.filter(s => !removedIds.has(s.id));
+    });
+  }, [setActiveTabId]);
+
   // Toggle workspace view mode between split and focus
   const toggleWorkspaceViewMode = useCallback((workspaceId: string) => {
     setWorkspaces(prev => prev.map(ws => {
@@ -603,6 +726,47 @@ export const useSessionState = () => {
     return [...orderedIds, ...newIds];
   }, [orphanSessions, workspaces, logViews, tabOrder]);
 
+  // Persist the layout for lazy restore on the next launch
+  const layoutRef = useRef({ sessions, workspaces, tabOrder: orderedTabs });
+  layoutRef.current = { sessions, workspaces, tabOrder: orderedTabs };
+
+  useEffect(() => {
+    if (!isSessionRestoreEnabled()) return;
+    const timer = setTimeout(() => {
+      saveRestoreLayout(sessions, workspaces, orderedTabs, activeTabStore.getActiveTabId());
+    }, LAYOUT_SAVE_DELAY_MS);
+    return () => clearTimeout(timer);
+  }, [sessions, workspaces, orderedTabs]);
+
+  useEffect(() => {
+    const saveAll = (unloading = false) => {
+      if (!isSessionRestoreEnabled()) {
+        clearRestoreState();
+        return;
+      }
+      const current = layoutRef.current;
+      saveRestoreLayout(current.sessions, current.workspaces, current.tabOrder, activeTabStore.getActiveTabId());
+      const sessionIds = current.sessions.map(s => s.id);
+      // An async (compressing) save would not finish during unload
+      if (unloading) persistScreensSync(sessionIds);
+      else void persistScreens(sessionIds);
+    };
+    const saveOnUnload = () => saveAll(true);
+    // The active tab lives outside React state, so follow it separately
+    const unsubscribe = activeTabStore.subscribe(() => {
+      if (!isSessionRestoreEnabled()) return;
+      const current = layoutRef.current;
+      saveRestoreLayout(current.sessions, current.workspaces, current.tabOrder, activeTabStore.getActiveTabId());
+    });
+    const interval = setInterval(() => saveAll(), SCREEN_SAVE_INTERVAL_MS);
+    window.addEventListener('beforeunload', saveOnUnload);
+    return () => {
+      unsubscribe();
+      clearInterval(interval);
+      window.removeEventListener('beforeunload', saveOnUnload);
+    };
+  }, []);
+
   const reorderTabs = useCallback((draggedId: string, targetId: string, position: 'before' | 'after' = 'before') => {
     if (draggedId === targetId) return;
     
@@ -669,10 +833,13 @@ export const useSessionState = () => {
     closeSession,
     closeWorkspace,
     updateSessionStatus,
+    activateRestoredSession,
     createWorkspaceFromSessions,
     addSessionToWorkspace,
     updateSplitSizes,
     splitSession,
+    syncTmuxWindow,
+    removeTmuxPanes,
     toggleWorkspaceViewMode,
     setWorkspaceFocusedSession,
     moveFocusInWorkspace,
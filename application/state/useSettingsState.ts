@@ -24,6 +24,9 @@ STORAGE_KEY_SFTP_USE_COMPRESSED_UPLOAD,
 STORAGE_KEY_SESSION_LOGS_ENABLED,
 STORAGE_KEY_SESSION_LOGS_DIR,
 STORAGE_KEY_SESSION_LOGS_FORMAT,
+STORAGE_KEY_SESSION_RESTORE_ENABLED,
+STORAGE_KEY_SESSION_RESTORE_BACKGROUND,
+STORAGE_KEY_SESSION_RESTORE_SCREENS_ENABLED,
 } from '../../infrastructure/config/storageKeys';
 import { DEFAULT_UI_LOCALE, resolveSupportedLocale } from '../../infrastructure/config/i18n';
 import { TERMINAL_THEMES } from '../../infrastructure/config/terminalThemes';
@@ -56,6 +59,12 @@ const DEFAULT_SFTP_USE_COMPRESSED_UPLOAD = true;
 const DEFAULT_SESSION_LOGS_ENABLED = false;
 const DEFAULT_SESSION_LOGS_FORMAT: SessionLogFormat = 'txt';
 
+// Session restore defaults
+const DEFAULT_SESSION_RESTORE_ENABLED = true;
+const DEFAULT_SESSION_RESTORE_BACKGROUND = false;
+// Scrollback can contain secrets, so screen contents are only kept on request
+const DEFAULT_SESSION_RESTORE_SCREENS = false;
+
 const readStoredString = (key: string): string | null => {
   const raw = localStorageAdapter.readString(key);
   if (!raw) return null;
@@ -211,6 +220,19 @@ export const useSettingsState = () => {
     const stored = readStoredString(STORAGE_KEY_SESSION_LOGS_ENABLED);
     return stored === 'true' ? true : DEFAULT_SESSION_LOGS_ENABLED;
   });
+  // Session Restore Settings
+  const [sessionRestoreEnabled, setSessionRestoreEnabled] = useState<boolean>(() => {
+    const stored = readStoredString(STORAGE_KEY_SESSION_RESTORE_ENABLED);
+    return stored === null ? DEFAULT_SESSION_RESTORE_ENABLED : stored === 'true';
+  });
+  const [sessionRestoreInBackground, setSessionRestoreInBackground] = useState<boolean>(() => {
+    const stored = readStoredString(STORAGE_KEY_SESSION_RESTORE_BACKGROUND);
+    return stored === null ? DEFAULT_SESSION_RESTORE_BACKGROUND : stored === 'true';
+  });
+  const [sessionRestoreScreens, setSessionRestoreScreens] = useState<boolean>(() => {
+    const stored = readStoredString(STORAGE_KEY_SESSION_RESTORE_SCREENS_ENABLED);
+    return stored === null ? DEFAULT_SESSION_RESTORE_SCREENS : stored === 'true';
+  });
   const [sessionLogsDir, setSessionLogsDir] = useState<string>(() => {
     return readStoredString(STORAGE_KEY_SESSION_LOGS_DIR) || '';
   });
@@ -343,6 +365,12 @@ export const useSettingsState = () => {
       if (key === STORAGE_KEY_HOTKEY_RECORDING && typeof value === 'boolean') {
         setIsHotkeyRecordingState(value);
       }
+      if (key === STORAGE_KEY_SESSION_RESTORE_BACKGROUND && typeof value === 'boolean') {
+        setSessionRestoreInBackground(value);
+      }
+      if (key === STORAGE_KEY_SESSION_RESTORE_SCREENS_ENABLED && typeof value === 'boolean') {
+        setSessionRestoreScreens(value);
+      }
     });
     return () => {
       try {
@@ -568,6 +596,22 @@ export const useSettingsState = () => {
     notifySettingsChanged(STORAGE_KEY_SESSION_LOGS_ENABLED, sessionLogsEnabled);
   }, [sessionLogsEnabled, notifySettingsChanged]);
 
+  // Persist Session Restore settings
+  useEffect(() => {
+    localStorageAdapter.writeString(STORAGE_KEY_SESSION_RESTORE_ENABLED, sessionRestoreEnabled ? 'true' : 'false');
+    notifySettingsChanged(STORAGE_KEY_SESSION_RESTORE_ENABLED, sessionRestoreEnabled);
+  }, [sessionRestoreEnabled, notifySettingsChanged]);
+
+  useEffect(() => {
+    localStorageAdapter.writeString(STORAGE_KEY_SESSION_RESTORE_BACKGROUND, sessionRestoreInBackground ? 'true' : 'false');
+    notifySettingsChanged(STORAGE_KEY_SESSION_RESTORE_BACKGROUND, sessionRestoreInBackground);
+  }, [sessionRestoreInBackground, notifySettingsChanged]);
+
+  useEffect(() => {
+    localStorageAdapter.writeString(STORAGE_KEY_SESSION_RESTORE_SCREENS_ENABLED, sessionRestoreScreens ? 'true' : 'false');
+    notifySettingsChanged(STORAGE_KEY_SESSION_RESTORE_SCREENS_ENABLED, sessionRestoreScreens);
+  }, [sessionRestoreScreens, notifySettingsChanged]);
+
   useEffect(() => {
     localStorageAdapter.writeString(STORAGE_KEY_SESSION_LOGS_DIR, sessionLogsDir);
     notifySettingsChanged(STORAGE_KEY_SESSION_LOGS_DIR, sessionLogsDir);
@@ -702,5 +746,12 @@ export const useSettingsState = () => {
     setSessionLogsDir,
     sessionLogsFormat,
     setSessionLogsFormat,
+    // Session Restore
+    sessionRestoreEnabled,
+    setSessionRestoreEnabled,
+    sessionRestoreInBackground,
+    setSessionRestoreInBackground,
+    sessionRestoreScreens,
+    setSessionRestoreScreens,
   };
 };
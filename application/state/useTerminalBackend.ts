@@ -33,6 +33,12 @@ export const useTerminalBackend = () => {
     return bridge.startSSHSession(options);
   }, []);
 
+  const attachTmuxPane = useCallback(async (sessionId: string) => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.tmuxAttachPane) throw new Error("tmuxAttachPane unavailable");
+    return bridge.tmuxAttachPane(sessionId);
+  }, []);
+
   const startTelnetSession = useCallback(async (options: Parameters<NonNullable<NetcattyBridge["startTelnetSession"]>>[0]) => {
     const bridge = netcattyBridge.get();
     if (!bridge?.startTelnetSession) throw new Error("startTelnetSession unavailable");
@@ -63,6 +69,12 @@ export const useTerminalBackend = () => {
     return bridge.execCommand(options);
   }, []);
 
+  const tuneSshTransport = useCallback(async (options: NetcattySSHOptions) => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.tuneSshTransport) throw new Error("tuneSshTransport unavailable");
+    return bridge.tuneSshTransport(options);
+  }, []);
+
   const writeToSession = useCallback((sessionId: string, data: string) => {
     const bridge = netcattyBridge.get();
     bridge?.writeToSession?.(sessionId, data);
@@ -128,6 +140,12 @@ export const useTerminalBackend = () => {
     return bridge.getServerStats(sessionId);
   }, []);
 
+  const getSessionCapabilities = useCallback(async (sessionId: string, force?: boolean) => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.getSessionCapabilities) return { success: false, error: 'getSessionCapabilities unavailable' };
+    return bridge.getSessionCapabilities(sessionId, force);
+  }, []);
+
   return {
     backendAvailable,
     telnetAvailable,
@@ -137,14 +155,17 @@ export const useTerminalBackend = () => {
     execAvailable,
     openExternalAvailable,
     startSSHSession,
+    attachTmuxPane,
     startTelnetSession,
     startMoshSession,
     startLocalSession,
     startSerialSession,
     listSerialPorts,
     execCommand,
+    tuneSshTransport,
     getSessionPwd,
     getServerStats,
+    getSessionCapabilities,
     writeToSession,
     resizeSession,
     closeSession,
@@ -0,0 +1,107 @@
+/**
+ * Hook for tmux control mode: runs `tmux -C` over an SSH tab's connection and
+ * mirrors the remote windows as tabs and workspaces, one session per pane.
+ * Splits of a tmux pane are done by tmux itself; the new pane shows up
+ * through the layout events.
+ */
+import { useCallback, useEffect, useRef } from "react";
+import { TerminalSession } from "../../domain/models";
+import { SplitDirection } from "../../domain/workspace";
+import { netcattyBridge } from "../../infrastructure/services/netcattyBridge";
+import { logger } from "../../lib/logger";
+
+export interface UseTmuxControlOptions {
+  sessions: TerminalSession[];
+  syncTmuxWindow: (
+    controlId: string,
+    owner: TerminalSession,
+    tmuxWindow: NetcattyTmuxWindow,
+    activate?: boolean,
+  ) => void;
+  removeTmuxPanes: (controlId: string, windowId?: string) => void;
+}
+
+export const useTmuxControl = ({
+  sessions,
+  syncTmuxWindow,
+  removeTmuxPanes,
+}: UseTmuxControlOptions) => {
+  const sessionsRef = useRef(sessions);
+  // controlId -> the SSH tab that owns the control channel
+  const ownersRef = useRef(new Map<string, TerminalSession>());
+
+  useEffect(() => {
+    sessionsRef.current = sessions;
+  }, [sessions]);
+
+  useEffect(() => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.onTmuxEvent) return;
+    return bridge.onTmuxEvent((event) => {
+      const owner = ownersRef.current.get(event.controlId);
+      if (!owner) return;
+      if (event.type === "window") {
+        syncTmuxWindow(event.controlId, owner, event.window);
+      } else if (event.type === "window-close") {
+        removeTmuxPanes(event.controlId, event.windowId);
+      } else if (event.type === "exit") {
+        logger.info("[tmux] Control mode ended", { controlId: event.controlId, reason: event.reason });
+        ownersRef.current.delete(event.controlId);
+        removeTmuxPanes(event.controlId);
+      }
+    });
+  }, [syncTmuxWindow, removeTmuxPanes]);
+
+  const tmuxAvailable = useCallback(() => {
+    const bridge = netcattyBridge.get();
+    return !!bridge?.tmuxAttach;
+  }, []);
+
+  /** Attach to (or create) the "netcatty" tmux session on the tab's host */
+  const attach = useCallback(async (sessionId: string, sessionName?: string) => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.tmuxAttach) throw new Error("tmuxAttach unavailable");
+    const owner = sessionsRef.current.find((s) => s.id === sessionId);
+    if (!owner) throw new Error("Session not found");
+
+    const result = await bridge.tmuxAttach({ sessionId, sessionName });
+    ownersRef.current.set(result.controlId, owner);
+    const active = result.windows.find((w) => w.active) ?? result.windows[0];
+    for (const tmuxWindow of result.windows) {
+      syncTmuxWindow(result.controlId, owner, tmuxWindow, tmuxWindow === active);
+    }
+    return result;
+  }, [syncTmuxWindow]);
+
+  /**
+   * Split a tmux pane on the server. Returns false when the session is not a
+   * tmux pane, so the caller can fall back to a regular split.
+   */
+  const splitPane = useCallback((sessionId: string, direction: SplitDirection) => {
+    const session = sessionsRef.current.find((s) => s.id === sessionId);
+    const bridge = netcattyBridge.get();
+    if (!session?.tmux || !bridge?.tmuxCommand) return false;
+    void bridge.tmuxCommand({
+      controlId: session.tmux.controlId,
+      action: "split",
+      sessionId,
+      direction,
+    }).then((res) => {
+      if (!res.success) logger.warn("[tmux] Split failed", res.error);
+    });
+    return true;
+  }, []);
+
+  const detach = useCallback(async (controlId: string) => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.tmuxDetach) return;
+    await bridge.tmuxDetach(controlId);
+  }, []);
+
+  return {
+    tmuxAvailable,
+    attach,
+    splitPane,
+    detach,
+  };
+};
@@ -2,6 +2,7 @@ import { useCallback, useEffect, useState } from "react";
 import { normalizeDistroId, sanitizeHost } from "../../domain/host";
 import {
   ConnectionLog,
+  ConnectTiming,
   Host,
   Identity,
   KeyCategory,
@@ -206,6 +207,24 @@ export const useVaultState = () => {
     []
   );
 
+  // Attach a connect-time breakdown to the newest open log for that host
+  const recordConnectTiming = useCallback(
+    (hostname: string, timing: ConnectTiming) => {
+      setConnectionLogs((prev) => {
+        const target = prev
+          .filter((log) => log.hostname === hostname && !log.endTime && !log.connectTiming)
+          .sort((a, b) => b.startTime - a.startTime)[0];
+        if (!target) return prev;
+        const updated = prev.map((log) =>
+          log.id === target.id ? { ...log, connectTiming: timing } : log
+        );
+        localStorageAdapter.write(STORAGE_KEY_CONNECTION_LOGS, updated);
+        return updated;
+      });
+    },
+    []
+  );
+
   const updateConnectionLog = useCallback(
     (id: string, updates: Partial<ConnectionLog>) => {
       setConnectionLogs((prev) => {
@@ -509,6 +528,7 @@ export const useVaultState = () => {
     clearShellHistory,
     addConnectionLog,
     updateConnectionLog,
+    recordConnectTiming,
     toggleConnectionLogSaved,
     deleteConnectionLog,
     clearUnsavedConnectionLogs,
@@ -711,6 +711,7 @@ export const SyncDashboard: React.FC<SyncDashboardProps> = ({
     const [newMasterKey, setNewMasterKey] = useState('');
     const [confirmNewMasterKey, setConfirmNewMasterKey] = useState('');
     const [showMasterKey, setShowMasterKey] = useState(false);
+    const [useArgon2, setUseArgon2] = useState(false);
     const [isChangingKey, setIsChangingKey] = useState(false);
     const [changeKeyError, setChangeKeyError] = useState<string | null>(null);
 
@@ -1025,6 +1026,7 @@ export const SyncDashboard: React.FC<SyncDashboardProps> = ({
                             setNewMasterKey('');
                             setConfirmNewMasterKey('');
                             setShowMasterKey(false);
+                            setUseArgon2(sync.masterKeyKdf === 'Argon2id');
                             setShowChangeKeyDialog(true);
                         }}
                     >
@@ -1527,6 +1529,19 @@ export const SyncDashboard: React.FC<SyncDashboardProps> = ({
                             {t('cloudSync.changeKey.showKeys')}
                         </label>
 
+                        <label className="flex items-start gap-2 text-sm text-muted-foreground select-none">
+                            <input
+                                type="checkbox"
+                                checked={useArgon2}
+                                onChange={(e) => setUseArgon2(e.target.checked)}
+                                className="accent-primary mt-0.5"
+                            />
+                            <span>
+                                {t('cloudSync.changeKey.useArgon2')}
+                                <span className="block text-xs">{t('cloudSync.changeKey.useArgon2Desc')}</span>
+                            </span>
+                        </label>
+
                         {changeKeyError && (
                             <p className="text-sm text-red-500">{changeKeyError}</p>
                         )}
@@ -1558,7 +1573,9 @@ export const SyncDashboard: React.FC<SyncDashboardProps> = ({
 
                                 setIsChangingKey(true);
                                 try {
-                                    const ok = await sync.changeMasterKey(currentMasterKey, newMasterKey);
+                                    const ok = await sync.changeMasterKey(currentMasterKey, newMasterKey, {
+                                        kdf: useArgon2 ? 'Argon2id' : 'PBKDF2',
+                                    });
                                     if (!ok) {
                                         setChangeKeyError(t('cloudSync.changeKey.incorrectCurrent'));
                                         return;
@@ -9,6 +9,7 @@ import {
 } from "lucide-react";
 import React, { memo, useCallback, useMemo, useState } from "react";
 import { useI18n } from "../application/i18n/I18nProvider";
+import { formatConnectTiming } from "../lib/connectTiming";
 import { cn } from "../lib/utils";
 import { ConnectionLog, Host } from "../types";
 import { ScrollArea } from "./ui/scroll-area";
@@ -100,8 +101,12 @@ const LogItem = memo<LogItemProps>(({ log, onToggleSaved, onDelete, onClick }) =
                 </div>
                 <div className="min-w-0">
                     <div className="text-sm font-medium truncate">{isLocal ? t("logs.localTerminal") : log.hostLabel}</div>
-                    <div className="text-xs text-muted-foreground truncate">
+                    <div
+                        className="text-xs text-muted-foreground truncate"
+                        title={log.connectTiming ? formatConnectTiming(log.connectTiming, t) : undefined}
+                    >
                         {isLocal ? "local" : isSerial ? `serial, ${log.hostname}` : `${log.protocol}, ${log.username}`}
+                        {log.connectTiming && `, ${t("logs.connectTime", { total: log.connectTiming.totalMs })}`}
                     </div>
                 </div>
             </div>
@@ -7,10 +7,12 @@ import {
   FolderLock,
   FolderPlus,
   Forward,
+  Gauge,
   Globe,
   Key,
   KeyRound,
   Link2,
+  Loader2,
   MapPin,
   Palette,
   Plus,
@@ -26,11 +28,14 @@ import {
 import React, { useEffect, useMemo, useState, useCallback } from "react";
 import { useI18n } from "../application/i18n/I18nProvider";
 import { useApplicationBackend } from "../application/state/useApplicationBackend";
+import { useTerminalBackend } from "../application/state/useTerminalBackend";
+import { useSftpHostCredentials } from "../application/state/sftp/useSftpHostCredentials";
 import { TERMINAL_THEMES } from "../infrastructure/config/terminalThemes";
 import { MIN_FONT_SIZE, MAX_FONT_SIZE } from "../infrastructure/config/fonts";
 import { cn } from "../lib/utils";
-import { EnvVar, Host, Identity, ManagedSource, ProxyConfig, SSHKey } from "../types";
+import { EnvVar, Host, Identity, ManagedSource, ProxyConfig, SSHKey, WanEmulationConfig } from "../types";
 import { DistroAvatar } from "./DistroAvatar";
+import { formatBytes } from "./sftp/utils";
 import ThemeSelectPanel from "./ThemeSelectPanel";
 import {
   AsidePanel,
@@ -97,6 +102,12 @@ const HostDetailsPanel: React.FC<HostDetailsPanelProps> = ({
 }) => {
   const { t } = useI18n();
   const { checkSshAgent } = useApplicationBackend();
+  const { tuneSshTransport } = useTerminalBackend();
+  const getHostCredentials = useSftpHostCredentials({
+    hosts: allHosts,
+    keys: availableKeys,
+    identities,
+  });
   const [form, setForm] = useState<Host>(
     () =>
       initialData ||
@@ -197,6 +208,44 @@ const HostDetailsPanel: React.FC<HostDetailsPanelProps> = ({
     [],
   );
 
+  const updateWanConfig = useCallback(
+    (field: keyof WanEmulationConfig, value: number) => {
+      setForm((prev) => ({
+        ...prev,
+        proxyConfig: {
+          type: "wan",
+          host: prev.proxyConfig?.host || "",
+          port: prev.proxyConfig?.port || 0,
+          ...prev.proxyConfig,
+          wan: { ...prev.proxyConfig?.wan, [field]: value },
+        },
+      }));
+    },
+    [],
+  );
+
+  // Transport tuning: runs a short throughput test per candidate profile
+  const [isTuning, setIsTuning] = useState(false);
+  const [tuneError, setTuneError] = useState<string | null>(null);
+
+  const handleTuneTransport = useCallback(async () => {
+    setIsTuning(true);
+    setTuneError(null);
+    try {
+      const { sudo: _sudo, transportProfile: _profile, ...options } = getHostCredentials(form);
+      const result = await tuneSshTransport(options);
+      if (result.success && result.profile) {
+        setForm((prev) => ({ ...prev, transportProfile: result.profile }));
+      } else {
+        setTuneError(result.error || "Unknown error");
+      }
+    } catch (err) {
+      setTuneError(err instanceof Error ? err.message : String(err));
+    } finally {
+      setIsTuning(false);
+    }
+  }, [form, getHostCredentials, tuneSshTransport]);
+
   const clearProxyConfig = useCallback(() => {
     setForm((prev) => {
       const { proxyConfig: _proxyConfig, ...rest } = prev;
@@ -423,6 +472,7 @@ const HostDetailsPanel: React.FC<HostDetailsPanelProps> = ({
       <ProxyPanel
         proxyConfig={form.proxyConfig}
         onUpdateProxy={updateProxyConfig}
+        onUpdateWan={updateWanConfig}
         onClearProxy={clearProxyConfig}
         onBack={() => setActiveSubPanel("none")}
         onCancel={onCancel}
@@ -1074,6 +1124,20 @@ const HostDetailsPanel: React.FC<HostDetailsPanelProps> = ({
               {t("hostDetails.sftp.sudo.passwordWarning")}
             </p>
           )}
+          <div className="flex items-center justify-between">
+            <div className="space-y-0.5">
+              <div className="text-sm font-medium">
+                {t("hostDetails.sftp.atomicUpload")}
+              </div>
+              <div className="text-xs text-muted-foreground">
+                {t("hostDetails.sftp.atomicUpload.desc")}
+              </div>
+            </div>
+            <Switch
+              checked={form.sftpAtomicUpload || false}
+              onCheckedChange={(val) => update("sftpAtomicUpload", val)}
+            />
+          </div>
           <div className="space-y-1">
             <div className="text-sm font-medium">
               {t("hostDetails.sftp.encoding")}
@@ -1230,6 +1294,55 @@ const HostDetailsPanel: React.FC<HostDetailsPanelProps> = ({
           )}
         </Card>
 
+        {/* Transport Tuning */}
+        <Card className="p-3 space-y-2 bg-card border-border/80">
+          <div className="flex items-center justify-between">
+            <div className="flex items-center gap-2">
+              <Gauge size={14} className="text-muted-foreground" />
+              <p className="text-xs font-semibold">{t("hostDetails.section.transport")}</p>
+            </div>
+            <div className="flex items-center gap-1">
+              {form.transportProfile && !isTuning && (
+                <Button
+                  variant="ghost"
+                  size="sm"
+                  className="h-7 text-xs"
+                  onClick={() => update("transportProfile", undefined)}
+                >
+                  {t("hostDetails.transport.reset")}
+                </Button>
+              )}
+              <Button
+                variant="secondary"
+                size="sm"
+                className="h-7 text-xs gap-1"
+                disabled={isTuning || !form.hostname}
+                onClick={() => void handleTuneTransport()}
+              >
+                {isTuning && <Loader2 size={12} className="animate-spin" />}
+                {isTuning ? t("hostDetails.transport.tuning") : t("hostDetails.transport.tune")}
+              </Button>
+            </div>
+          </div>
+          <p className="text-xs text-muted-foreground">
+            {form.transportProfile
+              ? t("hostDetails.transport.summary", {
+                  cipher: form.transportProfile.cipher === "chacha20" ? "ChaCha20-Poly1305" : "AES-GCM",
+                  compression: form.transportProfile.compression
+                    ? t("common.enabled")
+                    : t("common.disabled"),
+                  window: formatBytes(form.transportProfile.windowSize),
+                  speed: formatBytes(form.transportProfile.throughput || 0),
+                })
+              : t("hostDetails.transport.desc")}
+          </p>
+          {tuneError && (
+            <p className="text-xs text-destructive">
+              {t("hostDetails.transport.failed", { error: tuneError })}
+            </p>
+          )}
+        </Card>
+
         {/* Proxy via Hosts (Jump Hosts / ProxyJump) */}
         <Card className="p-3 space-y-2 bg-card border-border/80">
           <div className="flex items-center justify-between">
@@ -1312,7 +1425,11 @@ const HostDetailsPanel: React.FC<HostDetailsPanelProps> = ({
               <Globe size={14} className="text-muted-foreground" />
               <p className="text-xs font-semibold">{t("hostDetails.proxy")}</p>
             </div>
-            {form.proxyConfig?.host ? (
+            {form.proxyConfig?.type === "wan" ? (
+              <Badge variant="secondary" className="text-xs">
+                WAN {t("hostDetails.proxy.wanBadge", { latency: form.proxyConfig.wan?.latencyMs ?? 0 })}
+              </Badge>
+            ) : form.proxyConfig?.host ? (
               <Badge variant="secondary" className="text-xs">
                 {form.proxyConfig.type?.toUpperCase()} {form.proxyConfig.host}:
                 {form.proxyConfig.port}
@@ -1332,7 +1449,7 @@ const HostDetailsPanel: React.FC<HostDetailsPanelProps> = ({
             onClick={() => setActiveSubPanel("proxy")}
           >
             <Plus size={14} />
-            {form.proxyConfig?.host
+            {form.proxyConfig?.host || form.proxyConfig?.type === "wan"
               ? t("hostDetails.proxy.edit")
               : t("hostDetails.proxy.configure")}
           </Button>
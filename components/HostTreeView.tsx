@@ -10,6 +10,7 @@ import { Collapsible, CollapsibleContent, CollapsibleTrigger } from './ui/collap
 import { ContextMenu, ContextMenuContent, ContextMenuItem, ContextMenuTrigger } from './ui/context-menu';
 import { DistroAvatar } from './DistroAvatar';
 import { Button } from './ui/button';
+import { HostReachabilityDot } from './vault/HostReachabilityDot';
 
 interface HostTreeViewProps {
   groupTree: GroupNode[];
@@ -286,7 +287,10 @@ const HostTreeItem: React.FC<HostTreeItemProps> = ({
             <DistroAvatar host={host} fallback={(host.os || "L")[0].toUpperCase()} size="sm" />
           </div>
           <div className="flex-1 min-w-0">
-            <div className="font-medium truncate">{host.label}</div>
+            <div className="flex items-center gap-1.5 min-w-0">
+              <span className="font-medium truncate">{host.label}</span>
+              <HostReachabilityDot hostId={host.id} />
+            </div>
             <div className="text-xs text-muted-foreground truncate">
               {displayUsername}@{host.hostname}:{displayPort}
             </div>
@@ -5,6 +5,7 @@ import "@xterm/xterm/css/xterm.css";
 import { FileText, Download, Palette, X } from "lucide-react";
 import React, { memo, useCallback, useEffect, useMemo, useRef, useState } from "react";
 import { useI18n } from "../application/i18n/I18nProvider";
+import { formatConnectTiming } from "../lib/connectTiming";
 import { cn } from "../lib/utils";
 import { ConnectionLog, TerminalTheme } from "../types";
 import { TERMINAL_THEMES } from "../infrastructure/config/terminalThemes";
@@ -237,6 +238,7 @@ const LogViewComponent: React.FC<LogViewProps> = ({
                         </div>
                         <div className="text-xs text-muted-foreground">
                             {formattedDate} • {log.localUsername}@{log.localHostname}
+                            {log.connectTiming && ` • ${formatConnectTiming(log.connectTiming, t)}`}
                         </div>
                     </div>
                 </div>
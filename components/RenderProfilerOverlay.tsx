@@ -0,0 +1,210 @@
+/**
+ * Render Profiler Overlay - floating panel listing the components that render
+ * the most, with flame-style phase bars and changed-prop attribution
+ */
+import { ChevronDown, ChevronUp, Gauge, RotateCcw, X } from "lucide-react";
+import React, { useMemo, useState } from "react";
+import { useI18n } from "../application/i18n/I18nProvider";
+import {
+  type ComponentRenderStats,
+  type RenderPhase,
+  renderProfilerStore,
+  totalCommits,
+  totalDurationMs,
+  useRenderProfiler,
+} from "../lib/renderProfiler";
+import { cn } from "../lib/utils";
+import { Button } from "./ui/button";
+
+const TOP_COMPONENTS = 12;
+const TOP_PROPS = 4;
+const TIMELINE_EVENTS = 80;
+
+type SortKey = "time" | "renders" | "max";
+
+const PHASE_COLORS: Record<RenderPhase, string> = {
+  mount: "bg-sky-500/70",
+  update: "bg-amber-500/80",
+  "nested-update": "bg-rose-500/80",
+};
+
+const sortValue = (entry: ComponentRenderStats, key: SortKey) => {
+  switch (key) {
+    case "renders":
+      return Math.max(entry.renders, totalCommits(entry));
+    case "max":
+      return entry.maxMs;
+    default:
+      return totalDurationMs(entry);
+  }
+};
+
+const formatMs = (ms: number) => (ms < 10 ? `${ms.toFixed(2)} ms` : `${ms.toFixed(0)} ms`);
+
+const FlameBar: React.FC<{ entry: ComponentRenderStats; scaleMs: number }> = ({ entry, scaleMs }) => {
+  const phases: RenderPhase[] = ["mount", "update", "nested-update"];
+  return (
+    <div className="h-2 w-full bg-muted/50 rounded-sm overflow-hidden flex">
+      {phases.map((phase) =>
+        entry.durationMs[phase] > 0 ? (
+          <div
+            key={phase}
+            className={PHASE_COLORS[phase]}
+            style={{ width: `${(entry.durationMs[phase] / scaleMs) * 100}%` }}
+            title={`${phase}: ${formatMs(entry.durationMs[phase])} / ${entry.commits[phase]}`}
+          />
+        ) : null,
+      )}
+    </div>
+  );
+};
+
+const RenderProfilerOverlay: React.FC = () => {
+  const { t } = useI18n();
+  const snapshot = useRenderProfiler();
+  const [sortKey, setSortKey] = useState<SortKey>("time");
+  const [collapsed, setCollapsed] = useState(false);
+
+  const rows = useMemo(
+    () =>
+      [...snapshot.components]
+        .sort((a, b) => sortValue(b, sortKey) - sortValue(a, sortKey))
+        .slice(0, TOP_COMPONENTS),
+    [snapshot.components, sortKey],
+  );
+  const scaleMs = Math.max(0.001, ...rows.map(totalDurationMs));
+  const hasTimings = snapshot.components.some((entry) => totalCommits(entry) > 0);
+
+  const timeline = useMemo(
+    () => snapshot.recent.filter((event) => event.durationMs !== null).slice(-TIMELINE_EVENTS),
+    [snapshot.recent],
+  );
+  const timelinePeak = Math.max(1, ...timeline.map((event) => event.durationMs ?? 0));
+
+  const sortButtons: { key: SortKey; label: string }[] = [
+    { key: "time", label: t("renderProfiler.sort.time") },
+    { key: "renders", label: t("renderProfiler.sort.renders") },
+    { key: "max", label: t("renderProfiler.sort.max") },
+  ];
+
+  return (
+    <div className="fixed bottom-3 right-3 z-[9999] w-[380px] max-h-[70vh] flex flex-col rounded-lg border border-border bg-popover/95 text-popover-foreground shadow-xl backdrop-blur text-xs">
+      <div className="flex items-center gap-2 px-3 py-2 border-b border-border/60">
+        <Gauge size={14} className="text-muted-foreground" />
+        <span className="font-medium flex-1">{t("renderProfiler.title")}</span>
+        <Button
+          variant="ghost"
+          size="icon"
+          className="h-6 w-6"
+          onClick={renderProfilerStore.reset}
+          title={t("renderProfiler.reset")}
+        >
+          <RotateCcw size={12} />
+        </Button>
+        <Button variant="ghost" size="icon" className="h-6 w-6" onClick={() => setCollapsed(!collapsed)}>
+          {collapsed ? <ChevronUp size={12} /> : <ChevronDown size={12} />}
+        </Button>
+        <Button
+          variant="ghost"
+          size="icon"
+          className="h-6 w-6"
+          onClick={() => renderProfilerStore.setEnabled(false)}
+          title={t("renderProfiler.close")}
+        >
+          <X size={12} />
+        </Button>
+      </div>
+
+      {!collapsed && (
+        <div className="flex-1 overflow-y-auto px-3 py-2 space-y-3">
+          <div className="flex gap-1">
+            {sortButtons.map(({ key, label }) => (
+              <Button
+                key={key}
+                variant={sortKey === key ? "secondary" : "ghost"}
+                size="sm"
+                className="h-6 px-2 text-[11px]"
+                onClick={() => setSortKey(key)}
+              >
+                {label}
+              </Button>
+            ))}
+          </div>
+
+          {snapshot.syncOutput.frames > 0 && (
+            <div className="text-[10px] text-muted-foreground tabular-nums">
+              {t("renderProfiler.syncOutput", {
+                frames: snapshot.syncOutput.frames,
+                skipped: snapshot.syncOutput.skippedWrites,
+                timeouts: snapshot.syncOutput.timeouts,
+                max: formatMs(snapshot.syncOutput.maxHeldMs),
+              })}
+            </div>
+          )}
+
+          {timeline.length > 0 && (
+            <div>
+              <div className="text-[10px] uppercase text-muted-foreground mb-1">{t("renderProfiler.recent")}</div>
+              <div className="h-8 flex items-end gap-px">
+                {timeline.map((event, index) => (
+                  <div
+                    key={`${event.time}-${index}`}
+                    className={cn("flex-1 min-w-[2px] rounded-t-sm", PHASE_COLORS[event.phase as RenderPhase])}
+                    style={{ height: `${Math.max(4, ((event.durationMs ?? 0) / timelinePeak) * 100)}%` }}
+                    title={`${event.id} ${event.phase} ${formatMs(event.durationMs ?? 0)}`}
+                  />
+                ))}
+              </div>
+            </div>
+          )}
+
+          {rows.length === 0 ? (
+            <div className="py-4 text-center text-muted-foreground">{t("renderProfiler.empty")}</div>
+          ) : (
+            <div className="space-y-2.5">
+              {rows.map((entry) => {
+                const props = Object.entries(entry.changedProps)
+                  .sort((a, b) => b[1] - a[1])
+                  .slice(0, TOP_PROPS);
+                return (
+                  <div key={entry.id} className="space-y-1">
+                    <div className="flex items-baseline gap-2">
+                      <span className="font-mono truncate flex-1" title={entry.id}>{entry.id}</span>
+                      <span className="tabular-nums text-muted-foreground">
+                        {t("renderProfiler.renders", { count: Math.max(entry.renders, totalCommits(entry)) })}
+                      </span>
+                      {totalCommits(entry) > 0 && (
+                        <span className="tabular-nums w-16 text-right">{formatMs(totalDurationMs(entry))}</span>
+                      )}
+                    </div>
+                    {totalCommits(entry) > 0 && <FlameBar entry={entry} scaleMs={scaleMs} />}
+                    {props.length > 0 && (
+                      <div className="flex flex-wrap gap-1">
+                        {props.map(([prop, count]) => (
+                          <span key={prop} className="px-1 rounded bg-muted/60 font-mono text-[10px]">
+                            {prop} ×{count}
+                          </span>
+                        ))}
+                      </div>
+                    )}
+                    {totalCommits(entry) > 0 && (
+                      <div className="text-[10px] text-muted-foreground tabular-nums">
+                        {t("renderProfiler.maxLast", { max: formatMs(entry.maxMs), last: formatMs(entry.lastMs) })}
+                      </div>
+                    )}
+                  </div>
+                );
+              })}
+            </div>
+          )}
+
+          {!hasTimings && rows.length > 0 && (
+            <p className="text-[10px] text-muted-foreground">{t("renderProfiler.noTimings")}</p>
+          )}
+        </div>
+      )}
+    </div>
+  );
+};
+
+export default RenderProfilerOverlay;
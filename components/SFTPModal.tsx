@@ -41,6 +41,7 @@ interface SFTPModalProps {
     proxy?: NetcattyProxyConfig;
     jumpHosts?: NetcattyJumpHost[];
     sftpSudo?: boolean;
+    sftpAtomicUpload?: boolean;
   };
   open: boolean;
   onClose: () => void;
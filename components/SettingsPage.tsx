@@ -2,7 +2,7 @@
  * Settings Page - Standalone settings window content
  * This component is rendered in a separate Electron window
  */
-import { AppWindow, Cloud, FileType, HardDrive, Keyboard, Palette, TerminalSquare, X } from "lucide-react";
+import { Activity, AppWindow, Cloud, FileType, HardDrive, Keyboard, Palette, TerminalSquare, X } from "lucide-react";
 import React, { useCallback, useEffect, useState } from "react";
 import { useSettingsState } from "../application/state/useSettingsState";
 import { useVaultState } from "../application/state/useVaultState";
@@ -14,6 +14,7 @@ import SettingsFileAssociationsTab from "./settings/tabs/SettingsFileAssociation
 import SettingsShortcutsTab from "./settings/tabs/SettingsShortcutsTab";
 import SettingsTerminalTab from "./settings/tabs/SettingsTerminalTab";
 import SettingsSystemTab from "./settings/tabs/SettingsSystemTab";
+import SettingsDiagnosticsTab from "./settings/tabs/SettingsDiagnosticsTab";
 import { Tabs, TabsList, TabsTrigger } from "./ui/tabs";
 import type { TerminalFont } from "../infrastructure/config/fonts";
 
@@ -140,6 +141,12 @@ const SettingsPageContent: React.FC<{ settings: SettingsState }> = ({ settings }
                         >
                             <HardDrive size={14} /> {t("settings.tab.system")}
                         </TabsTrigger>
+                        <TabsTrigger
+                            value="diagnostics"
+                            className="w-full justify-start gap-2 px-3 py-2 text-sm data-[state=active]:bg-background hover:bg-background/60 rounded-md transition-colors"
+                        >
+                            <Activity size={14} /> {t("settings.tab.diagnostics")}
+                        </TabsTrigger>
                     </TabsList>
                 </div>
 
@@ -211,8 +218,18 @@ const SettingsPageContent: React.FC<{ settings: SettingsState }> = ({ settings }
                             setSessionLogsDir={settings.setSessionLogsDir}
                             sessionLogsFormat={settings.sessionLogsFormat}
                             setSessionLogsFormat={settings.setSessionLogsFormat}
+                            sessionRestoreEnabled={settings.sessionRestoreEnabled}
+                            setSessionRestoreEnabled={settings.setSessionRestoreEnabled}
+                            sessionRestoreInBackground={settings.sessionRestoreInBackground}
+                            setSessionRestoreInBackground={settings.setSessionRestoreInBackground}
+                            sessionRestoreScreens={settings.sessionRestoreScreens}
+                            setSessionRestoreScreens={settings.setSessionRestoreScreens}
                         />
                     )}
+
+                    {mountedTabs.has("diagnostics") && (
+                        <SettingsDiagnosticsTab active={activeTab === "diagnostics"} />
+                    )}
                 </div>
             </Tabs>
         </div>
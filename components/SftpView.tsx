@@ -21,7 +21,7 @@ import { useSftpState } from "../application/state/useSftpState";
 import { useSftpBackend } from "../application/state/useSftpBackend";
 import { useSettingsState } from "../application/state/useSettingsState";
 import { logger } from "../lib/logger";
-import { useRenderTracker } from "../lib/useRenderTracker";
+import { useRenderTracker, withRenderProfiler } from "../lib/useRenderTracker";
 import { cn } from "../lib/utils";
 import { Host, Identity, SSHKey } from "../types";
 import { useSftpFileAssociations } from "../application/state/useSftpFileAssociations";
@@ -321,5 +321,5 @@ const SftpViewInner: React.FC<SftpViewProps> = ({ hosts, keys, identities }) =>
 const sftpViewAreEqual = (prev: SftpViewProps, next: SftpViewProps): boolean =>
   prev.hosts === next.hosts && prev.keys === next.keys && prev.identities === next.identities;
 
-export const SftpView = memo(SftpViewInner, sftpViewAreEqual);
+export const SftpView = memo(withRenderProfiler("SftpView", SftpViewInner), sftpViewAreEqual);
 SftpView.displayName = "SftpView";
@@ -20,23 +20,34 @@ import {
   TerminalTheme,
   TerminalSettings,
   KeyBinding,
+  TmuxPaneRef,
 } from "../types";
 import { resolveHostAuth } from "../domain/sshAuth";
 import { useTerminalBackend } from "../application/state/useTerminalBackend";
+import { pasteToTerminal } from "../application/state/pasteEngine";
+import {
+  registerScreenSource,
+  SCREEN_SNAPSHOT_SCROLLBACK,
+  takeRestoredScreen,
+} from "../application/state/sessionRestoreStore";
 import KnownHostConfirmDialog, { HostKeyInfo } from "./KnownHostConfirmDialog";
 import SFTPModal from "./SFTPModal";
 import { Button } from "./ui/button";
 import { HoverCard, HoverCardContent, HoverCardTrigger } from "./ui/hover-card";
 import { toast } from "./ui/toast";
-import { useAvailableFonts } from "../application/state/fontStore";
-import { TERMINAL_THEMES } from "../infrastructure/config/terminalThemes";
+import { fontStore, useAvailableFonts } from "../application/state/fontStore";
+import { TERMINAL_THEMES, getXTermThemePalette } from "../infrastructure/config/terminalThemes";
 
 import { TerminalConnectionDialog } from "./terminal/TerminalConnectionDialog";
 import { TerminalToolbar } from "./terminal/TerminalToolbar";
 import { TerminalContextMenu } from "./terminal/TerminalContextMenu";
 import { TerminalSearchBar } from "./terminal/TerminalSearchBar";
+import { TerminalInbandTransfers } from "./terminal/TerminalInbandTransfers";
+import { TerminalPasteProgress } from "./terminal/TerminalPasteProgress";
 import { createTerminalSessionStarters, type PendingAuth } from "./terminal/runtime/createTerminalSessionStarters";
 import { createXTermRuntime, type XTermRuntime } from "./terminal/runtime/createXTermRuntime";
+import type { SynchronizedOutput } from "./terminal/runtime/synchronizedOutput";
+import { terminalAppearanceScheduler } from "./terminal/runtime/terminalAppearanceScheduler";
 import { XTERM_PERFORMANCE_CONFIG } from "../infrastructure/config/xtermPerformance";
 import { useTerminalSearch } from "./terminal/hooks/useTerminalSearch";
 import { useTerminalContextActions } from "./terminal/hooks/useTerminalContextActions";
@@ -113,6 +124,7 @@ interface TerminalProps {
   sessionId: string;
   startupCommand?: string;
   serialConfig?: SerialConfig;
+  tmuxPane?: TmuxPaneRef;
   onUpdateTerminalThemeId?: (themeId: string) => void;
   onUpdateTerminalFontFamilyId?: (fontFamilyId: string) => void;
   onUpdateTerminalFontSize?: (fontSize: number) => void;
@@ -135,6 +147,7 @@ interface TerminalProps {
   ) => void;
   onSplitHorizontal?: () => void;
   onSplitVertical?: () => void;
+  onAttachTmux?: () => void;
   isBroadcastEnabled?: boolean;
   onToggleBroadcast?: () => void;
   onBroadcastInput?: (data: string, sourceSessionId: string) => void;
@@ -172,6 +185,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
   sessionId,
   startupCommand,
   serialConfig,
+  tmuxPane,
   onUpdateTerminalThemeId,
   onUpdateTerminalFontFamilyId,
   onUpdateTerminalFontSize,
@@ -189,6 +203,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
   onCommandExecuted,
   onSplitHorizontal,
   onSplitVertical,
+  onAttachTmux,
   isBroadcastEnabled,
   onToggleBroadcast,
   onBroadcastInput,
@@ -201,6 +216,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
   const termRef = useRef<XTerm | null>(null);
   const fitAddonRef = useRef<FitAddon | null>(null);
   const serializeAddonRef = useRef<SerializeAddon | null>(null);
+  const synchronizedOutputRef = useRef<SynchronizedOutput | null>(null);
   const searchAddonRef = useRef<SearchAddon | null>(null);
   const xtermRuntimeRef = useRef<XTermRuntime | null>(null);
   const disposeDataRef = useRef<(() => void) | null>(null);
@@ -282,6 +298,9 @@ const TerminalComponent: React.FC<TerminalProps> = ({
   // Check if this is a local or serial connection (doesn't need connection dialog during connecting)
   const isLocalConnection = host.protocol === "local";
   const isSerialConnection = host.protocol === "serial";
+  // tmux control mode needs an exec channel on the tab's own SSH connection
+  const isSshHost = !isLocalConnection && !isSerialConnection && host.protocol !== "telnet"
+    && host.hostname !== "localhost" && !host.moshEnabled;
 
   // Server stats (CPU, Memory, Disk) for Linux servers
   const { stats: serverStats } = useServerStats({
@@ -362,6 +381,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
     termRef.current = null;
     fitAddonRef.current = null;
     serializeAddonRef.current = null;
+    synchronizedOutputRef.current = null;
     searchAddonRef.current = null;
   };
 
@@ -382,6 +402,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
     disposeExitRef,
     fitAddonRef,
     serializeAddonRef,
+    synchronizedOutputRef,
     pendingAuthRef,
     updateStatus,
     setStatus,
@@ -407,6 +428,11 @@ const TerminalComponent: React.FC<TerminalProps> = ({
     setShowLogs(false);
     setIsCancelling(false);
 
+    // Contribute this screen to the snapshot used by lazy restore
+    const unregisterScreenSource = registerScreenSource(sessionId, () =>
+      serializeAddonRef.current?.serialize({ scrollback: SCREEN_SNAPSHOT_SCROLLBACK }) ?? null,
+    );
+
     const boot = async () => {
       try {
         if (disposed || !containerRef.current) return;
@@ -440,11 +466,22 @@ const TerminalComponent: React.FC<TerminalProps> = ({
         termRef.current = runtime.term;
         fitAddonRef.current = runtime.fitAddon;
         serializeAddonRef.current = runtime.serializeAddon;
+        synchronizedOutputRef.current = runtime.synchronizedOutput;
         searchAddonRef.current = runtime.searchAddon;
 
         const term = runtime.term;
 
-        if (host.protocol === "serial") {
+        // A restored tab keeps showing what was on screen last time
+        const restoredScreen = takeRestoredScreen(sessionId);
+        if (restoredScreen) {
+          term.write(restoredScreen);
+          term.write(`\r\n\x1b[2m${t("terminal.restoredScreenMarker")}\x1b[0m\r\n`);
+        }
+
+        if (tmuxPane) {
+          setStatus("connecting");
+          await sessionStarters.startTmuxPane(term);
+        } else if (host.protocol === "serial") {
           setStatus("connecting");
           setProgressLogs(["Initializing serial connection..."]);
           await sessionStarters.startSerial(term);
@@ -492,6 +529,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
 
     return () => {
       disposed = true;
+      unregisterScreenSource();
       if (onTerminalDataCapture && serializeAddonRef.current) {
         try {
           const terminalData = serializeAddonRef.current.serialize();
@@ -588,20 +626,37 @@ const TerminalComponent: React.FC<TerminalProps> = ({
   };
 
   useEffect(() => {
-    if (termRef.current) {
-      const effectiveFontSize = host.fontSize || fontSize;
-      termRef.current.options.fontSize = effectiveFontSize;
+    terminalAppearanceScheduler.setVisible(sessionId, isVisible);
+  }, [sessionId, isVisible]);
 
-      termRef.current.options.theme = {
-        ...effectiveTheme.colors,
-        selectionBackground: effectiveTheme.colors.selection,
-      };
+  useEffect(() => {
+    return () => terminalAppearanceScheduler.unregister(sessionId);
+  }, [sessionId]);
+
+  // Theme/font/settings changes go through the appearance scheduler so that a
+  // global switch only rebuilds glyph atlases for visible terminals right away;
+  // hidden terminals pick up the latest appearance when revealed.
+  useEffect(() => {
+    if (!termRef.current) return;
+    let cancelled = false;
+
+    const effectiveFontSize = host.fontSize || fontSize;
+    const hostFontId = host.fontFamily || fontFamilyId || "menlo";
+    const fontObj = availableFonts.find((f) => f.id === hostFontId) || availableFonts[0];
+    const palette = getXTermThemePalette(effectiveTheme);
+
+    const applyAppearance = () => {
+      const term = termRef.current;
+      if (!term) return;
+      term.options.fontSize = effectiveFontSize;
+      term.options.fontFamily = fontObj.family;
+      term.options.theme = palette;
 
       if (terminalSettings) {
-        termRef.current.options.cursorStyle = terminalSettings.cursorShape;
-        termRef.current.options.cursorBlink = terminalSettings.cursorBlink;
-        termRef.current.options.scrollback = terminalSettings.scrollback;
-        termRef.current.options.fontWeight = terminalSettings.fontWeight as
+        term.options.cursorStyle = terminalSettings.cursorShape;
+        term.options.cursorBlink = terminalSettings.cursorBlink;
+        term.options.scrollback = terminalSettings.scrollback;
+        term.options.fontWeight = terminalSettings.fontWeight as
           | 100
           | 200
           | 300
@@ -612,17 +667,16 @@ const TerminalComponent: React.FC<TerminalProps> = ({
           | 800
           | 900;
         const resolvedFontWeightBold = (() => {
-          const fontFamily = termRef.current?.options.fontFamily || "";
           if (typeof document === "undefined" || !document.fonts?.check) {
             return terminalSettings.fontWeightBold;
           }
-          const weightSpec = `${terminalSettings.fontWeightBold} ${effectiveFontSize}px ${fontFamily}`;
+          const weightSpec = `${terminalSettings.fontWeightBold} ${effectiveFontSize}px ${fontObj.family}`;
           return document.fonts.check(weightSpec)
             ? terminalSettings.fontWeightBold
             : terminalSettings.fontWeight;
         })();
 
-        termRef.current.options.fontWeightBold = resolvedFontWeightBold as
+        term.options.fontWeightBold = resolvedFontWeightBold as
           | 100
           | 200
           | 300
@@ -632,37 +686,30 @@ const TerminalComponent: React.FC<TerminalProps> = ({
           | 700
           | 800
           | 900;
-        termRef.current.options.lineHeight = 1 + terminalSettings.linePadding / 10;
-        termRef.current.options.drawBoldTextInBrightColors =
+        term.options.lineHeight = 1 + terminalSettings.linePadding / 10;
+        term.options.drawBoldTextInBrightColors =
           terminalSettings.drawBoldInBrightColors;
-        termRef.current.options.minimumContrastRatio =
+        term.options.minimumContrastRatio =
           terminalSettings.minimumContrastRatio;
-        termRef.current.options.scrollOnUserInput = terminalSettings.scrollOnInput;
-        termRef.current.options.altClickMovesCursor = !terminalSettings.altAsMeta;
-        termRef.current.options.wordSeparator = terminalSettings.wordSeparators;
+        term.options.scrollOnUserInput = terminalSettings.scrollOnInput;
+        term.options.altClickMovesCursor = !terminalSettings.altAsMeta;
+        term.options.wordSeparator = terminalSettings.wordSeparators;
       }
 
       setTimeout(() => safeFit(), 50);
-    }
-  }, [fontSize, effectiveTheme, terminalSettings, host.fontSize]);
-
-  useEffect(() => {
-    if (termRef.current) {
-      const effectiveFontSize = host.fontSize || fontSize;
-      termRef.current.options.fontSize = effectiveFontSize;
-
-      const hostFontId = host.fontFamily || fontFamilyId || "menlo";
-      const fontObj = availableFonts.find((f) => f.id === hostFontId) || availableFonts[0];
-      termRef.current.options.fontFamily = fontObj.family;
+    };
 
-      termRef.current.options.theme = {
-        ...effectiveTheme.colors,
-        selectionBackground: effectiveTheme.colors.selection,
-      };
+    const weights = terminalSettings
+      ? [terminalSettings.fontWeight, terminalSettings.fontWeightBold]
+      : undefined;
+    void fontStore.warmFont(fontObj.family, effectiveFontSize, weights).then(() => {
+      if (!cancelled) terminalAppearanceScheduler.schedule(sessionId, applyAppearance);
+    });
 
-      setTimeout(() => safeFit(), 50);
-    }
-  }, [host.fontSize, host.fontFamily, host.theme, fontFamilyId, fontSize, effectiveTheme, availableFonts]);
+    return () => {
+      cancelled = true;
+    };
+  }, [sessionId, host.fontSize, host.fontFamily, fontFamilyId, fontSize, effectiveTheme, terminalSettings, availableFonts]);
 
   useEffect(() => {
     if (isVisible && fitAddonRef.current) {
@@ -839,7 +886,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
   const terminalContextActions = useTerminalContextActions({
     termRef,
     sessionRef,
-    terminalBackend,
+    terminalSettingsRef,
     onHasSelectionChange: setHasSelection,
   });
 
@@ -933,6 +980,12 @@ const TerminalComponent: React.FC<TerminalProps> = ({
 
   const handleRetry = () => {
     if (!termRef.current) return;
+    if (tmuxPane) {
+      // Closing the session would kill the pane on the server; just reattach
+      setError(null);
+      void sessionStarters.startTmuxPane(termRef.current);
+      return;
+    }
     cleanupSession();
     auth.resetForRetry();
     setStatus("connecting");
@@ -1003,7 +1056,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
         if (paths.length > 0 && termRef.current && sessionRef.current) {
           const pathsText = paths.join(' ');
           // Write the paths to the terminal
-          terminalBackend.writeToSession(sessionRef.current, pathsText);
+          void pasteToTerminal(termRef.current, sessionRef.current, pathsText, terminalSettingsRef.current);
           termRef.current.focus();
         }
       } else {
@@ -1038,6 +1091,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
   const renderControls = (opts?: { showClose?: boolean }) => (
     <TerminalToolbar
       status={status}
+      sessionId={sessionId}
       snippets={snippets}
       host={host}
       defaultThemeId={terminalTheme.id}
@@ -1080,6 +1134,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
       onSelectWord={terminalContextActions.onSelectWord}
       onSplitHorizontal={onSplitHorizontal}
       onSplitVertical={onSplitVertical}
+      onAttachTmux={onAttachTmux && !tmuxPane && status === "connected" && isSshHost ? onAttachTmux : undefined}
       onClose={inWorkspace ? () => onCloseSession?.(sessionId) : undefined}
     >
       <div 
@@ -1462,6 +1517,9 @@ const TerminalComponent: React.FC<TerminalProps> = ({
             }}
           />
 
+          <TerminalPasteProgress sessionId={sessionId} />
+          <TerminalInbandTransfers sessionId={sessionId} />
+
           {needsHostKeyVerification && pendingHostKeyInfo && (
             <div className="absolute inset-0 z-30 bg-background">
               <KnownHostConfirmDialog
@@ -1533,6 +1591,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
                 port: host.proxyConfig.port,
                 username: host.proxyConfig.username,
                 password: host.proxyConfig.password,
+                wan: host.proxyConfig.wan,
               }
               : undefined;
 
@@ -1579,6 +1638,7 @@ const TerminalComponent: React.FC<TerminalProps> = ({
               proxy: proxyConfig,
               jumpHosts: jumpHosts && jumpHosts.length > 0 ? jumpHosts : undefined,
               sftpSudo: host.sftpSudo,
+              sftpAtomicUpload: host.sftpAtomicUpload,
             };
           })()}
           open={showSFTP && status === "connected"}
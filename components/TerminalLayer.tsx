@@ -5,10 +5,12 @@ import { useTerminalBackend } from '../application/state/useTerminalBackend';
 import { collectSessionIds } from '../domain/workspace';
 import { SplitDirection } from '../domain/workspace';
 import { KeyBinding, TerminalSettings } from '../domain/models';
+import { withRenderProfiler } from '../lib/useRenderTracker';
 import { cn } from '../lib/utils';
 import { Host, Identity, KnownHost, SSHKey, Snippet, TerminalSession, TerminalTheme, Workspace, WorkspaceNode } from '../types';
 import { DistroAvatar } from './DistroAvatar';
 import Terminal from './Terminal';
+import { RestoredSessionPlaceholder } from './terminal/RestoredSessionPlaceholder';
 import { Button } from './ui/button';
 import { ScrollArea } from './ui/scroll-area';
 
@@ -63,11 +65,19 @@ interface TerminalLayerProps {
   onToggleWorkspaceViewMode?: (workspaceId: string) => void;
   onSetWorkspaceFocusedSession?: (workspaceId: string, sessionId: string) => void;
   onSplitSession?: (sessionId: string, direction: SplitDirection) => void;
+  onAttachTmux?: (sessionId: string) => void;
   // Broadcast mode
   isBroadcastEnabled?: (workspaceId: string) => boolean;
   onToggleBroadcast?: (workspaceId: string) => void;
+  // Lazy session restore
+  onActivateRestoredSession?: (sessionId: string) => void;
+  restoreInBackground?: boolean;
 }
 
+// Restored tabs connected in the background at once, and the gap between starts
+const BACKGROUND_RESTORE_CONCURRENCY = 2;
+const BACKGROUND_RESTORE_STAGGER_MS = 750;
+
 const TerminalLayerInner: React.FC<TerminalLayerProps> = ({
   hosts,
   keys,
@@ -101,8 +111,11 @@ const TerminalLayerInner: React.FC<TerminalLayerProps> = ({
   onToggleWorkspaceViewMode,
   onSetWorkspaceFocusedSession,
   onSplitSession,
+  onAttachTmux,
   isBroadcastEnabled,
   onToggleBroadcast,
+  onActivateRestoredSession,
+  restoreInBackground = false,
 }) => {
   // Subscribe to activeTabId from external store
   const activeTabId = useActiveTabId();
@@ -139,6 +152,10 @@ const TerminalLayerInner: React.FC<TerminalLayerProps> = ({
     onCommandExecuted?.(command, hostId, hostLabel, sessionId);
   }, [onCommandExecuted]);
 
+  const handleActivateRestoredSession = useCallback((sessionId: string) => {
+    onActivateRestoredSession?.(sessionId);
+  }, [onActivateRestoredSession]);
+
   const handleTerminalDataCapture = useCallback((sessionId: string, data: string) => {
     onTerminalDataCapture?.(sessionId, data);
   }, [onTerminalDataCapture]);
@@ -220,6 +237,47 @@ const TerminalLayerInner: React.FC<TerminalLayerProps> = ({
     return map;
   }, [sessions, hostMap]);
 
+  // Local and serial sessions carry their own connection settings; the rest need their vault host
+  const canConnectRestored = useCallback((session: TerminalSession) =>
+    hostMap.has(session.hostId) || session.hostId.startsWith('local-') || session.hostId.startsWith('serial-'),
+  [hostMap]);
+
+  // Restored tabs connect once they are shown
+  const visibleSessionIds = useMemo(() => {
+    if (!isVisible) return [] as string[];
+    if (activeWorkspace) {
+      if (activeWorkspace.viewMode !== 'focus') return collectSessionIds(activeWorkspace.root);
+      return activeWorkspace.focusedSessionId ? [activeWorkspace.focusedSessionId] : [];
+    }
+    return activeSession ? [activeSession.id] : [];
+  }, [isVisible, activeWorkspace, activeSession]);
+
+  useEffect(() => {
+    if (!onActivateRestoredSession) return;
+    for (const id of visibleSessionIds) {
+      const session = sessions.find(s => s.id === id);
+      if (session?.restorePending && canConnectRestored(session)) onActivateRestoredSession(id);
+    }
+  }, [visibleSessionIds, sessions, canConnectRestored, onActivateRestoredSession]);
+
+  // Optionally connect the remaining restored tabs a few at a time
+  const backgroundRestoredRef = useRef(new Set<string>());
+  useEffect(() => {
+    if (!restoreInBackground || !onActivateRestoredSession) return;
+    const inFlight = sessions.filter(s => backgroundRestoredRef.current.has(s.id) && s.status === 'connecting').length;
+    const slots = BACKGROUND_RESTORE_CONCURRENCY - inFlight;
+    if (slots <= 0) return;
+    const next = sessions.filter(s => s.restorePending && canConnectRestored(s)).slice(0, slots);
+    if (next.length === 0) return;
+    const timer = setTimeout(() => {
+      for (const session of next) {
+        backgroundRestoredRef.current.add(session.id);
+        onActivateRestoredSession(session.id);
+      }
+    }, BACKGROUND_RESTORE_STAGGER_MS);
+    return () => clearTimeout(timer);
+  }, [restoreInBackground, sessions, canConnectRestored, onActivateRestoredSession]);
+
   const computeWorkspaceRects = useCallback((workspace?: Workspace, size?: { width: number; height: number }): Record<string, WorkspaceRect> => {
     if (!workspace) return {} as Record<string, WorkspaceRect>;
     const wTotal = size?.width || 1;
@@ -665,6 +723,17 @@ const TerminalLayerInner: React.FC<TerminalLayerProps> = ({
                 }
               }}
             >
+              {session.restorePending ? (
+                <RestoredSessionPlaceholder
+                  sessionId={session.id}
+                  host={host}
+                  terminalTheme={terminalTheme}
+                  fontFamilyId={terminalFontFamilyId}
+                  fontSize={fontSize}
+                  canConnect={canConnectRestored(session)}
+                  onConnect={handleActivateRestoredSession}
+                />
+              ) : (
               <Terminal
                 host={host}
                 keys={keys}
@@ -684,6 +753,7 @@ const TerminalLayerInner: React.FC<TerminalLayerProps> = ({
                 sessionId={session.id}
                 startupCommand={session.startupCommand}
                 serialConfig={session.serialConfig}
+                tmuxPane={session.tmux}
                 onUpdateTerminalThemeId={onUpdateTerminalThemeId}
                 onUpdateTerminalFontFamilyId={onUpdateTerminalFontFamilyId}
                 onUpdateTerminalFontSize={onUpdateTerminalFontSize}
@@ -701,10 +771,12 @@ const TerminalLayerInner: React.FC<TerminalLayerProps> = ({
                 onExpandToFocus={inActiveWorkspace && !isFocusMode && activeWorkspace ? () => onToggleWorkspaceViewMode?.(activeWorkspace.id) : undefined}
                 onSplitHorizontal={onSplitSession ? () => onSplitSession(session.id, 'horizontal') : undefined}
                 onSplitVertical={onSplitSession ? () => onSplitSession(session.id, 'vertical') : undefined}
+                onAttachTmux={onAttachTmux ? () => onAttachTmux(session.id) : undefined}
                 isBroadcastEnabled={inActiveWorkspace && activeWorkspace ? isBroadcastEnabled?.(activeWorkspace.id) : false}
                 onToggleBroadcast={inActiveWorkspace && activeWorkspace ? () => onToggleBroadcast?.(activeWorkspace.id) : undefined}
                 onBroadcastInput={inActiveWorkspace && activeWorkspace && isBroadcastEnabled?.(activeWorkspace.id) ? handleBroadcastInput : undefined}
               />
+              )}
             </div>
           );
         })}
@@ -783,9 +855,12 @@ const terminalLayerAreEqual = (prev: TerminalLayerProps, next: TerminalLayerProp
     prev.onUpdateHost === next.onUpdateHost &&
     prev.onToggleWorkspaceViewMode === next.onToggleWorkspaceViewMode &&
     prev.onSetWorkspaceFocusedSession === next.onSetWorkspaceFocusedSession &&
-    prev.onSplitSession === next.onSplitSession
+    prev.onSplitSession === next.onSplitSession &&
+    prev.onAttachTmux === next.onAttachTmux &&
+    prev.onActivateRestoredSession === next.onActivateRestoredSession &&
+    prev.restoreInBackground === next.restoreInBackground
   );
 };
 
-export const TerminalLayer = memo(TerminalLayerInner, terminalLayerAreEqual);
+export const TerminalLayer = memo(withRenderProfiler("TerminalLayer", TerminalLayerInner), terminalLayerAreEqual);
 TerminalLayer.displayName = 'TerminalLayer';
@@ -7,17 +7,12 @@ import {
   Search,
   X,
 } from 'lucide-react';
-import Editor, { type OnMount, loader, useMonaco } from '@monaco-editor/react';
+import Editor, { type OnMount, useMonaco } from '@monaco-editor/react';
 import type * as Monaco from 'monaco-editor';
 import React, { useCallback, useEffect, useMemo, useRef, useState } from 'react';
 
-// Configure Monaco to use local files instead of CDN
-const monacoBasePath = import.meta.env.DEV
-  ? './node_modules/monaco-editor/min/vs'
-  : `${import.meta.env.BASE_URL}monaco/vs`;
-loader.config({ paths: { vs: monacoBasePath } });
-
 import { useI18n } from '../application/i18n/I18nProvider';
+import { getLargeContentEditorOptions, loadMonaco, profileEditorContent } from '../lib/monacoLoader';
 import { getLanguageId, getLanguageName, getSupportedLanguages } from '../lib/sftpFileUtils';
 import { Button } from './ui/button';
 import { Dialog, DialogContent, DialogHeader, DialogTitle } from './ui/dialog';
@@ -135,11 +130,24 @@ export const TextEditorModal: React.FC<TextEditorModalProps> = ({
 }) => {
   const { t } = useI18n();
   const monaco = useMonaco();
-  const [content, setContent] = useState(initialContent);
   const [saving, setSaving] = useState(false);
   const [hasChanges, setHasChanges] = useState(false);
-  const [languageId, setLanguageId] = useState(() => getLanguageId(fileName));
+  const [stats, setStats] = useState({ lines: 0, characters: 0 });
+  const contentProfile = useMemo(() => profileEditorContent(initialContent), [initialContent]);
+  // Large documents open as plain text: no tokenization and no language-worker
+  // round trips for the whole buffer. Picking a language still applies it.
+  const defaultLanguageId = contentProfile.isLarge ? 'plaintext' : getLanguageId(fileName);
+  const [languageId, setLanguageId] = useState(defaultLanguageId);
   const editorRef = useRef<Monaco.editor.IStandaloneCodeEditor | null>(null);
+  // Model version at the last load/save; avoids copying the whole document
+  // into React state on every keystroke just to detect changes.
+  const savedVersionIdRef = useRef<number | null>(null);
+  const statsFrameRef = useRef<number | null>(null);
+
+  // Make sure Monaco loads even if idle prewarm has not run yet
+  useEffect(() => {
+    if (open) loadMonaco().catch(() => undefined);
+  }, [open]);
 
   // Ref to store the latest save function to avoid stale closure in keyboard shortcut
   const handleSaveRef = useRef<() => Promise<void>>(() => Promise.resolve());
@@ -195,24 +203,48 @@ export const TextEditorModal: React.FC<TextEditorModalProps> = ({
     return () => observer.disconnect();
   }, []);
 
-  // Reset content when file changes
+  const updateStats = useCallback(() => {
+    statsFrameRef.current = null;
+    const model = editorRef.current?.getModel();
+    if (!model) return;
+    setStats({ lines: model.getLineCount(), characters: model.getValueLength() });
+  }, []);
+
+  const scheduleStatsUpdate = useCallback(() => {
+    if (statsFrameRef.current !== null) return;
+    statsFrameRef.current = requestAnimationFrame(updateStats);
+  }, [updateStats]);
+
   useEffect(() => {
-    setContent(initialContent);
-    setHasChanges(false);
-    setLanguageId(getLanguageId(fileName));
-  }, [initialContent, fileName]);
+    return () => {
+      if (statsFrameRef.current !== null) cancelAnimationFrame(statsFrameRef.current);
+    };
+  }, []);
 
-  // Track changes
+  // Reset content when file changes
   useEffect(() => {
-    setHasChanges(content !== initialContent);
-  }, [content, initialContent]);
+    setLanguageId(defaultLanguageId);
+    const editor = editorRef.current;
+    const model = editor?.getModel();
+    if (editor && model && model.getValue() !== initialContent) {
+      editor.setValue(initialContent);
+    }
+    // setValue fires the change listener against the old saved version, so
+    // record the new one and clear the modified flag only afterwards
+    savedVersionIdRef.current = model ? model.getAlternativeVersionId() : null;
+    setHasChanges(false);
+    scheduleStatsUpdate();
+  }, [initialContent, defaultLanguageId, scheduleStatsUpdate]);
 
   const handleSave = useCallback(async () => {
-    if (saving) return;
+    const editor = editorRef.current;
+    if (saving || !editor) return;
     setSaving(true);
     try {
-      await onSave(content);
-      setHasChanges(false);
+      const versionId = editor.getModel()?.getAlternativeVersionId() ?? null;
+      await onSave(editor.getValue());
+      savedVersionIdRef.current = versionId;
+      setHasChanges(editor.getModel()?.getAlternativeVersionId() !== versionId);
       toast.success(t('sftp.editor.saved'), 'SFTP');
     } catch (e) {
       toast.error(
@@ -222,7 +254,7 @@ export const TextEditorModal: React.FC<TextEditorModalProps> = ({
     } finally {
       setSaving(false);
     }
-  }, [content, onSave, saving, t]);
+  }, [onSave, saving, t]);
 
   // Keep the ref updated with the latest handleSave function
   useEffect(() => {
@@ -237,12 +269,23 @@ export const TextEditorModal: React.FC<TextEditorModalProps> = ({
     onClose();
   }, [hasChanges, onClose, t]);
 
-  const handleEditorChange = useCallback((value: string | undefined) => {
-    setContent(value || '');
-  }, []);
-
   const handleEditorMount: OnMount = useCallback((editor, monaco) => {
     editorRef.current = editor;
+    savedVersionIdRef.current = editor.getModel()?.getAlternativeVersionId() ?? null;
+    scheduleStatsUpdate();
+
+    // The editor unmounts with the dialog; don't keep saving into a disposed instance
+    editor.onDidDispose(() => {
+      if (editorRef.current !== editor) return;
+      editorRef.current = null;
+      savedVersionIdRef.current = null;
+    });
+
+    editor.onDidChangeModelContent(() => {
+      const versionId = editor.getModel()?.getAlternativeVersionId() ?? null;
+      setHasChanges(versionId !== savedVersionIdRef.current);
+      scheduleStatsUpdate();
+    });
 
     // Add save shortcut - use ref to avoid stale closure
     editor.addCommand(monaco.KeyMod.CtrlCmd | monaco.KeyCode.KeyS, () => {
@@ -254,7 +297,7 @@ export const TextEditorModal: React.FC<TextEditorModalProps> = ({
       // Trigger Monaco's built-in find widget
       editor.trigger('keyboard', 'actions.find', null);
     });
-  }, []);
+  }, [scheduleStatsUpdate]);
 
   // Trigger search dialog
   const handleSearch = useCallback(() => {
@@ -266,6 +309,10 @@ export const TextEditorModal: React.FC<TextEditorModalProps> = ({
 
   const supportedLanguages = useMemo(() => getSupportedLanguages(), []);
   const monacoLanguage = useMemo(() => languageIdToMonaco(languageId), [languageId]);
+  const largeContentOptions = useMemo(
+    () => getLargeContentEditorOptions(contentProfile),
+    [contentProfile],
+  );
   const languageOptions = useMemo(
     () => supportedLanguages.map((lang) => ({ value: lang.id, label: lang.name })),
     [supportedLanguages],
@@ -342,8 +389,7 @@ export const TextEditorModal: React.FC<TextEditorModalProps> = ({
           <Editor
             height="100%"
             language={monacoLanguage}
-            value={content}
-            onChange={handleEditorChange}
+            defaultValue={initialContent}
             onMount={handleEditorMount}
             theme={customThemeName}
             loading={
@@ -369,6 +415,7 @@ export const TextEditorModal: React.FC<TextEditorModalProps> = ({
                 autoFindInSelection: 'never',
                 seedSearchStringFromSelection: 'selection',
               },
+              ...largeContentOptions,
             }}
           />
         </div>
@@ -379,7 +426,7 @@ export const TextEditorModal: React.FC<TextEditorModalProps> = ({
             {getLanguageName(languageId)}
           </span>
           <span>
-            {content.split('\n').length} lines • {content.length} characters
+            {stats.lines} lines • {stats.characters} characters
           </span>
         </div>
       </DialogContent>
@@ -4,11 +4,13 @@ import { activeTabStore, useActiveTabId } from '../application/state/activeTabSt
 import { LogView } from '../application/state/useSessionState';
 import { useWindowControls } from '../application/state/useWindowControls';
 import { useI18n } from '../application/i18n/I18nProvider';
+import { withRenderProfiler } from '../lib/useRenderTracker';
 import { cn } from '../lib/utils';
 import { TerminalSession, Workspace } from '../types';
 import { Button } from './ui/button';
 import { ContextMenu, ContextMenuContent, ContextMenuItem, ContextMenuTrigger } from './ui/context-menu';
 import { SyncStatusButton } from './SyncStatusButton';
+import { SessionTrafficBadge, WorkspaceTrafficBadge } from './terminal/SessionTrafficIndicator';
 
 // Helper styles for Electron drag regions (use type assertion to include non-standard WebkitAppRegion)
 const dragRegionStyle = { WebkitAppRegion: 'drag' } as React.CSSProperties;
@@ -38,12 +40,16 @@ interface TopTabsProps {
   onReorderTabs: (draggedId: string, targetId: string, position: 'before' | 'after') => void;
 }
 
-const sessionStatusDot = (status: TerminalSession['status']) => {
-  const tone = status === 'connected'
-    ? "bg-emerald-400"
-    : status === 'connecting'
-      ? "bg-amber-400"
-      : "bg-rose-500";
+const sessionStatusDot = (session: TerminalSession) => {
+  const { status } = session;
+  // Restored tabs that have not connected yet are idle, not failed
+  const tone = session.restorePending
+    ? "bg-muted-foreground/50"
+    : status === 'connected'
+      ? "bg-emerald-400"
+      : status === 'connecting'
+        ? "bg-amber-400"
+        : "bg-rose-500";
   return <span className={cn("inline-block h-2 w-2 rounded-full ring-2 ring-background/60", tone)} />;
 };
 
@@ -397,7 +403,8 @@ const TopTabsInner: React.FC<TopTabsProps> = ({
                 <div className="flex items-center gap-2 min-w-0 flex-1">
                   <TerminalSquare size={14} className={cn("shrink-0", activeTabId === session.id ? "text-accent" : "text-muted-foreground")} />
                   <span className="truncate">{session.hostLabel}</span>
-                  <div className="flex-shrink-0">{sessionStatusDot(session.status)}</div>
+                  <SessionTrafficBadge sessionId={session.id} />
+                  <div className="flex-shrink-0">{sessionStatusDot(session)}</div>
                 </div>
                 <button
                   onClick={(e) => onCloseSession(session.id, e)}
@@ -467,6 +474,7 @@ const TopTabsInner: React.FC<TopTabsProps> = ({
                   <LayoutGrid size={14} className={cn("shrink-0", isActive ? "text-primary" : "text-muted-foreground")} />
                   <span className="truncate">{workspace.title}</span>
                 </div>
+                <WorkspaceTrafficBadge root={workspace.root} />
                 <div className="text-[10px] px-1.5 py-0.5 rounded-full border border-border/70 bg-background/60 min-w-[22px] text-center">
                   {paneCount}
                 </div>
@@ -676,5 +684,5 @@ const topTabsAreEqual = (prev: TopTabsProps, next: TopTabsProps): boolean => {
   );
 };
 
-export const TopTabs = memo(TopTabsInner, topTabsAreEqual);
+export const TopTabs = memo(withRenderProfiler("TopTabs", TopTabsInner), topTabsAreEqual);
 TopTabs.displayName = 'TopTabs';
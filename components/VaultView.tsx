@@ -19,6 +19,7 @@ import {
   Plus,
   Search,
   Settings,
+  ShieldCheck,
   Square,
   TerminalSquare,
   Trash2,
@@ -29,12 +30,14 @@ import {
 } from "lucide-react";
 import React, { Suspense, lazy, memo, useCallback, useEffect, useMemo, useState } from "react";
 import { useI18n } from "../application/i18n/I18nProvider";
+import { reachabilityStore, useReachabilityScanning } from "../application/state/reachabilityStore";
 import { useStoredViewMode } from "../application/state/useStoredViewMode";
 import { useTreeExpandedState } from "../application/state/useTreeExpandedState";
 import { sanitizeHost } from "../domain/host";
 import { importVaultHostsFromText, exportHostsToCsvWithStats } from "../domain/vaultImport";
 import type { VaultImportFormat } from "../domain/vaultImport";
 import { STORAGE_KEY_VAULT_HOSTS_VIEW_MODE, STORAGE_KEY_VAULT_HOSTS_TREE_EXPANDED } from "../infrastructure/config/storageKeys";
+import { withRenderProfiler } from "../lib/useRenderTracker";
 import { cn } from "../lib/utils";
 import {
   ConnectionLog,
@@ -58,6 +61,7 @@ import KeychainManager from "./KeychainManager";
 import KnownHostsManager from "./KnownHostsManager";
 import PortForwarding from "./PortForwardingNew";
 import QuickConnectWizard from "./QuickConnectWizard";
+import { HostReachabilityDot } from "./vault/HostReachabilityDot";
 import { isQuickConnectInput, parseQuickConnectInputWithWarnings } from "../domain/quickConnect";
 import SerialConnectModal from "./SerialConnectModal";
 import SerialHostDetailsPanel from "./SerialHostDetailsPanel";
@@ -934,6 +938,24 @@ const VaultViewInner: React.FC<VaultViewProps> = ({
     // eslint-disable-next-line react-hooks/exhaustive-deps -- findGroupNode is derived from buildGroupTree
   }, [buildGroupTree, selectedGroupPath, customGroups]);
 
+  // Reachability scan - results stream in from the main process
+  const isReachabilityScanning = useReachabilityScanning();
+  const [isReachabilityMenuOpen, setIsReachabilityMenuOpen] = useState(false);
+
+  useEffect(() => {
+    reachabilityStore.initialize();
+  }, []);
+
+  // Host-key checks need an extra handshake per host, so they are a separate choice
+  const handleReachabilityScan = useCallback((verifyHostKeys: boolean) => {
+    setIsReachabilityMenuOpen(false);
+    reachabilityStore
+      .scanHosts(hosts, { keys, identities, knownHosts, verifyHostKeys })
+      .catch((err) => {
+        toast.error(err instanceof Error ? err.message : String(err), t("vault.reachability.scan"));
+      });
+  }, [hosts, keys, identities, knownHosts, t]);
+
   // Known Hosts callbacks - use refs to keep stable references
   // Store latest values in refs so callbacks don't need to depend on them
   const knownHostsRef = React.useRef(knownHosts);
@@ -1411,6 +1433,46 @@ const VaultViewInner: React.FC<VaultViewProps> = ({
                   onChange={setSortMode}
                   className="h-10 w-10"
                 />
+                {isReachabilityScanning ? (
+                  <Button
+                    variant="secondary"
+                    size="icon"
+                    className="h-10 w-10"
+                    onClick={() => void reachabilityStore.cancelScan()}
+                    title={t("vault.reachability.cancelScan")}
+                  >
+                    <Activity size={16} className="animate-pulse" />
+                  </Button>
+                ) : (
+                  <Dropdown open={isReachabilityMenuOpen} onOpenChange={setIsReachabilityMenuOpen}>
+                    <DropdownTrigger asChild>
+                      <Button
+                        variant="ghost"
+                        size="icon"
+                        className="h-10 w-10"
+                        title={t("vault.reachability.scan")}
+                      >
+                        <Activity size={16} />
+                      </Button>
+                    </DropdownTrigger>
+                    <DropdownContent className="w-56" align="end">
+                      <Button
+                        variant="ghost"
+                        className="w-full justify-start gap-2 h-9"
+                        onClick={() => handleReachabilityScan(false)}
+                      >
+                        <Activity size={14} /> {t("vault.reachability.scan")}
+                      </Button>
+                      <Button
+                        variant="ghost"
+                        className="w-full justify-start gap-2 h-9"
+                        onClick={() => handleReachabilityScan(true)}
+                      >
+                        <ShieldCheck size={14} /> {t("vault.reachability.scanWithKeys")}
+                      </Button>
+                    </DropdownContent>
+                  </Dropdown>
+                )}
                 <Button
                   variant={isMultiSelectMode ? "secondary" : "ghost"}
                   size="icon"
@@ -1848,6 +1910,7 @@ const VaultViewInner: React.FC<VaultViewProps> = ({
                                               <span className="text-sm font-semibold truncate leading-5">
                                                 {safeHost.label}
                                               </span>
+                                              <HostReachabilityDot hostId={host.id} />
                                               {safeHost.managedSourceId && (
                                                 <Badge variant="secondary" className="text-[10px] px-1.5 py-0 h-4 shrink-0">
                                                   managed
@@ -1987,6 +2050,7 @@ const VaultViewInner: React.FC<VaultViewProps> = ({
                                         <span className="text-sm font-semibold truncate leading-5">
                                           {safeHost.label}
                                         </span>
+                                        <HostReachabilityDot hostId={host.id} />
                                         {safeHost.managedSourceId && (
                                           <Badge variant="secondary" className="text-[10px] px-1.5 py-0 h-4 shrink-0">
                                             managed
@@ -2468,7 +2532,7 @@ const vaultViewAreEqual = (
   return isEqual;
 };
 
-const MemoizedVaultViewInner = memo(VaultViewInner, vaultViewAreEqual);
+const MemoizedVaultViewInner = memo(withRenderProfiler("VaultView", VaultViewInner), vaultViewAreEqual);
 
 // Just export the memoized component directly
 // Visibility control is handled by parent (App.tsx)
@@ -1,12 +1,13 @@
 /**
  * Proxy Configuration Sub-Panel
- * Panel for configuring HTTP/SOCKS5 proxy settings
+ * Panel for configuring HTTP/SOCKS5 proxy settings, or the local WAN
+ * emulation test proxy
  */
 import { Check,Trash2 } from 'lucide-react';
 import React from 'react';
 import { useI18n } from '../../application/i18n/I18nProvider';
 import { cn } from '../../lib/utils';
-import { ProxyConfig } from '../../types';
+import { ProxyConfig, WanEmulationConfig } from '../../types';
 import { AsidePanel,AsidePanelContent } from '../ui/aside-panel';
 import { Badge } from '../ui/badge';
 import { Button } from '../ui/button';
@@ -16,6 +17,7 @@ import { Input } from '../ui/input';
 export interface ProxyPanelProps {
     proxyConfig?: ProxyConfig;
     onUpdateProxy: (field: keyof ProxyConfig, value: string | number) => void;
+    onUpdateWan: (field: keyof WanEmulationConfig, value: number) => void;
     onClearProxy: () => void;
     onBack: () => void;
     onCancel: () => void;
@@ -24,11 +26,20 @@ export interface ProxyPanelProps {
 export const ProxyPanel: React.FC<ProxyPanelProps> = ({
     proxyConfig,
     onUpdateProxy,
+    onUpdateWan,
     onClearProxy,
     onBack,
     onCancel,
 }) => {
     const { t } = useI18n();
+    const isWan = proxyConfig?.type === 'wan';
+    const isConfigured = isWan || !!proxyConfig?.host;
+    const wanFields: { field: keyof WanEmulationConfig; label: string; placeholder: string }[] = [
+        { field: 'latencyMs', label: t('hostDetails.proxyPanel.wan.latency'), placeholder: '200' },
+        { field: 'jitterMs', label: t('hostDetails.proxyPanel.wan.jitter'), placeholder: '0' },
+        { field: 'bandwidthKbps', label: t('hostDetails.proxyPanel.wan.bandwidth'), placeholder: '0' },
+        { field: 'lossPercent', label: t('hostDetails.proxyPanel.wan.loss'), placeholder: '0' },
+    ];
     return (
         <AsidePanel
             open={true}
@@ -37,7 +48,7 @@ export const ProxyPanel: React.FC<ProxyPanelProps> = ({
             showBackButton={true}
             onBack={onBack}
             actions={
-                <Button size="sm" onClick={onBack} disabled={!proxyConfig?.host}>
+                <Button size="sm" onClick={onBack} disabled={!isConfigured}>
                     {t('common.save')}
                 </Button>
             }
@@ -65,53 +76,87 @@ export const ProxyPanel: React.FC<ProxyPanelProps> = ({
                                 <Check size={14} className={cn("mr-1", proxyConfig?.type !== 'socks5' && "opacity-0")} />
                                 SOCKS5
                             </Button>
+                            <Button
+                                variant={isWan ? "secondary" : "ghost"}
+                                size="sm"
+                                className={cn("h-8", isWan && "bg-primary/15")}
+                                onClick={() => onUpdateProxy('type', 'wan')}
+                            >
+                                <Check size={14} className={cn("mr-1", !isWan && "opacity-0")} />
+                                WAN
+                            </Button>
                         </div>
                     </div>
 
-                    <div className="flex gap-2">
-                        <Input
-                            placeholder={t('hostDetails.proxyPanel.hostPlaceholder')}
-                            value={proxyConfig?.host || ""}
-                            onChange={(e) => onUpdateProxy('host', e.target.value)}
-                            className="h-10 flex-1"
-                        />
-                        <div className="flex items-center gap-1">
-                            <span className="text-xs text-muted-foreground">{t('hostDetails.port')}</span>
+                    {isWan && (
+                        <p className="text-xs text-muted-foreground">{t('hostDetails.proxyPanel.wan.desc')}</p>
+                    )}
+
+                    {!isWan && (
+                        <div className="flex gap-2">
                             <Input
-                                type="number"
-                                placeholder="3128"
-                                value={proxyConfig?.port || ""}
-                                onChange={(e) => onUpdateProxy('port', parseInt(e.target.value) || 0)}
-                                className="h-10 w-20 text-center"
+                                placeholder={t('hostDetails.proxyPanel.hostPlaceholder')}
+                                value={proxyConfig?.host || ""}
+                                onChange={(e) => onUpdateProxy('host', e.target.value)}
+                                className="h-10 flex-1"
                             />
+                            <div className="flex items-center gap-1">
+                                <span className="text-xs text-muted-foreground">{t('hostDetails.port')}</span>
+                                <Input
+                                    type="number"
+                                    placeholder="3128"
+                                    value={proxyConfig?.port || ""}
+                                    onChange={(e) => onUpdateProxy('port', parseInt(e.target.value) || 0)}
+                                    className="h-10 w-20 text-center"
+                                />
+                            </div>
                         </div>
-                    </div>
+                    )}
                 </Card>
 
-                <Card className="p-3 space-y-3 bg-card border-border/80">
-                    <div className="flex items-center justify-between">
-                        <p className="text-xs font-semibold">{t('hostDetails.proxyPanel.credentials')}</p>
-                        <Badge variant="secondary" className="text-xs">{t('common.optional')}</Badge>
-                    </div>
-                    <Input
-                        placeholder={t('hostDetails.proxyPanel.usernamePlaceholder')}
-                        value={proxyConfig?.username || ""}
-                        onChange={(e) => onUpdateProxy('username', e.target.value)}
-                        className="h-10"
-                    />
-                    <Input
-                        placeholder={t('hostDetails.proxyPanel.passwordPlaceholder')}
-                        type="password"
-                        value={proxyConfig?.password || ""}
-                        onChange={(e) => onUpdateProxy('password', e.target.value)}
-                        className="h-10"
-                    />
-                    <Button variant="ghost" size="sm" className="text-primary" onClick={() => { }}>
-                        {t('hostDetails.proxyPanel.identities')}
-                    </Button>
-                </Card>
+                {isWan ? (
+                    <Card className="p-3 space-y-3 bg-card border-border/80">
+                        <p className="text-xs font-semibold">{t('hostDetails.proxyPanel.wan.title')}</p>
+                        {wanFields.map(({ field, label, placeholder }) => (
+                            <div key={field} className="flex items-center justify-between gap-2">
+                                <span className="text-xs text-muted-foreground">{label}</span>
+                                <Input
+                                    type="number"
+                                    min={0}
+                                    placeholder={placeholder}
+                                    value={proxyConfig?.wan?.[field] ?? ""}
+                                    onChange={(e) => onUpdateWan(field, Math.max(0, Number(e.target.value) || 0))}
+                                    className="h-9 w-24 text-center"
+                                />
+                            </div>
+                        ))}
+                    </Card>
+                ) : (
+                    <Card className="p-3 space-y-3 bg-card border-border/80">
+                        <div className="flex items-center justify-between">
+                            <p className="text-xs font-semibold">{t('hostDetails.proxyPanel.credentials')}</p>
+                            <Badge variant="secondary" className="text-xs">{t('common.optional')}</Badge>
+                        </div>
+                        <Input
+                            placeholder={t('hostDetails.proxyPanel.usernamePlaceholder')}
+                            value={proxyConfig?.username || ""}
+                            onChange={(e) => onUpdateProxy('username', e.target.value)}
+                            className="h-10"
+                        />
+                        <Input
+                            placeholder={t('hostDetails.proxyPanel.passwordPlaceholder')}
+                            type="password"
+                            value={proxyConfig?.password || ""}
+                            onChange={(e) => onUpdateProxy('password', e.target.value)}
+                            className="h-10"
+                        />
+                        <Button variant="ghost" size="sm" className="text-primary" onClick={() => { }}>
+                            {t('hostDetails.proxyPanel.identities')}
+                        </Button>
+                    </Card>
+                )}
 
-                {proxyConfig?.host && (
+                {isConfigured && (
                     <Button variant="ghost" className="w-full h-10 text-destructive" onClick={onClearProxy}>
                         <Trash2 size={14} className="mr-2" /> {t('hostDetails.proxyPanel.remove')}
                     </Button>
@@ -154,6 +154,20 @@ export const EditPanel: React.FC<EditPanelProps> = ({
                     </>
                 )}
 
+                {/* On Demand Toggle (a remote listener needs the connection up front) */}
+                {draft.type !== 'remote' && (
+                    <div className="flex items-center justify-between py-2">
+                        <div className="space-y-0.5">
+                            <Label className="text-sm font-medium">{t('pf.form.onDemand')}</Label>
+                            <p className="text-[10px] text-muted-foreground">{t('pf.form.onDemandDesc')}</p>
+                        </div>
+                        <Switch
+                            checked={draft.onDemand ?? false}
+                            onCheckedChange={checked => onDraftChange({ onDemand: checked })}
+                        />
+                    </div>
+                )}
+
                 {/* Auto Start Toggle */}
                 <div className="flex items-center justify-between py-2">
                     <div className="space-y-0.5">
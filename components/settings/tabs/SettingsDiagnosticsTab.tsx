@@ -0,0 +1,414 @@
+/**
+ * Settings Diagnostics Tab - IPC statistics, log levels and diagnostics bundles
+ */
+import { Activity, Download, FileText, Gauge, Package, RefreshCw, RotateCcw } from "lucide-react";
+import React, { useCallback, useEffect, useMemo, useState, useSyncExternalStore } from "react";
+import { useI18n } from "../../../application/i18n/I18nProvider";
+import { netcattyBridge } from "../../../infrastructure/services/netcattyBridge";
+import { createLogger, getRecentLogs } from "../../../lib/logger";
+import { isRenderProfilerEnabled, renderProfilerStore } from "../../../lib/renderProfiler";
+import { cn } from "../../../lib/utils";
+import { TabsContent } from "../../ui/tabs";
+import { Button } from "../../ui/button";
+import { Input } from "../../ui/input";
+import { Select, SettingRow, Toggle } from "../settings-ui";
+
+const log = createLogger("Diagnostics");
+
+const REFRESH_INTERVAL_MS = 2000;
+const RECENT_LOG_LINES = 200;
+
+type SortKey = "total" | "calls" | "p99" | "max" | "response";
+
+const sortValue = (stats: IpcChannelStats, key: SortKey): number => {
+  switch (key) {
+    case "calls":
+      return stats.calls;
+    case "p99":
+      return stats.latency.p99Ms;
+    case "max":
+      return stats.latency.maxMs;
+    case "response":
+      return stats.response.maxBytes;
+    default:
+      return stats.latency.totalMs;
+  }
+};
+
+function formatBytes(bytes: number): string {
+  if (bytes < 1024) return `${bytes} B`;
+  if (bytes < 1048576) return `${(bytes / 1024).toFixed(1)} KB`;
+  return `${(bytes / 1048576).toFixed(1)} MB`;
+}
+
+function formatLogLine(entry: LogEntry): string {
+  const time = new Date(entry.time).toLocaleTimeString();
+  const source = entry.source === "renderer" ? "R" : "M";
+  return `${time} ${source} ${entry.level.toUpperCase().padEnd(5)} [${entry.category}] ${entry.message}`;
+}
+
+// Renderer-side counters for the diagnostics bundle
+function collectRendererPerf(): Record<string, unknown> {
+  const memory = (performance as Performance & {
+    memory?: { usedJSHeapSize: number; totalJSHeapSize: number; jsHeapSizeLimit: number };
+  }).memory;
+  return {
+    uptimeMs: Math.round(performance.now()),
+    memory: memory
+      ? { usedJSHeapSize: memory.usedJSHeapSize, totalJSHeapSize: memory.totalJSHeapSize, jsHeapSizeLimit: memory.jsHeapSizeLimit }
+      : null,
+    domNodes: document.getElementsByTagName("*").length,
+    hardwareConcurrency: navigator.hardwareConcurrency,
+    userAgent: navigator.userAgent,
+  };
+}
+
+function formatMs(ms: number): string {
+  if (ms === 0) return "-";
+  if (ms < 1) return `${(ms * 1000).toFixed(0)} µs`;
+  if (ms < 1000) return `${ms.toFixed(1)} ms`;
+  return `${(ms / 1000).toFixed(2)} s`;
+}
+
+const HistogramBars: React.FC<{ histogram: Array<[number, number]> }> = ({ histogram }) => {
+  const peak = Math.max(1, ...histogram.map(([, count]) => count));
+  return (
+    <div className="space-y-0.5 py-2">
+      {histogram.map(([upperMs, count]) => (
+        <div key={upperMs} className="flex items-center gap-2 text-[11px] font-mono">
+          <span className="w-20 text-right text-muted-foreground">≤ {formatMs(upperMs)}</span>
+          <div className="flex-1 h-2.5 bg-muted/40 rounded-sm overflow-hidden">
+            <div className="h-full bg-primary/60" style={{ width: `${(count / peak) * 100}%` }} />
+          </div>
+          <span className="w-12 text-right">{count}</span>
+        </div>
+      ))}
+    </div>
+  );
+};
+
+interface SettingsDiagnosticsTabProps {
+  /** Only poll while the tab is visible */
+  active: boolean;
+}
+
+const SettingsDiagnosticsTab: React.FC<SettingsDiagnosticsTabProps> = ({ active }) => {
+  const { t } = useI18n();
+  const [snapshot, setSnapshot] = useState<IpcStatsSnapshot | null>(null);
+  const [sortKey, setSortKey] = useState<SortKey>("total");
+  const [filter, setFilter] = useState("");
+  const [expanded, setExpanded] = useState<string | null>(null);
+  const [logConfig, setLogConfig] = useState<LogConfig | null>(null);
+  const [recentLogs, setRecentLogs] = useState<LogEntry[]>([]);
+  const renderProfilerEnabled = useSyncExternalStore(renderProfilerStore.subscribe, isRenderProfilerEnabled);
+
+  const loadStats = useCallback(async () => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.getIpcStats) return;
+    try {
+      setSnapshot(await bridge.getIpcStats());
+      const mainLogs = (await bridge.getRecentLogs?.(RECENT_LOG_LINES)) ?? [];
+      // Forwarded renderer warnings are already part of the main buffer
+      const rendererLogs = getRecentLogs(RECENT_LOG_LINES).filter(
+        (entry) => entry.level !== "warn" && entry.level !== "error",
+      );
+      setRecentLogs(
+        [...mainLogs, ...rendererLogs].sort((a, b) => a.time - b.time).slice(-RECENT_LOG_LINES),
+      );
+    } catch (err) {
+      log.error("Failed to load IPC stats:", err);
+    }
+  }, []);
+
+  useEffect(() => {
+    const bridge = netcattyBridge.get();
+    bridge?.getLogConfig?.().then(setLogConfig).catch(() => {});
+    return bridge?.onLogConfigChanged?.(setLogConfig);
+  }, []);
+
+  const handleLevelChange = useCallback(async (level: string) => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.setLogConfig) return;
+    setLogConfig(await bridge.setLogConfig({
+      level: level as LogLevel,
+      categories: logConfig?.categories ?? {},
+    }));
+  }, [logConfig]);
+
+  const handleExportBundle = useCallback(async () => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.showSaveDialog || !bridge.exportDiagnosticsBundle) return;
+    const filePath = await bridge.showSaveDialog(
+      `netcatty-diagnostics-${new Date().toISOString().slice(0, 19).replace(/[:T]/g, "-")}.json`,
+      [{ name: "JSON", extensions: ["json"] }],
+    );
+    if (!filePath) return;
+    try {
+      await bridge.exportDiagnosticsBundle(filePath, {
+        entries: getRecentLogs(),
+        perf: collectRendererPerf(),
+      });
+    } catch (err) {
+      log.error(t("settings.diagnostics.logs.exportFailed"), err);
+    }
+  }, [t]);
+
+  useEffect(() => {
+    if (!active) return;
+    void loadStats();
+    const timer = setInterval(loadStats, REFRESH_INTERVAL_MS);
+    return () => clearInterval(timer);
+  }, [active, loadStats]);
+
+  const handleReset = useCallback(async () => {
+    await netcattyBridge.get()?.resetIpcStats?.();
+    setExpanded(null);
+    await loadStats();
+  }, [loadStats]);
+
+  const handleExport = useCallback(async () => {
+    const bridge = netcattyBridge.get();
+    if (!bridge?.showSaveDialog || !bridge.exportIpcStats) return;
+    const filePath = await bridge.showSaveDialog(
+      `netcatty-ipc-stats-${new Date().toISOString().slice(0, 19).replace(/[:T]/g, "-")}.json`,
+      [{ name: "JSON", extensions: ["json"] }],
+    );
+    if (!filePath) return;
+    try {
+      await bridge.exportIpcStats(filePath);
+    } catch (err) {
+      log.error("Failed to export IPC stats:", err);
+    }
+  }, []);
+
+  const rows = useMemo(() => {
+    const query = filter.trim().toLowerCase();
+    return (snapshot?.channels ?? [])
+      .filter((stats) => !query || stats.channel.toLowerCase().includes(query))
+      .sort((a, b) => sortValue(b, sortKey) - sortValue(a, sortKey));
+  }, [snapshot, filter, sortKey]);
+
+  const levelOptions = (["debug", "info", "warn", "error"] as const).map((level) => ({
+    value: level,
+    label: t(`settings.diagnostics.logs.level.${level}`),
+  }));
+
+  const sortOptions = [
+    { value: "total", label: t("settings.diagnostics.ipc.sort.total") },
+    { value: "calls", label: t("settings.diagnostics.ipc.sort.calls") },
+    { value: "p99", label: t("settings.diagnostics.ipc.sort.p99") },
+    { value: "max", label: t("settings.diagnostics.ipc.sort.max") },
+    { value: "response", label: t("settings.diagnostics.ipc.sort.response") },
+  ];
+
+  return (
+    <TabsContent
+      value="diagnostics"
+      className="data-[state=inactive]:hidden h-full flex flex-col"
+    >
+      <div className="flex-1 overflow-y-auto overflow-x-hidden px-8 py-6">
+        <div className="space-y-8">
+          {/* Header */}
+          <div>
+            <h2 className="text-xl font-semibold">{t("settings.diagnostics.title")}</h2>
+            <p className="text-sm text-muted-foreground mt-1">
+              {t("settings.diagnostics.description")}
+            </p>
+          </div>
+
+          {/* IPC Section */}
+          <div className="space-y-4">
+            <div className="flex items-center gap-2">
+              <Activity size={18} className="text-muted-foreground" />
+              <h3 className="text-base font-medium">{t("settings.diagnostics.ipc.title")}</h3>
+              {snapshot && (
+                <span className="text-xs text-muted-foreground">
+                  {t("settings.diagnostics.ipc.since", {
+                    time: new Date(snapshot.startedAt).toLocaleTimeString(),
+                  })}
+                </span>
+              )}
+            </div>
+
+            <div className="flex items-center gap-2">
+              <Input
+                value={filter}
+                onChange={(e) => setFilter(e.target.value)}
+                placeholder={t("settings.diagnostics.ipc.filter")}
+                className="h-9 flex-1"
+              />
+              <Select
+                value={sortKey}
+                options={sortOptions}
+                onChange={(val) => setSortKey(val as SortKey)}
+                className="w-44"
+              />
+              <Button variant="outline" size="sm" onClick={loadStats} className="gap-1.5">
+                <RefreshCw size={14} />
+                {t("settings.system.refresh")}
+              </Button>
+              <Button variant="outline" size="sm" onClick={handleReset} className="gap-1.5">
+                <RotateCcw size={14} />
+                {t("settings.diagnostics.ipc.reset")}
+              </Button>
+              <Button variant="outline" size="sm" onClick={handleExport} className="gap-1.5">
+                <Download size={14} />
+                {t("settings.diagnostics.ipc.export")}
+              </Button>
+            </div>
+
+            <div className="bg-muted/30 rounded-lg overflow-x-auto">
+              <table className="w-full text-xs">
+                <thead className="text-muted-foreground">
+                  <tr className="border-b border-border/60">
+                    <th className="text-left font-medium px-3 py-2">{t("settings.diagnostics.ipc.channel")}</th>
+                    <th className="text-right font-medium px-2 py-2">{t("settings.diagnostics.ipc.calls")}</th>
+                    <th className="text-right font-medium px-2 py-2">{t("settings.diagnostics.ipc.errors")}</th>
+                    <th className="text-right font-medium px-2 py-2">{t("settings.diagnostics.ipc.inFlight")}</th>
+                    <th className="text-right font-medium px-2 py-2">p50</th>
+                    <th className="text-right font-medium px-2 py-2">p99</th>
+                    <th className="text-right font-medium px-2 py-2">{t("settings.diagnostics.ipc.max")}</th>
+                    <th className="text-right font-medium px-2 py-2">{t("settings.diagnostics.ipc.request")}</th>
+                    <th className="text-right font-medium px-3 py-2">{t("settings.diagnostics.ipc.response")}</th>
+                  </tr>
+                </thead>
+                <tbody>
+                  {rows.length === 0 && (
+                    <tr>
+                      <td colSpan={9} className="px-3 py-6 text-center text-muted-foreground">
+                        {t("settings.diagnostics.ipc.empty")}
+                      </td>
+                    </tr>
+                  )}
+                  {rows.map((stats) => {
+                    const key = `${stats.kind}:${stats.channel}`;
+                    const isExpanded = expanded === key;
+                    const timed = stats.kind !== "event";
+                    return (
+                      <React.Fragment key={key}>
+                        <tr
+                          className={cn(
+                            "border-b border-border/30 hover:bg-background/60",
+                            timed && "cursor-pointer",
+                            isExpanded && "bg-background/60",
+                          )}
+                          onClick={() => timed && setExpanded(isExpanded ? null : key)}
+                        >
+                          <td className="px-3 py-1.5 font-mono truncate max-w-[260px]" title={stats.channel}>
+                            {stats.channel.replace(/^netcatty:/, "")}
+                            {stats.kind !== "handle" && (
+                              <span className="ml-1.5 text-[10px] text-muted-foreground uppercase">{stats.kind}</span>
+                            )}
+                          </td>
+                          <td className="text-right px-2 py-1.5 tabular-nums">{stats.calls}</td>
+                          <td className={cn("text-right px-2 py-1.5 tabular-nums", stats.errors > 0 && "text-destructive")}>
+                            {stats.errors || "-"}
+                          </td>
+                          <td className="text-right px-2 py-1.5 tabular-nums">
+                            {stats.kind === "handle" ? `${stats.inFlight} / ${stats.maxInFlight}` : "-"}
+                          </td>
+                          <td className="text-right px-2 py-1.5 tabular-nums">{timed ? formatMs(stats.latency.p50Ms) : "-"}</td>
+                          <td className="text-right px-2 py-1.5 tabular-nums">{timed ? formatMs(stats.latency.p99Ms) : "-"}</td>
+                          <td className="text-right px-2 py-1.5 tabular-nums">{timed ? formatMs(stats.latency.maxMs) : "-"}</td>
+                          <td className="text-right px-2 py-1.5 tabular-nums" title={formatBytes(stats.request.maxBytes)}>
+                            {formatBytes(stats.request.meanBytes)}
+                          </td>
+                          <td className="text-right px-3 py-1.5 tabular-nums" title={formatBytes(stats.response.maxBytes)}>
+                            {stats.kind === "handle" ? formatBytes(stats.response.meanBytes) : "-"}
+                          </td>
+                        </tr>
+                        {isExpanded && (
+                          <tr className="border-b border-border/30">
+                            <td colSpan={9} className="px-3">
+                              <HistogramBars histogram={stats.histogram} />
+                            </td>
+                          </tr>
+                        )}
+                      </React.Fragment>
+                    );
+                  })}
+                </tbody>
+              </table>
+            </div>
+
+            <p className="text-xs text-muted-foreground">
+              {t("settings.diagnostics.ipc.hint")}
+            </p>
+          </div>
+
+          {/* Render Profiler Section */}
+          <div className="space-y-4">
+            <div className="flex items-center gap-2">
+              <Gauge size={18} className="text-muted-foreground" />
+              <h3 className="text-base font-medium">{t("settings.diagnostics.render.title")}</h3>
+            </div>
+            <div className="bg-muted/30 rounded-lg px-4">
+              <SettingRow
+                label={t("settings.diagnostics.render.overlay")}
+                description={t("settings.diagnostics.render.overlayDesc")}
+              >
+                <Toggle checked={renderProfilerEnabled} onChange={renderProfilerStore.setEnabled} />
+              </SettingRow>
+            </div>
+          </div>
+
+          {/* Logs Section */}
+          <div className="space-y-4">
+            <div className="flex items-center gap-2">
+              <FileText size={18} className="text-muted-foreground" />
+              <h3 className="text-base font-medium">{t("settings.diagnostics.logs.title")}</h3>
+            </div>
+
+            <div className="bg-muted/30 rounded-lg px-4 divide-y divide-border/40">
+              <SettingRow
+                label={t("settings.diagnostics.logs.level")}
+                description={logConfig?.envOverride
+                  ? t("settings.diagnostics.logs.envOverride")
+                  : t("settings.diagnostics.logs.levelDesc")}
+              >
+                <Select
+                  value={logConfig?.level ?? "info"}
+                  options={levelOptions}
+                  onChange={handleLevelChange}
+                  className="w-36"
+                  disabled={!logConfig}
+                />
+              </SettingRow>
+              <SettingRow
+                label={t("settings.diagnostics.logs.exportBundle")}
+                description={t("settings.diagnostics.logs.exportBundleDesc")}
+              >
+                <Button variant="outline" size="sm" onClick={handleExportBundle} className="gap-1.5">
+                  <Package size={14} />
+                  {t("settings.diagnostics.logs.exportBundle")}
+                </Button>
+              </SettingRow>
+            </div>
+
+            <div className="space-y-2">
+              <p className="text-xs font-medium text-muted-foreground">{t("settings.diagnostics.logs.recent")}</p>
+              <div className="bg-muted/30 rounded-lg p-3 text-[11px] font-mono leading-relaxed max-h-72 overflow-auto whitespace-pre-wrap break-all">
+                {recentLogs.length === 0
+                  ? t("settings.diagnostics.logs.empty")
+                  : recentLogs.map((entry, index) => (
+                      <div
+                        key={`${entry.time}-${index}`}
+                        className={cn(
+                          entry.level === "error" && "text-destructive",
+                          entry.level === "warn" && "text-yellow-600 dark:text-yellow-400",
+                          entry.level === "debug" && "text-muted-foreground",
+                        )}
+                      >
+                        {formatLogLine(entry)}
+                      </div>
+                    ))}
+              </div>
+            </div>
+          </div>
+        </div>
+      </div>
+    </TabsContent>
+  );
+};
+
+export default SettingsDiagnosticsTab;
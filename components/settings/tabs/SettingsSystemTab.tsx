@@ -1,7 +1,7 @@
 /**
  * Settings System Tab - System information, temp file management, and session logs
  */
-import { FileText, FolderOpen, HardDrive, RefreshCw, Trash2 } from "lucide-react";
+import { FileText, FolderOpen, HardDrive, History, RefreshCw, Trash2 } from "lucide-react";
 import React, { useCallback, useEffect, useState } from "react";
 import { useI18n } from "../../../application/i18n/I18nProvider";
 import { netcattyBridge } from "../../../infrastructure/services/netcattyBridge";
@@ -31,6 +31,12 @@ interface SettingsSystemTabProps {
   setSessionLogsDir: (dir: string) => void;
   sessionLogsFormat: SessionLogFormat;
   setSessionLogsFormat: (format: SessionLogFormat) => void;
+  sessionRestoreEnabled: boolean;
+  setSessionRestoreEnabled: (enabled: boolean) => void;
+  sessionRestoreInBackground: boolean;
+  setSessionRestoreInBackground: (enabled: boolean) => void;
+  sessionRestoreScreens: boolean;
+  setSessionRestoreScreens: (enabled: boolean) => void;
 }
 
 const SettingsSystemTab: React.FC<SettingsSystemTabProps> = ({
@@ -40,6 +46,12 @@ const SettingsSystemTab: React.FC<SettingsSystemTabProps> = ({
   setSessionLogsDir,
   sessionLogsFormat,
   setSessionLogsFormat,
+  sessionRestoreEnabled,
+  setSessionRestoreEnabled,
+  sessionRestoreInBackground,
+  setSessionRestoreInBackground,
+  sessionRestoreScreens,
+  setSessionRestoreScreens,
 }) => {
   const { t } = useI18n();
 
@@ -221,6 +233,48 @@ const SettingsSystemTab: React.FC<SettingsSystemTabProps> = ({
             </p>
           </div>
 
+          {/* Session Restore Section */}
+          <div className="space-y-4">
+            <div className="flex items-center gap-2">
+              <History size={18} className="text-muted-foreground" />
+              <h3 className="text-base font-medium">{t("settings.sessionRestore.title")}</h3>
+            </div>
+
+            <div className="bg-muted/30 rounded-lg p-4 space-y-4">
+              <SettingRow
+                label={t("settings.sessionRestore.enable")}
+                description={t("settings.sessionRestore.enableDesc")}
+              >
+                <Toggle
+                  checked={sessionRestoreEnabled}
+                  onChange={setSessionRestoreEnabled}
+                />
+              </SettingRow>
+
+              <SettingRow
+                label={t("settings.sessionRestore.background")}
+                description={t("settings.sessionRestore.backgroundDesc")}
+              >
+                <Toggle
+                  checked={sessionRestoreInBackground}
+                  onChange={setSessionRestoreInBackground}
+                  disabled={!sessionRestoreEnabled}
+                />
+              </SettingRow>
+
+              <SettingRow
+                label={t("settings.sessionRestore.screens")}
+                description={t("settings.sessionRestore.screensDesc")}
+              >
+                <Toggle
+                  checked={sessionRestoreScreens}
+                  onChange={setSessionRestoreScreens}
+                  disabled={!sessionRestoreEnabled}
+                />
+              </SettingRow>
+            </div>
+          </div>
+
           {/* Session Logs Section */}
           <div className="space-y-4">
             <div className="flex items-center gap-2">
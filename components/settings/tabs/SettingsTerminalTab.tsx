@@ -437,6 +437,25 @@ export default function SettingsTerminalTab(props: {
           <Toggle checked={terminalSettings.scrollOnPaste} onChange={(v) => updateTerminalSetting("scrollOnPaste", v)} />
         </SettingRow>
 
+        <SettingRow
+          label={t("settings.terminal.behavior.pasteLineDelay")}
+          description={t("settings.terminal.behavior.pasteLineDelay.desc")}
+        >
+          <Input
+            type="number"
+            min={0}
+            max={1000}
+            value={terminalSettings.pasteLineDelay ?? 0}
+            onChange={(e) => {
+              const val = parseInt(e.target.value) || 0;
+              if (val >= 0 && val <= 1000) {
+                updateTerminalSetting("pasteLineDelay", val);
+              }
+            }}
+            className="w-24"
+          />
+        </SettingRow>
+
         <SettingRow
           label={t("settings.terminal.behavior.linkModifier")}
           description={t("settings.terminal.behavior.linkModifier.desc")}
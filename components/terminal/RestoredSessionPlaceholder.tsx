@@ -0,0 +1,70 @@
+/**
+ * Restored Session Placeholder
+ * Stands in for a tab restored from the previous run until it connects,
+ * showing the last saved screen as plain text
+ */
+import { History, Play } from 'lucide-react';
+import React, { memo, useMemo } from 'react';
+import { useI18n } from '../../application/i18n/I18nProvider';
+import { useFontById } from '../../application/state/fontStore';
+import { screenToPlainText, useRestoredScreen } from '../../application/state/sessionRestoreStore';
+import type { Host, TerminalTheme } from '../../domain/models';
+import { Button } from '../ui/button';
+
+export interface RestoredSessionPlaceholderProps {
+    sessionId: string;
+    host: Host;
+    terminalTheme: TerminalTheme;
+    fontFamilyId: string;
+    fontSize?: number;
+    // False while the vault is loading or after the host was deleted
+    canConnect: boolean;
+    onConnect: (sessionId: string) => void;
+}
+
+const RestoredSessionPlaceholderInner: React.FC<RestoredSessionPlaceholderProps> = ({
+    sessionId,
+    host,
+    terminalTheme,
+    fontFamilyId,
+    fontSize,
+    canConnect,
+    onConnect,
+}) => {
+    const { t } = useI18n();
+    const screen = useRestoredScreen(sessionId);
+    const font = useFontById(host.fontFamily || fontFamilyId || 'menlo');
+    const text = useMemo(() => (screen ? screenToPlainText(screen) : ''), [screen]);
+
+    return (
+        <div
+            className="absolute inset-0 overflow-hidden"
+            style={{ background: terminalTheme.colors.background, color: terminalTheme.colors.foreground }}
+        >
+            <div
+                className="absolute inset-x-0 bottom-0 px-2 pb-1 whitespace-pre opacity-50 select-none"
+                style={{ fontFamily: font.family, fontSize: host.fontSize || fontSize || 14, lineHeight: 1.2 }}
+            >
+                {text}
+            </div>
+            <div className="absolute inset-0 flex items-center justify-center">
+                <div className="flex flex-col items-center gap-3 rounded-lg border border-border/60 bg-background/90 px-5 py-4 shadow-lg backdrop-blur">
+                    <div className="flex items-center gap-2 text-sm font-medium text-foreground">
+                        <History size={16} className="text-muted-foreground" />
+                        <span>{host.label}</span>
+                    </div>
+                    <div className="text-xs text-muted-foreground">
+                        {canConnect ? t('terminal.restore.pending') : t('terminal.restore.hostUnavailable')}
+                    </div>
+                    <Button size="sm" disabled={!canConnect} onClick={() => onConnect(sessionId)}>
+                        <Play size={14} className="mr-1.5" />
+                        {t('terminal.restore.connect')}
+                    </Button>
+                </div>
+            </div>
+        </div>
+    );
+};
+
+export const RestoredSessionPlaceholder = memo(RestoredSessionPlaceholderInner);
+RestoredSessionPlaceholder.displayName = 'RestoredSessionPlaceholder';
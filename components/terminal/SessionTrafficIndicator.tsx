@@ -0,0 +1,96 @@
+/**
+ * Session Traffic Indicator
+ * Live throughput and keystroke echo latency of a session: a compact badge
+ * for tabs (only shown while busy or slow) and a status readout for the
+ * terminal toolbar
+ */
+import { ArrowDown, ArrowUp } from 'lucide-react';
+import React, { memo, useMemo } from 'react';
+import { useI18n } from '../../application/i18n/I18nProvider';
+import { useCombinedSessionMetrics, useSessionMetrics } from '../../application/state/sessionMetricsStore';
+import type { WorkspaceNode } from '../../domain/models';
+import { collectSessionIds } from '../../domain/workspace';
+import { cn } from '../../lib/utils';
+import { formatBytes } from '../sftp/utils';
+
+// Tabs only show traffic above this, so idle shells stay quiet
+const BADGE_MIN_RATE = 8 * 1024;
+const BUSY_RATE = 1024 * 1024;
+const RTT_SLOW_MS = 250;
+const RTT_BAD_MS = 1000;
+
+const formatRate = (bytesPerSec: number) => `${formatBytes(bytesPerSec)}/s`;
+
+const rttTone = (rttMs: number | null) =>
+    rttMs === null || rttMs < RTT_SLOW_MS ? '' : rttMs < RTT_BAD_MS ? 'text-amber-500' : 'text-rose-500';
+
+const TrafficBadge: React.FC<{ rateIn: number; rateOut: number; rttMs: number | null }> = ({ rateIn, rateOut, rttMs }) => {
+    const { t } = useI18n();
+    const rate = rateIn + rateOut;
+    const showRate = rate >= BADGE_MIN_RATE;
+    const showRtt = rttMs !== null && rttMs >= RTT_SLOW_MS;
+    if (!showRate && !showRtt) return null;
+
+    return (
+        <span
+            className="flex-shrink-0 text-[9px] font-medium tabular-nums text-muted-foreground"
+            title={t('terminal.traffic.badgeTitle', {
+                in: formatRate(rateIn),
+                out: formatRate(rateOut),
+                rtt: rttMs === null ? t('terminal.traffic.rttUnknown') : `${rttMs} ms`,
+            })}
+        >
+            {showRate && <span className={cn(rate >= BUSY_RATE && 'text-amber-500')}>{formatRate(rate)}</span>}
+            {showRate && showRtt && ' · '}
+            {showRtt && <span className={rttTone(rttMs)}>{rttMs} ms</span>}
+        </span>
+    );
+};
+
+export const SessionTrafficBadge: React.FC<{ sessionId: string }> = memo(({ sessionId }) => {
+    const metrics = useSessionMetrics(sessionId);
+    if (!metrics) return null;
+    return <TrafficBadge rateIn={metrics.rateIn} rateOut={metrics.rateOut} rttMs={metrics.rttMs} />;
+});
+SessionTrafficBadge.displayName = 'SessionTrafficBadge';
+
+export const WorkspaceTrafficBadge: React.FC<{ root: WorkspaceNode }> = memo(({ root }) => {
+    const sessionIds = useMemo(() => collectSessionIds(root), [root]);
+    const combined = useCombinedSessionMetrics(sessionIds);
+    return <TrafficBadge {...combined} />;
+});
+WorkspaceTrafficBadge.displayName = 'WorkspaceTrafficBadge';
+
+/**
+ * Toolbar readout: current rates and echo RTT, totals on hover
+ */
+export const SessionTrafficStatus: React.FC<{ sessionId: string }> = memo(({ sessionId }) => {
+    const { t } = useI18n();
+    const metrics = useSessionMetrics(sessionId);
+    if (!metrics) return null;
+
+    return (
+        <div
+            className="flex items-center gap-1.5 px-1 text-[10px] tabular-nums text-[color:var(--terminal-toolbar-fg)] opacity-80"
+            title={t('terminal.traffic.statusTitle', {
+                received: formatBytes(metrics.bytesIn),
+                sent: formatBytes(metrics.bytesOut),
+            })}
+        >
+            <span className="flex items-center gap-0.5">
+                <ArrowDown size={10} />
+                {formatRate(metrics.rateIn)}
+            </span>
+            <span className="flex items-center gap-0.5">
+                <ArrowUp size={10} />
+                {formatRate(metrics.rateOut)}
+            </span>
+            {metrics.rttMs !== null && (
+                <span className={rttTone(metrics.rttMs)} title={t('terminal.traffic.rttHint')}>
+                    {metrics.rttMs} ms
+                </span>
+            )}
+        </div>
+    );
+});
+SessionTrafficStatus.displayName = 'SessionTrafficStatus';
@@ -5,6 +5,7 @@
 import {
   ClipboardPaste,
   Copy,
+  LayoutGrid,
   SplitSquareHorizontal,
   SplitSquareVertical,
   Terminal as TerminalIcon,
@@ -34,6 +35,7 @@ export interface TerminalContextMenuProps {
   onClear?: () => void;
   onSplitHorizontal?: () => void;
   onSplitVertical?: () => void;
+  onAttachTmux?: () => void;
   onClose?: () => void;
   onSelectWord?: () => void;
 }
@@ -50,6 +52,7 @@ export const TerminalContextMenu: React.FC<TerminalContextMenuProps> = ({
   onClear,
   onSplitHorizontal,
   onSplitVertical,
+  onAttachTmux,
   onClose,
   onSelectWord,
 }) => {
@@ -131,6 +134,12 @@ export const TerminalContextMenu: React.FC<TerminalContextMenuProps> = ({
             {t('terminal.menu.splitVertical')}
             <ContextMenuShortcut>{splitHShortcut}</ContextMenuShortcut>
           </ContextMenuItem>
+          {onAttachTmux && (
+            <ContextMenuItem onClick={onAttachTmux}>
+              <LayoutGrid size={14} className="mr-2" />
+              {t('terminal.menu.attachTmux')}
+            </ContextMenuItem>
+          )}
 
           <ContextMenuSeparator />
 
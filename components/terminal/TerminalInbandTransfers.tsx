@@ -0,0 +1,106 @@
+/**
+ * Terminal In-band Transfers
+ * ZMODEM/trzsz transfers running inside the session, shown with the SFTP transfer rows
+ */
+import React, { memo, useCallback, useEffect, useState } from 'react';
+import { useI18n } from '../../application/i18n/I18nProvider';
+import type { TransferTask } from '../../domain/models';
+import { netcattyBridge } from '../../infrastructure/services/netcattyBridge';
+import { SftpTransferItem } from '../sftp/SftpTransferItem';
+import { Button } from '../ui/button';
+
+export interface TerminalInbandTransfersProps {
+    sessionId: string;
+}
+
+// Finished rows disappear on their own after this long
+const COMPLETED_LINGER_MS = 5000;
+
+const PROTOCOL_LABELS: Record<InbandTransferUpdate['protocol'], string> = {
+    zmodem: 'ZMODEM',
+    trzsz: 'trzsz',
+};
+
+const toTask = (update: InbandTransferUpdate): TransferTask => ({
+    id: update.id,
+    fileName: update.fileName,
+    sourcePath: update.sourcePath,
+    targetPath: update.targetPath,
+    sourceConnectionId: update.direction === 'upload' ? 'local' : update.sessionId,
+    targetConnectionId: update.direction === 'upload' ? update.sessionId : 'local',
+    direction: update.direction,
+    status: update.status,
+    totalBytes: update.totalBytes,
+    transferredBytes: update.transferredBytes,
+    speed: update.speed,
+    error: update.error,
+    startTime: update.startTime,
+    endTime: update.endTime,
+    isDirectory: false,
+});
+
+const TerminalInbandTransfersInner: React.FC<TerminalInbandTransfersProps> = ({ sessionId }) => {
+    const { t } = useI18n();
+    const [tasks, setTasks] = useState<TransferTask[]>([]);
+    const [protocol, setProtocol] = useState<InbandTransferUpdate['protocol']>('zmodem');
+
+    const dismiss = useCallback((id: string) => {
+        setTasks((prev) => prev.filter((task) => task.id !== id));
+    }, []);
+
+    useEffect(() => {
+        const bridge = netcattyBridge.get();
+        if (!bridge?.onInbandTransfer) return;
+        return bridge.onInbandTransfer(sessionId, (update) => {
+            setProtocol(update.protocol);
+            setTasks((prev) => {
+                const task = toTask(update);
+                const index = prev.findIndex((item) => item.id === task.id);
+                if (index < 0) return [...prev, task];
+                const next = prev.slice();
+                next[index] = task;
+                return next;
+            });
+            if (update.status === 'completed') {
+                setTimeout(() => dismiss(update.id), COMPLETED_LINGER_MS);
+            }
+        });
+    }, [sessionId, dismiss]);
+
+    if (tasks.length === 0) return null;
+
+    const hasFinished = tasks.some((task) => task.status !== 'transferring' && task.status !== 'pending');
+
+    return (
+        <div className="absolute bottom-3 left-3 z-20 w-96 max-w-[calc(100%-1.5rem)] overflow-hidden rounded-md border border-border/60 bg-background/90 shadow-lg backdrop-blur">
+            <div className="flex items-center justify-between px-4 py-1.5 text-xs text-muted-foreground">
+                <span className="font-medium">{t('terminal.inband.title', { protocol: PROTOCOL_LABELS[protocol] })}</span>
+                {hasFinished && (
+                    <Button
+                        variant="ghost"
+                        size="sm"
+                        className="h-6 px-2 text-xs"
+                        onClick={() => setTasks((prev) => prev.filter((task) => task.status === 'transferring'))}
+                    >
+                        {t('terminal.inband.clear')}
+                    </Button>
+                )}
+            </div>
+            <div className="max-h-48 overflow-auto">
+                {tasks.map((task) => (
+                    <SftpTransferItem
+                        key={task.id}
+                        task={task}
+                        canRetry={false}
+                        onCancel={() => void netcattyBridge.get()?.cancelInbandTransfer?.(sessionId)}
+                        onRetry={() => dismiss(task.id)}
+                        onDismiss={() => dismiss(task.id)}
+                    />
+                ))}
+            </div>
+        </div>
+    );
+};
+
+export const TerminalInbandTransfers = memo(TerminalInbandTransfersInner);
+TerminalInbandTransfers.displayName = 'TerminalInbandTransfers';
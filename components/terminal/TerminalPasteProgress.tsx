@@ -0,0 +1,54 @@
+/**
+ * Terminal Paste Progress
+ * Small progress card shown while a large paste is being sent, with cancel
+ */
+import { ClipboardPaste, X } from 'lucide-react';
+import React, { memo } from 'react';
+import { useI18n } from '../../application/i18n/I18nProvider';
+import { cancelPaste, usePasteProgress } from '../../application/state/pasteEngine';
+import { formatBytes } from '../sftp/utils';
+import { Button } from '../ui/button';
+
+export interface TerminalPasteProgressProps {
+    sessionId: string;
+}
+
+const TerminalPasteProgressInner: React.FC<TerminalPasteProgressProps> = ({ sessionId }) => {
+    const { t } = useI18n();
+    const progress = usePasteProgress(sessionId);
+    if (!progress) return null;
+
+    const percent = progress.totalChars > 0
+        ? Math.min(100, Math.round((progress.sentChars / progress.totalChars) * 100))
+        : 0;
+
+    return (
+        <div className="absolute bottom-3 right-3 z-20 w-64 rounded-md border border-border/60 bg-background/90 px-3 py-2 shadow-lg backdrop-blur text-xs">
+            <div className="flex items-center gap-2">
+                <ClipboardPaste size={12} className="text-muted-foreground flex-shrink-0" />
+                <span className="flex-1 truncate tabular-nums">
+                    {t('terminal.paste.progress', {
+                        sent: formatBytes(progress.sentChars),
+                        total: formatBytes(progress.totalChars),
+                    })}
+                </span>
+                <Button
+                    variant="ghost"
+                    size="icon"
+                    className="h-5 w-5"
+                    onClick={() => cancelPaste(sessionId)}
+                    title={t('terminal.paste.cancel')}
+                    aria-label={t('terminal.paste.cancel')}
+                >
+                    <X size={12} />
+                </Button>
+            </div>
+            <div className="mt-1.5 h-1 w-full overflow-hidden rounded-full bg-muted">
+                <div className="h-full rounded-full bg-primary transition-[width]" style={{ width: `${percent}%` }} />
+            </div>
+        </div>
+    );
+};
+
+export const TerminalPasteProgress = memo(TerminalPasteProgressInner);
+TerminalPasteProgress.displayName = 'TerminalPasteProgress';
@@ -9,10 +9,13 @@ import { Snippet, Host } from '../../types';
 import { Button } from '../ui/button';
 import { Popover, PopoverContent, PopoverTrigger } from '../ui/popover';
 import { ScrollArea } from '../ui/scroll-area';
+import { SessionTrafficStatus } from './SessionTrafficIndicator';
 import ThemeCustomizeModal from './ThemeCustomizeModal';
 
 export interface TerminalToolbarProps {
     status: 'connecting' | 'connected' | 'disconnected';
+    // Session shown in the traffic/latency readout
+    sessionId?: string;
     snippets: Snippet[];
     host?: Host;
     defaultThemeId: string;
@@ -35,6 +38,7 @@ export interface TerminalToolbarProps {
 
 export const TerminalToolbar: React.FC<TerminalToolbarProps> = ({
     status,
+    sessionId,
     snippets,
     host,
     defaultThemeId,
@@ -97,6 +101,8 @@ export const TerminalToolbar: React.FC<TerminalToolbarProps> = ({
 
     return (
         <>
+            {status === 'connected' && sessionId && <SessionTrafficStatus sessionId={sessionId} />}
+
             {!hidesSftp && (
                 <Button
                     variant="secondary"
@@ -13,7 +13,7 @@ import React, { useEffect, useMemo, useState, useCallback, useRef, memo } from '
 import { createPortal } from 'react-dom';
 import { Check, Minus, Palette, Plus, Type, X } from 'lucide-react';
 import { useI18n } from '../../application/i18n/I18nProvider';
-import { useAvailableFonts } from '../../application/state/fontStore';
+import { fontStore, useAvailableFonts } from '../../application/state/fontStore';
 import { TERMINAL_THEMES, TerminalThemeConfig } from '../../infrastructure/config/terminalThemes';
 import { DEFAULT_FONT_SIZE, MIN_FONT_SIZE, MAX_FONT_SIZE, TerminalFont } from '../../infrastructure/config/fonts';
 import { Button } from '../ui/button';
@@ -66,14 +66,17 @@ ThemeItem.displayName = 'ThemeItem';
 const FontItem = memo(({
     font,
     isSelected,
-    onSelect
+    onSelect,
+    onPreview
 }: {
     font: TerminalFont;
     isSelected: boolean;
     onSelect: (id: string) => void;
+    onPreview: (font: TerminalFont) => void;
 }) => (
     <button
         onClick={() => onSelect(font.id)}
+        onMouseEnter={() => onPreview(font)}
         className={cn(
             'w-full flex items-center gap-3 px-3 py-2.5 rounded-lg text-left transition-all',
             isSelected
@@ -316,6 +319,14 @@ export const ThemeCustomizeModal: React.FC<ThemeCustomizeModalProps> = ({
         onFontFamilyChange?.(fontId); // Apply immediately
     }, [onFontFamilyChange]);
 
+    // Warm font faces on hover so selecting one switches terminals without a
+    // fallback-font measure followed by a second atlas rebuild.
+    const fontSizeRef = useRef(fontSize);
+    fontSizeRef.current = fontSize;
+    const handleFontPreview = useCallback((font: TerminalFont) => {
+        void fontStore.warmFont(font.family, fontSizeRef.current);
+    }, []);
+
     // Handle font size change - apply immediately for real-time preview
     const handleFontSizeChange = useCallback((delta: number) => {
         setFontSize(prev => {
@@ -438,6 +449,7 @@ export const ThemeCustomizeModal: React.FC<ThemeCustomizeModalProps> = ({
                                             font={font}
                                             isSelected={selectedFont === font.id}
                                             onSelect={handleFontSelect}
+                                            onPreview={handleFontPreview}
                                         />
                                     ))}
                                 </div>
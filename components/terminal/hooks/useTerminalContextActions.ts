@@ -1,22 +1,20 @@
 import type { Terminal as XTerm } from "@xterm/xterm";
 import { useCallback } from "react";
 import type { RefObject } from "react";
+import { pasteToTerminal } from "../../../application/state/pasteEngine";
+import type { TerminalSettings } from "../../../domain/models";
 import { logger } from "../../../lib/logger";
 import { normalizeLineEndings } from "../../../lib/utils";
 
-type TerminalBackendWriteApi = {
-  writeToSession: (sessionId: string, data: string) => void;
-};
-
 export const useTerminalContextActions = ({
   termRef,
   sessionRef,
-  terminalBackend,
+  terminalSettingsRef,
   onHasSelectionChange,
 }: {
   termRef: RefObject<XTerm | null>;
   sessionRef: RefObject<string | null>;
-  terminalBackend: TerminalBackendWriteApi;
+  terminalSettingsRef?: RefObject<TerminalSettings | undefined>;
   onHasSelectionChange?: (hasSelection: boolean) => void;
 }) => {
   const onCopy = useCallback(() => {
@@ -33,11 +31,13 @@ export const useTerminalContextActions = ({
     if (!term) return;
     try {
       const text = await navigator.clipboard.readText();
-      if (text && sessionRef.current) terminalBackend.writeToSession(sessionRef.current, normalizeLineEndings(text));
+      if (text && sessionRef.current) {
+        void pasteToTerminal(term, sessionRef.current, normalizeLineEndings(text), terminalSettingsRef?.current);
+      }
     } catch (err) {
       logger.warn("Failed to paste from clipboard", err);
     }
-  }, [sessionRef, termRef, terminalBackend]);
+  }, [sessionRef, termRef, terminalSettingsRef]);
 
   const onSelectAll = useCallback(() => {
     const term = termRef.current;
@@ -21,6 +21,12 @@ export type { TerminalContextMenuProps } from './TerminalContextMenu';
 export { TerminalSearchBar } from './TerminalSearchBar';
 export type { TerminalSearchBarProps } from './TerminalSearchBar';
 
+export { TerminalPasteProgress } from './TerminalPasteProgress';
+export type { TerminalPasteProgressProps } from './TerminalPasteProgress';
+
+export { TerminalInbandTransfers } from './TerminalInbandTransfers';
+export type { TerminalInbandTransfersProps } from './TerminalInbandTransfers';
+
 export { KeywordHighlighter } from './keywordHighlight';
 
 export { useTerminalSearch } from './hooks/useTerminalSearch';
@@ -5,6 +5,7 @@ import type { Dispatch, RefObject, SetStateAction } from "react";
 import { logger } from "../../../lib/logger";
 import type { Host, Identity, SerialConfig, SSHKey, TerminalSession, TerminalSettings } from "../../../types";
 import { resolveHostAuth } from "../../../domain/sshAuth";
+import type { SynchronizedOutput } from "./synchronizedOutput";
 
 type TerminalBackendApi = {
   backendAvailable: () => boolean;
@@ -12,7 +13,6 @@ type TerminalBackendApi = {
   moshAvailable: () => boolean;
   localAvailable: () => boolean;
   serialAvailable: () => boolean;
-  execAvailable: () => boolean;
   startSSHSession: (options: NetcattySSHOptions) => Promise<string>;
   startTelnetSession: (
     options: Parameters<NonNullable<NetcattyBridge["startTelnetSession"]>>[0],
@@ -26,10 +26,10 @@ type TerminalBackendApi = {
   startSerialSession: (
     options: Parameters<NonNullable<NetcattyBridge["startSerialSession"]>>[0],
   ) => Promise<string>;
-  execCommand: (options: Parameters<NetcattyBridge["execCommand"]>[0]) => Promise<{
-    stdout?: string;
-    stderr?: string;
-  }>;
+  attachTmuxPane: (sessionId: string) => Promise<{ snapshot: string }>;
+  getSessionCapabilities: (
+    sessionId: string,
+  ) => Promise<{ success: boolean; capabilities?: RemoteCapabilities; error?: string }>;
   onSessionData: (sessionId: string, cb: (data: string) => void) => () => void;
   onSessionExit: (
     sessionId: string,
@@ -74,6 +74,7 @@ export type TerminalSessionStartersContext = {
   disposeExitRef: RefObject<(() => void) | null>;
   fitAddonRef: RefObject<FitAddon | null>;
   serializeAddonRef: RefObject<SerializeAddon | null>;
+  synchronizedOutputRef: RefObject<SynchronizedOutput | null>;
   pendingAuthRef: RefObject<PendingAuth>;
 
   updateStatus: (next: TerminalSession["status"]) => void;
@@ -111,6 +112,12 @@ const buildTermEnv = (host: Host, terminalSettings?: TerminalSettings) => {
   return env;
 };
 
+const writeOutput = (ctx: TerminalSessionStartersContext, term: XTerm, data: string) => {
+  const output = ctx.synchronizedOutputRef.current;
+  if (output) output.write(data);
+  else term.write(data);
+};
+
 const attachSessionToTerminal = (
   ctx: TerminalSessionStartersContext,
   term: XTerm,
@@ -132,7 +139,7 @@ const attachSessionToTerminal = (
       // Replace \n that is not preceded by \r with \r\n
       data = data.replace(/(?<!\r)\n/g, "\r\n");
     }
-    term.write(data);
+    writeOutput(ctx, term, data);
     if (!ctx.hasConnectedRef.current) {
       ctx.updateStatus("connected");
       opts?.onConnected?.();
@@ -167,26 +174,14 @@ const attachSessionToTerminal = (
   });
 };
 
-const runDistroDetection = async (
-  ctx: TerminalSessionStartersContext,
-  auth: { username: string; password?: string; key?: SSHKey },
-) => {
-  if (!ctx.terminalBackend.execAvailable()) return;
+const runDistroDetection = async (ctx: TerminalSessionStartersContext) => {
+  const sessionId = ctx.sessionRef.current;
+  if (!sessionId) return;
   try {
-    const res = await ctx.terminalBackend.execCommand({
-      hostname: ctx.host.hostname,
-      username: auth.username || "root",
-      port: ctx.host.port || 22,
-      password: auth.password,
-      privateKey: auth.key?.privateKey,
-      command: "cat /etc/os-release 2>/dev/null || uname -a",
-      timeout: 8000,
-    });
-    const data = `${res.stdout || ""}\n${res.stderr || ""}`;
-    const idMatch = data.match(/ID=([\\w\\-]+)/i);
-    const distro = idMatch
-      ? idMatch[1].replace(/"/g, "")
-      : (data.split(/\s+/)[0] || "").toLowerCase();
+    // Served from the per-host capability cache; on a miss the main process
+    // probes over the already open SSH connection.
+    const res = await ctx.terminalBackend.getSessionCapabilities(sessionId);
+    const distro = res.capabilities?.distro;
     if (distro) ctx.onOsDetected?.(ctx.host.id, distro);
   } catch (err) {
     logger.warn("OS probe failed", err);
@@ -230,8 +225,6 @@ export const createTerminalSessionStarters = (ctx: TerminalSessionStartersContex
     const effectivePassword = resolvedAuth.password;
     const key = resolvedAuth.key;
     const effectivePassphrase = resolvedAuth.passphrase;
-    let usedKey: SSHKey | undefined;
-    let usedPassword: string | undefined;
 
     const isAuthError = (err: unknown): boolean => {
       if (!(err instanceof Error)) return false;
@@ -251,6 +244,7 @@ export const createTerminalSessionStarters = (ctx: TerminalSessionStartersContex
         port: ctx.host.proxyConfig.port,
         username: ctx.host.proxyConfig.username,
         password: ctx.host.proxyConfig.password,
+        wan: ctx.host.proxyConfig.wan,
       }
       : undefined;
 
@@ -343,6 +337,7 @@ export const createTerminalSessionStarters = (ctx: TerminalSessionStartersContex
           proxy: proxyConfig,
           jumpHosts: jumpHosts.length > 0 ? jumpHosts : undefined,
           keepaliveInterval: ctx.terminalSettings?.keepaliveInterval,
+          transportProfile: ctx.host.transportProfile,
         });
       };
 
@@ -356,7 +351,6 @@ export const createTerminalSessionStarters = (ctx: TerminalSessionStartersContex
       if (hasKeyMaterial) {
         try {
           id = await startAttempt({ key });
-          usedKey = key;
         } catch (err) {
           if (isAuthError(err) && hasPassword) {
             ctx.setProgressLogs((prev) => [
@@ -364,14 +358,12 @@ export const createTerminalSessionStarters = (ctx: TerminalSessionStartersContex
               "Key auth failed. Trying password...",
             ]);
             id = await startAttempt({ password: effectivePassword });
-            usedPassword = effectivePassword;
           } else {
             throw err;
           }
         }
       } else {
         id = await startAttempt({ password: effectivePassword });
-        usedPassword = effectivePassword;
       }
 
       if (unsubscribeChainProgress) unsubscribeChainProgress();
@@ -419,15 +411,7 @@ export const createTerminalSessionStarters = (ctx: TerminalSessionStartersContex
       if (unsubscribeChainProgress) unsubscribeChainProgress();
     }
 
-    setTimeout(
-      () =>
-        void runDistroDetection(ctx, {
-          username: effectiveUsername,
-          password: usedPassword,
-          key: usedKey,
-        }),
-      600,
-    );
+    setTimeout(() => void runDistroDetection(ctx), 600);
   };
 
   const startTelnet = async (term: XTerm) => {
@@ -555,7 +539,7 @@ export const createTerminalSessionStarters = (ctx: TerminalSessionStartersContex
 
       ctx.sessionRef.current = id;
       ctx.disposeDataRef.current = ctx.terminalBackend.onSessionData(id, (chunk) => {
-        term.write(chunk);
+        writeOutput(ctx, term, chunk);
         if (!ctx.hasConnectedRef.current) {
           ctx.updateStatus("connected");
           setTimeout(() => {
@@ -652,5 +636,30 @@ export const createTerminalSessionStarters = (ctx: TerminalSessionStartersContex
     }
   };
 
-  return { startSSH, startTelnet, startMosh, startLocal, startSerial };
+  // A tmux pane is already running on the server; its session is registered
+  // by the control channel, so only the stream has to be hooked up
+  const startTmuxPane = async (term: XTerm) => {
+    try {
+      attachSessionToTerminal(ctx, term, ctx.sessionId, {
+        onExitMessage: () => "\r\n[tmux pane closed]",
+      });
+      const { snapshot } = await ctx.terminalBackend.attachTmuxPane(ctx.sessionId);
+      if (snapshot) term.write(snapshot);
+      ctx.updateStatus("connected");
+      ctx.setProgressValue(100);
+      try {
+        ctx.fitAddonRef.current?.fit();
+      } catch (err) {
+        logger.warn("tmux pane fit failed", err);
+      }
+      ctx.terminalBackend.resizeSession(ctx.sessionId, term.cols, term.rows);
+    } catch (err) {
+      const message = err instanceof Error ? err.message : String(err);
+      ctx.setError(message);
+      term.writeln(`\r\n[Failed to attach tmux pane: ${message}]`);
+      ctx.updateStatus("disconnected");
+    }
+  };
+
+  return { startSSH, startTelnet, startMosh, startLocal, startSerial, startTmuxPane };
 };
@@ -11,7 +11,10 @@ import {
   getTerminalPassthroughActions,
 } from "../../../application/state/useGlobalHotkeys";
 import { fontStore } from "../../../application/state/fontStore";
+import { pasteToTerminal, wrapBracketedPaste } from "../../../application/state/pasteEngine";
 import { KeywordHighlighter } from "../keywordHighlight";
+import { createSynchronizedOutput, type SynchronizedOutput } from "./synchronizedOutput";
+import { getXTermThemePalette } from "../../../infrastructure/config/terminalThemes";
 import {
   XTERM_PERFORMANCE_CONFIG,
   type XTermPlatform,
@@ -39,6 +42,8 @@ export type XTermRuntime = {
   fitAddon: FitAddon;
   serializeAddon: SerializeAddon;
   searchAddon: SearchAddon;
+  /** Remote output goes through here so synchronized updates paint at once */
+  synchronizedOutput: SynchronizedOutput;
   dispose: () => void;
   /** Current working directory detected via OSC 7 */
   currentCwd: string | undefined;
@@ -190,10 +195,7 @@ export const createXTermRuntime = (ctx: CreateXTermRuntimeContext): XTermRuntime
     scrollOnUserInput,
     altClickMovesCursor: !altIsMeta,
     wordSeparator,
-    theme: {
-      ...ctx.terminalTheme.colors,
-      selectionBackground: ctx.terminalTheme.colors.selection,
-    },
+    theme: getXTermThemePalette(ctx.terminalTheme),
   });
 
   type MaybeRenderer = {
@@ -374,7 +376,7 @@ export const createXTermRuntime = (ctx: CreateXTermRuntimeContext): XTermRuntime
         case "paste": {
           navigator.clipboard.readText().then((text) => {
             const id = ctx.sessionRef.current;
-            if (id) ctx.terminalBackend.writeToSession(id, normalizeLineEndings(text));
+            if (id) void pasteToTerminal(term, id, normalizeLineEndings(text), ctx.terminalSettingsRef.current);
           });
           break;
         }
@@ -406,7 +408,7 @@ export const createXTermRuntime = (ctx: CreateXTermRuntimeContext): XTermRuntime
       try {
         const text = await navigator.clipboard.readText();
         if (text && ctx.sessionRef.current) {
-          ctx.terminalBackend.writeToSession(ctx.sessionRef.current, normalizeLineEndings(text));
+          void pasteToTerminal(term, ctx.sessionRef.current, normalizeLineEndings(text), ctx.terminalSettingsRef.current);
         }
       } catch (err) {
         logger.warn("[Terminal] Failed to paste from clipboard:", err);
@@ -418,6 +420,65 @@ export const createXTermRuntime = (ctx: CreateXTermRuntimeContext): XTermRuntime
       ctx.container.removeEventListener("auxclick", handleMiddleClick);
   }
 
+  // Local echo for serial connections only when explicitly enabled
+  // (character mode; line mode echoes from its own input buffer)
+  const echoSerialInput = (data: string) => {
+    if (ctx.host.protocol !== "serial" || !ctx.serialLocalEcho) return;
+    if (data === "\r") {
+      term.write("\r\n");
+    } else if (data === "\x7f" || data === "\b") {
+      term.write("\b \b");
+    } else if (data === "\x03") {
+      term.write("^C");
+    } else if (data.charCodeAt(0) >= 32 || data.length > 1) {
+      term.write(data);
+    }
+  };
+
+  // Command history: rebuild the typed line and report it on Enter
+  const trackCommandInput = (data: string) => {
+    if (ctx.statusRef.current !== "connected" || !ctx.onCommandExecuted) return;
+    if (data === "\r" || data === "\n") {
+      const cmd = ctx.commandBufferRef.current.trim();
+      if (cmd) ctx.onCommandExecuted(cmd, ctx.host.id, ctx.host.label, ctx.sessionId);
+      ctx.commandBufferRef.current = "";
+    } else if (data === "\x7f" || data === "\b") {
+      ctx.commandBufferRef.current = ctx.commandBufferRef.current.slice(0, -1);
+    } else if (data === "\x03") {
+      ctx.commandBufferRef.current = "";
+    } else if (data === "\x15") {
+      ctx.commandBufferRef.current = "";
+    } else if (data.length === 1 && data.charCodeAt(0) >= 32) {
+      ctx.commandBufferRef.current += data;
+    } else if (data.length > 1 && !data.startsWith("\x1b")) {
+      ctx.commandBufferRef.current += data;
+    }
+  };
+
+  // Take native paste events (Ctrl/Cmd+V, menu paste) away from xterm, which
+  // would emit the whole clipboard as one onData write, and hand them to the
+  // paste engine instead. Capture phase on the container runs before xterm's
+  // own listeners on the textarea.
+  const handleNativePaste = (e: ClipboardEvent) => {
+    const id = ctx.sessionRef.current;
+    const text = e.clipboardData?.getData("text/plain");
+    // Serial line mode edits pasted text in its own input buffer via onData
+    if (!id || !text || (ctx.host.protocol === "serial" && ctx.serialLineMode)) return;
+    e.preventDefault();
+    e.stopPropagation();
+    // Same line ending handling xterm applies to pasted text
+    const prepared = text.replace(/\r?\n/g, "\r");
+    void pasteToTerminal(term, id, prepared, ctx.terminalSettingsRef.current);
+    // What xterm would have emitted through onData for this paste
+    const pasted = wrapBracketedPaste(prepared, term.modes.bracketedPasteMode);
+    echoSerialInput(pasted);
+    if (ctx.isBroadcastEnabledRef.current && ctx.onBroadcastInputRef.current) {
+      ctx.onBroadcastInputRef.current(pasted, ctx.sessionId);
+    }
+    trackCommandInput(pasted);
+  };
+  ctx.container.addEventListener("paste", handleNativePaste, true);
+
   fitAddon.fit();
   term.focus();
 
@@ -468,42 +529,14 @@ export const createXTermRuntime = (ctx: CreateXTermRuntimeContext): XTermRuntime
       } else {
         // Character mode (default): send immediately
         ctx.terminalBackend.writeToSession(id, data);
-
-        // Local echo for serial connections only when explicitly enabled
-        if (ctx.host.protocol === "serial" && ctx.serialLocalEcho) {
-          if (data === "\r") {
-            term.write("\r\n");
-          } else if (data === "\x7f" || data === "\b") {
-            term.write("\b \b");
-          } else if (data === "\x03") {
-            term.write("^C");
-          } else if (data.charCodeAt(0) >= 32 || data.length > 1) {
-            term.write(data);
-          }
-        }
+        echoSerialInput(data);
       }
 
       if (ctx.isBroadcastEnabledRef.current && ctx.onBroadcastInputRef.current) {
         ctx.onBroadcastInputRef.current(data, ctx.sessionId);
       }
 
-      if (ctx.statusRef.current === "connected" && ctx.onCommandExecuted) {
-        if (data === "\r" || data === "\n") {
-          const cmd = ctx.commandBufferRef.current.trim();
-          if (cmd) ctx.onCommandExecuted(cmd, ctx.host.id, ctx.host.label, ctx.sessionId);
-          ctx.commandBufferRef.current = "";
-        } else if (data === "\x7f" || data === "\b") {
-          ctx.commandBufferRef.current = ctx.commandBufferRef.current.slice(0, -1);
-        } else if (data === "\x03") {
-          ctx.commandBufferRef.current = "";
-        } else if (data === "\x15") {
-          ctx.commandBufferRef.current = "";
-        } else if (data.length === 1 && data.charCodeAt(0) >= 32) {
-          ctx.commandBufferRef.current += data;
-        } else if (data.length > 1 && !data.startsWith("\x1b")) {
-          ctx.commandBufferRef.current += data;
-        }
-      }
+      trackCommandInput(data);
     }
   });
 
@@ -537,6 +570,17 @@ export const createXTermRuntime = (ctx: CreateXTermRuntimeContext): XTermRuntime
     return true; // Indicate we handled the sequence
   });
 
+  const synchronizedOutput = createSynchronizedOutput(term);
+
+  // DECRQM for mode 2026: apps only use synchronized updates once the
+  // terminal reports it (1 = set, 2 = reset)
+  term.parser.registerCsiHandler({ prefix: "?", intermediates: "$", final: "p" }, (params) => {
+    if (params[0] !== 2026) return false;
+    const id = ctx.sessionRef.current;
+    if (id) ctx.terminalBackend.writeToSession(id, `\x1b[?2026;${synchronizedOutput.active ? 1 : 2}$y`);
+    return true;
+  });
+
   let resizeTimeout: NodeJS.Timeout | null = null;
   const resizeDebounceMs = XTERM_PERFORMANCE_CONFIG.resize.debounceMs;
   term.onResize(({ cols, rows }) => {
@@ -557,9 +601,12 @@ export const createXTermRuntime = (ctx: CreateXTermRuntimeContext): XTermRuntime
     fitAddon,
     serializeAddon,
     searchAddon,
+    synchronizedOutput,
     keywordHighlighter,
     dispose: () => {
       cleanupMiddleClick?.();
+      synchronizedOutput.dispose();
+      ctx.container.removeEventListener("paste", handleNativePaste, true);
       keywordHighlighter.dispose();
       try {
         term.dispose();
@@ -0,0 +1,114 @@
+import type { Terminal as XTerm } from "@xterm/xterm";
+import { recordSyncFrame } from "../../../lib/renderProfiler";
+
+/**
+ * Synchronized output (DEC private mode 2026)
+ *
+ * TUIs wrap a redraw in `CSI ? 2026 h` ... `CSI ? 2026 l` so the terminal
+ * can show it as one frame. xterm.js 5.5 ignores the mode and paints
+ * whatever has arrived at each animation frame, so a redraw split over
+ * several IPC batches tears. Remote output goes through this filter instead
+ * of straight into term.write(): between the markers it is held and then
+ * written in one go, or flushed anyway after SYNC_TIMEOUT_MS so a client
+ * that never ends the update cannot freeze the screen.
+ *
+ * The markers themselves are passed through; xterm treats them as an
+ * unknown mode.
+ */
+
+const BEGIN = "\x1b[?2026h";
+const END = "\x1b[?2026l";
+const MARKER_LENGTH = BEGIN.length;
+// Same order of magnitude other terminals use; long enough for a slow link
+// to deliver a full redraw, short enough not to look like a hang
+const SYNC_TIMEOUT_MS = 150;
+// Held output beyond this is flushed even without an end marker
+const MAX_HELD_CHARS = 4 * 1024 * 1024;
+
+export type SynchronizedOutput = {
+  write: (data: string) => void;
+  /** Inside a synchronized update (for DECRQM replies) */
+  readonly active: boolean;
+  dispose: () => void;
+};
+
+export const createSynchronizedOutput = (term: XTerm): SynchronizedOutput => {
+  let active = false;
+  let held: string[] = [];
+  let heldChars = 0;
+  let heldSince = 0;
+  let timer: ReturnType<typeof setTimeout> | null = null;
+  // Last few characters already processed, so a marker split across two
+  // chunks is still found
+  let tail = "";
+
+  const flush = (timedOut: boolean) => {
+    if (timer) {
+      clearTimeout(timer);
+      timer = null;
+    }
+    active = false;
+    if (held.length === 0) return;
+    const writes = held.length;
+    term.write(writes === 1 ? held[0] : held.join(""));
+    recordSyncFrame({ writes, chars: heldChars, heldMs: performance.now() - heldSince, timedOut });
+    held = [];
+    heldChars = 0;
+  };
+
+  const hold = (data: string) => {
+    if (!data) return;
+    held.push(data);
+    heldChars += data.length;
+    if (heldChars > MAX_HELD_CHARS) flush(true);
+  };
+
+  const begin = () => {
+    active = true;
+    heldSince = performance.now();
+    timer = setTimeout(() => flush(true), SYNC_TIMEOUT_MS);
+  };
+
+  const write = (data: string) => {
+    if (!data) return;
+    const combined = tail + data;
+    // Positions in `combined`; everything before `cursor` has been handled
+    let cursor = tail.length;
+    let searchFrom = 0;
+    while (cursor < combined.length) {
+      const marker = active ? END : BEGIN;
+      const found = combined.indexOf(marker, searchFrom);
+      if (found === -1) {
+        const rest = combined.slice(cursor);
+        if (active) hold(rest);
+        else term.write(rest);
+        break;
+      }
+      const end = found + MARKER_LENGTH;
+      const upToMarker = combined.slice(cursor, end);
+      if (active) {
+        hold(upToMarker);
+        flush(false);
+      } else {
+        if (upToMarker) term.write(upToMarker);
+        begin();
+      }
+      cursor = end;
+      searchFrom = end;
+    }
+    tail = combined.slice(-(MARKER_LENGTH - 1));
+  };
+
+  return {
+    write,
+    get active() {
+      return active;
+    },
+    dispose: () => {
+      if (timer) clearTimeout(timer);
+      timer = null;
+      held = [];
+      heldChars = 0;
+    },
+  };
+};
@@ -0,0 +1,104 @@
+/**
+ * Terminal appearance scheduler
+ *
+ * Theme and font changes touch every open terminal at once. With the WebGL
+ * renderer each option change rebuilds the glyph atlas, so applying a switch
+ * to 30 terminals synchronously blocks the UI for seconds.
+ *
+ * Terminals register their latest "apply appearance" callback here instead of
+ * mutating xterm options directly:
+ * - visible terminals are applied first, one per animation frame
+ * - hidden terminals keep only their latest pending update, which is applied
+ *   when the terminal is revealed
+ */
+
+type ApplyAppearance = () => void;
+
+interface SchedulerEntry {
+  visible: boolean;
+  pending: ApplyAppearance | null;
+}
+
+const requestFrame = (cb: () => void): void => {
+  if (typeof requestAnimationFrame === "function") {
+    requestAnimationFrame(cb);
+  } else {
+    setTimeout(cb, 16);
+  }
+};
+
+class TerminalAppearanceScheduler {
+  private entries = new Map<string, SchedulerEntry>();
+  private queue: string[] = [];
+  private frameScheduled = false;
+
+  private getEntry = (id: string): SchedulerEntry => {
+    let entry = this.entries.get(id);
+    if (!entry) {
+      entry = { visible: false, pending: null };
+      this.entries.set(id, entry);
+    }
+    return entry;
+  };
+
+  private run = (id: string) => {
+    const entry = this.entries.get(id);
+    const apply = entry?.pending;
+    if (!entry || !apply) return;
+    entry.pending = null;
+    try {
+      apply();
+    } catch (err) {
+      console.warn("[TerminalAppearance] apply failed", err);
+    }
+  };
+
+  private pump = () => {
+    this.frameScheduled = false;
+    // Skip ids that were flushed or hidden since being queued.
+    while (this.queue.length > 0) {
+      const id = this.queue.shift()!;
+      const entry = this.entries.get(id);
+      if (!entry?.pending || !entry.visible) continue;
+      this.run(id);
+      break;
+    }
+    if (this.queue.length > 0) this.requestPump();
+  };
+
+  private requestPump = () => {
+    if (this.frameScheduled) return;
+    this.frameScheduled = true;
+    requestFrame(this.pump);
+  };
+
+  /**
+   * Queue the latest appearance update for a terminal. Earlier pending updates
+   * for the same terminal are replaced, since each callback applies the full
+   * current appearance.
+   */
+  schedule = (id: string, apply: ApplyAppearance) => {
+    const entry = this.getEntry(id);
+    entry.pending = apply;
+    if (!entry.visible) return;
+    if (!this.queue.includes(id)) this.queue.push(id);
+    this.requestPump();
+  };
+
+  /**
+   * Update visibility. Revealing a terminal applies its pending update right
+   * away so it never paints with stale colors or metrics.
+   */
+  setVisible = (id: string, visible: boolean) => {
+    const entry = this.getEntry(id);
+    entry.visible = visible;
+    if (visible && entry.pending) this.run(id);
+  };
+
+  unregister = (id: string) => {
+    this.entries.delete(id);
+    this.queue = this.queue.filter((queued) => queued !== id);
+  };
+}
+
+export const terminalAppearanceScheduler = new TerminalAppearanceScheduler();
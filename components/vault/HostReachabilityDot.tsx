@@ -0,0 +1,52 @@
+import React, { memo } from "react";
+import { useI18n } from "../../application/i18n/I18nProvider";
+import { useHostReachability } from "../../application/state/reachabilityStore";
+import { cn } from "../../lib/utils";
+
+// Above this the host is reachable but slow
+const SLOW_RTT_MS = 300;
+
+interface HostReachabilityDotProps {
+  hostId: string;
+  className?: string;
+}
+
+/**
+ * Status dot for the last reachability scan of a host. Renders nothing until
+ * the host has been scanned.
+ */
+const HostReachabilityDotInner: React.FC<HostReachabilityDotProps> = ({ hostId, className }) => {
+  const { t } = useI18n();
+  const result = useHostReachability(hostId);
+  if (!result || result.status === "unknown") return null;
+
+  const up = result.status === "up";
+  const slow = up && (result.rttMs ?? 0) > SLOW_RTT_MS;
+  const keyMismatch = result.hostKey === "mismatch";
+
+  const lines: string[] = [];
+  if (up) {
+    lines.push(t("vault.reachability.up", { rtt: result.rttMs ?? "?" }));
+    if (result.banner) lines.push(result.banner);
+    if (keyMismatch) lines.push(t("vault.reachability.keyMismatch"));
+  } else {
+    lines.push(t("vault.reachability.down", { error: result.error || "" }));
+    if (result.lastSeen) {
+      lines.push(t("vault.reachability.lastSeen", { time: new Date(result.lastSeen).toLocaleString() }));
+    }
+  }
+
+  return (
+    <span
+      className={cn(
+        "inline-block h-2 w-2 rounded-full shrink-0",
+        !up ? "bg-red-500" : keyMismatch ? "bg-orange-500" : slow ? "bg-yellow-500" : "bg-emerald-500",
+        className,
+      )}
+      title={lines.join("\n")}
+    />
+  );
+};
+
+export const HostReachabilityDot = memo(HostReachabilityDotInner);
+HostReachabilityDot.displayName = "HostReachabilityDot";
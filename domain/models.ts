@@ -1,14 +1,24 @@
 // Proxy configuration for SSH connections
-export type ProxyType = 'http' | 'socks5';
+// 'wan' is a local test proxy that shapes a direct connection (latency, loss, ...)
+export type ProxyType = 'http' | 'socks5' | 'wan';
 // UI locale identifier, stored in settings and used for i18n (e.g., "en", "zh-CN").
 export type UILanguage = string;
 
+// Link shaping for the 'wan' test proxy
+export interface WanEmulationConfig {
+  latencyMs?: number; // Added round-trip time
+  jitterMs?: number;
+  bandwidthKbps?: number; // Per direction, 0 = unlimited
+  lossPercent?: number;
+}
+
 export interface ProxyConfig {
   type: ProxyType;
   host: string;
   port: number;
   username?: string;
   password?: string;
+  wan?: WanEmulationConfig;
 }
 
 // Host chain configuration for jump host / bastion connections
@@ -51,6 +61,15 @@ export interface ProtocolConfig {
   theme?: string;
 }
 
+// SSH transport choices measured by the host "tune" action
+export interface SshTransportProfile {
+  cipher: 'aes-gcm' | 'chacha20';
+  compression: boolean;
+  windowSize: number; // Channel receive window in bytes
+  throughput?: number; // Bytes/s achieved during the tune run
+  tunedAt?: number;
+}
+
 export interface Host {
   id: string;
   label: string;
@@ -94,6 +113,9 @@ export interface Host {
   // SFTP specific configuration
   sftpSudo?: boolean; // Use sudo for SFTP operations (requires password)
   sftpEncoding?: SftpFilenameEncoding; // Filename encoding for SFTP operations
+  sftpAtomicUpload?: boolean; // Upload to a temp file, then rename over the target
+  // Transport tuning (cipher, compression, window) applied to SSH/SFTP/port forwards
+  transportProfile?: SshTransportProfile;
   // Managed source: if this host is managed by an external file (e.g., ~/.ssh/config)
   managedSourceId?: string; // Reference to ManagedSource.id
 }
@@ -371,6 +393,7 @@ export interface TerminalSettings {
   scrollOnOutput: boolean; // Scroll terminal to bottom on output
   scrollOnKeyPress: boolean; // Scroll terminal to bottom on key press
   scrollOnPaste: boolean; // Scroll terminal to bottom on paste
+  pasteLineDelay: number; // Milliseconds to wait after each pasted line (0 = no pacing)
 
   // Mouse
   rightClickBehavior: RightClickBehavior;
@@ -424,6 +447,7 @@ export const DEFAULT_TERMINAL_SETTINGS: TerminalSettings = {
   scrollOnOutput: false,
   scrollOnKeyPress: false,
   scrollOnPaste: true,
+  pasteLineDelay: 0, // 0 = send as fast as the connection drains
   rightClickBehavior: 'context-menu',
   copyOnSelect: false,
   middleClickPaste: true,
@@ -482,6 +506,18 @@ export interface TerminalSession {
   moshEnabled?: boolean;
   // Serial-specific connection settings
   serialConfig?: SerialConfig;
+  // Restored from the previous run; connects once the tab is focused
+  restorePending?: boolean;
+  // A pane of a tmux control mode session; streams through the control channel
+  tmux?: TmuxPaneRef;
+}
+
+export interface TmuxPaneRef {
+  controlId: string;
+  windowId: string;
+  paneId: string;
+  // The SSH tab whose connection carries the control channel
+  ownerSessionId: string;
 }
 
 export interface RemoteFile {
@@ -600,6 +636,9 @@ export interface PortForwardingRule {
   hostId?: string;
   // Auto-start: if true, this rule will automatically start when the app launches
   autoStart?: boolean;
+  // On demand: bind the listener right away but only connect SSH while clients
+  // are using it (local and dynamic rules only)
+  onDemand?: boolean;
   // Runtime state
   status: PortForwardingStatus;
   error?: string;
@@ -630,6 +669,18 @@ export interface ShellHistoryEntry {
 }
 
 // Connection Log - records connection history
+// Where the time went while opening an SSH connection (milliseconds)
+export interface ConnectTiming {
+  dnsMs: number;
+  tcpMs: number; // TCP connect, or proxy / jump-host socket setup when tunneled
+  kexMs: number; // Banner exchange and key exchange
+  authMs: number;
+  totalMs: number;
+  address?: string; // Address that won the IPv6/IPv4 race
+  dnsCached?: boolean;
+  tunneled?: boolean;
+}
+
 export interface ConnectionLog {
   id: string;
   sessionId?: string; // Terminal session ID for matching during capture
@@ -646,6 +697,7 @@ export interface ConnectionLog {
   terminalData?: string; // Captured terminal output data for replay
   themeId?: string; // Terminal theme ID for this log view
   fontSize?: number; // Terminal font size for this log view
+  connectTiming?: ConnectTiming; // SSH connect breakdown (DNS, TCP, KEX, auth)
 }
 
 // Session Logs Settings - for auto-saving terminal logs to local filesystem
@@ -107,6 +107,7 @@ export interface ProviderConnection {
   config?: WebDAVConfig | S3Config;
   lastSync?: number;        // Unix timestamp
   lastSyncVersion?: number;
+  lastSyncRevision?: string; // Remote revision (ETag / file version) seen at the last sync
   resourceId?: string;      // gistId / fileId / itemId
   error?: string;
 }
@@ -128,7 +129,9 @@ export interface SyncFileMeta {
   salt: string;             // KDF salt for key derivation (Base64)
   algorithm: 'AES-256-GCM'; // Encryption algorithm identifier
   kdf: 'PBKDF2' | 'Argon2id'; // Key derivation function
-  kdfIterations?: number;   // PBKDF2 iterations (if applicable)
+  kdfIterations?: number;   // PBKDF2 iterations, or Argon2id passes
+  kdfMemoryKiB?: number;    // Argon2id memory cost
+  kdfParallelism?: number;  // Argon2id lanes
 }
 
 /**
@@ -140,6 +143,16 @@ export interface SyncedFile {
   payload: string;          // Base64 encrypted ciphertext
 }
 
+/**
+ * Result of uploading the sync file
+ */
+export interface SyncUploadResult {
+  resourceId: string;
+  // Remote revision as reported by the upload response itself; null when the
+  // provider returns none (never probed afterwards, which could race)
+  revision: string | null;
+}
+
 /**
  * Decrypted payload structure - contains all syncable data
  */
@@ -218,11 +231,15 @@ export interface DecryptionInput {
  * Master key configuration stored in safeStorage
  */
 export interface MasterKeyConfig {
+  // Config format: absent/1 = PBKDF2 only, 2 = adds Argon2id parameters
+  version?: number;
   // Verification hash to confirm correct password
   verificationHash: string; // Base64 of hash(derived_key)
   salt: string;             // Base64 KDF salt
   kdf: 'PBKDF2' | 'Argon2id';
-  kdfIterations?: number;
+  kdfIterations?: number;   // PBKDF2 iterations, or Argon2id passes
+  kdfMemoryKiB?: number;    // Argon2id memory cost (calibrated per machine)
+  kdfParallelism?: number;  // Argon2id lanes
   createdAt: number;
 }
 
@@ -397,6 +414,13 @@ export const SYNC_CONSTANTS = {
   // PBKDF2
   PBKDF2_ITERATIONS: 600000, // OWASP recommended minimum
   PBKDF2_HASH: 'SHA-256',
+
+  // Argon2id (opt-in for the master key; memory is calibrated to the target time)
+  MASTER_KEY_CONFIG_VERSION: 2,
+  ARGON2_TARGET_UNLOCK_MS: 1000,
+  ARGON2_ITERATIONS: 2,
+  ARGON2_MIN_MEMORY_KIB: 19456,  // OWASP minimum for t=2, p=1
+  ARGON2_MAX_MEMORY_KIB: 262144,
   
   // Sync
   SYNC_FILE_NAME: 'netcatty-vault.json',
@@ -185,6 +185,37 @@ export const collectSessionIds = (node: WorkspaceNode): string[] => {
   return node.children.flatMap(child => collectSessionIds(child));
 };
 
+/**
+ * Build a workspace tree from a tmux window layout. Split sizes follow the
+ * tmux cell sizes so the native panes start out matching the remote ones.
+ */
+export const createWorkspaceNodeFromTmuxLayout = (layout: NetcattyTmuxLayoutNode): WorkspaceNode => {
+  if (layout.type === 'pane') {
+    return { id: crypto.randomUUID(), type: 'pane', sessionId: layout.sessionId };
+  }
+  const sizes = layout.children.map(child => (layout.direction === 'vertical' ? child.width : child.height) || 1);
+  const total = sizes.reduce((acc, n) => acc + n, 0) || 1;
+  return {
+    id: crypto.randomUUID(),
+    type: 'split',
+    direction: layout.direction,
+    children: layout.children.map(child => createWorkspaceNodeFromTmuxLayout(child)),
+    sizes: sizes.map(n => n / total),
+  };
+};
+
+/**
+ * Same pane tree shape (ignoring sizes)
+ */
+export const isSameTmuxLayoutShape = (node: WorkspaceNode, layout: NetcattyTmuxLayoutNode): boolean => {
+  if (node.type === 'pane' || layout.type === 'pane') {
+    return node.type === 'pane' && layout.type === 'pane' && node.sessionId === layout.sessionId;
+  }
+  return node.direction === layout.direction
+    && node.children.length === layout.children.length
+    && node.children.every((child, idx) => isSameTmuxLayoutShape(child, layout.children[idx]));
+};
+
 /**
  * Find a pane node by session ID in the workspace tree.
  */
@@ -141,7 +141,8 @@ const handleWebdavUpload = async (config, syncedFile) => {
     const client = buildWebdavClient(config);
     const path = getWebdavPath();
     await client.putFileContents(path, JSON.stringify(syncedFile), { overwrite: true });
-    return { resourceId: path };
+    // putFileContents does not expose the response ETag; the next sync probes
+    return { resourceId: path, revision: null };
   } catch (error) {
     throw wrapWebdavError("upload", error, config);
   }
@@ -161,6 +162,20 @@ const handleWebdavDownload = async (config) => {
   }
 };
 
+// PROPFIND (Depth 0) on the sync file; the ETag changes whenever the content does
+const handleWebdavRevision = async (config) => {
+  try {
+    const client = buildWebdavClient(config);
+    const path = getWebdavPath();
+    const stat = await client.stat(path);
+    const revision = stat?.etag || (stat?.lastmod ? `${stat.lastmod}:${stat.size}` : null);
+    return { revision };
+  } catch (error) {
+    if (error?.status === 404) return { revision: null };
+    throw wrapWebdavError("revision", error, config);
+  }
+};
+
 const handleWebdavDelete = async (config) => {
   try {
     const client = buildWebdavClient(config);
@@ -203,8 +218,9 @@ const handleS3Upload = async (config, syncedFile) => {
   if (!config) throw new Error("Missing S3 config");
   const client = buildS3Client(config);
   const key = getS3ObjectKey(config);
+  let response;
   try {
-    await client.send(
+    response = await client.send(
       new PutObjectCommand({
         Bucket: config.bucket,
         Key: key,
@@ -215,7 +231,8 @@ const handleS3Upload = async (config, syncedFile) => {
   } catch (error) {
     throw wrapS3Error("upload", error, config);
   }
-  return { resourceId: key };
+  // Same ETag HeadObject reports for the revision probe
+  return { resourceId: key, revision: response?.ETag || null };
 };
 
 const handleS3Download = async (config) => {
@@ -235,6 +252,20 @@ const handleS3Download = async (config) => {
   }
 };
 
+const handleS3Revision = async (config) => {
+  if (!config) throw new Error("Missing S3 config");
+  const client = buildS3Client(config);
+  const key = getS3ObjectKey(config);
+  try {
+    const response = await client.send(new HeadObjectCommand({ Bucket: config.bucket, Key: key }));
+    const revision = response.ETag || response.LastModified?.toISOString() || null;
+    return { revision };
+  } catch (error) {
+    if (isS3NotFound(error)) return { revision: null };
+    throw wrapS3Error("revision", error, config);
+  }
+};
+
 const handleS3Delete = async (config) => {
   if (!config) throw new Error("Missing S3 config");
   const client = buildS3Client(config);
@@ -258,6 +289,9 @@ const registerHandlers = (ipcMain) => {
   ipcMain.handle("netcatty:cloudSync:webdav:download", async (_event, payload) => {
     return handleWebdavDownload(payload?.config);
   });
+  ipcMain.handle("netcatty:cloudSync:webdav:revision", async (_event, payload) => {
+    return handleWebdavRevision(payload?.config);
+  });
   ipcMain.handle("netcatty:cloudSync:webdav:delete", async (_event, payload) => {
     return handleWebdavDelete(payload?.config);
   });
@@ -271,6 +305,9 @@ const registerHandlers = (ipcMain) => {
   ipcMain.handle("netcatty:cloudSync:s3:download", async (_event, payload) => {
     return handleS3Download(payload?.config);
   });
+  ipcMain.handle("netcatty:cloudSync:s3:revision", async (_event, payload) => {
+    return handleS3Revision(payload?.config);
+  });
   ipcMain.handle("netcatty:cloudSync:s3:delete", async (_event, payload) => {
     return handleS3Delete(payload?.config);
   });
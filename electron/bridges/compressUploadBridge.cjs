@@ -8,6 +8,7 @@ const fs = require("node:fs");
 const path = require("node:path");
 const { spawn } = require("node:child_process");
 const { getTempFilePath } = require("./tempDirBridge.cjs");
+const remoteCapabilities = require("./remoteCapabilities.cjs");
 
 /**
  * Escape shell arguments to prevent injection attacks
@@ -21,6 +22,7 @@ function escapeShellArg(arg) {
 // Shared references
 let sftpClients = null;
 let transferBridge = null;
+let sftpBridge = null;
 
 // Active compress operations
 const activeCompressions = new Map();
@@ -31,6 +33,7 @@ const activeCompressions = new Map();
 function init(deps) {
   sftpClients = deps.sftpClients;
   transferBridge = deps.transferBridge;
+  sftpBridge = deps.sftpBridge;
 }
 
 /**
@@ -50,37 +53,19 @@ async function checkTarAvailable() {
 
 /**
  * Check if tar command is available on remote server
+ * Uses the per-host capability cache, probing once over the SFTP connection
  */
 async function checkRemoteTarAvailable(sftpId) {
   try {
     const client = sftpClients.get(sftpId);
     if (!client) throw new Error("SFTP session not found");
     
-    // Try to execute tar --version via SSH
     const sshClient = client.client; // Get underlying SSH2 client
     if (!sshClient) throw new Error("SSH client not available");
     
-    return new Promise((resolve) => {
-      sshClient.exec('tar --version', (err, stream) => {
-        if (err) {
-          resolve(false);
-          return;
-        }
-        
-        let hasOutput = false;
-        stream.on('data', () => {
-          hasOutput = true;
-        });
-        
-        stream.on('close', (code) => {
-          resolve(code === 0 && hasOutput);
-        });
-        
-        stream.on('error', () => {
-          resolve(false);
-        });
-      });
-    });
+    const capabilityKey = sftpBridge?.getSessionCapabilityKey?.(sftpId);
+    const capabilities = await remoteCapabilities.ensureCapabilities(sshClient, capabilityKey);
+    return !!capabilities?.tools?.tar;
   } catch {
     return false;
   }
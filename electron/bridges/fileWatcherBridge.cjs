@@ -9,6 +9,7 @@
 const fs = require("node:fs");
 const path = require("node:path");
 const crypto = require("node:crypto");
+const log = require("./logBridge.cjs").createLogger("FileWatcher");
 
 // Lazy-load encodePathForSession to avoid circular dependency issues
 let encodePathForSession = null;
@@ -43,7 +44,7 @@ function registerTempFile(sftpId, localPath) {
     tempFilesMap.set(sftpId, new Set());
   }
   tempFilesMap.get(sftpId).add(localPath);
-  console.log(`[FileWatcher] Registered temp file for cleanup: ${localPath} (session: ${sftpId})`);
+  log.debug(`Registered temp file for cleanup: ${localPath} (session: ${sftpId})`);
 }
 
 /**
@@ -53,7 +54,7 @@ function registerTempFile(sftpId, localPath) {
 function showSystemNotification(title, body) {
   try {
     if (!electronModule?.Notification) {
-      console.warn("[FileWatcher] Electron Notification API not available");
+      log.warn("Electron Notification API not available");
       return;
     }
     
@@ -61,7 +62,7 @@ function showSystemNotification(title, body) {
     
     // Check if notifications are supported
     if (!Notification.isSupported()) {
-      console.warn("[FileWatcher] System notifications not supported on this platform");
+      log.warn("System notifications not supported on this platform");
       return;
     }
     
@@ -73,7 +74,7 @@ function showSystemNotification(title, body) {
     
     notification.show();
   } catch (err) {
-    console.warn("[FileWatcher] Failed to show system notification:", err.message);
+    log.warn("Failed to show system notification:", err.message);
   }
 }
 
@@ -84,7 +85,7 @@ function showSystemNotification(title, body) {
 async function startWatching(event, { localPath, remotePath, sftpId, encoding }) {
   const watchId = `watch-${crypto.randomUUID()}`;
   
-  console.log(`[FileWatcher] Starting watch: ${localPath} -> ${remotePath}`);
+  log.info(`Starting watch: ${localPath} -> ${remotePath}`);
   
   // Get initial file stats
   let lastModified;
@@ -93,9 +94,9 @@ async function startWatching(event, { localPath, remotePath, sftpId, encoding })
     const stat = await fs.promises.stat(localPath);
     lastModified = stat.mtimeMs;
     lastSize = stat.size;
-    console.log(`[FileWatcher] Initial file stats: mtime=${lastModified}, size=${lastSize}`);
+    log.debug(`Initial file stats: mtime=${lastModified}, size=${lastSize}`);
   } catch (err) {
-    console.error(`[FileWatcher] Failed to stat file ${localPath}:`, err.message);
+    log.error(`Failed to stat file ${localPath}:`, err.message);
     throw new Error(`Cannot watch file: ${err.message}`);
   }
   
@@ -108,20 +109,18 @@ async function startWatching(event, { localPath, remotePath, sftpId, encoding })
   const pollInterval = 1000; // Check every 1 second
   
   fs.watchFile(localPath, { persistent: true, interval: pollInterval }, async (curr, prev) => {
-    console.log(`[FileWatcher] File stat change detected for ${localPath}`);
-    console.log(`[FileWatcher]   Previous: mtime=${prev.mtimeMs}, size=${prev.size}`);
-    console.log(`[FileWatcher]   Current: mtime=${curr.mtimeMs}, size=${curr.size}`);
+    log.debug(() => `File stat change detected for ${localPath}: mtime ${prev.mtimeMs} -> ${curr.mtimeMs}, size ${prev.size} -> ${curr.size}`);
     
     // Check if file was deleted
     if (curr.nlink === 0) {
-      console.log(`[FileWatcher] File ${localPath} was deleted, stopping watch`);
+      log.debug(`File ${localPath} was deleted, stopping watch`);
       stopWatching(null, { watchId });
       return;
     }
     
     // Check if file was actually modified
     if (curr.mtimeMs <= prev.mtimeMs && curr.size === prev.size) {
-      console.log(`[FileWatcher] File unchanged, skipping`);
+      log.debug(`File unchanged, skipping`);
       return;
     }
     
@@ -151,7 +150,7 @@ async function startWatching(event, { localPath, remotePath, sftpId, encoding })
     useWatchFile: true, // Flag to indicate we're using fs.watchFile
   });
   
-  console.log(`[FileWatcher] Watch started with ID: ${watchId} (using fs.watchFile polling every ${pollInterval}ms)`);
+  log.info(`Watch started with ID: ${watchId} (using fs.watchFile polling every ${pollInterval}ms)`);
   return { watchId };
 }
 
@@ -172,7 +171,7 @@ async function handleFileChange(watchId, webContents) {
   // Extract file name once for notifications and logging
   const fileName = path.basename(remotePath);
   
-  console.log(`[FileWatcher] File change detected: ${localPath}`);
+  log.debug(`File change detected: ${localPath}`);
   
   try {
     // Check if file was actually modified (compare mtime and size)
@@ -180,7 +179,7 @@ async function handleFileChange(watchId, webContents) {
     
     // Skip if neither mtime nor size changed (prevents spurious events on some platforms)
     if (stat.mtimeMs <= previousModified && stat.size === previousSize) {
-      console.log(`[FileWatcher] File unchanged (mtime and size same), skipping sync`);
+      log.debug(`File unchanged (mtime and size same), skipping sync`);
       return;
     }
     
@@ -201,13 +200,13 @@ async function handleFileChange(watchId, webContents) {
     // Read the local file
     const content = await fs.promises.readFile(localPath);
     
-    console.log(`[FileWatcher] Syncing ${content.length} bytes to ${remotePath}`);
+    log.debug(`Syncing ${content.length} bytes to ${remotePath}`);
     
     // Upload to remote
     const encodedPath = encodePathForSession(sftpId, remotePath, encoding);
     await client.put(content, encodedPath);
     
-    console.log(`[FileWatcher] Sync complete: ${remotePath}`);
+    log.info(`Sync complete: ${remotePath}`);
     
     // Show system notification for successful sync
     showSystemNotification(
@@ -226,7 +225,7 @@ async function handleFileChange(watchId, webContents) {
     }
     
   } catch (err) {
-    console.error(`[FileWatcher] Sync failed for ${localPath}:`, err.message);
+    log.error(`Sync failed for ${localPath}:`, err.message);
     
     // Show system notification for sync failure
     showSystemNotification(
@@ -252,11 +251,11 @@ async function handleFileChange(watchId, webContents) {
 function stopWatching(event, { watchId, cleanupTempFile = false }) {
   const watchInfo = activeWatchers.get(watchId);
   if (!watchInfo) {
-    console.log(`[FileWatcher] Watch ID not found: ${watchId}`);
+    log.debug(`Watch ID not found: ${watchId}`);
     return { success: false };
   }
   
-  console.log(`[FileWatcher] Stopping watch: ${watchInfo.localPath}`);
+  log.info(`Stopping watch: ${watchInfo.localPath}`);
   
   // Clear debounce timer if any
   const timer = debounceTimers.get(watchId);
@@ -275,7 +274,7 @@ function stopWatching(event, { watchId, cleanupTempFile = false }) {
       watchInfo.watcher.close();
     }
   } catch (err) {
-    console.warn(`[FileWatcher] Error stopping watcher:`, err.message);
+    log.warn(`Error stopping watcher:`, err.message);
   }
   
   // Clean up temp file if requested
@@ -294,10 +293,10 @@ function stopWatching(event, { watchId, cleanupTempFile = false }) {
 async function cleanupTempFileAsync(filePath) {
   try {
     await fs.promises.unlink(filePath);
-    console.log(`[FileWatcher] Temp file cleaned up: ${filePath}`);
+    log.debug(`Temp file cleaned up: ${filePath}`);
   } catch (err) {
     // Silently ignore deletion failures (file may be in use or already deleted)
-    console.log(`[FileWatcher] Could not delete temp file (may be in use): ${filePath}`);
+    log.debug(`Could not delete temp file (may be in use): ${filePath}`);
   }
 }
 
@@ -316,7 +315,7 @@ function stopWatchersForSession(sftpId, cleanupTempFiles = true) {
     }
   }
   if (watcherCount > 0) {
-    console.log(`[FileWatcher] Stopped ${watcherCount} watcher(s) for SFTP session: ${sftpId}`);
+    log.info(`Stopped ${watcherCount} watcher(s) for SFTP session: ${sftpId}`);
   }
   
   // Clean up any registered temp files that weren't being watched
@@ -329,7 +328,7 @@ function stopWatchersForSession(sftpId, cleanupTempFiles = true) {
     }
     tempFilesMap.delete(sftpId);
     if (cleanedCount > 0) {
-      console.log(`[FileWatcher] Queued cleanup for ${cleanedCount} temp file(s) for SFTP session: ${sftpId}`);
+      log.debug(`Queued cleanup for ${cleanedCount} temp file(s) for SFTP session: ${sftpId}`);
     }
   }
 }
@@ -354,9 +353,9 @@ function listWatchers() {
  * Register IPC handlers for file watching operations
  */
 function registerHandlers(ipcMain) {
-  console.log("[FileWatcher] Registering IPC handlers");
+  log.debug("Registering IPC handlers");
   ipcMain.handle("netcatty:filewatch:start", (event, args) => {
-    console.log("[FileWatcher] IPC netcatty:filewatch:start received", args);
+    log.debug("IPC netcatty:filewatch:start received", args);
     return startWatching(event, args);
   });
   ipcMain.handle("netcatty:filewatch:stop", stopWatching);
@@ -371,7 +370,7 @@ function registerHandlers(ipcMain) {
  * Cleanup all watchers on shutdown
  */
 function cleanup() {
-  console.log(`[FileWatcher] Cleaning up ${activeWatchers.size} watcher(s)`);
+  log.info(`Cleaning up ${activeWatchers.size} watcher(s)`);
   for (const [watchId] of activeWatchers.entries()) {
     stopWatching(null, { watchId });
   }
@@ -10,6 +10,13 @@ const GOOGLE_USERINFO_URL = "https://www.googleapis.com/oauth2/v2/userinfo";
 const GOOGLE_DRIVE_API = "https://www.googleapis.com/drive/v3";
 const GOOGLE_DRIVE_UPLOAD_API = "https://www.googleapis.com/upload/drive/v3";
 const DEFAULT_SYNC_FILE_NAME = "netcatty-vault.json";
+// Drive file metadata that identifies a content revision
+const REVISION_FIELDS = "version,md5Checksum,modifiedTime";
+
+const toRevision = (data) => {
+  const revision = data?.version || data?.md5Checksum || data?.modifiedTime || null;
+  return revision ? String(revision) : null;
+};
 
 const isNonEmptyString = (v) => typeof v === "string" && v.trim().length > 0;
 
@@ -269,7 +276,7 @@ function registerHandlers(ipcMain, electronModule) {
 
     let res;
     try {
-      res = await fetchImpl(`${GOOGLE_DRIVE_UPLOAD_API}/files?uploadType=multipart`, {
+      res = await fetchImpl(`${GOOGLE_DRIVE_UPLOAD_API}/files?uploadType=multipart&fields=id,${REVISION_FIELDS}`, {
         method: "POST",
         headers: {
           Authorization: `Bearer ${accessToken}`,
@@ -301,7 +308,7 @@ function registerHandlers(ipcMain, electronModule) {
       throw new Error(`Google Drive upload invalid response: ${text.slice(0, 200)}`);
     }
 
-    return { fileId };
+    return { fileId, revision: toRevision(data) };
   });
 
   ipcMain.handle("netcatty:google:drive:updateSyncFile", async (_event, payload) => {
@@ -314,15 +321,18 @@ function registerHandlers(ipcMain, electronModule) {
 
     let res;
     try {
-      res = await fetchImpl(`${GOOGLE_DRIVE_UPLOAD_API}/files/${encodeURIComponent(fileId)}?uploadType=media`, {
-        method: "PATCH",
-        headers: {
-          Authorization: `Bearer ${accessToken}`,
-          Accept: "application/json",
-          "Content-Type": "application/json",
-        },
-        body: JSON.stringify(syncedFile, null, 2),
-      });
+      res = await fetchImpl(
+        `${GOOGLE_DRIVE_UPLOAD_API}/files/${encodeURIComponent(fileId)}?uploadType=media&fields=${REVISION_FIELDS}`,
+        {
+          method: "PATCH",
+          headers: {
+            Authorization: `Bearer ${accessToken}`,
+            Accept: "application/json",
+            "Content-Type": "application/json",
+          },
+          body: JSON.stringify(syncedFile, null, 2),
+        }
+      );
     } catch (err) {
       throw new Error(
         `Google Drive update network error. Check your network/VPN and whether Google services are reachable. (${describeNetworkError(err)})`
@@ -340,7 +350,7 @@ function registerHandlers(ipcMain, electronModule) {
       throw new Error(`Google Drive update error: ${describeGoogleApiError(res.status, text)}`);
     }
 
-    return { ok: true };
+    return { ok: true, revision: toRevision(safeJsonParse(text)) };
   });
 
   ipcMain.handle("netcatty:google:drive:downloadSyncFile", async (_event, payload) => {
@@ -380,6 +390,42 @@ function registerHandlers(ipcMain, electronModule) {
     return { syncedFile: data };
   });
 
+  // Metadata only - lets the renderer skip a full download when nothing changed
+  ipcMain.handle("netcatty:google:drive:getSyncFileRevision", async (_event, payload) => {
+    const accessToken = payload?.accessToken;
+    const fileId = payload?.fileId;
+    if (!isNonEmptyString(accessToken)) throw new Error("Missing accessToken");
+    if (!isNonEmptyString(fileId)) throw new Error("Missing fileId");
+
+    let res;
+    try {
+      res = await fetchImpl(
+        `${GOOGLE_DRIVE_API}/files/${encodeURIComponent(fileId)}?fields=${REVISION_FIELDS}`,
+        {
+          headers: {
+            Authorization: `Bearer ${accessToken}`,
+            Accept: "application/json",
+          },
+        }
+      );
+    } catch (err) {
+      throw new Error(
+        `Google Drive metadata network error. Check your network/VPN and whether Google services are reachable. (${describeNetworkError(err)})`
+      );
+    }
+
+    const text = await res.text();
+    if (!res.ok) {
+      if (res.status === 404) return { revision: null };
+      if (res.status === 401) {
+        throw new Error("Token expired or invalid. Please reconnect Google Drive.");
+      }
+      throw new Error(`Google Drive metadata error: ${describeGoogleApiError(res.status, text)}`);
+    }
+
+    return { revision: toRevision(safeJsonParse(text)) };
+  });
+
   ipcMain.handle("netcatty:google:drive:deleteSyncFile", async (_event, payload) => {
     const accessToken = payload?.accessToken;
     const fileId = payload?.fileId;
@@ -0,0 +1,415 @@
+/**
+ * In-band Transfer Bridge - ZMODEM and trzsz over the terminal stream
+ *
+ * Serial consoles, telnet hosts and jump chains without SFTP only have the
+ * terminal channel. Every session output path runs its raw bytes through
+ * `createOutputFilter()`, which looks for the `sz`/`rz` and `tsz`/`trz`
+ * handshakes. Once one shows up the bytes stop going to xterm and feed the
+ * protocol engine instead, the user picks files or a target folder, and
+ * progress is reported on `netcatty:inband:transfer` in the TransferTask
+ * shape the SFTP transfer list already renders.
+ */
+
+const zmodem = require("./zmodem.cjs");
+const trzsz = require("./trzsz.cjs");
+const logBridge = require("./logBridge.cjs");
+
+const log = logBridge.createLogger("InbandTransfer");
+
+let sessions = null;
+let electronModule = null;
+
+// sessionId -> filter state
+const filters = new Map();
+
+// Bytes at the end of a chunk that might begin a handshake are held back
+// this long waiting for the rest before being shown as plain output
+const HOLD_MS = 150;
+const PROGRESS_INTERVAL_MS = 100;
+const CTRL_C = 0x03;
+
+// Common start of the ZRQINIT and ZRINIT hex headers
+const ZMODEM_PREFIX = zmodem.ZRQINIT_TRIGGER.subarray(0, 4);
+
+function init(deps) {
+  sessions = deps.sessions;
+  electronModule = deps.electronModule;
+}
+
+/**
+ * Length of the longest suffix of `buf` that is a proper prefix of `marker`.
+ * A lone trailing "*" or ":" is too common in normal output (prompts,
+ * progress bars) to be worth delaying.
+ */
+function partialSuffix(buf, marker) {
+  const max = Math.min(buf.length, marker.length - 1);
+  for (let len = max; len > 1; len--) {
+    if (buf.subarray(buf.length - len).equals(marker.subarray(0, len))) return len;
+  }
+  return 0;
+}
+
+/**
+ * Write raw protocol bytes to the session transport and resolve once it is
+ * ready for more (false when the session went away)
+ */
+function writeRaw(sessionId, buf) {
+  const session = sessions.get(sessionId);
+  if (!session) return Promise.resolve(false);
+  // Telnet treats 0xff as IAC; data bytes have to be doubled
+  if (session.type === "telnet-native" && buf.includes(0xff)) {
+    const out = [];
+    for (const b of buf) {
+      out.push(b);
+      if (b === 0xff) out.push(0xff);
+    }
+    buf = Buffer.from(out);
+  }
+  const target = session.stream || session.socket || session.serialPort;
+  try {
+    if (!target) {
+      if (!session.proc) return Promise.resolve(false);
+      session.proc.write(buf);
+      return Promise.resolve(true);
+    }
+    if (target.destroyed || target.writableEnded) return Promise.resolve(false);
+    if (target.write(buf) !== false) return Promise.resolve(true);
+  } catch (err) {
+    log.warn("Write failed", err?.message || err);
+    return Promise.resolve(false);
+  }
+  return new Promise((resolve) => {
+    const finish = (ok) => {
+      target.off("drain", onDrain);
+      target.off("close", onClose);
+      resolve(ok);
+    };
+    const onDrain = () => finish(true);
+    const onClose = () => finish(false);
+    target.on("drain", onDrain);
+    target.on("close", onClose);
+  });
+}
+
+function setInputPaused(sessionId, paused) {
+  const session = sessions.get(sessionId);
+  const source = session?.stream || session?.socket || session?.serialPort || session?.proc;
+  try {
+    if (paused) source?.pause?.();
+    else source?.resume?.();
+  } catch (err) {
+    log.debug("Pause/resume failed", err?.message || err);
+  }
+}
+
+function getContents(sessionId) {
+  const session = sessions.get(sessionId);
+  if (!session) return null;
+  const contents = electronModule.webContents.fromId(session.webContentsId);
+  return contents && !contents.isDestroyed() ? contents : null;
+}
+
+async function chooseFiles(sessionId, protocol) {
+  const contents = getContents(sessionId);
+  if (!contents) return null;
+  const { dialog, BrowserWindow } = electronModule;
+  const win = BrowserWindow.fromWebContents(contents);
+  const result = await dialog.showOpenDialog(win, {
+    title: `Send files (${protocol})`,
+    properties: ["openFile", "multiSelections"],
+  });
+  return result.canceled || !result.filePaths?.length ? null : result.filePaths;
+}
+
+async function chooseSaveDir(sessionId, protocol) {
+  const contents = getContents(sessionId);
+  if (!contents) return null;
+  const { app, dialog, BrowserWindow } = electronModule;
+  const win = BrowserWindow.fromWebContents(contents);
+  const result = await dialog.showOpenDialog(win, {
+    title: `Save received files (${protocol})`,
+    defaultPath: app.getPath("downloads"),
+    properties: ["openDirectory", "createDirectory"],
+  });
+  return result.canceled || !result.filePaths?.length ? null : result.filePaths[0];
+}
+
+/**
+ * Turns engine events into TransferTask-shaped updates for the renderer
+ */
+function createReporter(sessionId, protocol, direction) {
+  let counter = 0;
+  let task = null;
+
+  const send = (force = false) => {
+    if (!task) return;
+    const now = Date.now();
+    if (!force && now - task.lastSentAt < PROGRESS_INTERVAL_MS) return;
+    task.lastSentAt = now;
+    const { lastSentAt, lastBytes, lastAt, ...payload } = task;
+    getContents(sessionId)?.send("netcatty:inband:transfer", payload);
+  };
+
+  return {
+    onEvent(event) {
+      if (event.type === "file-start") {
+        const now = Date.now();
+        task = {
+          sessionId,
+          id: `inband-${sessionId}-${now}-${counter++}`,
+          protocol,
+          fileName: event.name,
+          sourcePath: direction === "upload" ? event.path : event.name,
+          targetPath: direction === "upload" ? event.name : event.path,
+          direction,
+          status: "transferring",
+          totalBytes: event.size || 0,
+          transferredBytes: 0,
+          speed: 0,
+          startTime: now,
+          lastSentAt: 0,
+          lastBytes: 0,
+          lastAt: now,
+        };
+        send(true);
+      } else if (event.type === "progress" && task) {
+        const now = Date.now();
+        task.transferredBytes = event.transferred;
+        if (now - task.lastAt >= 250) {
+          const instant = ((event.transferred - task.lastBytes) * 1000) / (now - task.lastAt);
+          task.speed = task.speed ? task.speed * 0.7 + instant * 0.3 : instant;
+          task.lastBytes = event.transferred;
+          task.lastAt = now;
+        }
+        send();
+      } else if (event.type === "file-done" && task) {
+        task.transferredBytes = event.transferred;
+        task.status = "completed";
+        task.endTime = Date.now();
+        send(true);
+        task = null;
+      } else if (event.type === "file-skipped") {
+        log.info(`Skipped ${event.name}${event.error ? `: ${event.error}` : ""}`);
+      }
+    },
+    finish(err) {
+      if (!task) return;
+      task.status = !err ? "completed" : err.message === "Cancelled" ? "cancelled" : "failed";
+      if (task.status === "failed") task.error = err.message;
+      task.endTime = Date.now();
+      send(true);
+      task = null;
+    },
+  };
+}
+
+/**
+ * Wrap a session's output path. `forward(buffer)` is the existing display
+ * path; everything not consumed by a transfer still goes through it.
+ */
+function createOutputFilter(sessionId, forward) {
+  const state = {
+    mode: "idle",
+    held: null,
+    holdTimer: null,
+    pending: [],
+    engine: null,
+    lastTrzszId: null,
+    flushHeld: null,
+  };
+  filters.set(sessionId, state);
+
+  const flushHeld = () => {
+    if (state.holdTimer) clearTimeout(state.holdTimer);
+    state.holdTimer = null;
+    const held = state.held;
+    state.held = null;
+    if (held?.length) forward(held);
+  };
+  state.flushHeld = flushHeld;
+
+  const hold = (buf) => {
+    state.held = buf;
+    state.holdTimer = setTimeout(flushHeld, HOLD_MS);
+  };
+
+  const finishTransfer = (err, leftover) => {
+    state.engine = null;
+    state.mode = "idle";
+    state.pending = [];
+    setInputPaused(sessionId, false);
+    if (err) log.info(`Transfer ended: ${err.message}`);
+    if (leftover?.length) filter(leftover);
+  };
+
+  const startZmodem = async (direction, initial) => {
+    state.mode = "prompt";
+    state.pending = [initial];
+    const files = direction === "upload" ? await chooseFiles(sessionId, "ZMODEM") : null;
+    const saveDir = direction === "download" ? await chooseSaveDir(sessionId, "ZMODEM") : null;
+    if (!filters.has(sessionId)) return;
+    if (!files && !saveDir) {
+      // Stop the remote `sz`/`rz`; its own messages show up afterwards
+      void writeRaw(sessionId, zmodem.ABORT_SEQUENCE);
+      finishTransfer(new Error("Cancelled"));
+      return;
+    }
+    const reporter = createReporter(sessionId, "zmodem", direction);
+    const options = {
+      write: (buf) => writeRaw(sessionId, buf),
+      onEvent: reporter.onEvent,
+      onDone: (err, leftover) => {
+        reporter.finish(err);
+        finishTransfer(err, leftover);
+      },
+    };
+    state.engine = direction === "upload"
+      ? new zmodem.ZmodemSender({ ...options, files })
+      : new zmodem.ZmodemReceiver({
+        ...options,
+        saveDir,
+        pauseInput: () => setInputPaused(sessionId, true),
+        resumeInput: () => setInputPaused(sessionId, false),
+      });
+    state.mode = "active";
+    const pending = state.pending;
+    state.pending = [];
+    for (const chunk of pending) state.engine?.push(chunk);
+  };
+
+  const startTrzsz = async (match, rest) => {
+    state.mode = "prompt";
+    state.pending = rest.length ? [rest] : [];
+    const direction = match.mode === "S" ? "download" : "upload";
+    let files = null;
+    let saveDir = null;
+    if (match.mode === "R") files = await chooseFiles(sessionId, "trzsz");
+    else if (match.mode === "S") saveDir = await chooseSaveDir(sessionId, "trzsz");
+    if (!filters.has(sessionId)) return;
+    const reporter = createReporter(sessionId, "trzsz", direction);
+    const client = new trzsz.TrzszClient({
+      mode: match.mode,
+      write: (buf) => writeRaw(sessionId, buf),
+      files,
+      saveDir,
+      onEvent: reporter.onEvent,
+      onDone: (err, leftover) => {
+        reporter.finish(err);
+        finishTransfer(err, leftover);
+      },
+    });
+    state.engine = client;
+    state.mode = "active";
+    const pending = state.pending;
+    state.pending = [];
+    void client.run();
+    for (const chunk of pending) client.push(chunk);
+  };
+
+  function filter(data) {
+    let buf = Buffer.isBuffer(data) ? data : Buffer.from(data, "binary");
+    if (state.mode === "active") {
+      state.engine.push(buf);
+      return;
+    }
+    if (state.mode === "prompt") {
+      state.pending.push(buf);
+      return;
+    }
+
+    if (state.held) {
+      clearTimeout(state.holdTimer);
+      state.holdTimer = null;
+      buf = Buffer.concat([state.held, buf]);
+      state.held = null;
+    }
+
+    const z = zmodem.detect(buf);
+    let t = trzsz.detect(buf);
+    // tmux and screen redraws repeat the trigger line; only act on it once
+    if (t && !t.partial && t.uniqueId && t.uniqueId === state.lastTrzszId) t = null;
+
+    if (t && (!z || t.index < z.index)) {
+      if (t.partial) {
+        if (t.index > 0) forward(buf.subarray(0, t.index));
+        hold(buf.subarray(t.index));
+        return;
+      }
+      if (t.end !== undefined) {
+        state.lastTrzszId = t.uniqueId;
+        forward(buf.subarray(0, t.end));
+        void startTrzsz(t, buf.subarray(t.end)).catch((err) => finishTransfer(err));
+        return;
+      }
+    }
+    if (z) {
+      if (z.index > 0) forward(buf.subarray(0, z.index));
+      void startZmodem(z.direction, buf.subarray(z.index)).catch((err) => finishTransfer(err));
+      return;
+    }
+
+    const keep = Math.max(partialSuffix(buf, ZMODEM_PREFIX), partialSuffix(buf, trzsz.TRIGGER_PREFIX));
+    if (keep > 0) {
+      if (buf.length > keep) forward(buf.subarray(0, buf.length - keep));
+      hold(buf.subarray(buf.length - keep));
+      return;
+    }
+    forward(buf);
+  }
+
+  return filter;
+}
+
+/**
+ * Keystrokes must not reach the remote while a transfer owns the channel.
+ * Ctrl+C cancels the transfer. Returns true when the input was consumed.
+ */
+function interceptInput(sessionId, data) {
+  const state = filters.get(sessionId);
+  if (!state || state.mode === "idle") return false;
+  const text = typeof data === "string" ? data : "";
+  if (state.mode === "active" && text.includes(String.fromCharCode(CTRL_C))) {
+    state.engine?.cancel();
+  }
+  return true;
+}
+
+function isActive(sessionId) {
+  const state = filters.get(sessionId);
+  return !!state && state.mode !== "idle";
+}
+
+function cancel(sessionId) {
+  const state = filters.get(sessionId);
+  state?.engine?.cancel();
+}
+
+/**
+ * Drop the filter for a closed session, aborting a running transfer.
+ * Output held back as a possible handshake prefix is still shown, since
+ * callers dispose before flushing their own buffers.
+ */
+function disposeSession(sessionId) {
+  const state = filters.get(sessionId);
+  if (!state) return;
+  filters.delete(sessionId);
+  state.flushHeld?.();
+  state.engine?.cancel();
+}
+
+function registerHandlers(ipcMain) {
+  ipcMain.handle("netcatty:inband:cancel", (_event, { sessionId }) => {
+    cancel(sessionId);
+    return { ok: true };
+  });
+}
+
+module.exports = {
+  init,
+  registerHandlers,
+  createOutputFilter,
+  interceptInput,
+  isActive,
+  cancel,
+  disposeSession,
+};
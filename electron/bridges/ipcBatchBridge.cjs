@@ -0,0 +1,102 @@
+/**
+ * IPC Batch Bridge - Executes coalesced renderer invokes in one round trip
+ *
+ * The preload queues small invokes issued in the same tick and sends them as
+ * a single "netcatty:batch:invoke" message. Bridges opt channels in with
+ * registerBatchable(); calls run with bounded concurrency and every call gets
+ * its own { ok, value | error } entry in the reply, so one failure does not
+ * reject its neighbours.
+ */
+
+// Upper bound on calls running at once for a single batch
+const MAX_CONCURRENCY = 16;
+// The preload splits larger bursts; anything beyond this is rejected outright
+const MAX_BATCH_CALLS = 2000;
+
+const batchable = new Map();
+
+/**
+ * Allow a channel to be invoked through a batch
+ * @param {string} channel - IPC channel name the call would otherwise use
+ * @param {(event: any, payload: any) => any} handler - Same handler as ipcMain.handle
+ * @param {Object} [options]
+ * @param {boolean} [options.serial] - Run this channel's calls one at a time in
+ *   submission order (e.g. recursive mkdir, where parents must exist first)
+ */
+function registerBatchable(channel, handler, options = {}) {
+  batchable.set(channel, { handler, serial: !!options.serial });
+}
+
+function serializeError(err) {
+  if (err instanceof Error) return err.message;
+  return String(err ?? "Unknown error");
+}
+
+/**
+ * Run a list of calls and return one result per call, in the same order
+ */
+async function runBatch(event, calls) {
+  const results = new Array(calls.length);
+
+  // Each lane runs its calls in order; independent calls get a lane each
+  const lanes = [];
+  const serialLanes = new Map();
+  calls.forEach((call, index) => {
+    const entry = batchable.get(call?.channel);
+    if (!entry) {
+      results[index] = { ok: false, error: `Channel not batchable: ${call?.channel}` };
+      return;
+    }
+    if (entry.serial) {
+      let lane = serialLanes.get(call.channel);
+      if (!lane) {
+        lane = [];
+        serialLanes.set(call.channel, lane);
+        lanes.push(lane);
+      }
+      lane.push({ index, entry, payload: call.payload });
+    } else {
+      lanes.push([{ index, entry, payload: call.payload }]);
+    }
+  });
+
+  let nextLane = 0;
+  const worker = async () => {
+    while (nextLane < lanes.length) {
+      const lane = lanes[nextLane++];
+      for (const { index, entry, payload } of lane) {
+        try {
+          results[index] = { ok: true, value: await entry.handler(event, payload) };
+        } catch (err) {
+          results[index] = { ok: false, error: serializeError(err) };
+        }
+      }
+    }
+  };
+
+  const workers = [];
+  for (let i = 0; i < Math.min(MAX_CONCURRENCY, lanes.length); i++) workers.push(worker());
+  await Promise.all(workers);
+  return results;
+}
+
+async function invokeBatch(event, payload) {
+  const calls = Array.isArray(payload?.calls) ? payload.calls : [];
+  if (calls.length > MAX_BATCH_CALLS) {
+    throw new Error(`Batch too large: ${calls.length} calls (max ${MAX_BATCH_CALLS})`);
+  }
+  return runBatch(event, calls);
+}
+
+/**
+ * Register IPC handlers for batched invokes
+ */
+function registerHandlers(ipcMain) {
+  ipcMain.handle("netcatty:batch:invoke", invokeBatch);
+}
+
+module.exports = {
+  registerBatchable,
+  registerHandlers,
+  runBatch,
+};
@@ -0,0 +1,303 @@
+/**
+ * IPC Stats Bridge - Latency and payload instrumentation for every IPC channel
+ *
+ * instrument() patches ipcMain.handle / ipcMain.on and webContents.send before
+ * any bridge registers, so all channels are covered without touching the
+ * bridges themselves. Per channel it keeps call and error counts, in-flight
+ * counts, a log-linear (HDR-style) latency histogram and payload sizes.
+ * Recording is a Map lookup, two hrtime reads and a bounded size estimate.
+ */
+
+const fs = require("node:fs");
+
+// Log-linear histogram: 8 sub-buckets per power of two (~9% precision),
+// covering 1 µs .. ~2^31 µs (about 36 minutes)
+const SUB_BUCKET_BITS = 3;
+const SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+const MAX_EXPONENT = 31;
+const BUCKET_COUNT = (MAX_EXPONENT + 1) * SUB_BUCKETS;
+
+// Size estimation walks at most this many values; long arrays are sampled
+const SIZE_NODE_BUDGET = 2000;
+const ARRAY_SAMPLE = 32;
+
+// Our own polling should not show up in the numbers
+const SELF_PREFIX = "netcatty:ipcStats:";
+
+const channels = new Map();
+let startedAt = Date.now();
+let instrumented = false;
+
+function bucketIndex(us) {
+  const value = Math.min(0x7fffffff, Math.max(1, Math.floor(us)));
+  const exponent = Math.min(MAX_EXPONENT, 31 - Math.clz32(value));
+  const shift = Math.max(0, exponent - SUB_BUCKET_BITS);
+  const sub = exponent < SUB_BUCKET_BITS
+    ? value - (1 << exponent)
+    : (value >>> shift) - SUB_BUCKETS;
+  return Math.min(BUCKET_COUNT - 1, exponent * SUB_BUCKETS + Math.max(0, Math.min(SUB_BUCKETS - 1, sub)));
+}
+
+// Upper bound (µs) of a bucket, used when reading percentiles back
+function bucketUpperBound(index) {
+  const exponent = Math.floor(index / SUB_BUCKETS);
+  const sub = index % SUB_BUCKETS;
+  if (exponent < SUB_BUCKET_BITS) return (1 << exponent) + sub + 1;
+  const step = 2 ** (exponent - SUB_BUCKET_BITS);
+  return 2 ** exponent + (sub + 1) * step;
+}
+
+/**
+ * Approximate serialized size in bytes. Arrays longer than ARRAY_SAMPLE are
+ * extrapolated from their first items, which is accurate for the homogeneous
+ * lists bridges return (directory listings, transfer lists, ...).
+ */
+function estimateSize(value) {
+  let budget = SIZE_NODE_BUDGET;
+  const visit = (v) => {
+    if (budget-- <= 0) return 0;
+    if (v === null || v === undefined) return 1;
+    switch (typeof v) {
+      case "string":
+        return v.length;
+      case "number":
+        return 8;
+      case "boolean":
+        return 1;
+      case "bigint":
+        return 8;
+      case "object":
+        break;
+      default:
+        return 0;
+    }
+    if (ArrayBuffer.isView(v)) return v.byteLength;
+    if (v instanceof ArrayBuffer) return v.byteLength;
+    if (Array.isArray(v)) {
+      const sampled = Math.min(v.length, ARRAY_SAMPLE);
+      let total = 0;
+      for (let i = 0; i < sampled; i++) total += visit(v[i]);
+      return sampled === v.length ? total : Math.round((total / sampled) * v.length);
+    }
+    let total = 0;
+    for (const key in v) {
+      total += key.length + visit(v[key]);
+    }
+    return total;
+  };
+  return visit(value);
+}
+
+function getChannelStats(channel, kind) {
+  const key = `${kind}:${channel}`;
+  let stats = channels.get(key);
+  if (!stats) {
+    stats = {
+      channel,
+      kind,
+      calls: 0,
+      errors: 0,
+      inFlight: 0,
+      maxInFlight: 0,
+      totalUs: 0,
+      maxUs: 0,
+      histogram: new Uint32Array(BUCKET_COUNT),
+      requestBytes: 0,
+      maxRequestBytes: 0,
+      responseBytes: 0,
+      maxResponseBytes: 0,
+    };
+    channels.set(key, stats);
+  }
+  return stats;
+}
+
+function recordLatency(stats, startNs) {
+  const us = Number(process.hrtime.bigint() - startNs) / 1000;
+  stats.totalUs += us;
+  if (us > stats.maxUs) stats.maxUs = us;
+  stats.histogram[bucketIndex(us)]++;
+}
+
+function recordRequest(stats, args) {
+  const bytes = args.length === 0 ? 0 : estimateSize(args.length === 1 ? args[0] : args);
+  stats.requestBytes += bytes;
+  if (bytes > stats.maxRequestBytes) stats.maxRequestBytes = bytes;
+}
+
+function recordResponse(stats, result) {
+  const bytes = estimateSize(result);
+  stats.responseBytes += bytes;
+  if (bytes > stats.maxResponseBytes) stats.maxResponseBytes = bytes;
+}
+
+function wrapHandle(channel, listener) {
+  if (channel.startsWith(SELF_PREFIX)) return listener;
+  return async (event, ...args) => {
+    const stats = getChannelStats(channel, "handle");
+    stats.calls++;
+    stats.inFlight++;
+    if (stats.inFlight > stats.maxInFlight) stats.maxInFlight = stats.inFlight;
+    recordRequest(stats, args);
+    const start = process.hrtime.bigint();
+    try {
+      const result = await listener(event, ...args);
+      recordResponse(stats, result);
+      return result;
+    } catch (err) {
+      stats.errors++;
+      throw err;
+    } finally {
+      stats.inFlight--;
+      recordLatency(stats, start);
+    }
+  };
+}
+
+// Fire-and-forget channels: count, size and synchronous handler time
+function wrapOn(channel, listener) {
+  return (event, ...args) => {
+    const stats = getChannelStats(channel, "on");
+    stats.calls++;
+    recordRequest(stats, args);
+    const start = process.hrtime.bigint();
+    try {
+      return listener(event, ...args);
+    } catch (err) {
+      stats.errors++;
+      throw err;
+    } finally {
+      recordLatency(stats, start);
+    }
+  };
+}
+
+function instrumentWebContents(contents) {
+  const originalSend = contents.send.bind(contents);
+  contents.send = (channel, ...args) => {
+    const stats = getChannelStats(channel, "event");
+    stats.calls++;
+    recordRequest(stats, args);
+    return originalSend(channel, ...args);
+  };
+}
+
+/**
+ * Patch ipcMain and future webContents. Call once, before bridges register.
+ */
+function instrument(electronModule) {
+  if (instrumented) return;
+  instrumented = true;
+  const { ipcMain, app } = electronModule;
+
+  const originalHandle = ipcMain.handle.bind(ipcMain);
+  ipcMain.handle = (channel, listener) => originalHandle(channel, wrapHandle(channel, listener));
+
+  // Keep removeListener working with the caller's original function
+  const wrappedListeners = new WeakMap();
+  const originalOn = ipcMain.on.bind(ipcMain);
+  const originalRemoveListener = ipcMain.removeListener.bind(ipcMain);
+  ipcMain.on = (channel, listener) => {
+    const wrapped = wrapOn(channel, listener);
+    wrappedListeners.set(listener, wrapped);
+    return originalOn(channel, wrapped);
+  };
+  ipcMain.removeListener = (channel, listener) =>
+    originalRemoveListener(channel, wrappedListeners.get(listener) || listener);
+  ipcMain.off = ipcMain.removeListener;
+
+  app?.on?.("web-contents-created", (_event, contents) => instrumentWebContents(contents));
+}
+
+// Percentiles read back as bucket upper bounds, capped at the observed max
+function percentileMs(stats, p) {
+  const { histogram } = stats;
+  let count = 0;
+  for (let i = 0; i < histogram.length; i++) count += histogram[i];
+  if (count === 0) return 0;
+  const target = Math.ceil((p / 100) * count);
+  let seen = 0;
+  for (let i = 0; i < histogram.length; i++) {
+    seen += histogram[i];
+    if (seen >= target) return Math.min(bucketUpperBound(i), stats.maxUs) / 1000;
+  }
+  return stats.maxUs / 1000;
+}
+
+const round = (value) => Math.round(value * 1000) / 1000;
+
+/**
+ * Snapshot of all channels, sorted by total time spent
+ */
+function getSnapshot() {
+  const list = [];
+  for (const stats of channels.values()) {
+    const { calls } = stats;
+    const histogram = [];
+    for (let i = 0; i < stats.histogram.length; i++) {
+      if (stats.histogram[i] > 0) histogram.push([round(bucketUpperBound(i) / 1000), stats.histogram[i]]);
+    }
+    list.push({
+      channel: stats.channel,
+      kind: stats.kind,
+      calls,
+      errors: stats.errors,
+      inFlight: stats.inFlight,
+      maxInFlight: stats.maxInFlight,
+      latency: {
+        totalMs: round(stats.totalUs / 1000),
+        meanMs: calls ? round(stats.totalUs / calls / 1000) : 0,
+        p50Ms: round(percentileMs(stats, 50)),
+        p90Ms: round(percentileMs(stats, 90)),
+        p99Ms: round(percentileMs(stats, 99)),
+        maxMs: round(stats.maxUs / 1000),
+      },
+      request: {
+        totalBytes: stats.requestBytes,
+        meanBytes: calls ? Math.round(stats.requestBytes / calls) : 0,
+        maxBytes: stats.maxRequestBytes,
+      },
+      response: {
+        totalBytes: stats.responseBytes,
+        meanBytes: calls ? Math.round(stats.responseBytes / calls) : 0,
+        maxBytes: stats.maxResponseBytes,
+      },
+      histogram,
+    });
+  }
+  list.sort((a, b) => b.latency.totalMs - a.latency.totalMs || b.calls - a.calls);
+  return {
+    startedAt,
+    uptimeMs: Date.now() - startedAt,
+    channels: list,
+  };
+}
+
+function reset() {
+  channels.clear();
+  startedAt = Date.now();
+}
+
+/**
+ * Register IPC handlers for the stats panel
+ */
+function registerHandlers(ipcMain) {
+  ipcMain.handle("netcatty:ipcStats:get", async () => getSnapshot());
+  ipcMain.handle("netcatty:ipcStats:reset", async () => {
+    reset();
+    return true;
+  });
+  ipcMain.handle("netcatty:ipcStats:export", async (_event, { filePath }) => {
+    const snapshot = { exportedAt: new Date().toISOString(), ...getSnapshot() };
+    await fs.promises.writeFile(filePath, JSON.stringify(snapshot, null, 2), "utf8");
+    return { success: true };
+  });
+}
+
+module.exports = {
+  instrument,
+  registerHandlers,
+  getSnapshot,
+  reset,
+  estimateSize,
+};
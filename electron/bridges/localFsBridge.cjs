@@ -11,113 +11,296 @@ const { promisify } = require("node:util");
 
 const execAsync = promisify(exec);
 
+// Column codes used by the paged listing API (netcatty:local:listPage)
+const KIND_FILE = 0;
+const KIND_DIRECTORY = 1;
+const KIND_SYMLINK = 2;
+const KIND_INVALID = 255;
+const LINK_NONE = 0;
+const LINK_FILE = 1;
+const LINK_DIRECTORY = 2;
+
+const LISTING_CACHE_LIMIT = 64;
+const LISTING_PAGE_SIZE = 2000;
+// Listings of directories fs.watch cannot observe (some network shares)
+// are only trusted briefly.
+const UNWATCHED_LISTING_TTL_MS = 2000;
+const STAT_CONCURRENCY = 32;
+
+/**
+ * Directory listings keyed by absolute path. Map insertion order doubles as
+ * LRU order. Entries are invalidated by fs.watch events and by mutations made
+ * through this bridge.
+ */
+const listingCache = new Map();
+// Bumped for every listing built, so a client paging through one can tell
+// when the cached listing was replaced underneath it
+let listingGeneration = 0;
+
 /**
- * Check if a file is hidden on Windows using the attrib command
- * Returns true if the file has the hidden attribute set
- * Uses async exec to avoid blocking the main process
+ * Get the names of all hidden entries in a directory with a single query.
+ * `cmd /u` makes dir print UTF-16 so non-ASCII names survive the codepage.
  */
-async function isWindowsHiddenFile(filePath) {
-  if (process.platform !== "win32") return false;
+async function getWindowsHiddenNames(dirPath) {
+  if (process.platform !== "win32") return new Set();
   try {
-    const { stdout } = await execAsync(`attrib "${filePath}"`);
-    // attrib output format: "     H  R  filename" where H = hidden, R = read-only, etc.
-    // The attributes appear in the first ~10 characters before the path
-    const attrPart = stdout.substring(0, stdout.indexOf(filePath)).toUpperCase();
-    return attrPart.includes("H");
+    const { stdout } = await execAsync(`cmd /d /u /c dir /a:h /b "${dirPath}"`, {
+      encoding: "buffer",
+      windowsHide: true,
+      maxBuffer: 64 * 1024 * 1024,
+    });
+    const names = stdout.toString("utf16le").split(/\r?\n/).filter(Boolean);
+    return new Set(names);
   } catch (err) {
-    console.warn(`Could not check hidden attribute for ${filePath}:`, err.message);
-    return false;
+    // dir exits non-zero when nothing matches
+    if (err && err.code === 1) return new Set();
+    console.warn(`Could not list hidden entries for ${dirPath}:`, err.message);
+    return new Set();
   }
 }
 
-/**
- * List files in a local directory
- * Properly handles symlinks by resolving their target type
- * On Windows, also detects hidden files using the hidden attribute
- */
-async function listLocalDir(event, payload) {
-  const dirPath = payload.path;
-  const entries = await fs.promises.readdir(dirPath, { withFileTypes: true });
-  const isWindows = process.platform === "win32";
-
-  // Stat entries in parallel with a small concurrency limit.
-  // Serial stats can be very slow on Windows for large dirs.
-  const CONCURRENCY = 32;
-  const result = new Array(entries.length);
-  let cursor = 0;
-
-  const worker = async () => {
-    while (true) {
-      const i = cursor++;
-      if (i >= entries.length) return;
-      const entry = entries[i];
+function invalidateListing(dirPath) {
+  const listing = listingCache.get(dirPath);
+  if (!listing) return;
+  listingCache.delete(dirPath);
+  listing.stale = true;
+  try {
+    listing.watcher?.close();
+  } catch {
+    // ignore
+  }
+}
+
+function invalidateListingsFor(targetPath) {
+  invalidateListing(path.dirname(targetPath));
+  invalidateListing(targetPath);
+}
+
+function watchListing(listing) {
+  try {
+    const watcher = fs.watch(listing.dirPath, { persistent: false }, () => {
+      invalidateListing(listing.dirPath);
+    });
+    watcher.on("error", () => invalidateListing(listing.dirPath));
+    listing.watcher = watcher;
+  } catch {
+    listing.watcher = null;
+  }
+}
+
+function isListingFresh(listing) {
+  if (listing.stale || listing.error) return false;
+  if (listing.watcher) return true;
+  return Date.now() - listing.createdAt < UNWATCHED_LISTING_TTL_MS;
+}
+
+async function statEntry(listing, dirent, i, hiddenNames) {
+  const fullPath = path.join(listing.dirPath, dirent.name);
+  listing.names[i] = dirent.name;
+  listing.hidden[i] = hiddenNames.has(dirent.name) ? 1 : 0;
+  try {
+    // fs.promises.stat follows symlinks, so we get the target's stats
+    const stat = await fs.promises.stat(fullPath);
+    if (dirent.isSymbolicLink()) {
+      listing.kinds[i] = KIND_SYMLINK;
+      listing.linkTargets[i] = stat.isDirectory() ? LINK_DIRECTORY : LINK_FILE;
+    } else {
+      listing.kinds[i] = dirent.isDirectory() ? KIND_DIRECTORY : KIND_FILE;
+    }
+    listing.sizes[i] = stat.size;
+    listing.mtimes[i] = stat.mtimeMs;
+  } catch (err) {
+    // Handle broken symlinks - lstat doesn't follow symlinks
+    if (err.code === "ENOENT" || err.code === "ELOOP") {
       try {
-        const fullPath = path.join(dirPath, entry.name);
-        // fs.promises.stat follows symlinks, so we get the target's stats
-        const stat = await fs.promises.stat(fullPath);
-        
-        let type;
-        let linkTarget = null;
-        
-        if (entry.isSymbolicLink()) {
-          // This is a symlink - mark it as such and record the target type
-          type = "symlink";
-          // stat follows symlinks, so stat.isDirectory() tells us if target is a directory
-          linkTarget = stat.isDirectory() ? "directory" : "file";
-        } else if (entry.isDirectory()) {
-          type = "directory";
-        } else {
-          type = "file";
-        }
-        
-        // Check for Windows hidden attribute
-        const hidden = isWindows ? await isWindowsHiddenFile(fullPath) : false;
-        
-        result[i] = {
-          name: entry.name,
-          type,
-          linkTarget,
-          size: `${stat.size} bytes`,
-          lastModified: stat.mtime.toISOString(),
-          hidden,
-        };
-      } catch (err) {
-        // Handle broken symlinks - lstat doesn't follow symlinks
-        if (err.code === 'ENOENT' || err.code === 'ELOOP') {
-          const brokenEntry = entries[i];
-          try {
-            const fullPath = path.join(dirPath, brokenEntry.name);
-            const lstat = await fs.promises.lstat(fullPath);
-            if (lstat.isSymbolicLink()) {
-              // Broken symlink
-              const hidden = isWindows ? await isWindowsHiddenFile(fullPath) : false;
-              result[i] = {
-                name: brokenEntry.name,
-                type: "symlink",
-                linkTarget: null, // Broken link - target unknown
-                size: `${lstat.size} bytes`,
-                lastModified: lstat.mtime.toISOString(),
-                hidden,
-              };
-              return;
-            }
-          } catch (lstatErr) {
-            console.warn(`Could not lstat ${brokenEntry.name}:`, lstatErr.message);
-          }
+        const lstat = await fs.promises.lstat(fullPath);
+        if (lstat.isSymbolicLink()) {
+          listing.kinds[i] = KIND_SYMLINK;
+          listing.linkTargets[i] = LINK_NONE; // Broken link - target unknown
+          listing.sizes[i] = lstat.size;
+          listing.mtimes[i] = lstat.mtimeMs;
+          return;
         }
-        console.warn(`Could not stat ${entries[i].name}:`, err.message);
-        result[i] = null;
+      } catch (lstatErr) {
+        console.warn(`Could not lstat ${dirent.name}:`, lstatErr.message);
       }
     }
+    console.warn(`Could not stat ${dirent.name}:`, err.message);
+    listing.kinds[i] = KIND_INVALID;
+  }
+}
+
+function notifyListingWaiters(listing) {
+  const waiters = listing.waiters;
+  listing.waiters = [];
+  waiters.forEach((resolve) => resolve());
+}
+
+/**
+ * Stat entries page by page so callers can start consuming the first page
+ * while the rest of a huge directory is still being read.
+ */
+async function fillListing(listing, dirents) {
+  const hiddenNames = await getWindowsHiddenNames(listing.dirPath);
+  for (let pageStart = 0; pageStart < dirents.length; pageStart += LISTING_PAGE_SIZE) {
+    const pageEnd = Math.min(pageStart + LISTING_PAGE_SIZE, dirents.length);
+    let cursor = pageStart;
+    const worker = async () => {
+      while (cursor < pageEnd) {
+        const i = cursor++;
+        await statEntry(listing, dirents[i], i, hiddenNames);
+      }
+    };
+    await Promise.all(
+      Array.from({ length: Math.min(STAT_CONCURRENCY, pageEnd - pageStart) }, () => worker()),
+    );
+    listing.ready = pageEnd;
+    notifyListingWaiters(listing);
+  }
+  listing.done = true;
+  notifyListingWaiters(listing);
+}
+
+async function getListing(dirPath, force) {
+  const cached = listingCache.get(dirPath);
+  if (cached && !force && isListingFresh(cached)) {
+    // Refresh LRU position
+    listingCache.delete(dirPath);
+    listingCache.set(dirPath, cached);
+    return cached;
+  }
+  invalidateListing(dirPath);
+
+  const listing = {
+    dirPath,
+    generation: ++listingGeneration,
+    createdAt: Date.now(),
+    total: 0,
+    names: [],
+    kinds: new Uint8Array(0),
+    linkTargets: new Uint8Array(0),
+    sizes: new Float64Array(0),
+    mtimes: new Float64Array(0),
+    hidden: new Uint8Array(0),
+    ready: 0,
+    done: false,
+    stale: false,
+    error: null,
+    waiters: [],
+    watcher: null,
+  };
+  // Watch before reading so changes made during the read invalidate it
+  watchListing(listing);
+  listingCache.set(dirPath, listing);
+  while (listingCache.size > LISTING_CACHE_LIMIT) {
+    invalidateListing(listingCache.keys().next().value);
+  }
+
+  let dirents;
+  try {
+    dirents = await fs.promises.readdir(dirPath, { withFileTypes: true });
+  } catch (err) {
+    listing.error = err;
+    invalidateListing(dirPath);
+    throw err;
+  }
+  const total = dirents.length;
+  listing.total = total;
+  listing.names = new Array(total);
+  listing.kinds = new Uint8Array(total);
+  listing.linkTargets = new Uint8Array(total);
+  listing.sizes = new Float64Array(total);
+  listing.mtimes = new Float64Array(total);
+  listing.hidden = new Uint8Array(total);
+
+  fillListing(listing, dirents).catch((err) => {
+    listing.error = err;
+    listing.done = true;
+    invalidateListing(dirPath);
+    notifyListingWaiters(listing);
+  });
+  return listing;
+}
+
+async function waitForListing(listing, end) {
+  while (!listing.done && listing.ready < end) {
+    await new Promise((resolve) => listing.waiters.push(resolve));
+  }
+  if (listing.error) throw listing.error;
+}
+
+/**
+ * Extract entries [offset, end) as columns, skipping entries that could not be stat'ed
+ */
+function sliceListingColumns(listing, offset, end) {
+  const indices = [];
+  for (let i = offset; i < end; i++) {
+    if (listing.kinds[i] !== KIND_INVALID) indices.push(i);
+  }
+  const pick = (column, Ctor) => Ctor.from(indices, (i) => column[i]);
+  return {
+    names: indices.map((i) => listing.names[i]),
+    kinds: pick(listing.kinds, Uint8Array),
+    linkTargets: pick(listing.linkTargets, Uint8Array),
+    sizes: pick(listing.sizes, Float64Array),
+    mtimes: pick(listing.mtimes, Float64Array),
+    hidden: pick(listing.hidden, Uint8Array),
   };
+}
 
-  const workers = Array.from(
-    { length: Math.min(CONCURRENCY, entries.length) },
-    () => worker(),
-  );
-  await Promise.all(workers);
+/**
+ * List one page of a local directory as numeric columns.
+ * payload: { path, offset?, limit?, force?, generation? } - `force` bypasses
+ * the cache (only honoured for the first page so later pages see the same
+ * listing). Every page reports the listing's `generation`; later pages pass
+ * it back, and if the directory changed in between the reply is an empty
+ * page with `restart: true` so the client starts over from offset 0.
+ */
+async function listLocalDirPage(event, payload) {
+  const offset = Math.max(0, payload.offset || 0);
+  const limit = Math.max(1, payload.limit || LISTING_PAGE_SIZE);
+  const listing = await getListing(payload.path, !!payload.force && offset === 0);
+  if (offset > 0 && payload.generation != null && payload.generation !== listing.generation) {
+    return {
+      ...sliceListingColumns(listing, 0, 0),
+      total: listing.total,
+      nextOffset: null,
+      generation: listing.generation,
+      restart: true,
+    };
+  }
+  const end = Math.min(offset + limit, listing.total);
+  await waitForListing(listing, end);
+  return {
+    ...sliceListingColumns(listing, offset, end),
+    total: listing.total,
+    nextOffset: end < listing.total ? end : null,
+    generation: listing.generation,
+  };
+}
 
-  return result.filter(Boolean);
+/**
+ * List files in a local directory
+ * Properly handles symlinks by resolving their target type
+ * On Windows, also detects hidden files using the hidden attribute
+ */
+async function listLocalDir(event, payload) {
+  const listing = await getListing(payload.path, !!payload.force);
+  await waitForListing(listing, listing.total);
+  const columns = sliceListingColumns(listing, 0, listing.total);
+  return columns.names.map((name, i) => {
+    const kind = columns.kinds[i];
+    const link = columns.linkTargets[i];
+    return {
+      name,
+      type: kind === KIND_DIRECTORY ? "directory" : kind === KIND_SYMLINK ? "symlink" : "file",
+      linkTarget:
+        kind !== KIND_SYMLINK ? null : link === LINK_DIRECTORY ? "directory" : link === LINK_FILE ? "file" : null,
+      size: `${columns.sizes[i]} bytes`,
+      lastModified: new Date(columns.mtimes[i]).toISOString(),
+      hidden: columns.hidden[i] === 1,
+    };
+  });
 }
 
 /**
@@ -133,6 +316,7 @@ async function readLocalFile(event, payload) {
  */
 async function writeLocalFile(event, payload) {
   await fs.promises.writeFile(payload.path, Buffer.from(payload.content));
+  invalidateListingsFor(payload.path);
   return true;
 }
 
@@ -146,6 +330,7 @@ async function deleteLocalFile(event, payload) {
   } else {
     await fs.promises.unlink(payload.path);
   }
+  invalidateListingsFor(payload.path);
   return true;
 }
 
@@ -154,6 +339,8 @@ async function deleteLocalFile(event, payload) {
  */
 async function renameLocalFile(event, payload) {
   await fs.promises.rename(payload.oldPath, payload.newPath);
+  invalidateListingsFor(payload.oldPath);
+  invalidateListingsFor(payload.newPath);
   return true;
 }
 
@@ -162,6 +349,7 @@ async function renameLocalFile(event, payload) {
  */
 async function mkdirLocal(event, payload) {
   await fs.promises.mkdir(payload.path, { recursive: true });
+  invalidateListingsFor(payload.path);
   return true;
 }
 
@@ -236,6 +424,7 @@ async function readKnownHosts() {
  */
 function registerHandlers(ipcMain) {
   ipcMain.handle("netcatty:local:list", listLocalDir);
+  ipcMain.handle("netcatty:local:listPage", listLocalDirPage);
   ipcMain.handle("netcatty:local:read", readLocalFile);
   ipcMain.handle("netcatty:local:write", writeLocalFile);
   ipcMain.handle("netcatty:local:delete", deleteLocalFile);
@@ -250,6 +439,8 @@ function registerHandlers(ipcMain) {
 module.exports = {
   registerHandlers,
   listLocalDir,
+  listLocalDirPage,
+  invalidateListing,
   readLocalFile,
   writeLocalFile,
   deleteLocalFile,
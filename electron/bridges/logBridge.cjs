@@ -0,0 +1,315 @@
+/**
+ * Log Bridge - Structured, ring-buffered logging for main and renderer
+ *
+ * createLogger(category) returns debug/info/warn/error functions. Each logger
+ * caches its own threshold, so a disabled call costs one comparison; message
+ * formatting only happens once a call passes it. Arguments may be thunks
+ * (`log.debug(() => expensive())`) to defer building them as well.
+ *
+ * Enabled entries are written to the console and kept in a fixed-size ring
+ * buffer together with warn/error entries forwarded by renderers. The buffer
+ * is dumped to userData/logs on crashes and included in diagnostics bundles.
+ *
+ * Levels come from log-config.json in userData and can be overridden at
+ * startup with NETCATTY_LOG, e.g. NETCATTY_LOG=debug or
+ * NETCATTY_LOG=warn,Telnet=debug,FileWatcher=debug.
+ */
+
+const fs = require("node:fs");
+const os = require("node:os");
+const path = require("node:path");
+const util = require("node:util");
+
+const LEVELS = { debug: 10, info: 20, warn: 30, error: 40, off: 100 };
+const DEFAULT_LEVEL = "info";
+const CONFIG_FILE = "log-config.json";
+
+const RING_SIZE = 4000;
+const MAX_MESSAGE_CHARS = 4096;
+const MAX_CRASH_DUMPS = 10;
+
+let electronModule = null;
+let config = { level: DEFAULT_LEVEL, categories: {} };
+
+const loggers = new Map();
+const ring = new Array(RING_SIZE);
+let ringNext = 0;
+let ringCount = 0;
+
+const isLevel = (value) => typeof value === "string" && Object.prototype.hasOwnProperty.call(LEVELS, value);
+
+/**
+ * Parse NETCATTY_LOG: a bare level sets the default, Category=level overrides one
+ */
+function parseEnvConfig(value) {
+  if (!value) return null;
+  const parsed = { level: null, categories: {} };
+  for (const part of String(value).split(",")) {
+    const [name, level] = part.split("=").map((s) => s.trim());
+    if (level === undefined) {
+      if (isLevel(name)) parsed.level = name;
+    } else if (name && isLevel(level)) {
+      parsed.categories[name] = level;
+    }
+  }
+  return parsed;
+}
+
+// Parsed at load so loggers created before init() already honour it
+const envOverride = parseEnvConfig(process.env.NETCATTY_LOG);
+
+function normalizeConfig(value) {
+  const categories = {};
+  if (value?.categories && typeof value.categories === "object") {
+    for (const [name, level] of Object.entries(value.categories)) {
+      if (isLevel(level)) categories[name] = level;
+    }
+  }
+  return { level: isLevel(value?.level) ? value.level : DEFAULT_LEVEL, categories };
+}
+
+function effectiveConfig() {
+  if (!envOverride) return config;
+  return {
+    level: envOverride.level || config.level,
+    categories: { ...config.categories, ...envOverride.categories },
+  };
+}
+
+function thresholdFor(category) {
+  const effective = effectiveConfig();
+  return LEVELS[effective.categories[category] || effective.level];
+}
+
+function refreshThresholds() {
+  for (const [category, state] of loggers) state.threshold = thresholdFor(category);
+}
+
+function formatArgs(args) {
+  const resolved = args.map((arg) => (typeof arg === "function" ? arg() : arg));
+  const message = util.format(...resolved);
+  return message.length > MAX_MESSAGE_CHARS ? `${message.slice(0, MAX_MESSAGE_CHARS)}…` : message;
+}
+
+function pushEntry(entry) {
+  ring[ringNext] = entry;
+  ringNext = (ringNext + 1) % RING_SIZE;
+  if (ringCount < RING_SIZE) ringCount++;
+}
+
+/**
+ * Most recent entries, oldest first
+ * @param {number} [limit]
+ */
+function getRecent(limit = RING_SIZE) {
+  const count = Math.min(ringCount, Math.max(0, limit));
+  const out = new Array(count);
+  const start = (ringNext - count + RING_SIZE) % RING_SIZE;
+  for (let i = 0; i < count; i++) out[i] = ring[(start + i) % RING_SIZE];
+  return out;
+}
+
+const CONSOLE_METHODS = { debug: "debug", info: "log", warn: "warn", error: "error" };
+
+function write(category, level, args) {
+  const message = formatArgs(args);
+  pushEntry({ time: Date.now(), level, category, source: "main", message });
+  console[CONSOLE_METHODS[level]](`[${category}] ${message}`);
+}
+
+/**
+ * Get the logger for a category. Loggers are cached, so calling this at
+ * module load is the intended usage.
+ * @param {string} category - Shown as the [Category] prefix
+ */
+function createLogger(category) {
+  let state = loggers.get(category);
+  if (!state) {
+    state = { threshold: thresholdFor(category), logger: null };
+    loggers.set(category, state);
+    const s = state;
+    state.logger = {
+      debug: (...args) => { if (s.threshold <= LEVELS.debug) write(category, "debug", args); },
+      info: (...args) => { if (s.threshold <= LEVELS.info) write(category, "info", args); },
+      warn: (...args) => { if (s.threshold <= LEVELS.warn) write(category, "warn", args); },
+      error: (...args) => { if (s.threshold <= LEVELS.error) write(category, "error", args); },
+      isEnabled: (level) => s.threshold <= LEVELS[level],
+    };
+  }
+  return state.logger;
+}
+
+function getUserDataPath(...parts) {
+  try {
+    const app = electronModule?.app;
+    return app ? path.join(app.getPath("userData"), ...parts) : null;
+  } catch {
+    return null;
+  }
+}
+
+function loadConfig() {
+  const filePath = getUserDataPath(CONFIG_FILE);
+  if (!filePath) return;
+  try {
+    config = normalizeConfig(JSON.parse(fs.readFileSync(filePath, "utf8")));
+  } catch (err) {
+    if (err.code !== "ENOENT") console.warn("[Log] Failed to read config:", err.message);
+  }
+}
+
+function getConfig() {
+  return { ...effectiveConfig(), envOverride: !!envOverride };
+}
+
+/**
+ * Replace the persisted config and notify every window
+ */
+async function setConfig(next) {
+  config = normalizeConfig(next);
+  refreshThresholds();
+  const filePath = getUserDataPath(CONFIG_FILE);
+  if (filePath) {
+    try {
+      await fs.promises.writeFile(filePath, JSON.stringify(config, null, 2), "utf8");
+    } catch (err) {
+      console.warn("[Log] Failed to write config:", err.message);
+    }
+  }
+  const current = getConfig();
+  for (const win of electronModule?.BrowserWindow?.getAllWindows?.() || []) {
+    if (!win.isDestroyed()) win.webContents.send("netcatty:log:config", current);
+  }
+  return current;
+}
+
+function formatEntry(entry) {
+  const source = entry.source === "renderer" ? "R" : "M";
+  return `${new Date(entry.time).toISOString()} ${source} ${entry.level.toUpperCase().padEnd(5)} [${entry.category}] ${entry.message}`;
+}
+
+/**
+ * Write the ring buffer to userData/logs. Synchronous so it completes while
+ * the process is going down. Old dumps beyond MAX_CRASH_DUMPS are pruned.
+ */
+function dumpCrash(reason, detail) {
+  const dir = getUserDataPath("logs");
+  if (!dir) return null;
+  try {
+    fs.mkdirSync(dir, { recursive: true });
+    const filePath = path.join(dir, `crash-${new Date().toISOString().replace(/[:.]/g, "-")}.log`);
+    const header = [
+      `Reason: ${reason}`,
+      detail ? `Detail: ${detail instanceof Error ? detail.stack || detail.message : util.inspect(detail)}` : null,
+      "",
+    ].filter((line) => line !== null);
+    const lines = getRecent().map(formatEntry);
+    fs.writeFileSync(filePath, `${header.join("\n")}\n${lines.join("\n")}\n`, "utf8");
+
+    const dumps = fs.readdirSync(dir).filter((name) => name.startsWith("crash-")).sort();
+    for (const name of dumps.slice(0, Math.max(0, dumps.length - MAX_CRASH_DUMPS))) {
+      try { fs.unlinkSync(path.join(dir, name)); } catch {}
+    }
+    return filePath;
+  } catch (err) {
+    console.error("[Log] Failed to write crash dump:", err.message);
+    return null;
+  }
+}
+
+/**
+ * Write a diagnostics bundle: app info, recent logs from both processes and
+ * perf counters (IPC stats, process metrics, renderer supplied counters)
+ */
+async function exportBundle(filePath, renderer = {}) {
+  const app = electronModule?.app;
+  let ipcStats = null;
+  try {
+    ipcStats = require("./ipcStatsBridge.cjs").getSnapshot();
+  } catch {
+    // Stats are optional
+  }
+  const rendererEntries = (Array.isArray(renderer.entries) ? renderer.entries : [])
+    .map((entry) => ({ ...entry, source: "renderer" }));
+  // Warn/error entries from this renderer were already forwarded into the ring
+  const entryKey = (entry) => `${entry.time}|${entry.category}|${entry.message}`;
+  const supplied = new Set(rendererEntries.map(entryKey));
+  const logs = [
+    ...getRecent().filter((entry) => entry.source !== "renderer" || !supplied.has(entryKey(entry))),
+    ...rendererEntries,
+  ].sort((a, b) => a.time - b.time);
+
+  const bundle = {
+    exportedAt: new Date().toISOString(),
+    app: {
+      version: app?.getVersion?.(),
+      electron: process.versions.electron,
+      chrome: process.versions.chrome,
+      node: process.versions.node,
+      platform: process.platform,
+      arch: process.arch,
+      osRelease: os.release(),
+      uptimeSec: Math.round(process.uptime()),
+    },
+    logConfig: getConfig(),
+    perf: {
+      mainMemory: process.memoryUsage(),
+      appMetrics: app?.getAppMetrics?.() ?? null,
+      renderer: renderer.perf ?? null,
+      ipc: ipcStats,
+    },
+    logs: logs.map(formatEntry),
+  };
+  await fs.promises.writeFile(filePath, JSON.stringify(bundle, null, 2), "utf8");
+  return { success: true };
+}
+
+function init(deps) {
+  electronModule = deps.electronModule;
+  loadConfig();
+  refreshThresholds();
+
+  const app = electronModule?.app;
+  app?.on?.("render-process-gone", (_event, _contents, details) => {
+    dumpCrash("render-process-gone", details);
+  });
+  app?.on?.("child-process-gone", (_event, details) => {
+    if (details?.reason !== "clean-exit") dumpCrash("child-process-gone", details);
+  });
+}
+
+/**
+ * Register IPC handlers for log config, renderer entries and bundle export
+ */
+function registerHandlers(ipcMain) {
+  ipcMain.handle("netcatty:log:getConfig", async () => getConfig());
+  ipcMain.handle("netcatty:log:setConfig", async (_event, next) => setConfig(next));
+  ipcMain.handle("netcatty:log:getRecent", async (_event, payload) => getRecent(payload?.limit));
+  ipcMain.handle("netcatty:log:exportBundle", async (_event, { filePath, renderer }) =>
+    exportBundle(filePath, renderer));
+  // Renderers forward warn/error entries so crash dumps include them
+  ipcMain.on("netcatty:log:append", (_event, entries) => {
+    if (!Array.isArray(entries)) return;
+    for (const entry of entries) {
+      if (!entry || typeof entry.message !== "string") continue;
+      pushEntry({
+        time: Number(entry.time) || Date.now(),
+        level: isLevel(entry.level) ? entry.level : "info",
+        category: String(entry.category || "Renderer"),
+        source: "renderer",
+        message: entry.message.slice(0, MAX_MESSAGE_CHARS),
+      });
+    }
+  });
+}
+
+module.exports = {
+  init,
+  registerHandlers,
+  createLogger,
+  getRecent,
+  getConfig,
+  setConfig,
+  dumpCrash,
+  exportBundle,
+};
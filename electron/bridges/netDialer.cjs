@@ -0,0 +1,280 @@
+/**
+ * Net Dialer - Cached DNS and Happy Eyeballs (RFC 8305) TCP connects
+ *
+ * Bridges dial the TCP connection themselves and hand ssh2 the connected
+ * socket (`sock`). That way every tab and bridge shares one DNS cache, and a
+ * dual-stack host whose IPv6 (or IPv4) path is broken falls back to the
+ * other family after 250 ms instead of waiting for a TCP timeout.
+ */
+
+const net = require("node:net");
+const dns = require("node:dns");
+const { performance } = require("node:perf_hooks");
+
+// RFC 8305 section 8 recommended Connection Attempt Delay
+const CONNECTION_ATTEMPT_DELAY_MS = 250;
+const DIAL_TIMEOUT_MS = 20000;
+// getaddrinfo() reports no TTL; use this until the resolver tells us better
+const DEFAULT_TTL_MS = 30 * 1000;
+const MIN_TTL_MS = 5 * 1000;
+const MAX_TTL_MS = 5 * 60 * 1000;
+const MAX_CACHE_ENTRIES = 256;
+
+// lowercased host -> { addresses: [{ address, family }], resolvedAt, expiresAt, preferred }
+const dnsCache = new Map();
+// lowercased host -> Promise of an in-flight lookup, so parallel tabs share it
+const pendingLookups = new Map();
+
+const elapsed = (since) => Math.round(performance.now() - since);
+
+/**
+ * Refine a cache entry's expiry from the DNS TTLs (best effort; the
+ * addresses themselves always come from the system resolver)
+ */
+async function learnTtl(host, entry) {
+  const answers = await Promise.allSettled([
+    dns.promises.resolve4(host, { ttl: true }),
+    dns.promises.resolve6(host, { ttl: true }),
+  ]);
+  const ttls = answers
+    .filter((r) => r.status === "fulfilled")
+    .flatMap((r) => r.value.map((record) => record.ttl))
+    .filter((ttl) => Number.isFinite(ttl));
+  if (ttls.length === 0) return;
+  const ttlMs = Math.min(MAX_TTL_MS, Math.max(MIN_TTL_MS, Math.min(...ttls) * 1000));
+  entry.expiresAt = entry.resolvedAt + ttlMs;
+}
+
+/**
+ * Resolve a host name to all of its addresses, served from cache while the
+ * entry is fresh. IP literals skip DNS entirely.
+ * @returns {Promise<{ addresses: Array<{address: string, family: number}>, cached: boolean, entry: Object|null }>}
+ */
+async function resolveHost(host) {
+  const family = net.isIP(host);
+  if (family) return { addresses: [{ address: host, family }], cached: false, entry: null };
+
+  const key = host.toLowerCase();
+  const hit = dnsCache.get(key);
+  if (hit && hit.expiresAt > Date.now()) {
+    return { addresses: hit.addresses, cached: true, entry: hit };
+  }
+
+  let pending = pendingLookups.get(key);
+  if (!pending) {
+    pending = dns.promises.lookup(host, { all: true, verbatim: true })
+      .then((results) => {
+        const seen = new Set();
+        const addresses = results.filter((r) => {
+          if (seen.has(r.address)) return false;
+          seen.add(r.address);
+          return true;
+        });
+        if (addresses.length === 0) throw new Error(`No addresses found for ${host}`);
+        const now = Date.now();
+        const entry = {
+          addresses,
+          resolvedAt: now,
+          expiresAt: now + DEFAULT_TTL_MS,
+          preferred: hit?.preferred || null,
+        };
+        dnsCache.delete(key);
+        dnsCache.set(key, entry);
+        if (dnsCache.size > MAX_CACHE_ENTRIES) {
+          dnsCache.delete(dnsCache.keys().next().value);
+        }
+        learnTtl(host, entry).catch(() => { });
+        return entry;
+      })
+      .finally(() => pendingLookups.delete(key));
+    pendingLookups.set(key, pending);
+  }
+  const entry = await pending;
+  return { addresses: entry.addresses, cached: false, entry };
+}
+
+/**
+ * RFC 8305 section 4 ordering: alternate families starting with IPv6, but
+ * try the address that won last time first
+ */
+function orderAddresses(addresses, preferred) {
+  const v6 = addresses.filter((a) => a.family === 6);
+  const v4 = addresses.filter((a) => a.family !== 6);
+  const preferredFamily = preferred ? net.isIP(preferred) : 6;
+  const [first, second] = preferredFamily === 4 ? [v4, v6] : [v6, v4];
+  const ordered = [];
+  for (let i = 0; i < Math.max(first.length, second.length); i++) {
+    if (first[i]) ordered.push(first[i]);
+    if (second[i]) ordered.push(second[i]);
+  }
+  const index = preferred ? ordered.findIndex((a) => a.address === preferred) : -1;
+  if (index > 0) ordered.unshift(...ordered.splice(index, 1));
+  return ordered;
+}
+
+/**
+ * Race staggered connection attempts; the first socket to connect wins and
+ * the rest are destroyed. A failed attempt starts the next one right away.
+ */
+function raceConnect(addresses, port, timeoutMs, label) {
+  return new Promise((resolve, reject) => {
+    const attempts = new Map(); // socket -> onError
+    let nextIndex = 0;
+    let settled = false;
+    let staggerTimer = null;
+    let lastError = null;
+
+    const cleanup = () => {
+      clearTimeout(staggerTimer);
+      clearTimeout(deadline);
+    };
+    const fail = (err) => {
+      if (settled) return;
+      settled = true;
+      cleanup();
+      for (const socket of attempts.keys()) socket.destroy();
+      attempts.clear();
+      reject(err);
+    };
+
+    const startNext = () => {
+      clearTimeout(staggerTimer);
+      if (settled || nextIndex >= addresses.length) return;
+      const target = addresses[nextIndex++];
+      const socket = net.connect({ host: target.address, port, family: target.family });
+
+      const onError = (err) => {
+        attempts.delete(socket);
+        socket.destroy();
+        lastError = err;
+        if (attempts.size === 0 && nextIndex >= addresses.length) {
+          fail(lastError);
+        } else {
+          startNext();
+        }
+      };
+      attempts.set(socket, onError);
+      socket.once("error", onError);
+      socket.once("connect", () => {
+        if (settled) {
+          socket.destroy();
+          return;
+        }
+        settled = true;
+        cleanup();
+        socket.removeListener("error", onError);
+        for (const other of attempts.keys()) {
+          if (other !== socket) other.destroy();
+        }
+        attempts.clear();
+        resolve({ socket, target });
+      });
+
+      staggerTimer = setTimeout(startNext, CONNECTION_ATTEMPT_DELAY_MS);
+    };
+
+    const deadline = setTimeout(() => {
+      fail(lastError || new Error(`Timed out connecting to ${label}`));
+    }, timeoutMs);
+
+    startNext();
+  });
+}
+
+/**
+ * Open a TCP connection to host:port
+ * @param {string} host
+ * @param {number} port
+ * @param {Object} [options]
+ * @param {number} [options.timeoutMs] - Overall DNS + connect budget
+ * @returns {Promise<{ socket: net.Socket, timing: { dnsMs: number, tcpMs: number, address: string, family: number, dnsCached: boolean } }>}
+ */
+async function dial(host, port, options = {}) {
+  const timeoutMs = options.timeoutMs || DIAL_TIMEOUT_MS;
+  const started = performance.now();
+  const { addresses, cached, entry } = await resolveHost(host);
+  const dnsMs = elapsed(started);
+
+  const connectStarted = performance.now();
+  const { socket, target } = await raceConnect(
+    orderAddresses(addresses, entry?.preferred),
+    port,
+    Math.max(1000, timeoutMs - dnsMs),
+    `${host}:${port}`,
+  );
+  if (entry) entry.preferred = target.address;
+  socket.setNoDelay(true);
+
+  return {
+    socket,
+    timing: {
+      dnsMs,
+      tcpMs: elapsed(connectStarted),
+      address: target.address,
+      family: target.family,
+      dnsCached: cached,
+    },
+  };
+}
+
+/**
+ * Dial connectOpts.host/port and hand the socket to ssh2 via `sock`.
+ * Options that already carry a socket (proxy, jump host) are left alone.
+ * @returns {Promise<Object|null>} dial timing, or null when nothing was dialed
+ */
+async function dialInto(connectOpts, options = {}) {
+  if (connectOpts.sock || !connectOpts.host) return null;
+  const { socket, timing } = await dial(connectOpts.host, connectOpts.port || 22, options);
+  connectOpts.sock = socket;
+  delete connectOpts.host;
+  delete connectOpts.port;
+  return timing;
+}
+
+/**
+ * Split an ssh2 connect into key exchange and authentication time. Call
+ * right before conn.connect(); `finish()` on "ready" returns the breakdown.
+ * @param {import("ssh2").Client} conn
+ * @param {Object|null} dialTiming - From dial()/dialInto(), null for tunneled sockets
+ * @param {number} [socketMs] - Time spent obtaining a proxy/jump socket instead
+ */
+function startConnectTimer(conn, dialTiming, socketMs) {
+  const started = performance.now();
+  let handshakeAt = null;
+  conn.once("handshake", () => {
+    handshakeAt = performance.now();
+  });
+  return {
+    finish() {
+      const now = performance.now();
+      const dnsMs = dialTiming?.dnsMs ?? 0;
+      const tcpMs = dialTiming?.tcpMs ?? socketMs ?? 0;
+      const kexMs = Math.round((handshakeAt ?? now) - started);
+      const authMs = Math.round(now - (handshakeAt ?? now));
+      return {
+        dnsMs,
+        tcpMs,
+        kexMs,
+        authMs,
+        totalMs: dnsMs + tcpMs + kexMs + authMs,
+        address: dialTiming?.address,
+        dnsCached: dialTiming?.dnsCached,
+        tunneled: !dialTiming,
+      };
+    },
+  };
+}
+
+function clearDnsCache() {
+  dnsCache.clear();
+}
+
+module.exports = {
+  CONNECTION_ATTEMPT_DELAY_MS,
+  resolveHost,
+  orderAddresses,
+  dial,
+  dialInto,
+  startConnectTimer,
+  clearDnsCache,
+};
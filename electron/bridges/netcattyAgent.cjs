@@ -5,18 +5,12 @@
  * - OpenSSH certificate authentication (client cert + private key)
  */
 
-const fs = require("node:fs");
-const path = require("node:path");
 const { BaseAgent } = require("ssh2/lib/agent.js");
 const { parseKey } = require("ssh2/lib/protocol/keyParser.js");
 
-// Simple file logger for debugging
-const logFile = path.join(require("os").tmpdir(), "netcatty-agent.log");
-const log = (msg, data) => {
-  const line = `[${new Date().toISOString()}] ${msg} ${data ? JSON.stringify(data) : ""}\n`;
-  try { fs.appendFileSync(logFile, line); } catch {}
-  console.log("[Agent]", msg, data || "");
-};
+const agentLog = require("./logBridge.cjs").createLogger("Agent");
+// Called on every sign; the data is only serialized when debug is enabled
+const log = (msg, data) => agentLog.debug(() => (data ? `${msg} ${JSON.stringify(data)}` : msg));
 
 const DUMMY_ED25519_PUB =
   "ssh-ed25519 AAAAC3NzaC1lZDI1NTE5AAAAIAEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEBAQEB netcatty-agent-dummy";
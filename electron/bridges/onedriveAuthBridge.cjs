@@ -245,8 +245,9 @@ function registerHandlers(ipcMain, electronModule) {
       throw new Error(`OneDrive upload failed: ${res.status} - ${text.slice(0, 200)}`);
     }
 
+    // The returned driveItem carries the new cTag, same as getSyncFileRevision reports
     const item = safeJsonParse(text) || {};
-    return { fileId: item.id || null };
+    return { fileId: item.id || null, revision: item.cTag || item.eTag || null };
   });
 
   ipcMain.handle("netcatty:onedrive:drive:downloadSyncFile", async (_event, payload) => {
@@ -298,6 +299,34 @@ function registerHandlers(ipcMain, electronModule) {
     return { syncedFile: data };
   });
 
+  ipcMain.handle("netcatty:onedrive:drive:getSyncFileRevision", async (_event, payload) => {
+    const accessToken = payload?.accessToken;
+    const fileId = payload?.fileId;
+    const fileName = isNonEmptyString(payload?.fileName) ? payload.fileName : DEFAULT_SYNC_FILE_NAME;
+    if (!isNonEmptyString(accessToken)) throw new Error("Missing accessToken");
+
+    const itemUrl = fileId
+      ? `${ONEDRIVE_GRAPH_API}/me/drive/items/${fileId}`
+      : `${ONEDRIVE_GRAPH_API}/me${APP_FOLDER_PATH}:/${encodeURIComponent(fileName)}`;
+
+    // cTag only changes with the content, eTag also with metadata
+    const res = await fetchImpl(`${itemUrl}?$select=id,cTag,eTag`, {
+      headers: { Authorization: `Bearer ${accessToken}` },
+    });
+
+    if (res.status === 404) {
+      return { revision: null };
+    }
+
+    const text = await res.text();
+    if (!res.ok) {
+      throw new Error(`OneDrive sync file metadata failed: ${res.status} - ${text.slice(0, 200)}`);
+    }
+
+    const item = safeJsonParse(text) || {};
+    return { revision: item.cTag || item.eTag || null };
+  });
+
   ipcMain.handle("netcatty:onedrive:drive:deleteSyncFile", async (_event, payload) => {
     const accessToken = payload?.accessToken;
     const fileId = payload?.fileId;
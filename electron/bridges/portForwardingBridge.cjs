@@ -1,11 +1,18 @@
 /**
  * Port Forwarding Bridge - Handles SSH port forwarding tunnels
  * Extracted from main.cjs for single responsibility
+ *
+ * Tunnels to the same user@host:port share one SSH connection and multiplex
+ * their forward channels over it. On-demand tunnels (local and dynamic only)
+ * bind their listener right away but only borrow the connection while they
+ * have clients, releasing it after ON_DEMAND_IDLE_MS without any.
  */
 
 const net = require("node:net");
 const { Client: SSHClient } = require("ssh2");
 const keyboardInteractiveHandler = require("./keyboardInteractiveHandler.cjs");
+const transportProfile = require("./sshTransportProfile.cjs");
+const { dialInto } = require("./netDialer.cjs");
 const { 
   buildAuthHandler, 
   createKeyboardInteractiveHandler, 
@@ -15,6 +22,12 @@ const {
 // Active port forwarding tunnels
 const portForwardingTunnels = new Map();
 
+// Shared SSH connections: "user@host:port" -> { key, conn, ready, holders, remoteForwards }
+const sharedConnections = new Map();
+
+// How long an on-demand tunnel keeps the connection after its last client leaves
+const ON_DEMAND_IDLE_MS = 5 * 60 * 1000;
+
 /**
  * Send message to renderer safely
  */
@@ -27,34 +40,27 @@ function safeSend(sender, channel, payload) {
   }
 }
 
+function connectionKey({ hostname, port = 22, username }) {
+  return `${username || 'root'}@${hostname}:${port}`;
+}
+
 /**
- * Start a port forwarding tunnel
+ * Open an authenticated SSH connection for forwarding. `onLost(err)` runs
+ * once the ready connection errors or closes.
  */
-async function startPortForward(event, payload) {
+function openConnection(sender, payload, tunnelId, onLost) {
   const {
-    tunnelId,
-    type, // 'local' | 'remote' | 'dynamic'
-    localPort,
-    bindAddress = '127.0.0.1',
-    remoteHost,
-    remotePort,
     hostname,
     port = 22,
     username,
     password,
     privateKey,
     passphrase,
+    transportProfile: profile,
   } = payload;
 
   return new Promise((resolve, reject) => {
     const conn = new SSHClient();
-    const sender = event.sender;
-
-    const sendStatus = (status, error = null) => {
-      if (!sender.isDestroyed()) {
-        sender.send("netcatty:portforward:status", { tunnelId, status, error });
-      }
-    };
 
     const connectOpts = {
       host: hostname,
@@ -65,6 +71,7 @@ async function startPortForward(event, payload) {
       // Enable keyboard-interactive authentication (required for 2FA/MFA)
       tryKeyboard: true,
     };
+    transportProfile.applyTransportProfile(connectOpts, profile);
 
     if (privateKey) {
       connectOpts.privateKey = privateKey;
@@ -95,212 +102,398 @@ async function startPortForward(event, payload) {
       logPrefix: "[PortForward]",
     }));
 
-
+    let ready = false;
     conn.on('ready', () => {
-      console.log(`[PortForward] SSH connection ready for tunnel ${tunnelId}`);
-
-      if (type === 'local') {
-        // LOCAL FORWARDING: Listen on local port, forward to remote
-        const server = net.createServer((socket) => {
-          conn.forwardOut(
-            bindAddress,
-            localPort,
-            remoteHost,
-            remotePort,
-            (err, stream) => {
-              if (err) {
-                console.error(`[PortForward] Forward error:`, err.message);
-                socket.end();
-                return;
-              }
-              socket.pipe(stream).pipe(socket);
-
-              socket.on('error', (e) => console.warn('[PortForward] Socket error:', e.message));
-              stream.on('error', (e) => console.warn('[PortForward] Stream error:', e.message));
-            }
-          );
-        });
+      console.log(`[PortForward] SSH connection ready for ${connectionKey(payload)}`);
+      ready = true;
+      resolve(conn);
+    });
 
-        server.on('error', (err) => {
-          console.error(`[PortForward] Server error:`, err.message);
-          sendStatus('error', err.message);
-          conn.end();
-          portForwardingTunnels.delete(tunnelId);
-          reject(err);
-        });
+    conn.on('error', (err) => {
+      console.error(`[PortForward] SSH error:`, err.message);
+      if (ready) onLost(err);
+      else reject(err);
+    });
 
-        server.listen(localPort, bindAddress, () => {
-          console.log(`[PortForward] Local forwarding active: ${bindAddress}:${localPort} -> ${remoteHost}:${remotePort}`);
-          portForwardingTunnels.set(tunnelId, {
-            type: 'local',
-            conn,
-            server,
-            webContentsId: sender.id
-          });
-          sendStatus('active');
-          resolve({ tunnelId, success: true });
-        });
+    conn.on('close', () => {
+      console.log(`[PortForward] SSH connection closed for ${connectionKey(payload)}`);
+      if (ready) onLost(null);
+      else reject(new Error('SSH connection closed'));
+    });
 
-      } else if (type === 'remote') {
-        // REMOTE FORWARDING: Listen on remote port, forward to local
-        conn.forwardIn(bindAddress, localPort, (err) => {
-          if (err) {
-            console.error(`[PortForward] Remote forward error:`, err.message);
-            sendStatus('error', err.message);
-            conn.end();
-            reject(err);
-            return;
-          }
+    dialInto(connectOpts).then(
+      () => conn.connect(connectOpts),
+      (err) => {
+        console.error(`[PortForward] Connect error:`, err.message);
+        reject(err);
+      },
+    );
+  });
+}
 
-          console.log(`[PortForward] Remote forwarding active: remote ${bindAddress}:${localPort} -> local ${remoteHost}:${remotePort}`);
-          portForwardingTunnels.set(tunnelId, {
-            type: 'remote',
-            conn,
-            webContentsId: sender.id
-          });
-          sendStatus('active');
-          resolve({ tunnelId, success: true });
+/**
+ * Register `tunnelId` as a user of the shared connection to the payload's
+ * host, connecting when there is none yet (the first tunnel's credentials
+ * and transport profile are used). `onLost(err)` runs if the connection
+ * drops while the tunnel still holds it.
+ * @returns {Object} the pool entry; `entry.ready` resolves with the ssh2 Client
+ */
+function acquireConnection(sender, payload, tunnelId, onLost) {
+  const key = connectionKey(payload);
+  let entry = sharedConnections.get(key);
+  if (!entry) {
+    entry = { key, conn: null, ready: null, holders: new Map(), remoteForwards: new Map() };
+    const created = entry;
+    const forget = () => {
+      if (sharedConnections.get(key) === created) sharedConnections.delete(key);
+    };
+    const lose = (err) => {
+      forget();
+      const holders = [...created.holders.values()];
+      created.holders.clear();
+      for (const notify of holders) notify(err);
+    };
+    entry.ready = openConnection(sender, payload, tunnelId, lose).then(
+      (conn) => {
+        created.conn = conn;
+        // One dispatcher per connection; remote tunnels register by bound port
+        conn.on('tcp connection', (info, accept, rejectConn) => {
+          const handler = created.remoteForwards.get(info.destPort);
+          if (handler) handler(accept);
+          else rejectConn();
         });
+        // Every tunnel gave up while we were connecting
+        if (created.holders.size === 0) {
+          forget();
+          conn.end();
+        }
+        return conn;
+      },
+      (err) => {
+        forget();
+        created.holders.clear();
+        throw err;
+      },
+    );
+    // Holders that stop waiting must not leave an unhandled rejection behind
+    entry.ready.catch(() => { });
+    sharedConnections.set(key, entry);
+  }
+  entry.holders.set(tunnelId, onLost);
+  return entry;
+}
 
-        // Handle incoming connections from remote
-        conn.on('tcp connection', (info, accept, rejectConn) => {
-          const stream = accept();
-          const socket = net.connect(remotePort, remoteHost || '127.0.0.1', () => {
-            stream.pipe(socket).pipe(stream);
-          });
+/**
+ * Drop a tunnel's hold on a shared connection; the last holder closes it
+ */
+function releaseConnection(entry, tunnelId) {
+  if (!entry.holders.delete(tunnelId) || entry.holders.size > 0) return;
+  if (sharedConnections.get(entry.key) === entry) sharedConnections.delete(entry.key);
+  // Still connecting: the ready handler ends it once it sees no holders
+  if (entry.conn) {
+    try { entry.conn.end(); } catch { }
+  }
+}
 
-          socket.on('error', (e) => {
-            console.warn('[PortForward] Local socket error:', e.message);
-            stream.end();
+/**
+ * Start a port forwarding tunnel
+ */
+async function startPortForward(event, payload) {
+  const {
+    tunnelId,
+    type, // 'local' | 'remote' | 'dynamic'
+    localPort,
+    bindAddress = '127.0.0.1',
+    remoteHost,
+    remotePort,
+    onDemand = false,
+    transportProfile: profile,
+  } = payload;
+  const windowSize = transportProfile.normalizeProfile(profile)?.windowSize;
+  const sender = event.sender;
+
+  if (type !== 'local' && type !== 'remote' && type !== 'dynamic') {
+    throw new Error(`Unknown forwarding type: ${type}`);
+  }
+
+  const sendStatus = (status, error = null) => {
+    safeSend(sender, "netcatty:portforward:status", { tunnelId, status, error });
+  };
+
+  const tunnel = {
+    type,
+    // A remote listener lives on the server, so it needs the connection up front
+    onDemand: !!onDemand && type !== 'remote',
+    entry: null,
+    server: null,
+    remoteBoundPort: null,
+    clients: new Set(),
+    idleTimer: null,
+    closed: false,
+    webContentsId: sender.id,
+  };
+
+  const closeTunnel = () => {
+    if (portForwardingTunnels.get(tunnelId) === tunnel) portForwardingTunnels.delete(tunnelId);
+    tunnel.closed = true;
+    clearTimeout(tunnel.idleTimer);
+    if (tunnel.server) {
+      try { tunnel.server.close(); } catch { }
+    }
+    for (const socket of tunnel.clients) socket.destroy();
+    tunnel.clients.clear();
+    const entry = tunnel.entry;
+    tunnel.entry = null;
+    if (entry) {
+      if (tunnel.remoteBoundPort !== null) {
+        entry.remoteForwards.delete(tunnel.remoteBoundPort);
+        try { entry.conn?.unforwardIn(bindAddress, tunnel.remoteBoundPort); } catch { }
+      }
+      releaseConnection(entry, tunnelId);
+    }
+  };
+  tunnel.close = closeTunnel;
+
+  const onConnectionLost = (err) => {
+    tunnel.entry = null;
+    clearTimeout(tunnel.idleTimer);
+    if (tunnel.closed) return;
+    if (tunnel.onDemand) {
+      // Keep listening; the next client connects again
+      console.log(`[PortForward] On-demand tunnel ${tunnelId} lost its SSH connection, waiting for clients`);
+      return;
+    }
+    closeTunnel();
+    sendStatus(err ? 'error' : 'inactive', err ? err.message : null);
+  };
+
+  const holdConnection = () => {
+    if (!tunnel.entry) {
+      tunnel.entry = acquireConnection(sender, payload, tunnelId, onConnectionLost);
+    }
+    const entry = tunnel.entry;
+    return entry.ready.catch((err) => {
+      if (tunnel.entry === entry) tunnel.entry = null;
+      throw err;
+    });
+  };
+
+  const trackClient = (socket) => {
+    tunnel.clients.add(socket);
+    clearTimeout(tunnel.idleTimer);
+    socket.on('close', () => {
+      tunnel.clients.delete(socket);
+      if (!tunnel.onDemand || tunnel.closed || tunnel.clients.size > 0 || !tunnel.entry) return;
+      tunnel.idleTimer = setTimeout(() => {
+        if (tunnel.closed || tunnel.clients.size > 0 || !tunnel.entry) return;
+        console.log(`[PortForward] On-demand tunnel ${tunnelId} idle, releasing SSH connection`);
+        const entry = tunnel.entry;
+        tunnel.entry = null;
+        releaseConnection(entry, tunnelId);
+      }, ON_DEMAND_IDLE_MS);
+    });
+  };
+
+  // Open a forward channel, connecting first for on-demand tunnels
+  const openChannel = (srcPort, dstHost, dstPort, callback) => {
+    holdConnection().then(
+      (conn) => {
+        try {
+          conn.forwardOut(bindAddress, srcPort, dstHost, dstPort, (err, stream) => {
+            if (!err) transportProfile.enlargeChannelWindow(stream, windowSize);
+            callback(err, stream);
           });
-          stream.on('error', (e) => {
-            console.warn('[PortForward] Remote stream error:', e.message);
+        } catch (err) {
+          callback(err);
+        }
+      },
+      (err) => {
+        console.error(`[PortForward] On-demand connect failed for tunnel ${tunnelId}:`, err.message);
+        callback(err);
+      },
+    );
+  };
+
+  // LOCAL FORWARDING: Listen on local port, forward to remote
+  const handleLocalClient = (socket) => {
+    trackClient(socket);
+    socket.on('error', (e) => console.warn('[PortForward] Socket error:', e.message));
+    openChannel(localPort, remoteHost, remotePort, (err, stream) => {
+      if (err) {
+        console.error(`[PortForward] Forward error:`, err.message);
+        socket.end();
+        return;
+      }
+      if (socket.destroyed) {
+        stream.end();
+        return;
+      }
+      socket.pipe(stream).pipe(socket);
+      stream.on('error', (e) => console.warn('[PortForward] Stream error:', e.message));
+    });
+  };
+
+  // DYNAMIC FORWARDING (SOCKS5 Proxy)
+  const handleSocksClient = (socket) => {
+    trackClient(socket);
+    socket.on('error', () => { });
+    // Simple SOCKS5 handshake
+    socket.once('data', (data) => {
+      if (data[0] !== 0x05) {
+        socket.end();
+        return;
+      }
+
+      // Reply: version, no auth required
+      socket.write(Buffer.from([0x05, 0x00]));
+
+      // Wait for connection request
+      socket.once('data', (request) => {
+        if (request[0] !== 0x05 || request[1] !== 0x01) {
+          socket.write(Buffer.from([0x05, 0x07, 0x00, 0x01, 0, 0, 0, 0, 0, 0]));
+          socket.end();
+          return;
+        }
+
+        let targetHost, targetPort;
+        const addressType = request[3];
+
+        if (addressType === 0x01) {
+          // IPv4
+          targetHost = `${request[4]}.${request[5]}.${request[6]}.${request[7]}`;
+          targetPort = request.readUInt16BE(8);
+        } else if (addressType === 0x03) {
+          // Domain name
+          const domainLength = request[4];
+          targetHost = request.slice(5, 5 + domainLength).toString();
+          targetPort = request.readUInt16BE(5 + domainLength);
+        } else if (addressType === 0x04) {
+          // IPv6 - simplified handling
+          socket.write(Buffer.from([0x05, 0x08, 0x00, 0x01, 0, 0, 0, 0, 0, 0]));
+          socket.end();
+          return;
+        } else {
+          socket.write(Buffer.from([0x05, 0x08, 0x00, 0x01, 0, 0, 0, 0, 0, 0]));
+          socket.end();
+          return;
+        }
+
+        // Forward through SSH tunnel
+        openChannel(0, targetHost, targetPort, (err, stream) => {
+          if (err) {
+            socket.write(Buffer.from([0x05, 0x05, 0x00, 0x01, 0, 0, 0, 0, 0, 0]));
             socket.end();
-          });
-        });
+            return;
+          }
+          if (socket.destroyed) {
+            stream.end();
+            return;
+          }
 
-      } else if (type === 'dynamic') {
-        // DYNAMIC FORWARDING (SOCKS5 Proxy)
-        const server = net.createServer((socket) => {
-          // Simple SOCKS5 handshake
-          socket.once('data', (data) => {
-            if (data[0] !== 0x05) {
-              socket.end();
-              return;
-            }
-
-            // Reply: version, no auth required
-            socket.write(Buffer.from([0x05, 0x00]));
-
-            // Wait for connection request
-            socket.once('data', (request) => {
-              if (request[0] !== 0x05 || request[1] !== 0x01) {
-                socket.write(Buffer.from([0x05, 0x07, 0x00, 0x01, 0, 0, 0, 0, 0, 0]));
-                socket.end();
-                return;
-              }
-
-              let targetHost, targetPort;
-              const addressType = request[3];
-
-              if (addressType === 0x01) {
-                // IPv4
-                targetHost = `${request[4]}.${request[5]}.${request[6]}.${request[7]}`;
-                targetPort = request.readUInt16BE(8);
-              } else if (addressType === 0x03) {
-                // Domain name
-                const domainLength = request[4];
-                targetHost = request.slice(5, 5 + domainLength).toString();
-                targetPort = request.readUInt16BE(5 + domainLength);
-              } else if (addressType === 0x04) {
-                // IPv6 - simplified handling
-                socket.write(Buffer.from([0x05, 0x08, 0x00, 0x01, 0, 0, 0, 0, 0, 0]));
-                socket.end();
-                return;
-              } else {
-                socket.write(Buffer.from([0x05, 0x08, 0x00, 0x01, 0, 0, 0, 0, 0, 0]));
-                socket.end();
-                return;
-              }
-
-              // Forward through SSH tunnel
-              conn.forwardOut(
-                bindAddress,
-                0,
-                targetHost,
-                targetPort,
-                (err, stream) => {
-                  if (err) {
-                    socket.write(Buffer.from([0x05, 0x05, 0x00, 0x01, 0, 0, 0, 0, 0, 0]));
-                    socket.end();
-                    return;
-                  }
-
-                  // Success reply
-                  const reply = Buffer.alloc(10);
-                  reply[0] = 0x05;
-                  reply[1] = 0x00;
-                  reply[2] = 0x00;
-                  reply[3] = 0x01;
-                  reply.writeUInt16BE(0, 8);
-                  socket.write(reply);
-
-                  socket.pipe(stream).pipe(socket);
-
-                  socket.on('error', () => stream.end());
-                  stream.on('error', () => socket.end());
-                }
-              );
-            });
-          });
-        });
+          // Success reply
+          const reply = Buffer.alloc(10);
+          reply[0] = 0x05;
+          reply[1] = 0x00;
+          reply[2] = 0x00;
+          reply[3] = 0x01;
+          reply.writeUInt16BE(0, 8);
+          socket.write(reply);
 
-        server.on('error', (err) => {
-          console.error(`[PortForward] SOCKS server error:`, err.message);
-          sendStatus('error', err.message);
-          conn.end();
-          portForwardingTunnels.delete(tunnelId);
-          reject(err);
-        });
+          socket.pipe(stream).pipe(socket);
 
-        server.listen(localPort, bindAddress, () => {
-          console.log(`[PortForward] Dynamic SOCKS5 proxy active on ${bindAddress}:${localPort}`);
-          portForwardingTunnels.set(tunnelId, {
-            type: 'dynamic',
-            conn,
-            server,
-            webContentsId: sender.id
-          });
-          sendStatus('active');
-          resolve({ tunnelId, success: true });
+          socket.on('error', () => stream.end());
+          stream.on('error', () => socket.end());
         });
-      } else {
-        reject(new Error(`Unknown forwarding type: ${type}`));
-      }
+      });
     });
+  };
+
+  // REMOTE FORWARDING: incoming connection on the remote port, forward to local
+  const handleRemoteConnection = (accept) => {
+    const stream = accept();
+    transportProfile.enlargeChannelWindow(stream, windowSize);
+    const socket = net.connect(remotePort, remoteHost || '127.0.0.1', () => {
+      stream.pipe(socket).pipe(stream);
+    });
+    trackClient(socket);
 
-    conn.on('error', (err) => {
-      console.error(`[PortForward] SSH error:`, err.message);
-      sendStatus('error', err.message);
-      portForwardingTunnels.delete(tunnelId);
-      reject(err);
+    socket.on('error', (e) => {
+      console.warn('[PortForward] Local socket error:', e.message);
+      stream.end();
     });
+    stream.on('error', (e) => {
+      console.warn('[PortForward] Remote stream error:', e.message);
+      socket.end();
+    });
+  };
+
+  const listen = (onClient) => new Promise((resolve, reject) => {
+    const server = net.createServer(onClient);
+    tunnel.server = server;
+    server.once('error', reject);
+    server.listen(localPort, bindAddress, () => {
+      server.removeListener('error', reject);
+      server.on('error', (err) => {
+        console.error(`[PortForward] Server error:`, err.message);
+        sendStatus('error', err.message);
+        closeTunnel();
+      });
+      resolve();
+    });
+  });
 
-    conn.on('close', () => {
-      console.log(`[PortForward] SSH connection closed for tunnel ${tunnelId}`);
-      const tunnel = portForwardingTunnels.get(tunnelId);
-      if (tunnel) {
-        if (tunnel.server) {
-          try { tunnel.server.close(); } catch { }
-        }
-        sendStatus('inactive');
-        portForwardingTunnels.delete(tunnelId);
+  const forwardIn = () => new Promise((resolve, reject) => {
+    const entry = tunnel.entry;
+    if (!entry?.conn) {
+      reject(new Error('SSH connection closed'));
+      return;
+    }
+    entry.conn.forwardIn(bindAddress, localPort, (err, boundPort) => {
+      if (err) {
+        reject(err);
+        return;
       }
+      tunnel.remoteBoundPort = boundPort || localPort;
+      entry.remoteForwards.set(tunnel.remoteBoundPort, handleRemoteConnection);
+      resolve();
     });
+  });
 
+  if (!tunnel.onDemand) {
     sendStatus('connecting');
-    conn.connect(connectOpts);
-  });
+    try {
+      await holdConnection();
+    } catch (err) {
+      sendStatus('error', err.message);
+      throw err;
+    }
+  }
+
+  try {
+    if (type === 'local') {
+      await listen(handleLocalClient);
+      console.log(`[PortForward] Local forwarding ${tunnel.onDemand ? 'listening (on demand)' : 'active'}: ${bindAddress}:${localPort} -> ${remoteHost}:${remotePort}`);
+    } else if (type === 'remote') {
+      await forwardIn();
+      console.log(`[PortForward] Remote forwarding active: remote ${bindAddress}:${localPort} -> local ${remoteHost}:${remotePort}`);
+    } else {
+      await listen(handleSocksClient);
+      console.log(`[PortForward] Dynamic SOCKS5 proxy ${tunnel.onDemand ? 'listening (on demand)' : 'active'} on ${bindAddress}:${localPort}`);
+    }
+  } catch (err) {
+    console.error(`[PortForward] ${type === 'remote' ? 'Remote forward' : 'Server'} error:`, err.message);
+    sendStatus('error', err.message);
+    closeTunnel();
+    throw err;
+  }
+
+  // The connection may have dropped while we were binding
+  if (tunnel.closed) {
+    throw new Error('SSH connection closed');
+  }
+  portForwardingTunnels.set(tunnelId, tunnel);
+  sendStatus('active');
+  return { tunnelId, success: true };
 }
 
 /**
@@ -315,14 +508,7 @@ async function stopPortForward(event, payload) {
   }
 
   try {
-    if (tunnel.server) {
-      tunnel.server.close();
-    }
-    if (tunnel.conn) {
-      tunnel.conn.end();
-    }
-    portForwardingTunnels.delete(tunnelId);
-
+    tunnel.close();
     return { tunnelId, success: true };
   } catch (err) {
     return { tunnelId, success: false, error: err.message };
@@ -340,7 +526,7 @@ async function getPortForwardStatus(event, payload) {
     return { tunnelId, status: 'inactive' };
   }
 
-  return { tunnelId, status: 'active', type: tunnel.type };
+  return { tunnelId, status: 'active', type: tunnel.type, onDemand: tunnel.onDemand, connected: !!tunnel.entry?.conn };
 }
 
 /**
@@ -353,6 +539,8 @@ async function listPortForwards() {
       tunnelId,
       type: tunnel.type,
       status: 'active',
+      onDemand: tunnel.onDemand,
+      connected: !!tunnel.entry?.conn,
     });
   }
   return list;
@@ -363,20 +551,19 @@ async function listPortForwards() {
  */
 function stopAllPortForwards() {
   console.log(`[PortForward] Stopping all ${portForwardingTunnels.size} active tunnels...`);
-  for (const [tunnelId, tunnel] of portForwardingTunnels) {
+  for (const [tunnelId, tunnel] of [...portForwardingTunnels]) {
     try {
-      if (tunnel.server) {
-        tunnel.server.close();
-      }
-      if (tunnel.conn) {
-        tunnel.conn.end();
-      }
+      tunnel.close();
       console.log(`[PortForward] Stopped tunnel ${tunnelId}`);
     } catch (err) {
       console.warn(`[PortForward] Failed to stop tunnel ${tunnelId}:`, err.message);
     }
   }
   portForwardingTunnels.clear();
+  for (const entry of sharedConnections.values()) {
+    try { entry.conn?.end(); } catch { }
+  }
+  sharedConnections.clear();
   console.log('[PortForward] All tunnels stopped');
 }
 
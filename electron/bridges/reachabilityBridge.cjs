@@ -0,0 +1,501 @@
+/**
+ * Reachability Bridge - Background reachability and latency scanner for Vault hosts
+ *
+ * For each host a scan TCP-connects (directly, through the host's proxy, or
+ * through its jump host chain), reads the SSH identification banner and
+ * optionally compares the host key with the known hosts list. Scans run
+ * with bounded concurrency so thousands of hosts can be checked at once.
+ *
+ * Results are kept compactly per host id and persisted; the renderer gets
+ * batched, throttled updates instead of one IPC message per host.
+ */
+
+const crypto = require("node:crypto");
+const fs = require("node:fs");
+const path = require("node:path");
+const { Client: SSHClient } = require("ssh2");
+const { createProxySocket } = require("./proxyUtils.cjs");
+const { dial } = require("./netDialer.cjs");
+const { buildAuthHandler, applyAuthToConnOpts } = require("./sshAuthHelper.cjs");
+
+const RESULTS_FILE = "reachability.json";
+const RESULTS_VERSION = 1;
+const DEFAULT_CONCURRENCY = 64;
+const MAX_CONCURRENCY = 256;
+const CONNECT_TIMEOUT_MS = 5000;
+const BANNER_TIMEOUT_MS = 5000;
+const CHAIN_READY_TIMEOUT_MS = 15000;
+const UPDATE_THROTTLE_MS = 250;
+const SAVE_DEBOUNCE_MS = 2000;
+const MAX_BANNER_LENGTH = 255;
+
+// Status codes stored per host
+const STATUS_UNKNOWN = 0;
+const STATUS_UP = 1;
+const STATUS_DOWN = 2;
+
+// Host key check result
+const KEY_NOT_CHECKED = 0;
+const KEY_MATCH = 1;
+const KEY_MISMATCH = 2;
+const KEY_UNKNOWN = 3;
+
+// Host key algorithms that yield a key of each known_hosts key type
+const HOST_KEY_ALGORITHMS = {
+  "ssh-ed25519": ["ssh-ed25519"],
+  "ecdsa-sha2-nistp256": ["ecdsa-sha2-nistp256"],
+  "ecdsa-sha2-nistp384": ["ecdsa-sha2-nistp384"],
+  "ecdsa-sha2-nistp521": ["ecdsa-sha2-nistp521"],
+  "ssh-rsa": ["rsa-sha2-512", "rsa-sha2-256", "ssh-rsa"],
+  "ssh-dss": ["ssh-dss"],
+};
+
+let electronModule = null;
+
+// hostId -> [status, rttMs, lastSeen, bannerIndex, keyCheck, checkedAt, error]
+// Banners repeat across a fleet, so they are interned in `banners`.
+let results = null;
+let banners = [];
+let bannerIndex = new Map();
+let saveTimer = null;
+let activeScan = null;
+
+function init(deps) {
+  electronModule = deps.electronModule;
+}
+
+function getResultsFilePath() {
+  try {
+    const app = electronModule?.app;
+    return app ? path.join(app.getPath("userData"), RESULTS_FILE) : null;
+  } catch {
+    return null;
+  }
+}
+
+function loadResults() {
+  if (results) return results;
+  results = new Map();
+  const filePath = getResultsFilePath();
+  if (!filePath) return results;
+  try {
+    const data = JSON.parse(fs.readFileSync(filePath, "utf8"));
+    if (data?.version === RESULTS_VERSION && Array.isArray(data.banners) && data.results) {
+      banners = data.banners.map(String);
+      bannerIndex = new Map(banners.map((b, i) => [b, i]));
+      for (const [hostId, row] of Object.entries(data.results)) {
+        if (Array.isArray(row)) results.set(hostId, row);
+      }
+    }
+  } catch (err) {
+    if (err.code !== "ENOENT") {
+      console.warn("[Reachability] Failed to read results:", err.message);
+    }
+  }
+  return results;
+}
+
+function scheduleSave() {
+  if (saveTimer) return;
+  saveTimer = setTimeout(() => {
+    saveTimer = null;
+    const filePath = getResultsFilePath();
+    if (!filePath || !results) return;
+    const data = { version: RESULTS_VERSION, banners, results: Object.fromEntries(results) };
+    fs.promises.writeFile(filePath, JSON.stringify(data), "utf8").catch((err) => {
+      console.warn("[Reachability] Failed to write results:", err.message);
+    });
+  }, SAVE_DEBOUNCE_MS);
+}
+
+function internBanner(banner) {
+  if (!banner) return -1;
+  let index = bannerIndex.get(banner);
+  if (index === undefined) {
+    index = banners.length;
+    banners.push(banner);
+    bannerIndex.set(banner, index);
+  }
+  return index;
+}
+
+function toResult(hostId, row) {
+  const [status, rtt, lastSeen, banner, keyCheck, checkedAt, error] = row;
+  return {
+    hostId,
+    status: status === STATUS_UP ? "up" : status === STATUS_DOWN ? "down" : "unknown",
+    rttMs: rtt >= 0 ? rtt : null,
+    lastSeen: lastSeen || null,
+    banner: banner >= 0 ? banners[banner] || null : null,
+    hostKey: keyCheck === KEY_MATCH ? "match" : keyCheck === KEY_MISMATCH ? "mismatch" : keyCheck === KEY_UNKNOWN ? "unknown" : null,
+    checkedAt: checkedAt || null,
+    error: error || null,
+  };
+}
+
+function recordResult(hostId, probe) {
+  const map = loadResults();
+  const previous = map.get(hostId);
+  const now = Date.now();
+  const up = probe.status === STATUS_UP;
+  const row = [
+    probe.status,
+    up ? Math.round(probe.rttMs) : -1,
+    up ? now : previous?.[2] || 0,
+    up ? internBanner(probe.banner) : previous?.[3] ?? -1,
+    probe.keyCheck || KEY_NOT_CHECKED,
+    now,
+    up ? "" : probe.error || "",
+  ];
+  map.set(hostId, row);
+  scheduleSave();
+  return toResult(hostId, row);
+}
+
+/**
+ * Read the SSH identification line ("SSH-2.0-...") from a connected socket
+ */
+function readBanner(socket) {
+  return new Promise((resolve, reject) => {
+    let buffer = "";
+    const timer = setTimeout(() => finish(new Error("No SSH banner")), BANNER_TIMEOUT_MS);
+    const finish = (err, banner) => {
+      clearTimeout(timer);
+      socket.removeListener("data", onData);
+      socket.removeListener("error", onError);
+      socket.removeListener("close", onClose);
+      if (err) reject(err);
+      else resolve(banner);
+    };
+    // Servers may send other lines before the identification string (RFC 4253 4.2)
+    const onData = (chunk) => {
+      buffer += chunk.toString("latin1");
+      let newline;
+      while ((newline = buffer.indexOf("\n")) !== -1) {
+        const line = buffer.slice(0, newline).replace(/\r$/, "");
+        buffer = buffer.slice(newline + 1);
+        if (line.startsWith("SSH-")) {
+          finish(null, line.slice(0, MAX_BANNER_LENGTH));
+          return;
+        }
+      }
+      if (buffer.length > 8192) finish(new Error("Invalid SSH banner"));
+    };
+    const onError = (err) => finish(err);
+    const onClose = () => finish(new Error("Connection closed before banner"));
+    socket.on("data", onData);
+    socket.on("error", onError);
+    socket.on("close", onClose);
+  });
+}
+
+// Shares the DNS cache and IPv6/IPv4 racing with session connects
+async function connectTcp(hostname, port) {
+  const { socket } = await dial(hostname, port, { timeoutMs: CONNECT_TIMEOUT_MS });
+  return socket;
+}
+
+function withTimeout(promise, ms, message) {
+  let timer;
+  return Promise.race([
+    promise,
+    new Promise((_, reject) => {
+      timer = setTimeout(() => reject(new Error(message)), ms);
+    }),
+  ]).finally(() => clearTimeout(timer));
+}
+
+function forwardOut(conn, hostname, port) {
+  return new Promise((resolve, reject) => {
+    conn.forwardOut("127.0.0.1", 0, hostname, port, (err, stream) => (err ? reject(err) : resolve(stream)));
+  });
+}
+
+/**
+ * Connect a jump host chain non-interactively (no keyboard-interactive or
+ * passphrase prompts during a background scan). Returns the last hop.
+ */
+async function openChain(jumpHosts, proxy) {
+  const connections = [];
+  let sock = null;
+  try {
+    for (let i = 0; i < jumpHosts.length; i++) {
+      const jump = jumpHosts[i];
+      const port = jump.port || 22;
+      if (i === 0 && proxy) {
+        sock = await createProxySocket(proxy, jump.hostname, port);
+      } else if (i > 0) {
+        sock = await forwardOut(connections[i - 1], jump.hostname, port);
+      }
+      const connOpts = {
+        username: jump.username || "root",
+        readyTimeout: CHAIN_READY_TIMEOUT_MS,
+        tryKeyboard: false,
+      };
+      if (sock) connOpts.sock = sock;
+      else Object.assign(connOpts, { host: jump.hostname, port });
+      if (jump.privateKey) {
+        connOpts.privateKey = jump.privateKey;
+        if (jump.passphrase) connOpts.passphrase = jump.passphrase;
+      }
+      if (jump.password) connOpts.password = jump.password;
+      applyAuthToConnOpts(connOpts, buildAuthHandler({
+        privateKey: connOpts.privateKey,
+        password: connOpts.password,
+        passphrase: connOpts.passphrase,
+        username: connOpts.username,
+        logPrefix: `[Reachability] Hop ${i + 1}`,
+      }));
+
+      const conn = new SSHClient();
+      await new Promise((resolve, reject) => {
+        conn.once("ready", resolve);
+        conn.once("error", reject);
+        conn.connect(connOpts);
+      });
+      // Later errors (e.g. keepalive) must not crash the process
+      conn.on("error", (err) => console.warn("[Reachability] Chain error:", err.message));
+      connections.push(conn);
+    }
+    return { last: connections[connections.length - 1], connections };
+  } catch (err) {
+    for (const conn of connections) {
+      try { conn.end(); } catch { }
+    }
+    throw err;
+  }
+}
+
+/**
+ * Open a raw stream to the target: via the chain, the proxy or plain TCP.
+ * Returns the stream and the time to establish it.
+ */
+async function openTargetStream(target, chain) {
+  const port = target.port || 22;
+  const start = performance.now();
+  let socket;
+  if (chain) {
+    socket = await withTimeout(forwardOut(chain.last, target.hostname, port), CONNECT_TIMEOUT_MS, "Forward timed out");
+  } else if (target.proxy) {
+    socket = await withTimeout(createProxySocket(target.proxy, target.hostname, port), CONNECT_TIMEOUT_MS, "Proxy connect timed out");
+  } else {
+    socket = await connectTcp(target.hostname, port);
+  }
+  return { socket, connectMs: performance.now() - start };
+}
+
+/**
+ * Key type named at the start of a public key blob ("ssh-ed25519", ...)
+ */
+function blobKeyType(blob) {
+  if (blob.length < 4) return null;
+  const length = blob.readUInt32BE(0);
+  return length > 0 && 4 + length <= blob.length ? blob.toString("latin1", 4, 4 + length) : null;
+}
+
+/**
+ * SHA256 fingerprint as unpadded base64; accepts "SHA256:..." and hex forms
+ */
+function normalizeFingerprint(value) {
+  const text = String(value).trim().replace(/^SHA256:/i, "");
+  const hex = text.replace(/:/g, "");
+  if (/^[0-9a-f]{64}$/i.test(hex)) return Buffer.from(hex, "hex").toString("base64").replace(/=+$/, "");
+  return text.replace(/=+$/, "");
+}
+
+/**
+ * Compare an offered host key blob with the known keys of the same type.
+ * Keys of other types say nothing about this one, so with no comparable
+ * entry the result is unknown rather than a mismatch.
+ */
+function compareHostKey(offered, knownKeys) {
+  const type = blobKeyType(offered);
+  const fingerprint = crypto.createHash("sha256").update(offered).digest("base64").replace(/=+$/, "");
+  let compared = false;
+  for (const known of knownKeys) {
+    if (known.blob) {
+      const blob = Buffer.from(known.blob, "base64");
+      if (blobKeyType(blob) !== type) continue;
+      compared = true;
+      if (blob.equals(offered)) return KEY_MATCH;
+    } else if (known.fingerprint) {
+      const matches = normalizeFingerprint(known.fingerprint) === fingerprint;
+      if (matches) return KEY_MATCH;
+      // Without a type, a different fingerprint may just be another key type
+      if (known.keyType === type) compared = true;
+    }
+  }
+  return compared ? KEY_MISMATCH : KEY_UNKNOWN;
+}
+
+/**
+ * Fetch the server host key over a fresh stream and compare it with the known
+ * host keys ({ keyType, blob } or { keyType, fingerprint }) for this host.
+ * Only the known key types are offered, so the server presents a key that
+ * can be compared.
+ */
+async function checkHostKey(target, chain) {
+  const knownKeys = Array.isArray(target.knownKeys)
+    ? target.knownKeys.filter((known) => known && (known.blob || known.fingerprint))
+    : [];
+  if (knownKeys.length === 0) return KEY_UNKNOWN;
+  const knownTypes = new Set(knownKeys.map((known) =>
+    known.blob ? blobKeyType(Buffer.from(known.blob, "base64")) : known.keyType));
+  const serverHostKey = [...new Set([...knownTypes].flatMap((type) => HOST_KEY_ALGORITHMS[type] || []))];
+  const { socket } = await openTargetStream(target, chain);
+  return new Promise((resolve) => {
+    const conn = new SSHClient();
+    let result = KEY_UNKNOWN;
+    const done = () => {
+      try { conn.end(); } catch { }
+      try { socket.destroy(); } catch { }
+      resolve(result);
+    };
+    conn.on("error", done);
+    conn.on("close", done);
+    conn.connect({
+      sock: socket,
+      username: "netcatty-probe",
+      readyTimeout: BANNER_TIMEOUT_MS + CONNECT_TIMEOUT_MS,
+      algorithms: serverHostKey.length > 0 ? { serverHostKey } : undefined,
+      // Abort right after key exchange; no authentication is attempted
+      hostVerifier: (key) => {
+        result = compareHostKey(Buffer.isBuffer(key) ? key : Buffer.from(String(key), "base64"), knownKeys);
+        return false;
+      },
+    });
+  });
+}
+
+async function probeTarget(target, chain, verifyHostKeys) {
+  let socket = null;
+  try {
+    const opened = await openTargetStream(target, chain);
+    socket = opened.socket;
+    const bannerStart = performance.now();
+    const banner = await readBanner(socket);
+    // Through proxies and chains the TCP handshake happens remotely, so the
+    // banner round trip is the meaningful latency
+    const rttMs = chain || target.proxy ? performance.now() - bannerStart : opened.connectMs;
+    socket.destroy();
+    socket = null;
+    const keyCheck = verifyHostKeys ? await checkHostKey(target, chain).catch(() => KEY_NOT_CHECKED) : KEY_NOT_CHECKED;
+    return { status: STATUS_UP, rttMs, banner, keyCheck };
+  } catch (err) {
+    return { status: STATUS_DOWN, error: err.message || String(err) };
+  } finally {
+    if (socket) socket.destroy();
+  }
+}
+
+const chainKeyFor = (target) => JSON.stringify([
+  target.proxy ? [target.proxy.type, target.proxy.host, target.proxy.port, target.proxy.wan || null] : null,
+  target.jumpHosts.map((j) => [j.hostname, j.port || 22, j.username || "root"]),
+]);
+
+/**
+ * Start scanning `targets`. Any previous scan is cancelled.
+ * Target: { hostId, hostname, port, proxy?, jumpHosts?, knownKeys? }
+ */
+async function startScan(event, payload) {
+  const targets = Array.isArray(payload?.targets) ? payload.targets.filter((t) => t?.hostId && t.hostname) : [];
+  const concurrency = Math.max(1, Math.min(MAX_CONCURRENCY, payload?.concurrency || DEFAULT_CONCURRENCY));
+  const verifyHostKeys = !!payload?.verifyHostKeys;
+  const sender = event.sender;
+
+  if (activeScan) activeScan.cancelled = true;
+  const scan = { cancelled: false, pending: [], flushTimer: null, chains: new Map() };
+  activeScan = scan;
+  loadResults();
+
+  const flush = () => {
+    scan.flushTimer = null;
+    if (scan.pending.length === 0 || sender.isDestroyed()) return;
+    sender.send("netcatty:reachability:update", { results: scan.pending.splice(0) });
+  };
+  const publish = (result) => {
+    scan.pending.push(result);
+    if (!scan.flushTimer) scan.flushTimer = setTimeout(flush, UPDATE_THROTTLE_MS);
+  };
+
+  // One chain connection per distinct chain, shared by every host behind it
+  const getChain = (target) => {
+    const key = chainKeyFor(target);
+    let chain = scan.chains.get(key);
+    if (!chain) {
+      chain = openChain(target.jumpHosts, target.proxy);
+      chain.catch(() => { });
+      scan.chains.set(key, chain);
+    }
+    return chain;
+  };
+
+  const run = async () => {
+    let next = 0;
+    const worker = async () => {
+      while (!scan.cancelled && next < targets.length) {
+        const target = targets[next++];
+        const hasChain = Array.isArray(target.jumpHosts) && target.jumpHosts.length > 0;
+        let probe;
+        if (hasChain) {
+          try {
+            probe = await probeTarget(target, await getChain(target), verifyHostKeys);
+          } catch (err) {
+            probe = { status: STATUS_DOWN, error: `Jump host: ${err.message || err}` };
+          }
+        } else {
+          probe = await probeTarget(target, null, verifyHostKeys);
+        }
+        if (!scan.cancelled) publish(recordResult(target.hostId, probe));
+      }
+    };
+    const workers = [];
+    for (let i = 0; i < Math.min(concurrency, targets.length); i++) workers.push(worker());
+    await Promise.all(workers);
+
+    if (scan.flushTimer) clearTimeout(scan.flushTimer);
+    flush();
+    for (const chain of scan.chains.values()) {
+      chain.then(({ connections }) => {
+        for (const conn of connections) {
+          try { conn.end(); } catch { }
+        }
+      }, () => { });
+    }
+    if (!sender.isDestroyed()) {
+      sender.send("netcatty:reachability:done", { cancelled: scan.cancelled });
+    }
+    if (activeScan === scan) activeScan = null;
+  };
+
+  console.log(`[Reachability] Scanning ${targets.length} host(s), concurrency ${concurrency}`);
+  void run();
+  return { total: targets.length };
+}
+
+async function cancelScan() {
+  if (activeScan) activeScan.cancelled = true;
+  return { success: true };
+}
+
+async function getResults() {
+  const map = loadResults();
+  return Array.from(map, ([hostId, row]) => toResult(hostId, row));
+}
+
+/**
+ * Register IPC handlers for reachability scanning
+ */
+function registerHandlers(ipcMain) {
+  ipcMain.handle("netcatty:reachability:scan", startScan);
+  ipcMain.handle("netcatty:reachability:cancel", cancelScan);
+  ipcMain.handle("netcatty:reachability:results", getResults);
+}
+
+module.exports = {
+  init,
+  registerHandlers,
+  startScan,
+  cancelScan,
+  getResults,
+};
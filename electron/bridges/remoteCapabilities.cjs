@@ -0,0 +1,277 @@
+/**
+ * Remote Capabilities - Per-host cache of what a remote server supports
+ *
+ * Terminal, SFTP and compressed upload paths all need to know things about
+ * the remote host (OS/distro, login shell, available tools, sftp-server path,
+ * SFTP extensions). Instead of each path running its own probes on every
+ * connect, one combined probe runs over an already open connection and the
+ * result is persisted per host key fingerprint with a TTL.
+ */
+
+const fs = require("node:fs");
+const path = require("node:path");
+
+const CAPABILITIES_FILE = "remote-capabilities.json";
+const CAPABILITIES_VERSION = 1;
+const CAPABILITIES_TTL_MS = 7 * 24 * 60 * 60 * 1000;
+const MAX_ENTRIES = 500;
+const PROBE_TIMEOUT_MS = 8000;
+const SAVE_DEBOUNCE_MS = 1000;
+
+const PROBED_TOOLS = ["tar", "zstd", "rsync", "sha256sum"];
+
+// Known sftp-server locations, used for sudo SFTP
+const SFTP_SERVER_PATHS = [
+  "/usr/lib/openssh/sftp-server",
+  "/usr/libexec/openssh/sftp-server",
+  "/usr/lib/ssh/sftp-server",
+  "/usr/libexec/sftp-server",
+  "/usr/local/libexec/sftp-server",
+  "/usr/local/lib/sftp-server",
+];
+
+let electronModule = null;
+// key -> { probedAt, os, arch, distro, distroVersion, shell, tools, sftpServerPath, sftp }
+let entries = null;
+let saveTimer = null;
+const inflightProbes = new Map();
+
+function init(deps) {
+  electronModule = deps.electronModule;
+}
+
+function getCacheFilePath() {
+  try {
+    const app = electronModule?.app;
+    return app ? path.join(app.getPath("userData"), CAPABILITIES_FILE) : null;
+  } catch {
+    return null;
+  }
+}
+
+function loadEntries() {
+  if (entries) return entries;
+  entries = new Map();
+  const filePath = getCacheFilePath();
+  if (!filePath) return entries;
+  try {
+    const data = JSON.parse(fs.readFileSync(filePath, "utf8"));
+    if (data?.version === CAPABILITIES_VERSION && data.entries && typeof data.entries === "object") {
+      for (const [key, value] of Object.entries(data.entries)) {
+        if (value && typeof value.probedAt === "number") entries.set(key, value);
+      }
+    }
+  } catch (err) {
+    if (err.code !== "ENOENT") {
+      console.warn("[Capabilities] Failed to read cache:", err.message);
+    }
+  }
+  return entries;
+}
+
+function scheduleSave() {
+  if (saveTimer) return;
+  saveTimer = setTimeout(() => {
+    saveTimer = null;
+    const filePath = getCacheFilePath();
+    if (!filePath || !entries) return;
+    const data = { version: CAPABILITIES_VERSION, entries: Object.fromEntries(entries) };
+    fs.promises.writeFile(filePath, JSON.stringify(data), "utf8").catch((err) => {
+      console.warn("[Capabilities] Failed to write cache:", err.message);
+    });
+  }, SAVE_DEBOUNCE_MS);
+}
+
+/**
+ * Make ssh2 report the server host key fingerprint (sha256, hex) without
+ * changing host key acceptance.
+ */
+function captureHostFingerprint(connectOpts, onFingerprint) {
+  connectOpts.hostHash = "sha256";
+  connectOpts.hostVerifier = (hashedKey) => {
+    if (typeof hashedKey === "string" && hashedKey) onFingerprint(hashedKey);
+    return true;
+  };
+}
+
+/**
+ * Cache key for a connection. Shell and PATH are per login user, so the user
+ * is part of the key; falls back to the address when no fingerprint is known.
+ */
+function makeCapabilityKey(fingerprint, username, hostname, port) {
+  const user = username || "root";
+  if (fingerprint) return `fp:${fingerprint}|${user}`;
+  return `addr:${user}@${hostname}:${port || 22}`;
+}
+
+function isFresh(entry) {
+  return !!entry && Date.now() - entry.probedAt < CAPABILITIES_TTL_MS;
+}
+
+function getCachedCapabilities(key) {
+  if (!key) return null;
+  const entry = loadEntries().get(key);
+  return isFresh(entry) ? entry : null;
+}
+
+function storeCapabilities(key, patch) {
+  const map = loadEntries();
+  const next = { ...(map.get(key) || {}), ...patch };
+  // Re-insert so Map order tracks recency for eviction
+  map.delete(key);
+  map.set(key, next);
+  while (map.size > MAX_ENTRIES) {
+    map.delete(map.keys().next().value);
+  }
+  scheduleSave();
+  return next;
+}
+
+// Runs under `sh -c` so the login shell (fish, csh, ...) does not matter.
+// Must not contain single quotes.
+const PROBE_SCRIPT = [
+  `echo "os=$(uname -s 2>/dev/null)"`,
+  `echo "arch=$(uname -m 2>/dev/null)"`,
+  `if [ -r /etc/os-release ]; then (. /etc/os-release 2>/dev/null; echo "distro=$ID"; echo "distroVersion=$VERSION_ID"); fi`,
+  `echo "shell=$SHELL"`,
+  `for t in ${PROBED_TOOLS.join(" ")}; do command -v "$t" >/dev/null 2>&1 && echo "tool=$t"; done`,
+  `for p in ${SFTP_SERVER_PATHS.join(" ")}; do if [ -x "$p" ]; then echo "sftpServer=$p"; break; fi; done`,
+  `echo "end=1"`,
+].join("; ");
+
+function parseProbeOutput(output) {
+  const result = {
+    os: null,
+    arch: null,
+    distro: null,
+    distroVersion: null,
+    shell: null,
+    tools: {},
+    sftpServerPath: null,
+  };
+  for (const tool of PROBED_TOOLS) result.tools[tool] = false;
+  let complete = false;
+  for (const rawLine of output.split(/\r?\n/)) {
+    const eq = rawLine.indexOf("=");
+    if (eq <= 0) continue;
+    const name = rawLine.slice(0, eq).trim();
+    const value = rawLine.slice(eq + 1).trim().replace(/^"|"$/g, "");
+    switch (name) {
+      case "os": result.os = value || null; break;
+      case "arch": result.arch = value || null; break;
+      case "distro": result.distro = value ? value.toLowerCase() : null; break;
+      case "distroVersion": result.distroVersion = value || null; break;
+      case "shell": result.shell = value || null; break;
+      case "tool": if (value in result.tools) result.tools[value] = true; break;
+      case "sftpServer": result.sftpServerPath = value || null; break;
+      case "end": complete = true; break;
+      default: break;
+    }
+  }
+  // Non-Linux systems have no os-release; `uname -s` is the best identifier
+  if (!result.distro && result.os) result.distro = result.os.toLowerCase();
+  return complete ? result : null;
+}
+
+/**
+ * Run the combined capability probe as a single exec channel on an existing
+ * ssh2 client connection.
+ */
+function probeRemoteCapabilities(conn) {
+  return new Promise((resolve, reject) => {
+    let settled = false;
+    const finish = (err, value) => {
+      if (settled) return;
+      settled = true;
+      clearTimeout(timer);
+      if (err) reject(err);
+      else resolve(value);
+    };
+    const timer = setTimeout(() => finish(new Error("Capability probe timed out")), PROBE_TIMEOUT_MS);
+
+    conn.exec(`sh -c '${PROBE_SCRIPT}'`, (err, stream) => {
+      if (err) return finish(err);
+      let output = "";
+      stream.on("data", (data) => { output += data.toString(); });
+      stream.stderr?.on("data", () => { /* probe noise is irrelevant */ });
+      stream.on("close", () => {
+        const parsed = parseProbeOutput(output);
+        if (parsed) finish(null, parsed);
+        else finish(new Error("Capability probe produced no result"));
+      });
+      stream.on("error", (e) => finish(e));
+    });
+  });
+}
+
+/**
+ * Return cached capabilities for `key`, probing over `conn` when missing or
+ * expired. Concurrent callers for the same key share one probe.
+ */
+async function ensureCapabilities(conn, key, { force = false } = {}) {
+  if (!key) return null;
+  if (!force) {
+    const cached = getCachedCapabilities(key);
+    if (cached) return cached;
+  }
+  const inflight = inflightProbes.get(key);
+  if (inflight) return inflight;
+
+  const probe = probeRemoteCapabilities(conn)
+    .then((result) => {
+      console.log(`[Capabilities] Probed ${key}: ${result.distro || "unknown"}, sftp-server=${result.sftpServerPath || "none"}`);
+      return storeCapabilities(key, { ...result, probedAt: Date.now() });
+    })
+    .catch((err) => {
+      console.warn(`[Capabilities] Probe failed for ${key}:`, err.message);
+      return getCachedCapabilities(key);
+    })
+    .finally(() => {
+      inflightProbes.delete(key);
+    });
+  inflightProbes.set(key, probe);
+  return probe;
+}
+
+/**
+ * Record the SFTP protocol details negotiated on an open session.
+ */
+function recordSftpInfo(key, sftp) {
+  if (!key || !sftp) return;
+  const extensions = sftp._extensions && typeof sftp._extensions === "object"
+    ? { ...sftp._extensions }
+    : {};
+  // ssh2 negotiates limits@openssh.com during SFTP init and keeps the result
+  // on the SFTP instance
+  const limits = {};
+  for (const [field, name] of [
+    ["_maxOutPktLen", "maxPacketLength"],
+    ["_maxReadLen", "maxReadLength"],
+    ["_maxWriteLen", "maxWriteLength"],
+    ["maxOpenHandles", "maxOpenHandles"],
+  ]) {
+    const value = sftp[field];
+    if (typeof value === "number" && value > 0 && Number.isFinite(value)) limits[name] = value;
+  }
+  const existing = loadEntries().get(key);
+  storeCapabilities(key, {
+    probedAt: existing?.probedAt || 0,
+    sftp: { extensions, limits },
+  });
+}
+
+function invalidateCapabilities(key) {
+  if (!key) return;
+  if (loadEntries().delete(key)) scheduleSave();
+}
+
+module.exports = {
+  init,
+  SFTP_SERVER_PATHS,
+  captureHostFingerprint,
+  makeCapabilityKey,
+  getCachedCapabilities,
+  ensureCapabilities,
+  recordSftpInfo,
+  invalidateCapabilities,
+};
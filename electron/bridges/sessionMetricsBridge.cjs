@@ -0,0 +1,180 @@
+/**
+ * Session Metrics Bridge - Per-session traffic and latency accounting
+ *
+ * Every terminal session (SSH, Telnet, Mosh, local, serial, tmux pane) gets
+ * a small `metrics` record on its entry in the shared sessions map. The
+ * bridges count bytes where data enters and leaves the session; recording is
+ * two additions and, for keystroke-sized writes, a timestamp.
+ *
+ * Latency is the keystroke-to-echo round trip: the time from a short write
+ * (a typed key) to the next output from the session. Samples are smoothed
+ * like TCP's SRTT, and a write that gets no response within ECHO_MAX_MS
+ * (password prompts, silent vim commands) is dropped rather than counted.
+ *
+ * Once a second the bridge sends each window the current totals, rates and
+ * RTT of its sessions. Nothing is sent while all of them are idle.
+ */
+
+const { performance } = require("node:perf_hooks");
+
+const TICK_MS = 1000;
+// Writes up to this size count as keystrokes for the echo RTT
+const KEYSTROKE_MAX_BYTES = 8;
+const ECHO_MAX_MS = 1500;
+// SRTT gain (RFC 6298 uses 1/8)
+const RTT_GAIN = 1 / 8;
+
+let sessions = null;
+let electronModule = null;
+let tickTimer = null;
+// webContentsId -> signature of the last update sent, to skip idle ticks
+const lastSent = new Map();
+
+function init(deps) {
+  sessions = deps.sessions;
+  electronModule = deps.electronModule;
+}
+
+/**
+ * Start accounting for a session; call right after sessions.set()
+ */
+function track(session) {
+  session.metrics = {
+    startedAt: Date.now(),
+    bytesIn: 0,
+    bytesOut: 0,
+    rateIn: 0,
+    rateOut: 0,
+    lastIn: 0,
+    lastOut: 0,
+    lastTickAt: performance.now(),
+    echoPendingSince: 0,
+    srttMs: null,
+    rttSamples: 0,
+  };
+  if (!tickTimer) tickTimer = setInterval(tick, TICK_MS);
+  return session.metrics;
+}
+
+const byteLength = (data) => (typeof data === "string" ? Buffer.byteLength(data) : data?.length || 0);
+
+/**
+ * Data received from the remote side (string or Buffer)
+ */
+function recordIn(session, data) {
+  const metrics = session?.metrics;
+  if (!metrics) return;
+  metrics.bytesIn += byteLength(data);
+  if (metrics.echoPendingSince) {
+    const sample = performance.now() - metrics.echoPendingSince;
+    metrics.echoPendingSince = 0;
+    if (sample <= ECHO_MAX_MS) {
+      metrics.srttMs = metrics.srttMs === null
+        ? sample
+        : metrics.srttMs + RTT_GAIN * (sample - metrics.srttMs);
+      metrics.rttSamples++;
+    }
+  }
+}
+
+/**
+ * Data written to the remote side (string or Buffer)
+ */
+function recordOut(session, data) {
+  const metrics = session?.metrics;
+  if (!metrics) return;
+  const bytes = byteLength(data);
+  metrics.bytesOut += bytes;
+  if (bytes <= KEYSTROKE_MAX_BYTES && !metrics.echoPendingSince) {
+    metrics.echoPendingSince = performance.now();
+  }
+}
+
+function describe(sessionId, metrics) {
+  return {
+    sessionId,
+    bytesIn: metrics.bytesIn,
+    bytesOut: metrics.bytesOut,
+    rateIn: metrics.rateIn,
+    rateOut: metrics.rateOut,
+    rttMs: metrics.srttMs === null ? null : Math.round(metrics.srttMs),
+    startedAt: metrics.startedAt,
+  };
+}
+
+function tick() {
+  const now = performance.now();
+  const byWindow = new Map();
+  for (const [sessionId, session] of sessions) {
+    const metrics = session.metrics;
+    if (!metrics) continue;
+    const elapsed = Math.max(1, now - metrics.lastTickAt);
+    metrics.rateIn = Math.round(((metrics.bytesIn - metrics.lastIn) * 1000) / elapsed);
+    metrics.rateOut = Math.round(((metrics.bytesOut - metrics.lastOut) * 1000) / elapsed);
+    metrics.lastIn = metrics.bytesIn;
+    metrics.lastOut = metrics.bytesOut;
+    metrics.lastTickAt = now;
+    if (metrics.echoPendingSince && now - metrics.echoPendingSince > ECHO_MAX_MS) {
+      metrics.echoPendingSince = 0;
+    }
+    const list = byWindow.get(session.webContentsId) || [];
+    list.push(describe(sessionId, metrics));
+    byWindow.set(session.webContentsId, list);
+  }
+
+  for (const [webContentsId, list] of byWindow) {
+    const signature = list
+      .map((m) => `${m.sessionId}:${m.bytesIn}:${m.bytesOut}:${m.rateIn}:${m.rateOut}:${m.rttMs}`)
+      .join("|");
+    if (lastSent.get(webContentsId) === signature) continue;
+    lastSent.set(webContentsId, signature);
+    send(webContentsId, list);
+  }
+  // Windows whose last session went away get one final, empty update
+  for (const webContentsId of [...lastSent.keys()]) {
+    if (byWindow.has(webContentsId)) continue;
+    lastSent.delete(webContentsId);
+    send(webContentsId, []);
+  }
+
+  if (byWindow.size === 0 && tickTimer) {
+    clearInterval(tickTimer);
+    tickTimer = null;
+  }
+}
+
+function send(webContentsId, list) {
+  try {
+    const contents = electronModule?.webContents?.fromId(webContentsId);
+    if (!contents || contents.isDestroyed()) return;
+    contents.send("netcatty:session:metrics", { metrics: list });
+  } catch {
+    // Ignore destroyed webContents during shutdown.
+  }
+}
+
+/**
+ * Current metrics of the calling window's sessions
+ */
+function getMetrics(event) {
+  const list = [];
+  for (const [sessionId, session] of sessions) {
+    if (session.metrics && session.webContentsId === event.sender.id) {
+      list.push(describe(sessionId, session.metrics));
+    }
+  }
+  return list;
+}
+
+function registerHandlers(ipcMain) {
+  ipcMain.handle("netcatty:session:metrics:get", getMetrics);
+}
+
+module.exports = {
+  init,
+  registerHandlers,
+  track,
+  recordIn,
+  recordOut,
+  getMetrics,
+};
@@ -23,6 +23,11 @@ const { NetcattyAgent } = require("./netcattyAgent.cjs");
 const fileWatcherBridge = require("./fileWatcherBridge.cjs");
 const keyboardInteractiveHandler = require("./keyboardInteractiveHandler.cjs");
 const { createProxySocket } = require("./proxyUtils.cjs");
+const remoteCapabilities = require("./remoteCapabilities.cjs");
+const { pipelinedUploadBuffer } = require("./sftpPipeline.cjs");
+const ipcBatchBridge = require("./ipcBatchBridge.cjs");
+const transportProfile = require("./sshTransportProfile.cjs");
+const { dialInto } = require("./netDialer.cjs");
 const { 
   buildAuthHandler, 
   createKeyboardInteractiveHandler, 
@@ -40,6 +45,12 @@ const jumpConnectionsMap = new Map(); // connId -> { connections: SSHClient[], s
 // Storage for active SFTP uploads that can be cancelled
 const activeSftpUploads = new Map(); // transferId -> { cancelled: boolean, stream: Readable }
 
+// Identity of the host behind each SFTP session, used to key per-host caches
+const sftpSessionHosts = new Map(); // sftpId -> "user@host:port"
+const sftpCapabilityKeys = new Map(); // sftpId -> remote capability cache key
+// Sessions whose host opted into temp-file-then-rename uploads
+const sftpAtomicUploads = new Set(); // sftpId
+
 // Track requested/resolved filename encoding per SFTP session
 const sftpEncodingState = new Map(); // sftpId -> { requested: 'auto'|'utf-8'|'gb18030', resolved: 'utf-8'|'gb18030' }
 const utf8Decoder = new TextDecoder("utf-8", { fatal: true });
@@ -349,6 +360,8 @@ async function connectThroughChainForSftp(event, options, jumpHosts, targetHost,
         connOpts.sock = currentSocket;
         delete connOpts.host;
         delete connOpts.port;
+      } else {
+        await dialInto(connOpts);
       }
 
       // Connect this hop
@@ -425,49 +438,22 @@ async function connectThroughChainForSftp(event, options, jumpHosts, targetHost,
  * @param {SSHClient} client - Connected SSH client
  * @param {string} password - User password for sudo
  */
-async function connectSudoSftp(client, password) {
+async function connectSudoSftp(client, password, capabilityKey) {
   if (!SFTPWrapper) {
     throw new Error("SFTP sudo mode is not available on this platform. Please disable sudo mode in host settings.");
   }
 
-  // Known sftp-server paths to try
-  const sftpPaths = [
-    "/usr/lib/openssh/sftp-server",
-    "/usr/libexec/openssh/sftp-server",
-    "/usr/lib/ssh/sftp-server",
-    "/usr/libexec/sftp-server",
-    "/usr/local/libexec/sftp-server",
-    "/usr/local/lib/sftp-server"
-  ];
-
-  console.log("[SFTP] Probing sftp-server path for sudo mode...");
-
-  let serverPath = null;
-  // Try to find the path
-  for (const p of sftpPaths) {
-    try {
-      await new Promise((resolve, reject) => {
-        client.exec(`test -x ${p}`, (err, stream) => {
-          if (err) return reject(err);
-          stream.on('exit', (code) => {
-            if (code === 0) resolve();
-            else reject(new Error('Not found'));
-          });
-        });
-      });
-      serverPath = p;
-      break;
-    } catch (e) {
-      // Continue probing
-    }
-  }
+  // The capability probe checks all known sftp-server paths in one exec and
+  // is cached per host, so reconnects skip probing entirely
+  const capabilities = await remoteCapabilities.ensureCapabilities(client, capabilityKey);
+  let serverPath = capabilities?.sftpServerPath || null;
 
   if (!serverPath) {
     // Fallback: try to find it in path or assume standard location
     console.warn("[SFTP] Could not probe sftp-server, trying default /usr/lib/openssh/sftp-server");
-    serverPath = "/usr/lib/openssh/sftp-server";
+    serverPath = remoteCapabilities.SFTP_SERVER_PATHS[0];
   } else {
-    console.log(`[SFTP] Found sftp-server at ${serverPath}`);
+    console.log(`[SFTP] Using sftp-server at ${serverPath}`);
   }
 
   return new Promise((resolve, reject) => {
@@ -692,6 +678,18 @@ async function openSftp(event, options) {
     tryKeyboard: true,
     readyTimeout: 120000, // 2 minutes for 2FA input
   };
+  transportProfile.applyTransportProfile(connectOpts, options.transportProfile);
+
+  let hostFingerprint = null;
+  remoteCapabilities.captureHostFingerprint(connectOpts, (fp) => {
+    hostFingerprint = fp;
+  });
+  const getCapabilityKey = () => remoteCapabilities.makeCapabilityKey(
+    hostFingerprint,
+    connectOpts.username,
+    options.hostname,
+    options.port,
+  );
 
   // Use the tunneled socket if we have one
   if (connectionSocket) {
@@ -699,6 +697,9 @@ async function openSftp(event, options) {
     // When using sock, we should not set host/port as the connection is already established
     delete connectOpts.host;
     delete connectOpts.port;
+  } else {
+    // Direct: cached DNS + Happy Eyeballs instead of ssh2's single lookup
+    await dialInto(connectOpts);
   }
 
   const hasCertificate = typeof options.certificate === "string" && options.certificate.trim().length > 0;
@@ -764,7 +765,7 @@ async function openSftp(event, options) {
           try {
             // Use provided password or try empty if using key auth (and hope for nopasswd sudo)
             const sudoPass = options.password || "";
-            const sftpWrapper = await connectSudoSftp(sshClient, sudoPass);
+            const sftpWrapper = await connectSudoSftp(sshClient, sudoPass, getCapabilityKey());
 
             // Inject into sftp-client
             client.sftp = sftpWrapper;
@@ -796,6 +797,19 @@ async function openSftp(event, options) {
     }
 
     sftpClients.set(connId, client);
+    // Downloads are bounded by our receive window; grow it if the host was tuned for that
+    transportProfile.enlargeChannelWindow(
+      client.sftp,
+      transportProfile.normalizeProfile(options.transportProfile)?.windowSize,
+    );
+    const capabilityKey = getCapabilityKey();
+    sftpCapabilityKeys.set(connId, capabilityKey);
+    if (options.atomicUpload) sftpAtomicUploads.add(connId);
+    remoteCapabilities.recordSftpInfo(capabilityKey, client.sftp);
+    sftpSessionHosts.set(
+      connId,
+      `${connectOpts.username}@${options.hostname}:${options.port || 22}`,
+    );
 
     // Store jump connections for cleanup when SFTP is closed
     if (chainConnections.length > 0) {
@@ -1031,71 +1045,57 @@ async function writeSftpBinaryWithProgress(event, payload) {
   const PROGRESS_THROTTLE_BYTES = 1024 * 1024; // 1MB
   let lastProgressSentBytes = 0;
 
-  const { Readable } = require("stream");
-  const readableStream = new Readable({
-    read() {
-      // Check for cancellation
-      const uploadState = activeSftpUploads.get(transferId);
-      if (uploadState?.cancelled) {
-        this.destroy(new Error("Upload cancelled"));
-        return;
-      }
-
-      // Use larger chunk size for better performance (256KB instead of 64KB)
-      const chunkSize = 262144;
-      if (transferredBytes < totalBytes) {
-        const end = Math.min(transferredBytes + chunkSize, totalBytes);
-        // Use subarray instead of slice to avoid copying
-        const chunk = buffer.subarray(transferredBytes, end);
-        transferredBytes = end;
-
-        const now = Date.now();
-        const elapsed = (now - lastProgressTime) / 1000;
-        let speed = 0;
-        if (elapsed >= 0.1) {
-          speed = (transferredBytes - lastTransferredBytes) / elapsed;
-          lastProgressTime = now;
-          lastTransferredBytes = transferredBytes;
-        }
+  const reportProgress = (transferred) => {
+    transferredBytes = transferred;
+    const now = Date.now();
+    const elapsed = (now - lastProgressTime) / 1000;
+    let speed = 0;
+    if (elapsed >= 0.1) {
+      speed = (transferredBytes - lastTransferredBytes) / elapsed;
+      lastProgressTime = now;
+      lastTransferredBytes = transferredBytes;
+    }
 
-        // Throttle IPC progress events: only send if enough time or bytes have passed
-        const timeSinceLastProgress = now - lastProgressSentTime;
-        const bytesSinceLastProgress = transferredBytes - lastProgressSentBytes;
-        const isComplete = transferredBytes >= totalBytes;
+    // Throttle IPC progress events: only send if enough time or bytes have passed
+    const timeSinceLastProgress = now - lastProgressSentTime;
+    const bytesSinceLastProgress = transferredBytes - lastProgressSentBytes;
+    const isComplete = transferredBytes >= totalBytes;
 
-        if (isComplete || timeSinceLastProgress >= PROGRESS_THROTTLE_MS || bytesSinceLastProgress >= PROGRESS_THROTTLE_BYTES) {
-          // Call the progress callback if provided, otherwise send IPC event
-          if (typeof onProgress === 'function') {
-            try {
-              onProgress(transferredBytes, totalBytes, speed);
-            } catch (err) {
-              console.warn('[SFTP] Progress callback error:', err);
-            }
-          } else {
-            const contents = electronModule.webContents.fromId(event.sender.id);
-            contents?.send("netcatty:upload:progress", {
-              transferId,
-              transferred: transferredBytes,
-              totalBytes,
-              speed,
-            });
-          }
-          lastProgressSentTime = now;
-          lastProgressSentBytes = transferredBytes;
+    if (isComplete || timeSinceLastProgress >= PROGRESS_THROTTLE_MS || bytesSinceLastProgress >= PROGRESS_THROTTLE_BYTES) {
+      // Call the progress callback if provided, otherwise send IPC event
+      if (typeof onProgress === 'function') {
+        try {
+          onProgress(transferredBytes, totalBytes, speed);
+        } catch (err) {
+          console.warn('[SFTP] Progress callback error:', err);
         }
-
-        this.push(chunk);
       } else {
-        this.push(null);
+        const contents = electronModule.webContents.fromId(event.sender.id);
+        contents?.send("netcatty:upload:progress", {
+          transferId,
+          transferred: transferredBytes,
+          totalBytes,
+          speed,
+        });
       }
+      lastProgressSentTime = now;
+      lastProgressSentBytes = transferredBytes;
     }
-  });
+  };
 
   // Register this upload for potential cancellation
-  activeSftpUploads.set(transferId, { cancelled: false, stream: readableStream });
+  const uploadState = { cancelled: false, stream: null };
+  activeSftpUploads.set(transferId, uploadState);
 
   try {
-    await client.put(readableStream, encodedPath);
+    const sftp = getSftpChannel(client);
+    if (!sftp) throw new Error("SFTP client not ready");
+    // Pipelined writes sized to the server's advertised limits
+    await pipelinedUploadBuffer(sftp, buffer, encodedPath, {
+      atomic: usesAtomicUpload(sftpId),
+      isCancelled: () => uploadState.cancelled,
+      onProgress: reportProgress,
+    });
 
     // Call the complete callback if provided, otherwise send IPC event
     if (typeof onComplete === 'function') {
@@ -1112,9 +1112,8 @@ async function writeSftpBinaryWithProgress(event, payload) {
     return { success: true, transferId };
   } catch (err) {
     // Check if this upload was cancelled - the error might not be exactly "Upload cancelled"
-    // when stream is destroyed, SFTP server may return different errors like "Write stream error"
-    const uploadState = activeSftpUploads.get(transferId);
-    if (uploadState?.cancelled || err.message === "Upload cancelled") {
+    // when the upload is aborted mid-request, SFTP server may return different errors
+    if (uploadState.cancelled || err.message === "Upload cancelled" || err.message === "Transfer cancelled") {
       const contents = electronModule.webContents.fromId(event.sender.id);
       contents?.send("netcatty:upload:cancelled", { transferId });
       return { success: false, transferId, cancelled: true };
@@ -1183,6 +1182,9 @@ async function closeSftp(event, payload) {
   }
   sftpClients.delete(payload.sftpId);
   sftpEncodingState.delete(payload.sftpId);
+  sftpSessionHosts.delete(payload.sftpId);
+  sftpCapabilityKeys.delete(payload.sftpId);
+  sftpAtomicUploads.delete(payload.sftpId);
 
   // Clean up jump connections if any
   const jumpData = jumpConnectionsMap.get(payload.sftpId);
@@ -1351,6 +1353,13 @@ function registerHandlers(ipcMain) {
   ipcMain.handle("netcatty:sftp:rename", renameSftp);
   ipcMain.handle("netcatty:sftp:stat", statSftp);
   ipcMain.handle("netcatty:sftp:chmod", chmodSftp);
+
+  // Per-item operations that multi-select flows fire in bursts
+  ipcBatchBridge.registerBatchable("netcatty:sftp:mkdir", mkdirSftp, { serial: true });
+  ipcBatchBridge.registerBatchable("netcatty:sftp:delete", deleteSftp);
+  ipcBatchBridge.registerBatchable("netcatty:sftp:rename", renameSftp);
+  ipcBatchBridge.registerBatchable("netcatty:sftp:stat", statSftp);
+  ipcBatchBridge.registerBatchable("netcatty:sftp:chmod", chmodSftp);
 }
 
 /**
@@ -1360,10 +1369,34 @@ function getSftpClients() {
   return sftpClients;
 }
 
+/**
+ * Get the "user@host:port" identity of an SFTP session
+ */
+function getSessionHostKey(sftpId) {
+  return sftpSessionHosts.get(sftpId) || null;
+}
+
+/**
+ * Get the remote capability cache key for an SFTP session
+ */
+function getSessionCapabilityKey(sftpId) {
+  return sftpCapabilityKeys.get(sftpId) || null;
+}
+
+/**
+ * Whether uploads for an SFTP session go to a temp file and are renamed into place
+ */
+function usesAtomicUpload(sftpId) {
+  return sftpAtomicUploads.has(sftpId);
+}
+
 module.exports = {
   init,
   registerHandlers,
   getSftpClients,
+  getSessionHostKey,
+  getSessionCapabilityKey,
+  usesAtomicUpload,
   encodePathForSession,
   ensureRemoteDirForSession,
   openSftp,
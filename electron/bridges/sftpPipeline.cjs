@@ -0,0 +1,303 @@
+/**
+ * SFTP Pipeline - Pipelined SFTP reads/writes sized to the server's limits
+ *
+ * Stream based transfers issue one 32-64 KB request at a time, so throughput
+ * is bounded by round trips. Here each transfer keeps several requests in
+ * flight, each as large as the server accepts. ssh2 negotiates
+ * `limits@openssh.com` during SFTP init (OpenSSH 8.6+) and stores the result
+ * on the SFTP instance; servers without it get conservative defaults.
+ *
+ * Optional OpenSSH extensions are used where advertised:
+ * - statvfs@openssh.com: free-space precheck before uploads
+ * - fsync@openssh.com: flush uploaded files before reporting success
+ * - posix-rename@openssh.com: when the host opts in, upload to a temp name and
+ *   then replace the target atomically. Off by default: it needs a writable
+ *   directory and gives the file a new inode (owner, hard links, ACLs and
+ *   xattrs do not carry over), so it falls back to an in-place write when the
+ *   temp file cannot be created or renamed.
+ */
+
+const fs = require("node:fs");
+const path = require("node:path");
+
+// Per request payload when the server does not advertise limits (fits in
+// the 34000 byte packets every SFTP server must accept)
+const DEFAULT_CHUNK_BYTES = 32 * 1024;
+const MAX_CHUNK_BYTES = 255 * 1024;
+// Bytes kept in flight per transfer, bounded by a request count
+const TARGET_INFLIGHT_BYTES = 8 * 1024 * 1024;
+const MIN_REQUESTS = 4;
+const MAX_REQUESTS = 64;
+
+const PARTIAL_SUFFIX = ".netcatty-part";
+
+/**
+ * Read and write request sizes plus outstanding request counts for a session
+ */
+function getTransferProfile(sftp) {
+  const ext = sftp?._extensions || {};
+  const readLen = sanitizeLength(sftp?._maxReadLen);
+  const writeLen = sanitizeLength(sftp?._maxWriteLen);
+  return {
+    readChunk: readLen,
+    writeChunk: writeLen,
+    readRequests: requestsFor(readLen),
+    writeRequests: requestsFor(writeLen),
+    hasFsync: ext["fsync@openssh.com"] === "1",
+    hasStatvfs: ext["statvfs@openssh.com"] === "2",
+    hasPosixRename: ext["posix-rename@openssh.com"] === "1",
+  };
+}
+
+/**
+ * `fastGet`/`fastPut` options matching the session's transfer profile
+ */
+function getFastTransferOptions(sftp, direction = "download") {
+  const profile = getTransferProfile(sftp);
+  return direction === "upload"
+    ? { chunkSize: profile.writeChunk, concurrency: profile.writeRequests }
+    : { chunkSize: profile.readChunk, concurrency: profile.readRequests };
+}
+
+function sanitizeLength(value) {
+  if (typeof value !== "number" || !Number.isFinite(value) || value <= 0) {
+    return DEFAULT_CHUNK_BYTES;
+  }
+  return Math.min(Math.floor(value), MAX_CHUNK_BYTES);
+}
+
+function requestsFor(chunk) {
+  return Math.max(MIN_REQUESTS, Math.min(MAX_REQUESTS, Math.ceil(TARGET_INFLIGHT_BYTES / chunk)));
+}
+
+const call = (fn) => new Promise((resolve, reject) => {
+  fn((err, ...results) => (err ? reject(err) : resolve(results)));
+});
+
+const cancelledError = () => new Error("Transfer cancelled");
+
+/**
+ * Run `count` sequential chunk jobs with at most `limit` in flight
+ */
+async function runPipeline(count, limit, job, isCancelled) {
+  let next = 0;
+  let failed = null;
+  const worker = async () => {
+    while (!failed && next < count) {
+      if (isCancelled()) {
+        failed = cancelledError();
+        break;
+      }
+      const index = next++;
+      try {
+        await job(index);
+      } catch (err) {
+        failed = failed || err;
+      }
+    }
+  };
+  const workers = [];
+  for (let i = 0; i < Math.min(limit, count); i++) workers.push(worker());
+  await Promise.all(workers);
+  if (failed) throw failed;
+  if (isCancelled()) throw cancelledError();
+}
+
+/**
+ * Throw when statvfs says the remote filesystem cannot hold `bytes`
+ */
+async function assertRemoteFreeSpace(sftp, remoteDir, bytes, profile = getTransferProfile(sftp)) {
+  if (!profile.hasStatvfs || !bytes) return;
+  let info;
+  try {
+    [info] = await call((cb) => sftp.ext_openssh_statvfs(remoteDir, cb));
+  } catch {
+    return; // Precheck only; let the upload report real errors
+  }
+  const blockSize = Number(info?.frsize || info?.bsize || 0);
+  const available = Number(info?.bavail || 0) * blockSize;
+  if (blockSize > 0 && available < bytes) {
+    throw new Error(
+      `Not enough space on remote filesystem (${Math.floor(available / 1048576)} MB free, ${Math.ceil(bytes / 1048576)} MB needed)`,
+    );
+  }
+}
+
+/**
+ * Download `remotePath` to `localPath` with pipelined reads
+ * @param {object} options - { size, isCancelled, onProgress(transferred) }
+ */
+async function pipelinedDownload(sftp, remotePath, localPath, options = {}) {
+  const profile = getTransferProfile(sftp);
+  const isCancelled = options.isCancelled || (() => false);
+  const [handle] = await call((cb) => sftp.open(remotePath, "r", cb));
+  let file = null;
+  try {
+    let size = options.size;
+    if (typeof size !== "number" || size < 0) {
+      const [attrs] = await call((cb) => sftp.fstat(handle, cb));
+      size = attrs.size;
+    }
+    file = await fs.promises.open(localPath, "w");
+    const chunk = profile.readChunk;
+    let transferred = 0;
+
+    // Reads may come back short; keep reading the remainder of the chunk
+    const readChunk = async (index) => {
+      let position = index * chunk;
+      const end = Math.min(position + chunk, size);
+      while (position < end) {
+        const length = end - position;
+        const buffer = Buffer.allocUnsafe(length);
+        const [bytesRead] = await call((cb) => sftp.read(handle, buffer, 0, length, position, cb));
+        if (!bytesRead) throw new Error("Unexpected end of remote file");
+        await file.write(buffer, 0, bytesRead, position);
+        position += bytesRead;
+        transferred += bytesRead;
+        options.onProgress?.(transferred, size);
+      }
+    };
+
+    await runPipeline(Math.ceil(size / chunk), profile.readRequests, readChunk, isCancelled);
+    return { bytes: size, profile };
+  } finally {
+    if (file) await file.close().catch(() => {});
+    await call((cb) => sftp.close(handle, cb)).catch(() => {});
+  }
+}
+
+/**
+ * Upload with pipelined writes. `readAt(position, length)` supplies data, so
+ * local files and in-memory buffers share one path.
+ * @param {object} options - { size, readAt, isCancelled, onProgress(transferred), atomic }
+ */
+async function pipelinedUpload(sftp, remotePath, options) {
+  const profile = getTransferProfile(sftp);
+  const size = options.size;
+
+  // Encoded (Buffer) paths only go through the core requests
+  const isStringPath = typeof remotePath === "string";
+  if (isStringPath) {
+    await assertRemoteFreeSpace(sftp, path.posix.dirname(remotePath), size, profile);
+  }
+
+  // Keep the existing file's mode when replacing it; symlinks are written
+  // through in place so the link itself survives
+  let existingMode = null;
+  let targetIsLink = false;
+  try {
+    const [attrs] = await call((cb) => sftp.lstat(remotePath, cb));
+    targetIsLink = (attrs.mode & 0o170000) === 0o120000;
+    if (!targetIsLink) existingMode = attrs.mode & 0o7777;
+  } catch {
+    // Target does not exist
+  }
+
+  const atomic = options.atomic === true && profile.hasPosixRename && isStringPath && !targetIsLink;
+  if (atomic) {
+    const partialPath = `${remotePath}${PARTIAL_SUFFIX}`;
+    let handle = null;
+    try {
+      [handle] = await call((cb) => sftp.open(partialPath, "w", cb));
+    } catch (err) {
+      // Directory not writable (the file may still be): write in place
+      console.warn("[SFTP] Cannot create temp upload file, writing in place:", err?.message || err);
+    }
+    if (handle) {
+      await writeHandle(sftp, handle, partialPath, profile, existingMode, options, true);
+      try {
+        await call((cb) => sftp.ext_openssh_rename(partialPath, remotePath, cb));
+        return { bytes: size, profile };
+      } catch (err) {
+        await call((cb) => sftp.unlink(partialPath, cb)).catch(() => {});
+        console.warn("[SFTP] Atomic replace failed, writing in place:", err?.message || err);
+      }
+    }
+  }
+
+  const [handle] = await call((cb) => sftp.open(remotePath, "w", cb));
+  await writeHandle(sftp, handle, remotePath, profile, existingMode, options, false);
+  return { bytes: size, profile };
+}
+
+/**
+ * Write all data through an open handle and close it. A temp file is
+ * removed again on failure.
+ */
+async function writeHandle(sftp, handle, writePath, profile, existingMode, options, isTemp) {
+  const isCancelled = options.isCancelled || (() => false);
+  const size = options.size;
+  let closed = false;
+  try {
+    const chunk = profile.writeChunk;
+    let transferred = 0;
+
+    const writeChunk = async (index) => {
+      const position = index * chunk;
+      const length = Math.min(chunk, size - position);
+      const data = await options.readAt(position, length);
+      await call((cb) => sftp.write(handle, data, 0, data.length, position, cb));
+      transferred += data.length;
+      options.onProgress?.(transferred, size);
+    };
+
+    await runPipeline(Math.ceil(size / chunk), profile.writeRequests, writeChunk, isCancelled);
+
+    if (isTemp && existingMode !== null) {
+      await call((cb) => sftp.fchmod(handle, existingMode, cb)).catch(() => {});
+    }
+    if (profile.hasFsync) {
+      await call((cb) => sftp.ext_openssh_fsync(handle, cb));
+    }
+    await call((cb) => sftp.close(handle, cb));
+    closed = true;
+  } catch (err) {
+    if (!closed) await call((cb) => sftp.close(handle, cb)).catch(() => {});
+    if (isTemp) await call((cb) => sftp.unlink(writePath, cb)).catch(() => {});
+    throw err;
+  }
+}
+
+/**
+ * Upload a local file with pipelined writes
+ */
+async function pipelinedUploadFile(sftp, localPath, remotePath, options = {}) {
+  const file = await fs.promises.open(localPath, "r");
+  try {
+    const size = typeof options.size === "number" && options.size >= 0
+      ? options.size
+      : (await file.stat()).size;
+    return await pipelinedUpload(sftp, remotePath, {
+      ...options,
+      size,
+      readAt: async (position, length) => {
+        const buffer = Buffer.allocUnsafe(length);
+        const { bytesRead } = await file.read(buffer, 0, length, position);
+        if (bytesRead !== length) throw new Error("Local file changed during upload");
+        return buffer;
+      },
+    });
+  } finally {
+    await file.close().catch(() => {});
+  }
+}
+
+/**
+ * Upload an in-memory buffer with pipelined writes
+ */
+function pipelinedUploadBuffer(sftp, buffer, remotePath, options = {}) {
+  return pipelinedUpload(sftp, remotePath, {
+    ...options,
+    size: buffer.length,
+    readAt: async (position, length) => buffer.subarray(position, position + length),
+  });
+}
+
+module.exports = {
+  getTransferProfile,
+  getFastTransferOptions,
+  assertRemoteFreeSpace,
+  pipelinedDownload,
+  pipelinedUploadFile,
+  pipelinedUploadBuffer,
+};
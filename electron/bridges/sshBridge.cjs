@@ -8,11 +8,18 @@ const fs = require("node:fs");
 const path = require("node:path");
 const os = require("node:os");
 const { exec } = require("node:child_process");
+const { performance } = require("node:perf_hooks");
+const { StringDecoder } = require("node:string_decoder");
 const { Client: SSHClient, utils: sshUtils } = require("ssh2");
 const { NetcattyAgent } = require("./netcattyAgent.cjs");
 const keyboardInteractiveHandler = require("./keyboardInteractiveHandler.cjs");
 const passphraseHandler = require("./passphraseHandler.cjs");
 const { createProxySocket } = require("./proxyUtils.cjs");
+const remoteCapabilities = require("./remoteCapabilities.cjs");
+const inbandTransfer = require("./inbandTransferBridge.cjs");
+const transportProfile = require("./sshTransportProfile.cjs");
+const netDialer = require("./netDialer.cjs");
+const sessionMetrics = require("./sessionMetricsBridge.cjs");
 const { 
   buildAuthHandler, 
   createKeyboardInteractiveHandler, 
@@ -21,6 +28,7 @@ const {
   requestPassphrasesForEncryptedKeys,
   findAllDefaultPrivateKeys: findAllDefaultPrivateKeysFromHelper,
 } = require("./sshAuthHelper.cjs");
+const pwdLog = require("./logBridge.cjs").createLogger("getSessionPwd");
 
 // Default SSH key names in priority order
 const DEFAULT_KEY_NAMES = ["id_ed25519", "id_ecdsa", "id_rsa"];
@@ -332,6 +340,8 @@ async function connectThroughChain(event, options, jumpHosts, targetHost, target
         connOpts.sock = currentSocket;
         delete connOpts.host;
         delete connOpts.port;
+      } else {
+        await netDialer.dialInto(connOpts);
       }
 
       // Connect this hop
@@ -458,6 +468,13 @@ async function startSSHSession(event, options) {
         compress: ['none'],
       },
     };
+    // Per-host cipher/compression choice from a previous "tune" run
+    transportProfile.applyTransportProfile(connectOpts, options.transportProfile);
+
+    let hostFingerprint = null;
+    remoteCapabilities.captureHostFingerprint(connectOpts, (fp) => {
+      hostFingerprint = fp;
+    });
 
     // Authentication for final target
     const hasCertificate = typeof options.certificate === "string" && options.certificate.trim().length > 0;
@@ -812,7 +829,9 @@ async function startSSHSession(event, options) {
       }
     }
 
-    // Handle chain/proxy connections
+    // Handle chain/proxy connections; direct connects go through the shared dialer
+    let dialTiming = null;
+    const socketStarted = performance.now();
     if (hasJumpHosts) {
       const chainResult = await connectThroughChain(
         event,
@@ -840,13 +859,22 @@ async function startSSHSession(event, options) {
       connectOpts.sock = connectionSocket;
       delete connectOpts.host;
       delete connectOpts.port;
+    } else {
+      dialTiming = await netDialer.dialInto(connectOpts);
     }
+    const socketMs = Math.round(performance.now() - socketStarted);
 
     return new Promise((resolve, reject) => {
       const logPrefix = hasJumpHosts ? '[Chain]' : '[SSH]';
+      const connectTimer = netDialer.startConnectTimer(conn, dialTiming, socketMs);
       conn.on("ready", () => {
         console.log(`${logPrefix} ${options.hostname} ready`);
 
+        // DNS / TCP / KEX / auth breakdown for the connection log
+        const timing = connectTimer.finish();
+        log("Connect timing", { hostname: options.hostname, ...timing });
+        safeSend(sender, "netcatty:connect:timing", { sessionId, hostname: options.hostname, timing });
+
         // Cache the successful auth method
         if (connectOpts._lastTriedMethodRef) {
           const successMethod = connectOpts._lastTriedMethodRef();
@@ -887,8 +915,22 @@ async function startSSHSession(event, options) {
               stream,
               chainConnections,
               webContentsId: event.sender.id,
+              capabilityKey: remoteCapabilities.makeCapabilityKey(
+                hostFingerprint,
+                connectOpts.username,
+                options.hostname,
+                options.port,
+              ),
             };
             sessions.set(sessionId, session);
+            sessionMetrics.track(session);
+            transportProfile.enlargeChannelWindow(
+              stream,
+              transportProfile.normalizeProfile(options.transportProfile)?.windowSize,
+            );
+
+            // Probe (or load) host capabilities over this connection in the background
+            void remoteCapabilities.ensureCapabilities(conn, session.capabilityKey);
 
             // Data buffering for reduced IPC overhead
             let dataBuffer = '';
@@ -920,15 +962,25 @@ async function startSSHSession(event, options) {
               }
             };
 
+            // ZMODEM/trzsz detection needs the raw bytes; decode afterwards so
+            // multi-byte characters split across packets stay intact
+            const decoder = new StringDecoder("utf8");
+            const filterOutput = inbandTransfer.createOutputFilter(sessionId, (buf) => {
+              bufferData(decoder.write(buf));
+            });
+
             stream.on("data", (data) => {
-              bufferData(data.toString("utf8"));
+              sessionMetrics.recordIn(session, data);
+              filterOutput(data);
             });
 
             stream.stderr?.on("data", (data) => {
+              sessionMetrics.recordIn(session, data);
               bufferData(data.toString("utf8"));
             });
 
             stream.on("close", () => {
+              inbandTransfer.disposeSession(sessionId);
               // Flush any remaining data before close
               if (flushTimeout) {
                 clearTimeout(flushTimeout);
@@ -1153,44 +1205,152 @@ async function execCommand(event, payload) {
         }
       });
 
-    const hasCertificate = typeof payload.certificate === "string" && payload.certificate.trim().length > 0;
+    const connectOpts = buildOneShotConnectOpts(event, payload, timeoutMs);
+    netDialer.dialInto(connectOpts, { timeoutMs }).then(
+      () => conn.connect(connectOpts),
+      (err) => {
+        if (settled) return;
+        clearTimeout(timer);
+        settled = true;
+        reject(err);
+      },
+    );
+  });
+}
 
-    const connectOpts = {
-      host: payload.hostname,
-      port: payload.port || 22,
-      username: payload.username,
-      readyTimeout: timeoutMs,
-      keepaliveInterval: 0,
-    };
+/**
+ * Connect options for short-lived, non-interactive connections (exec, tune)
+ */
+function buildOneShotConnectOpts(event, payload, timeoutMs) {
+  const hasCertificate = typeof payload.certificate === "string" && payload.certificate.trim().length > 0;
+
+  const connectOpts = {
+    host: payload.hostname,
+    port: payload.port || 22,
+    username: payload.username,
+    readyTimeout: timeoutMs,
+    keepaliveInterval: 0,
+  };
 
-    let authAgent = null;
-    if (hasCertificate) {
-      authAgent = new NetcattyAgent({
-        mode: "certificate",
-        webContents: event.sender,
-        meta: {
-          label: payload.keyId || payload.username || "",
-          certificate: payload.certificate,
-          privateKey: payload.privateKey,
-          passphrase: payload.passphrase,
-        },
-      });
-      connectOpts.agent = authAgent;
-    } else if (payload.privateKey) {
-      connectOpts.privateKey = payload.privateKey;
-      if (payload.passphrase) connectOpts.passphrase = payload.passphrase;
-    }
+  let authAgent = null;
+  if (hasCertificate) {
+    authAgent = new NetcattyAgent({
+      mode: "certificate",
+      webContents: event.sender,
+      meta: {
+        label: payload.keyId || payload.username || "",
+        certificate: payload.certificate,
+        privateKey: payload.privateKey,
+        passphrase: payload.passphrase,
+      },
+    });
+    connectOpts.agent = authAgent;
+  } else if (payload.privateKey) {
+    connectOpts.privateKey = payload.privateKey;
+    if (payload.passphrase) connectOpts.passphrase = payload.passphrase;
+  }
 
-    if (payload.password) connectOpts.password = payload.password;
+  if (payload.password) connectOpts.password = payload.password;
 
-    if (authAgent) {
-      const order = ["agent"];
-      if (connectOpts.password) order.push("password");
-      connectOpts.authHandler = order;
+  if (authAgent) {
+    const order = ["agent"];
+    if (connectOpts.password) order.push("password");
+    connectOpts.authHandler = order;
+  }
+
+  return connectOpts;
+}
+
+/**
+ * Benchmark transport profiles against a host and return the fastest.
+ * Every candidate needs its own connection since algorithms are fixed at
+ * key exchange; jump hosts are connected once and reused for all of them.
+ */
+async function tuneSshTransport(event, payload) {
+  const targetHost = payload.hostname;
+  const targetPort = payload.port || 22;
+  const jumpHosts = payload.jumpHosts || [];
+  let chain = null;
+
+  try {
+    if (jumpHosts.length > 0) {
+      chain = await connectThroughChain(
+        event,
+        payload,
+        jumpHosts,
+        targetHost,
+        targetPort,
+        `tune-${Date.now()}`,
+      );
     }
+    let chainSocket = chain?.socket || null;
+
+    const openSocket = async () => {
+      if (chain) {
+        if (chainSocket) {
+          const sock = chainSocket;
+          chainSocket = null;
+          return sock;
+        }
+        const lastHop = chain.connections[chain.connections.length - 1];
+        return new Promise((resolve, reject) => {
+          lastHop.forwardOut("127.0.0.1", 0, targetHost, targetPort, (err, stream) => {
+            if (err) reject(err);
+            else resolve(stream);
+          });
+        });
+      }
+      if (payload.proxy) return createProxySocket(payload.proxy, targetHost, targetPort);
+      return null;
+    };
 
-    conn.connect(connectOpts);
-  });
+    const connect = async (profile) => {
+      const connectOpts = buildOneShotConnectOpts(event, payload, 20000);
+      // No credentials on the host: same ssh-agent / default key fallback as sessions
+      if (!connectOpts.agent && !connectOpts.privateKey && !connectOpts.password) {
+        const agentSocket = process.platform === "win32"
+          ? "\\\\.\\pipe\\openssh-ssh-agent"
+          : process.env.SSH_AUTH_SOCK;
+        if (agentSocket) connectOpts.agent = agentSocket;
+        const defaultKey = findDefaultPrivateKey();
+        if (defaultKey) connectOpts.privateKey = defaultKey.privateKey;
+      }
+      transportProfile.applyTransportProfile(connectOpts, profile);
+      const sock = await openSocket();
+      if (sock) {
+        connectOpts.sock = sock;
+        delete connectOpts.host;
+        delete connectOpts.port;
+      } else {
+        await netDialer.dialInto(connectOpts);
+      }
+
+      const conn = new SSHClient();
+      return new Promise((resolve, reject) => {
+        let ready = false;
+        conn.once("ready", () => {
+          ready = true;
+          resolve(conn);
+        });
+        // Keep a listener after ready so late socket errors don't throw
+        conn.on("error", (err) => {
+          if (!ready) reject(err);
+        });
+        conn.connect(connectOpts);
+      });
+    };
+
+    const result = await transportProfile.tuneTransport(connect, ({ step, profile }) => {
+      log("Transport tune step", { hostname: targetHost, step, profile });
+    });
+    return { success: true, ...result };
+  } catch (err) {
+    return { success: false, error: err?.message || String(err) };
+  } finally {
+    for (const c of chain?.connections || []) {
+      try { c.end(); } catch { }
+    }
+  }
 }
 
 /**
@@ -1363,14 +1523,14 @@ async function getSessionPwd(event, payload) {
           stream.removeListener('data', onData);
 
           const pwdOutput = buffer.slice(startIdx, endIdx).trim();
-          console.log('[getSessionPwd] pwdOutput:', JSON.stringify(pwdOutput));
+          pwdLog.debug(() => `pwdOutput: ${JSON.stringify(pwdOutput)}`);
 
           // The pwd output should be a valid absolute path
           if (pwdOutput && pwdOutput.startsWith('/')) {
-            console.log('[getSessionPwd] Success, cwd:', pwdOutput);
+            pwdLog.debug('Success, cwd:', pwdOutput);
             resolve({ success: true, cwd: pwdOutput });
           } else {
-            console.log('[getSessionPwd] Failed - invalid path:', pwdOutput);
+            pwdLog.debug('Failed - invalid path:', pwdOutput);
             resolve({ success: false, error: 'Invalid pwd output' });
           }
         }
@@ -1703,14 +1863,34 @@ async function getServerStats(event, payload) {
   });
 }
 
+/**
+ * Get cached remote capabilities (OS, shell, tools, sftp-server) for an active
+ * SSH session, probing over the session's connection when not cached yet
+ */
+async function getSessionCapabilities(event, payload) {
+  const session = sessions.get(payload?.sessionId);
+  if (!session || !session.conn || !session.capabilityKey) {
+    return { success: false, error: 'Session not found or not connected' };
+  }
+  const capabilities = await remoteCapabilities.ensureCapabilities(
+    session.conn,
+    session.capabilityKey,
+    { force: !!payload.force },
+  );
+  if (!capabilities) return { success: false, error: 'Capability probe failed' };
+  return { success: true, capabilities };
+}
+
 /**
  * Register IPC handlers for SSH operations
  */
 function registerHandlers(ipcMain) {
   ipcMain.handle("netcatty:start", startSSHSessionWrapper);
   ipcMain.handle("netcatty:ssh:exec", execCommand);
+  ipcMain.handle("netcatty:ssh:tuneTransport", tuneSshTransport);
   ipcMain.handle("netcatty:ssh:pwd", getSessionPwd);
   ipcMain.handle("netcatty:ssh:stats", getServerStats);
+  ipcMain.handle("netcatty:ssh:capabilities", getSessionCapabilities);
   ipcMain.handle("netcatty:key:generate", generateKeyPair);
   ipcMain.handle("netcatty:ssh:check-agent", async () => {
     return await checkWindowsSshAgent();
@@ -1738,8 +1918,10 @@ module.exports = {
   createProxySocket,
   startSSHSession,
   execCommand,
+  tuneSshTransport,
   getSessionPwd,
   getServerStats,
+  getSessionCapabilities,
   generateKeyPair,
   checkWindowsSshAgent,
   findDefaultPrivateKey,
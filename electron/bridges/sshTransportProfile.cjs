@@ -0,0 +1,242 @@
+/**
+ * SSH Transport Profiles - per-host cipher, compression and channel window
+ * choices, plus the short throughput test ("tune") that picks them.
+ *
+ * A profile looks like { cipher: "aes-gcm" | "chacha20", compression, windowSize }.
+ * Hosts without a profile keep the connection defaults of each bridge.
+ */
+
+const { performance } = require("node:perf_hooks");
+
+const CHACHA20 = "chacha20-poly1305@openssh.com";
+const AES_GCM = ["aes128-gcm@openssh.com", "aes256-gcm@openssh.com"];
+const AES_CTR = ["aes128-ctr", "aes256-ctr"];
+
+// ssh2 opens every channel with a fixed 2 MB receive window (Channel.js MAX_WINDOW)
+const DEFAULT_WINDOW = 2 * 1024 * 1024;
+const LARGE_WINDOW = 16 * 1024 * 1024;
+const MAX_WINDOW = 64 * 1024 * 1024;
+
+// Throughput test: stream base64 of random bytes (compresses roughly like
+// mixed text, so zlib only wins on genuinely slow links)
+const TUNE_BYTES = 64 * 1024 * 1024;
+const TUNE_DURATION_MS = 2500;
+const TUNE_TIMEOUT_MS = 15000;
+// A candidate has to beat the current best by this much to replace it
+const MIN_GAIN = 0.05;
+
+let supportedCiphers = null;
+
+/**
+ * Cipher names this ssh2 build accepts; falls back to the AES set when the
+ * internal constants module moves
+ */
+function getSupportedCiphers() {
+  if (supportedCiphers) return supportedCiphers;
+  try {
+    const constants = require("ssh2/lib/protocol/constants.js");
+    if (Array.isArray(constants.SUPPORTED_CIPHER)) {
+      supportedCiphers = new Set(constants.SUPPORTED_CIPHER);
+      return supportedCiphers;
+    }
+  } catch {
+    // Not resolvable from this layout
+  }
+  supportedCiphers = new Set([...AES_GCM, ...AES_CTR]);
+  return supportedCiphers;
+}
+
+function isChachaSupported() {
+  return getSupportedCiphers().has(CHACHA20);
+}
+
+/**
+ * Validate a stored profile; returns null when there is nothing to apply
+ */
+function normalizeProfile(profile) {
+  if (!profile || typeof profile !== "object") return null;
+  const cipher = profile.cipher === "chacha20" && isChachaSupported() ? "chacha20" : "aes-gcm";
+  const windowSize = Number(profile.windowSize) > DEFAULT_WINDOW
+    ? Math.min(Math.floor(Number(profile.windowSize)), MAX_WINDOW)
+    : DEFAULT_WINDOW;
+  return { cipher, compression: !!profile.compression, windowSize };
+}
+
+/**
+ * Cipher preference list with the profile's choice first; the rest stay as
+ * fallbacks for servers that lack it
+ */
+function cipherList(cipher) {
+  const chacha = isChachaSupported() ? [CHACHA20] : [];
+  return cipher === "chacha20"
+    ? [...chacha, ...AES_GCM, ...AES_CTR]
+    : [...AES_GCM, ...chacha, ...AES_CTR];
+}
+
+/**
+ * Apply a host's transport profile to ssh2 connect options (in place)
+ */
+function applyTransportProfile(connectOpts, profile) {
+  const normalized = normalizeProfile(profile);
+  if (!normalized) return connectOpts;
+  connectOpts.algorithms = {
+    ...(connectOpts.algorithms || {}),
+    cipher: cipherList(normalized.cipher),
+    compress: normalized.compression ? ["zlib@openssh.com", "zlib", "none"] : ["none"],
+  };
+  return connectOpts;
+}
+
+/**
+ * Grow an ssh2 channel's receive window beyond the built-in 2 MB.
+ *
+ * ssh2 only tops the window back up to its fixed maximum, so we send the
+ * extra WINDOW_ADJUST ourselves and refill after each accepted packet.
+ * Works for both Channel and SFTP (the client pushes data into either).
+ * Returns false when the channel doesn't expose the expected internals.
+ */
+function enlargeChannelWindow(channel, windowSize) {
+  const target = Math.min(Number(windowSize) || 0, MAX_WINDOW);
+  const incoming = channel?.incoming;
+  const outgoing = channel?.outgoing;
+  const protocol = channel?._client?._protocol || channel?._protocol;
+  if (
+    target <= DEFAULT_WINDOW ||
+    !incoming || typeof incoming.window !== "number" ||
+    !outgoing || typeof outgoing.id !== "number" ||
+    !protocol || typeof protocol.channelWindowAdjust !== "function" ||
+    typeof channel.push !== "function" ||
+    channel._netcattyWindow
+  ) {
+    return false;
+  }
+  channel._netcattyWindow = target;
+
+  const topUp = (force) => {
+    if (outgoing.state === "closed" || outgoing.state === "eof") return;
+    const amount = target - incoming.window;
+    // Refill once half the window is used, like ssh2 does for its own
+    if (amount <= 0 || (!force && amount < target / 2)) return;
+    incoming.window += amount;
+    try {
+      protocol.channelWindowAdjust(outgoing.id, amount);
+    } catch {
+      // Connection is going away
+    }
+  };
+
+  const push = channel.push;
+  channel.push = function (data, ...rest) {
+    const accepted = push.call(this, data, ...rest);
+    // Leave the window alone while the consumer applies backpressure
+    if (data && accepted !== false) topUp(false);
+    return accepted;
+  };
+  topUp(true);
+  return true;
+}
+
+/**
+ * Stream test data over an exec channel and return bytes/second of payload
+ */
+function measureThroughput(conn, profile) {
+  return new Promise((resolve, reject) => {
+    const command = `head -c ${TUNE_BYTES} /dev/urandom | base64`;
+    conn.exec(command, (err, stream) => {
+      if (err) return reject(err);
+      enlargeChannelWindow(stream, profile.windowSize);
+
+      let received = 0;
+      let firstAt = 0;
+      let lastAt = 0;
+      let settled = false;
+      const finish = (error) => {
+        if (settled) return;
+        settled = true;
+        clearTimeout(timer);
+        try { stream.close(); } catch { }
+        if (error) return reject(error);
+        const seconds = (lastAt - firstAt) / 1000;
+        if (received < 256 * 1024 || seconds <= 0) {
+          return reject(new Error("Remote throughput test produced no data (needs head, base64 and /dev/urandom)"));
+        }
+        resolve({ bytes: received, seconds, bytesPerSecond: received / seconds });
+      };
+      const timer = setTimeout(() => finish(), TUNE_TIMEOUT_MS);
+
+      stream.on("data", (data) => {
+        const now = performance.now();
+        // Time from the first byte so command start-up doesn't count
+        if (!firstAt) firstAt = now;
+        else received += data.length;
+        lastAt = now;
+        if (now - firstAt >= TUNE_DURATION_MS) finish();
+      });
+      stream.stderr?.resume();
+      stream.on("close", () => finish());
+      stream.on("error", (e) => finish(e));
+    });
+  });
+}
+
+/**
+ * Run the tune sequence. `connect(profile)` must resolve with a ready ssh2
+ * Client whose connect options had the profile applied.
+ *
+ * Each step keeps the best profile so far and flips one setting: cipher,
+ * then compression, then the channel window.
+ */
+async function tuneTransport(connect, onStep) {
+  const results = [];
+  const trial = async (profile) => {
+    onStep?.({ step: results.length + 1, profile });
+    let conn = null;
+    try {
+      conn = await connect(profile);
+      const measured = await measureThroughput(conn, profile);
+      results.push({ profile, bytesPerSecond: Math.round(measured.bytesPerSecond) });
+      return measured.bytesPerSecond;
+    } catch (err) {
+      results.push({ profile, error: err?.message || String(err) });
+      return 0;
+    } finally {
+      try { conn?.end(); } catch { }
+    }
+  };
+
+  let best = { cipher: "aes-gcm", compression: false, windowSize: DEFAULT_WINDOW };
+  let bestRate = await trial(best);
+  if (!bestRate) {
+    throw new Error(results[0]?.error || "Throughput test failed");
+  }
+
+  const candidates = [
+    isChachaSupported() ? (p) => ({ ...p, cipher: "chacha20" }) : null,
+    (p) => ({ ...p, compression: true }),
+    (p) => ({ ...p, windowSize: LARGE_WINDOW }),
+  ].filter(Boolean);
+
+  for (const vary of candidates) {
+    const candidate = vary(best);
+    const rate = await trial(candidate);
+    if (rate > bestRate * (1 + MIN_GAIN)) {
+      best = candidate;
+      bestRate = rate;
+    }
+  }
+
+  return {
+    profile: { ...best, throughput: Math.round(bestRate), tunedAt: Date.now() },
+    results,
+  };
+}
+
+module.exports = {
+  DEFAULT_WINDOW,
+  LARGE_WINDOW,
+  normalizeProfile,
+  applyTransportProfile,
+  enlargeChannelWindow,
+  measureThroughput,
+  tuneTransport,
+};
@@ -8,10 +8,30 @@
 const fs = require("node:fs");
 const path = require("node:path");
 const os = require("node:os");
+const crypto = require("node:crypto");
 
 // Netcatty temp directory name
 const NETCATTY_TEMP_DIR_NAME = "Netcatty";
 
+// Content cache for remote files opened with external applications.
+// Lives in a subdirectory so per-open temp files can be cleaned up freely.
+const CONTENT_CACHE_DIR_NAME = "cache";
+const CONTENT_CACHE_INDEX_FILE = "index.json";
+const DEFAULT_CONTENT_CACHE_LIMIT_BYTES = 1024 * 1024 * 1024;
+
+// key -> { file, size, mtimeMs, lastUsed }, where size/mtimeMs describe the
+// cached local file so in-place edits (e.g. through a hard link) are detected
+let contentCacheIndex = null;
+const contentCacheLimitBytes = DEFAULT_CONTENT_CACHE_LIMIT_BYTES;
+let contentCacheSaveTimer = null;
+// key -> number of operations currently reading the entry; never evicted
+const pinnedContentCacheKeys = new Map();
+// key -> download in progress, shared by concurrent fills of the same entry
+const contentCacheFills = new Map();
+// Partial files being written; anything else with the suffix is left over
+const CONTENT_CACHE_PARTIAL_SUFFIX = ".partial";
+const activeContentCachePartials = new Set();
+
 // Cached temp directory path
 let cachedTempDir = null;
 
@@ -81,6 +101,12 @@ async function getTempDirInfo() {
       }
     }
     
+    // Include the "open with" content cache kept in a subdirectory
+    for (const entry of loadContentCacheIndex().values()) {
+      totalSize += entry.size;
+      fileCount++;
+    }
+
     return {
       path: tempDir,
       totalSize,
@@ -129,6 +155,8 @@ async function clearTempDir() {
       }
     }
     
+    // The content cache directory was removed with everything else
+    contentCacheIndex = null;
     console.log(`[TempDir] Cleanup complete: ${deletedCount} deleted, ${failedCount} failed`);
     return { deletedCount, failedCount };
   } catch (err) {
@@ -147,6 +175,208 @@ function getTempFilePath(fileName) {
   return path.join(tempDir, `${timestamp}_${safeFileName}`);
 }
 
+function getContentCacheDir() {
+  const dir = path.join(getTempDir(), CONTENT_CACHE_DIR_NAME);
+  fs.mkdirSync(dir, { recursive: true });
+  return dir;
+}
+
+function loadContentCacheIndex() {
+  if (contentCacheIndex) return contentCacheIndex;
+  contentCacheIndex = new Map();
+  try {
+    const raw = fs.readFileSync(path.join(getContentCacheDir(), CONTENT_CACHE_INDEX_FILE), "utf8");
+    const entries = JSON.parse(raw);
+    if (Array.isArray(entries)) {
+      for (const [key, entry] of entries) {
+        if (key && entry?.file) contentCacheIndex.set(key, entry);
+      }
+    }
+  } catch {
+    // Missing or corrupt index - start empty
+  }
+  // Downloads interrupted by a crash or quit
+  try {
+    for (const name of fs.readdirSync(getContentCacheDir())) {
+      if (name.endsWith(CONTENT_CACHE_PARTIAL_SUFFIX) && !activeContentCachePartials.has(name)) {
+        fs.promises.unlink(path.join(getContentCacheDir(), name)).catch(() => {});
+      }
+    }
+  } catch {
+    // Listing failed; leftovers are removed on a later load or clear
+  }
+  return contentCacheIndex;
+}
+
+function scheduleContentCacheSave() {
+  if (contentCacheSaveTimer) return;
+  contentCacheSaveTimer = setTimeout(() => {
+    contentCacheSaveTimer = null;
+    if (!contentCacheIndex) return;
+    const indexPath = path.join(getContentCacheDir(), CONTENT_CACHE_INDEX_FILE);
+    fs.promises
+      .writeFile(indexPath, JSON.stringify(Array.from(contentCacheIndex.entries())))
+      .catch((err) => console.warn(`[TempDir] Failed to save content cache index:`, err.message));
+  }, 1000);
+  contentCacheSaveTimer.unref?.();
+}
+
+/**
+ * Cache key for a remote file version. A change in size or mtime yields a new
+ * key, so stale content is never served.
+ */
+function makeContentCacheKey(hostKey, remotePath, size, mtimeMs) {
+  return crypto
+    .createHash("sha1")
+    .update(`${hostKey}\0${remotePath}\0${size}\0${mtimeMs}`)
+    .digest("hex");
+}
+
+async function removeContentCacheEntry(key) {
+  const index = loadContentCacheIndex();
+  const entry = index.get(key);
+  index.delete(key);
+  scheduleContentCacheSave();
+  if (entry) {
+    await fs.promises.unlink(path.join(getContentCacheDir(), entry.file)).catch(() => {});
+  }
+}
+
+function pinContentCacheEntry(key) {
+  pinnedContentCacheKeys.set(key, (pinnedContentCacheKeys.get(key) || 0) + 1);
+}
+
+function unpinContentCacheEntry(key) {
+  const count = (pinnedContentCacheKeys.get(key) || 0) - 1;
+  if (count > 0) pinnedContentCacheKeys.set(key, count);
+  else pinnedContentCacheKeys.delete(key);
+}
+
+/**
+ * Whether a file of this size belongs in the cache. Anything larger than the
+ * budget would be evicted right after it is written.
+ */
+function fitsContentCache(size) {
+  return typeof size === "number" && size >= 0 && size <= contentCacheLimitBytes;
+}
+
+/**
+ * Evict least recently used entries until the cache fits its size budget.
+ * Pinned entries (being committed or opened) are skipped.
+ */
+async function enforceContentCacheLimit() {
+  const index = loadContentCacheIndex();
+  let total = 0;
+  for (const entry of index.values()) total += entry.size;
+  if (total <= contentCacheLimitBytes) return;
+
+  const byAge = Array.from(index.entries()).sort((a, b) => a[1].lastUsed - b[1].lastUsed);
+  for (const [key, entry] of byAge) {
+    if (total <= contentCacheLimitBytes) break;
+    if (pinnedContentCacheKeys.has(key)) continue;
+    total -= entry.size;
+    await removeContentCacheEntry(key);
+  }
+}
+
+/**
+ * Move a finished download into place and record it. The rename replaces the
+ * directory entry only, so a copy already linked out to an editor keeps its
+ * own content.
+ */
+async function commitContentCacheEntry(key, partialPath) {
+  const file = key;
+  const filePath = path.join(getContentCacheDir(), file);
+  await fs.promises.rename(partialPath, filePath);
+  const stat = await fs.promises.stat(filePath);
+  loadContentCacheIndex().set(key, {
+    file,
+    size: stat.size,
+    mtimeMs: stat.mtimeMs,
+    lastUsed: Date.now(),
+  });
+  scheduleContentCacheSave();
+  pinContentCacheEntry(key);
+  try {
+    await enforceContentCacheLimit();
+  } finally {
+    unpinContentCacheEntry(key);
+  }
+}
+
+/**
+ * Download a file into the cache. `download(filePath)` writes to a private
+ * partial file that is committed when it completes; concurrent fills of the
+ * same key share one download.
+ */
+function fillContentCacheEntry(key, download) {
+  const existing = contentCacheFills.get(key);
+  if (existing) return existing;
+  const name = `${key}.${crypto.randomBytes(6).toString("hex")}${CONTENT_CACHE_PARTIAL_SUFFIX}`;
+  const partialPath = path.join(getContentCacheDir(), name);
+  activeContentCachePartials.add(name);
+  const fill = (async () => {
+    try {
+      await download(partialPath);
+      await commitContentCacheEntry(key, partialPath);
+    } catch (err) {
+      await fs.promises.unlink(partialPath).catch(() => {});
+      throw err;
+    } finally {
+      activeContentCachePartials.delete(name);
+      contentCacheFills.delete(key);
+    }
+  })();
+  contentCacheFills.set(key, fill);
+  return fill;
+}
+
+/**
+ * Check whether a cache entry exists and is unmodified
+ */
+async function hasContentCacheEntry(key) {
+  const index = loadContentCacheIndex();
+  const entry = index.get(key);
+  if (!entry) return false;
+  try {
+    const stat = await fs.promises.stat(path.join(getContentCacheDir(), entry.file));
+    if (stat.size === entry.size && stat.mtimeMs === entry.mtimeMs) return true;
+  } catch {
+    // Deleted externally
+  }
+  await removeContentCacheEntry(key);
+  return false;
+}
+
+/**
+ * Materialize a cached file as a fresh per-open temp file.
+ * Uses a hard link (instant, no extra space) and falls back to a copy.
+ * Returns null on a cache miss.
+ */
+async function openContentCacheEntry(key, fileName) {
+  pinContentCacheEntry(key);
+  try {
+    if (!(await hasContentCacheEntry(key))) return null;
+    const entry = loadContentCacheIndex().get(key);
+    if (!entry) return null;
+    const cachedPath = path.join(getContentCacheDir(), entry.file);
+    const localPath = getTempFilePath(fileName);
+    try {
+      await fs.promises.link(cachedPath, localPath);
+    } catch {
+      await fs.promises.copyFile(cachedPath, localPath, fs.constants.COPYFILE_FICLONE);
+    }
+    entry.lastUsed = Date.now();
+    scheduleContentCacheSave();
+    return localPath;
+  } catch (err) {
+    console.warn(`[TempDir] Could not open content cache entry:`, err.message);
+    return null;
+  } finally {
+    unpinContentCacheEntry(key);
+  }
+}
+
 /**
  * Register IPC handlers
  */
@@ -179,5 +409,10 @@ module.exports = {
   getTempDirInfo,
   clearTempDir,
   getTempFilePath,
+  makeContentCacheKey,
+  fitsContentCache,
+  fillContentCacheEntry,
+  hasContentCacheEntry,
+  openContentCacheEntry,
   registerHandlers,
 };
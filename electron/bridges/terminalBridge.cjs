@@ -7,8 +7,15 @@ const os = require("node:os");
 const fs = require("node:fs");
 const net = require("node:net");
 const path = require("node:path");
+const { StringDecoder } = require("node:string_decoder");
 const pty = require("node-pty");
 const { SerialPort } = require("serialport");
+const logBridge = require("./logBridge.cjs");
+const inbandTransfer = require("./inbandTransferBridge.cjs");
+const sessionMetrics = require("./sessionMetricsBridge.cjs");
+
+const telnetLog = logBridge.createLogger("Telnet");
+const serialLog = logBridge.createLogger("Serial");
 
 // Shared references
 let sessions = null;
@@ -127,11 +134,14 @@ function startLocalSession(event, payload) {
     }
   }
   
+  // Raw bytes let ZMODEM/trzsz run over the local pty; ConPTY only hands out text
+  const rawOutput = process.platform !== "win32";
   const proc = pty.spawn(shell, shellArgs, {
     cols: payload?.cols || 80,
     rows: payload?.rows || 24,
     env,
     cwd,
+    ...(rawOutput ? { encoding: null } : {}),
   });
   
   const session = {
@@ -139,13 +149,22 @@ function startLocalSession(event, payload) {
     webContentsId: event.sender.id,
   };
   sessions.set(sessionId, session);
+  sessionMetrics.track(session);
   
-  proc.onData((data) => {
+  const decoder = new StringDecoder("utf8");
+  const filterOutput = inbandTransfer.createOutputFilter(sessionId, (buf) => {
+    const data = decoder.write(buf);
+    if (!data) return;
     const contents = electronModule.webContents.fromId(session.webContentsId);
     contents?.send("netcatty:data", { sessionId, data });
   });
+  proc.onData((data) => {
+    sessionMetrics.recordIn(session, data);
+    filterOutput(typeof data === "string" ? Buffer.from(data, "utf8") : data);
+  });
   
   proc.onExit((evt) => {
+    inbandTransfer.disposeSession(sessionId);
     sessions.delete(sessionId);
     const contents = electronModule.webContents.fromId(session.webContentsId);
     contents?.send("netcatty:exit", { sessionId, ...evt });
@@ -167,7 +186,7 @@ async function startTelnetSession(event, options) {
   const cols = options.cols || 80;
   const rows = options.rows || 24;
 
-  console.log(`[Telnet] Starting connection to ${hostname}:${port}`);
+  telnetLog.info(`Starting connection to ${hostname}:${port}`);
 
   return new Promise((resolve, reject) => {
     const socket = new net.Socket();
@@ -222,7 +241,7 @@ async function startTelnetSession(event, options) {
             if (i + 2 >= data.length) break;
             
             const opt = data[i + 2];
-            console.log(`[Telnet] Received: ${cmd === TELNET.DO ? 'DO' : cmd === TELNET.DONT ? 'DONT' : cmd === TELNET.WILL ? 'WILL' : 'WONT'} ${opt}`);
+            telnetLog.debug(() => `Received: ${cmd === TELNET.DO ? 'DO' : cmd === TELNET.DONT ? 'DONT' : cmd === TELNET.WILL ? 'WILL' : 'WONT'} ${opt}`);
 
             if (cmd === TELNET.DO) {
               if (opt === TELNET.NAWS) {
@@ -262,7 +281,7 @@ async function startTelnetSession(event, options) {
 
             if (seIndex < data.length - 1) {
               const subOpt = data[i + 2];
-              console.log(`[Telnet] Sub-negotiation for option ${subOpt}`);
+              telnetLog.debug(() => `Sub-negotiation for option ${subOpt}`);
               
               if (subOpt === TELNET.TERMINAL_TYPE && data[i + 3] === 1) {
                 const termType = 'xterm-256color';
@@ -292,7 +311,7 @@ async function startTelnetSession(event, options) {
 
     const connectTimeout = setTimeout(() => {
       if (!connected) {
-        console.error(`[Telnet] Connection timeout to ${hostname}:${port}`);
+        telnetLog.error(`Connection timeout to ${hostname}:${port}`);
         socket.destroy();
         reject(new Error(`Connection timeout to ${hostname}:${port}`));
       }
@@ -301,7 +320,7 @@ async function startTelnetSession(event, options) {
     socket.on('connect', () => {
       connected = true;
       clearTimeout(connectTimeout);
-      console.log(`[Telnet] Connected to ${hostname}:${port}`);
+      telnetLog.info(`Connected to ${hostname}:${port}`);
 
       const session = {
         socket,
@@ -311,24 +330,32 @@ async function startTelnetSession(event, options) {
         rows,
       };
       sessions.set(sessionId, session);
+      sessionMetrics.track(session);
 
       resolve({ sessionId });
     });
 
+    const filterOutput = inbandTransfer.createOutputFilter(sessionId, (buf) => {
+      const session = sessions.get(sessionId);
+      if (!session) return;
+      const contents = electronModule.webContents.fromId(session.webContentsId);
+      contents?.send("netcatty:data", { sessionId, data: buf.toString('binary') });
+    });
+
     socket.on('data', (data) => {
       const session = sessions.get(sessionId);
       if (!session) return;
+      sessionMetrics.recordIn(session, data);
 
       const cleanData = handleTelnetNegotiation(data);
       
       if (cleanData.length > 0) {
-        const contents = electronModule.webContents.fromId(session.webContentsId);
-        contents?.send("netcatty:data", { sessionId, data: cleanData.toString('binary') });
+        filterOutput(cleanData);
       }
     });
 
     socket.on('error', (err) => {
-      console.error(`[Telnet] Socket error: ${err.message}`);
+      telnetLog.error(`Socket error: ${err.message}`);
       clearTimeout(connectTimeout);
       
       if (!connected) {
@@ -344,8 +371,9 @@ async function startTelnetSession(event, options) {
     });
 
     socket.on('close', (hadError) => {
-      console.log(`[Telnet] Connection closed${hadError ? ' with error' : ''}`);
+      telnetLog.info(`Connection closed${hadError ? ' with error' : ''}`);
       clearTimeout(connectTimeout);
+      inbandTransfer.disposeSession(sessionId);
       
       const session = sessions.get(sessionId);
       if (session) {
@@ -355,7 +383,7 @@ async function startTelnetSession(event, options) {
       sessions.delete(sessionId);
     });
 
-    console.log(`[Telnet] Connecting to ${hostname}:${port}...`);
+    telnetLog.debug(`Connecting to ${hostname}:${port}...`);
     socket.connect(port, hostname);
   });
 }
@@ -425,8 +453,10 @@ async function startMoshSession(event, options) {
       webContentsId: event.sender.id,
     };
     sessions.set(sessionId, session);
+    sessionMetrics.track(session);
 
     proc.onData((data) => {
+      sessionMetrics.recordIn(session, data);
       const contents = electronModule.webContents.fromId(session.webContentsId);
       contents?.send("netcatty:data", { sessionId, data });
     });
@@ -460,7 +490,7 @@ async function listSerialPorts() {
       type: 'hardware',
     }));
   } catch (err) {
-    console.error("[Serial] Failed to list ports:", err.message);
+    serialLog.error("Failed to list ports:", err.message);
     return [];
   }
 }
@@ -481,7 +511,7 @@ async function startSerialSession(event, options) {
   const parity = options.parity || 'none';
   const flowControl = options.flowControl || 'none';
 
-  console.log(`[Serial] Starting connection to ${portPath} at ${baudRate} baud`);
+  serialLog.info(`Starting connection to ${portPath} at ${baudRate} baud`);
 
   return new Promise((resolve, reject) => {
     try {
@@ -499,12 +529,12 @@ async function startSerialSession(event, options) {
 
       serialPort.open((err) => {
         if (err) {
-          console.error(`[Serial] Failed to open port ${portPath}:`, err.message);
+          serialLog.error(`Failed to open port ${portPath}:`, err.message);
           reject(new Error(`Failed to open serial port: ${err.message}`));
           return;
         }
 
-        console.log(`[Serial] Connected to ${portPath}`);
+        serialLog.info(`Connected to ${portPath}`);
 
         const session = {
           serialPort,
@@ -512,21 +542,28 @@ async function startSerialSession(event, options) {
           webContentsId: event.sender.id,
         };
         sessions.set(sessionId, session);
+        sessionMetrics.track(session);
 
-        serialPort.on('data', (data) => {
+        const filterOutput = inbandTransfer.createOutputFilter(sessionId, (buf) => {
           const contents = electronModule.webContents.fromId(session.webContentsId);
-          contents?.send("netcatty:data", { sessionId, data: data.toString('binary') });
+          contents?.send("netcatty:data", { sessionId, data: buf.toString('binary') });
+        });
+
+        serialPort.on('data', (data) => {
+          sessionMetrics.recordIn(session, data);
+          filterOutput(data);
         });
 
         serialPort.on('error', (err) => {
-          console.error(`[Serial] Port error: ${err.message}`);
+          serialLog.error(`Port error: ${err.message}`);
           const contents = electronModule.webContents.fromId(session.webContentsId);
           contents?.send("netcatty:exit", { sessionId, exitCode: 1, error: err.message });
           sessions.delete(sessionId);
         });
 
         serialPort.on('close', () => {
-          console.log(`[Serial] Port closed`);
+          serialLog.info(`Port closed`);
+          inbandTransfer.disposeSession(sessionId);
           const contents = electronModule.webContents.fromId(session.webContentsId);
           contents?.send("netcatty:exit", { sessionId, exitCode: 0 });
           sessions.delete(sessionId);
@@ -535,7 +572,7 @@ async function startSerialSession(event, options) {
         resolve({ sessionId });
       });
     } catch (err) {
-      console.error("[Serial] Failed to start serial session:", err.message);
+      serialLog.error("Failed to start serial session:", err.message);
       reject(err);
     }
   });
@@ -547,6 +584,9 @@ async function startSerialSession(event, options) {
 function writeToSession(event, payload) {
   const session = sessions.get(payload.sessionId);
   if (!session) return;
+  // A running ZMODEM/trzsz transfer owns the channel
+  if (inbandTransfer.interceptInput(payload.sessionId, payload.data)) return;
+  sessionMetrics.recordOut(session, payload.data);
   
   try {
     if (session.stream) {
@@ -565,6 +605,49 @@ function writeToSession(event, payload) {
   }
 }
 
+/**
+ * Write to a session and resolve once the transport is ready for more.
+ * Used by the paste engine so large pastes follow ssh2/socket/serial
+ * backpressure instead of queueing everything in memory at once.
+ * node-pty has no drain signal; its writes resolve immediately.
+ */
+function writeToSessionDrained(event, payload) {
+  const session = sessions.get(payload?.sessionId);
+  if (!session) return Promise.resolve({ ok: false });
+  if (inbandTransfer.isActive(payload.sessionId)) return Promise.resolve({ ok: false });
+  sessionMetrics.recordOut(session, payload.data);
+
+  const target = session.stream || session.socket || session.serialPort;
+  try {
+    if (!target) {
+      if (!session.proc) return Promise.resolve({ ok: false });
+      session.proc.write(payload.data);
+      return Promise.resolve({ ok: true });
+    }
+    if (target.destroyed || target.writableEnded) return Promise.resolve({ ok: false });
+    if (target.write(payload.data) !== false) return Promise.resolve({ ok: true });
+  } catch (err) {
+    if (err.code !== 'EPIPE' && err.code !== 'ERR_STREAM_DESTROYED') {
+      console.warn("Write failed", err);
+    }
+    return Promise.resolve({ ok: false });
+  }
+
+  return new Promise((resolve) => {
+    const finish = (ok) => {
+      target.off("drain", onDrain);
+      target.off("close", onClose);
+      target.off("error", onClose);
+      resolve({ ok });
+    };
+    const onDrain = () => finish(true);
+    const onClose = () => finish(false);
+    target.on("drain", onDrain);
+    target.on("close", onClose);
+    target.on("error", onClose);
+  });
+}
+
 /**
  * Resize a session terminal
  */
@@ -602,6 +685,7 @@ function resizeSession(event, payload) {
 function closeSession(event, payload) {
   const session = sessions.get(payload.sessionId);
   if (!session) return;
+  inbandTransfer.disposeSession(payload.sessionId);
   
   try {
     if (session.stream) {
@@ -637,6 +721,7 @@ function registerHandlers(ipcMain) {
   ipcMain.handle("netcatty:local:defaultShell", getDefaultShell);
   ipcMain.handle("netcatty:local:validatePath", validatePath);
   ipcMain.on("netcatty:write", writeToSession);
+  ipcMain.handle("netcatty:writeDrained", writeToSessionDrained);
   ipcMain.on("netcatty:resize", resizeSession);
   ipcMain.on("netcatty:close", closeSession);
 }
@@ -764,6 +849,7 @@ module.exports = {
   startSerialSession,
   listSerialPorts,
   writeToSession,
+  writeToSessionDrained,
   resizeSession,
   closeSession,
   cleanupAllSessions,
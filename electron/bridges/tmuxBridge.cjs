@@ -0,0 +1,438 @@
+/**
+ * tmux Bridge - tmux control mode over an open SSH session
+ *
+ * `attach` runs `tmux -C new-session -A` on an exec channel of an existing
+ * SSH connection. Every tmux pane becomes a virtual session in the shared
+ * `sessions` map, so the regular write/resize/close IPC and the renderer's
+ * terminal code work on it unchanged: writes turn into send-keys, resizes
+ * into window/pane sizes, and closing the tab kills the pane. %output is
+ * routed to the pane's session id on `netcatty:data`, and window/layout
+ * changes go to the renderer on `netcatty:tmux:event` so tabs and splits
+ * follow the tmux session.
+ *
+ * The tmux session outlives the SSH connection; attaching again to the same
+ * session name brings every window back, screens included.
+ */
+
+const crypto = require("node:crypto");
+const { EventEmitter } = require("node:events");
+const { StringDecoder } = require("node:string_decoder");
+const logBridge = require("./logBridge.cjs");
+const sessionMetrics = require("./sessionMetricsBridge.cjs");
+const {
+  TmuxControlClient,
+  quoteArg,
+  parseLayout,
+  layoutPaneIds,
+  layoutSizeWith,
+  findPane,
+} = require("./tmuxControl.cjs");
+
+const log = logBridge.createLogger("Tmux");
+
+let sessions = null;
+
+// controlId -> control state
+const controls = new Map();
+
+const DEFAULT_SESSION_NAME = "netcatty";
+const ATTACH_TIMEOUT_MS = 15000;
+// Same batching as the SSH shell path
+const FLUSH_INTERVAL = 8;
+const MAX_BUFFER_SIZE = 16384;
+// Pane resizes from one layout pass are applied together
+const RESIZE_DEBOUNCE_MS = 30;
+// Output held for a pane whose terminal has not attached yet
+const MAX_PENDING_OUTPUT = 256 * 1024;
+
+function init(deps) {
+  sessions = deps.sessions;
+}
+
+function safeSend(sender, channel, payload) {
+  try {
+    if (!sender || sender.isDestroyed()) return;
+    sender.send(channel, payload);
+  } catch {
+    // Ignore destroyed webContents during shutdown.
+  }
+}
+
+const paneSessionId = (control, paneId) => `${control.id}-p${paneId.slice(1)}`;
+
+/**
+ * Window description for the renderer: the layout tree with each leaf
+ * carrying the pane's session id
+ */
+function describeWindow(control, window) {
+  const annotate = (node) => node.type === "pane"
+    ? { type: "pane", paneId: node.paneId, sessionId: paneSessionId(control, node.paneId), width: node.width, height: node.height }
+    : { type: "split", direction: node.direction, width: node.width, height: node.height, children: node.children.map(annotate) };
+  return {
+    windowId: window.windowId,
+    name: window.name,
+    active: window.active,
+    layout: annotate(window.layout),
+  };
+}
+
+function sendEvent(control, payload) {
+  safeSend(control.sender, "netcatty:tmux:event", { controlId: control.id, ...payload });
+}
+
+/**
+ * Register a virtual session for a pane
+ */
+function addPane(control, paneId, windowId) {
+  const id = paneSessionId(control, paneId);
+  const existing = control.panes.get(paneId);
+  if (existing) {
+    existing.windowId = windowId;
+    return existing;
+  }
+
+  const stream = new EventEmitter();
+  const pane = {
+    id,
+    paneId,
+    windowId,
+    attached: false,
+    pending: [],
+    pendingBytes: 0,
+    decoder: new StringDecoder("utf8"),
+    dataBuffer: "",
+    flushTimeout: null,
+    stream,
+  };
+
+  stream.write = (data) => control.client.sendKeys(paneId, data);
+  stream.setWindow = (rows, cols) => requestPaneSize(control, pane, cols, rows);
+  stream.close = () => {
+    if (!control.panes.has(paneId)) return;
+    control.client.killPane(paneId).catch((err) => log.warn("kill-pane failed", { paneId, error: err.message }));
+  };
+
+  control.panes.set(paneId, pane);
+  const session = {
+    stream,
+    webContentsId: control.webContentsId,
+    tmuxControlId: control.id,
+    tmuxPaneId: paneId,
+  };
+  sessions.set(id, session);
+  sessionMetrics.track(session);
+  return pane;
+}
+
+function flushPane(control, pane) {
+  if (pane.dataBuffer.length > 0) {
+    safeSend(control.sender, "netcatty:data", { sessionId: pane.id, data: pane.dataBuffer });
+    pane.dataBuffer = "";
+  }
+  pane.flushTimeout = null;
+}
+
+function deliverOutput(control, pane, buf) {
+  sessionMetrics.recordIn(sessions.get(pane.id), buf);
+  pane.dataBuffer += pane.decoder.write(buf);
+  if (pane.dataBuffer.length >= MAX_BUFFER_SIZE) {
+    clearTimeout(pane.flushTimeout);
+    flushPane(control, pane);
+  } else if (!pane.flushTimeout) {
+    pane.flushTimeout = setTimeout(() => flushPane(control, pane), FLUSH_INTERVAL);
+  }
+}
+
+function removePane(control, paneId) {
+  const pane = control.panes.get(paneId);
+  if (!pane) return;
+  control.panes.delete(paneId);
+  clearTimeout(pane.flushTimeout);
+  flushPane(control, pane);
+  sessions.delete(pane.id);
+  pane.stream.emit("close");
+  safeSend(control.sender, "netcatty:exit", { sessionId: pane.id, exitCode: 0 });
+}
+
+/**
+ * Bring our window table in line with a layout; returns false when the
+ * layout string could not be parsed
+ */
+function applyLayout(control, windowId, layoutString, name) {
+  const layout = parseLayout(layoutString);
+  if (!layout) {
+    log.warn("Unparsable tmux layout", { windowId, layout: layoutString });
+    return false;
+  }
+  const previous = control.windows.get(windowId);
+  const window = {
+    windowId,
+    name: name ?? previous?.name ?? windowId,
+    active: previous?.active ?? false,
+    layout,
+  };
+  control.windows.set(windowId, window);
+
+  const paneIds = new Set(layoutPaneIds(layout));
+  for (const paneId of paneIds) addPane(control, paneId, windowId);
+  for (const [paneId, pane] of control.panes) {
+    if (pane.windowId === windowId && !paneIds.has(paneId)) removePane(control, paneId);
+  }
+  return true;
+}
+
+function closeWindow(control, windowId) {
+  if (!control.windows.delete(windowId)) return;
+  for (const [paneId, pane] of control.panes) {
+    if (pane.windowId === windowId) removePane(control, paneId);
+  }
+  sendEvent(control, { type: "window-close", windowId });
+}
+
+/**
+ * Panes report the size of their native split; collect one layout pass and
+ * turn it into a window size plus pane sizes
+ */
+function requestPaneSize(control, pane, cols, rows) {
+  if (!cols || !rows) return;
+  const window = control.windows.get(pane.windowId);
+  if (!window) return;
+  let pending = control.resizes.get(window.windowId);
+  if (!pending) {
+    pending = { sizes: new Map(), timer: null };
+    control.resizes.set(window.windowId, pending);
+  }
+  pending.sizes.set(pane.paneId, { cols, rows });
+  clearTimeout(pending.timer);
+  pending.timer = setTimeout(() => {
+    control.resizes.delete(window.windowId);
+    void applyPaneSizes(control, window.windowId, pending.sizes);
+  }, RESIZE_DEBOUNCE_MS);
+}
+
+async function applyPaneSizes(control, windowId, sizes) {
+  const window = control.windows.get(windowId);
+  if (!window || control.client.closed) return;
+  try {
+    const target = layoutSizeWith(window.layout, sizes);
+    if (target.cols !== window.layout.width || target.rows !== window.layout.height) {
+      await control.client.resizeWindow(windowId, target.cols, target.rows);
+    }
+    // A single pane always fills its window
+    if (window.layout.type === "pane") return;
+    for (const [paneId, size] of sizes) {
+      const current = findPane(control.windows.get(windowId)?.layout, paneId);
+      if (current && (current.width !== size.cols || current.height !== size.rows)) {
+        await control.client.resizePane(paneId, size.cols, size.rows);
+      }
+    }
+  } catch (err) {
+    log.warn("tmux resize failed", { windowId, error: err.message });
+  }
+}
+
+function teardown(control, reason) {
+  if (!controls.has(control.id)) return;
+  controls.delete(control.id);
+  for (const pending of control.resizes.values()) clearTimeout(pending.timer);
+  for (const paneId of [...control.panes.keys()]) removePane(control, paneId);
+  control.windows.clear();
+  try { control.channel.close(); } catch { }
+  sendEvent(control, { type: "exit", reason: reason || null });
+  log.info("tmux control mode ended", { controlId: control.id, reason });
+}
+
+/**
+ * Start tmux control mode on an SSH session's connection
+ */
+async function attachTmux(event, payload) {
+  const owner = sessions.get(payload?.sessionId);
+  if (!owner?.conn) {
+    throw new Error("tmux control mode needs a connected SSH session");
+  }
+  const sessionName = payload.sessionName || DEFAULT_SESSION_NAME;
+
+  const channel = await new Promise((resolve, reject) => {
+    owner.conn.exec(`tmux -C new-session -A -s ${quoteArg(sessionName)}`, (err, stream) => {
+      if (err) reject(err);
+      else resolve(stream);
+    });
+  });
+
+  const control = {
+    id: `tmux-${crypto.randomUUID()}`,
+    ownerSessionId: payload.sessionId,
+    sessionName,
+    sender: event.sender,
+    webContentsId: event.sender.id,
+    channel,
+    client: new TmuxControlClient(channel, channel),
+    windows: new Map(),
+    panes: new Map(),
+    resizes: new Map(),
+  };
+
+  let stderr = "";
+  channel.stderr?.on("data", (data) => {
+    stderr += data.toString("utf8");
+  });
+
+  const { client } = control;
+  client.on("output", (paneId, buf) => {
+    const pane = control.panes.get(paneId);
+    if (!pane) return;
+    if (pane.attached) {
+      deliverOutput(control, pane, buf);
+    } else if (pane.pendingBytes < MAX_PENDING_OUTPUT) {
+      pane.pending.push(buf);
+      pane.pendingBytes += buf.length;
+    }
+  });
+  client.on("layout-change", (windowId, layout) => {
+    if (!control.ready || !applyLayout(control, windowId, layout)) return;
+    sendEvent(control, { type: "window", window: describeWindow(control, control.windows.get(windowId)) });
+  });
+  client.on("window-add", async (windowId) => {
+    if (!control.ready) return;
+    try {
+      const info = await client.windowInfo(windowId);
+      if (info && applyLayout(control, windowId, info.layout, info.name)) {
+        sendEvent(control, { type: "window", window: describeWindow(control, control.windows.get(windowId)) });
+      }
+    } catch (err) {
+      log.warn("Failed to read new tmux window", { windowId, error: err.message });
+    }
+  });
+  client.on("window-close", (windowId) => closeWindow(control, windowId));
+  client.on("window-renamed", (windowId, name) => {
+    const window = control.windows.get(windowId);
+    if (!window) return;
+    window.name = name;
+    sendEvent(control, { type: "window", window: describeWindow(control, window) });
+  });
+  client.on("exit", (reason) => teardown(control, reason));
+  client.on("close", () => teardown(control, stderr.trim() || null));
+  channel.on("drain", () => {
+    for (const pane of control.panes.values()) pane.stream.emit("drain");
+  });
+
+  controls.set(control.id, control);
+
+  let timer = null;
+  try {
+    const [windows] = await Promise.race([
+      Promise.all([client.listWindows(), client.detectVersion()]),
+      new Promise((_, reject) => {
+        timer = setTimeout(() => reject(new Error("tmux did not answer")), ATTACH_TIMEOUT_MS);
+      }),
+    ]);
+    for (const window of windows) {
+      applyLayout(control, window.windowId, window.layout, window.name);
+      control.windows.get(window.windowId).active = window.active;
+    }
+    control.ready = true;
+  } catch (err) {
+    teardown(control, err.message);
+    throw new Error(stderr.trim() || err.message);
+  } finally {
+    clearTimeout(timer);
+  }
+
+  log.info("tmux control mode attached", {
+    controlId: control.id,
+    sessionName,
+    version: client.version,
+    windows: control.windows.size,
+    panes: control.panes.size,
+  });
+  return {
+    controlId: control.id,
+    sessionName,
+    windows: [...control.windows.values()].map((window) => describeWindow(control, window)),
+  };
+}
+
+/**
+ * A pane's terminal is ready: hand it the current screen and start streaming
+ */
+async function attachPane(event, payload) {
+  const session = sessions.get(payload?.sessionId);
+  const control = session?.tmuxControlId && controls.get(session.tmuxControlId);
+  const pane = control?.panes.get(session.tmuxPaneId);
+  if (!pane) throw new Error("tmux pane not found");
+
+  let snapshot = "";
+  try {
+    // Replies and notifications arrive in one ordered stream, so output held
+    // before the capture reply is in the capture and output after it is not
+    const { lines, cursorX, cursorY, height } = await control.client.capturePane(pane.paneId, () => {
+      pane.pending = [];
+      pane.pendingBytes = 0;
+    });
+    // The last `height` lines are the visible screen; put the cursor back on it
+    snapshot = `${lines.map((line) => line.toString("utf8")).join("\r\n")}`;
+    if (height > 0) snapshot += `\x1b[${cursorY + 1};${cursorX + 1}H`;
+  } catch (err) {
+    log.warn("capture-pane failed", { paneId: pane.paneId, error: err.message });
+  }
+
+  // Output that came in while the cursor was read continues the snapshot
+  const held = Buffer.concat(pane.pending);
+  pane.pending = [];
+  pane.pendingBytes = 0;
+  if (held.length > 0) {
+    sessionMetrics.recordIn(sessions.get(pane.id), held);
+    snapshot += pane.decoder.write(held);
+  }
+  pane.attached = true;
+  return { snapshot };
+}
+
+/**
+ * Layout changes made in Netcatty (split, new window)
+ */
+async function tmuxCommand(event, payload) {
+  const control = controls.get(payload?.controlId);
+  if (!control) return { success: false, error: "tmux control mode is not attached" };
+  try {
+    if (payload.action === "split") {
+      const session = sessions.get(payload.sessionId);
+      if (!session?.tmuxPaneId) throw new Error("tmux pane not found");
+      await control.client.splitPane(session.tmuxPaneId, payload.direction);
+    } else if (payload.action === "newWindow") {
+      await control.client.newWindow();
+    } else {
+      throw new Error(`Unknown tmux action: ${payload.action}`);
+    }
+    return { success: true };
+  } catch (err) {
+    return { success: false, error: err.message };
+  }
+}
+
+/**
+ * Leave control mode; the tmux session keeps running on the server
+ */
+async function detachTmux(event, payload) {
+  const control = controls.get(payload?.controlId);
+  if (!control) return { success: false };
+  control.client.detach();
+  setTimeout(() => teardown(control, "detached"), 1000);
+  return { success: true };
+}
+
+function registerHandlers(ipcMain) {
+  ipcMain.handle("netcatty:tmux:attach", attachTmux);
+  ipcMain.handle("netcatty:tmux:attachPane", attachPane);
+  ipcMain.handle("netcatty:tmux:command", tmuxCommand);
+  ipcMain.handle("netcatty:tmux:detach", detachTmux);
+}
+
+module.exports = {
+  init,
+  registerHandlers,
+  attachTmux,
+  attachPane,
+  tmuxCommand,
+  detachTmux,
+};
@@ -0,0 +1,476 @@
+/**
+ * tmux Control Mode - line protocol parser and client for `tmux -C`
+ *
+ * In control mode tmux does not draw a screen. Command replies come back
+ * between %begin/%end (or %error) guard lines, and everything else is a
+ * notification: %output carries pane output, %layout-change a window's pane
+ * tree, %window-add/%window-close/%window-renamed the window list.
+ *
+ * No Electron dependencies, so scripts/tmux-check.cjs can drive it against
+ * a local tmux.
+ */
+
+const { EventEmitter } = require("node:events");
+
+// send-keys -H takes one hex argument per byte; keep command lines short
+const SEND_KEYS_CHUNK = 256;
+// First release with send-keys -H
+const HEX_KEYS_VERSION = 3.0;
+// Control bytes, or up to a chunk of anything else, for literal send-keys
+const LITERAL_KEYS_TOKEN = new RegExp(`[\\x00-\\x1f\\x7f]+|[^\\x00-\\x1f\\x7f]{1,${SEND_KEYS_CHUNK}}`, "gu");
+// History lines included when a pane's screen is captured on attach
+const CAPTURE_HISTORY_LINES = 1000;
+// -CC wraps the stream in a DCS when tmux runs on a terminal
+const DCS_START = "\x1bP1000p";
+const WINDOW_FORMAT = "#{window_id}\t#{window_active}\t#{window_layout}\t#{window_name}";
+
+/**
+ * Undo tmux's %output escaping: bytes below 0x20 and "\" arrive as \ooo
+ * @param {Buffer} buf
+ * @returns {Buffer}
+ */
+function decodeOutput(buf) {
+  if (!buf.includes(0x5c)) return buf;
+  const out = Buffer.allocUnsafe(buf.length);
+  let length = 0;
+  for (let i = 0; i < buf.length; i++) {
+    const byte = buf[i];
+    if (byte === 0x5c && i + 3 < buf.length && isOctal(buf[i + 1]) && isOctal(buf[i + 2]) && isOctal(buf[i + 3])) {
+      out[length++] = ((buf[i + 1] - 0x30) << 6) | ((buf[i + 2] - 0x30) << 3) | (buf[i + 3] - 0x30);
+      i += 3;
+    } else {
+      out[length++] = byte;
+    }
+  }
+  return out.subarray(0, length);
+}
+
+function isOctal(byte) {
+  return byte >= 0x30 && byte <= 0x37;
+}
+
+/**
+ * Numeric version from #{version} ("3.3a" -> 3.3, "next-3.5" -> 3.5).
+ * Development builds without a number count as new; an empty answer comes
+ * from a server too old to know the format.
+ * @returns {number}
+ */
+function parseVersion(text) {
+  const value = String(text || "").trim();
+  if (!value) return 0;
+  const match = value.match(/(\d+)\.(\d+)/);
+  return match ? Number(`${match[1]}.${match[2]}`) : Infinity;
+}
+
+/**
+ * tmux key name for a control byte
+ */
+function controlKeyName(byte) {
+  switch (byte) {
+    case 0x00: return "C-Space";
+    case 0x09: return "Tab";
+    case 0x0d: return "Enter";
+    case 0x1b: return "Escape";
+    case 0x7f: return "BSpace";
+    default:
+      // 0x01-0x1a are C-a..C-z, 0x1c-0x1f C-\ C-] C-^ C-_
+      return byte <= 0x1a ? `C-${String.fromCharCode(0x60 + byte)}` : `C-${String.fromCharCode(0x40 + byte)}`;
+  }
+}
+
+/**
+ * Quote a value as a single tmux command argument
+ */
+function quoteArg(value) {
+  return `'${String(value).replace(/'/g, "'\\''")}'`;
+}
+
+/**
+ * Parse a window layout string ("b25f,160x48,0,0{80x48,0,0,1,79x48,81,0,2}").
+ *
+ * Leaves are { type: "pane", paneId: "%1", width, height, x, y }. Splits use
+ * Netcatty's naming: tmux's {} (side by side) is a "vertical" split and []
+ * (stacked) a "horizontal" one.
+ * @returns {Object|null}
+ */
+function parseLayout(layout) {
+  if (typeof layout !== "string") return null;
+  // Drop the checksum
+  const text = layout.replace(/^[0-9a-f]{4},/, "");
+  let pos = 0;
+
+  const readNumber = () => {
+    const start = pos;
+    while (pos < text.length && text[pos] >= "0" && text[pos] <= "9") pos++;
+    if (start === pos) throw new Error(`Bad tmux layout at ${start}: ${layout}`);
+    return Number(text.slice(start, pos));
+  };
+  const expect = (ch) => {
+    if (text[pos] !== ch) throw new Error(`Bad tmux layout at ${pos}: ${layout}`);
+    pos++;
+  };
+
+  const readCell = () => {
+    const width = readNumber();
+    expect("x");
+    const height = readNumber();
+    expect(",");
+    const x = readNumber();
+    expect(",");
+    const y = readNumber();
+    const open = text[pos];
+    if (open === "{" || open === "[") {
+      pos++;
+      const children = [readCell()];
+      while (text[pos] === ",") {
+        pos++;
+        children.push(readCell());
+      }
+      expect(open === "{" ? "}" : "]");
+      return { type: "split", direction: open === "{" ? "vertical" : "horizontal", width, height, x, y, children };
+    }
+    expect(",");
+    return { type: "pane", paneId: `%${readNumber()}`, width, height, x, y };
+  };
+
+  try {
+    const root = readCell();
+    return pos === text.length ? root : null;
+  } catch {
+    return null;
+  }
+}
+
+/**
+ * Pane ids of a parsed layout, in layout order
+ */
+function layoutPaneIds(node, out = []) {
+  if (!node) return out;
+  if (node.type === "pane") out.push(node.paneId);
+  else node.children.forEach((child) => layoutPaneIds(child, out));
+  return out;
+}
+
+/**
+ * Window size needed for the panes to get the sizes in `requested`
+ * (paneId -> { cols, rows }); other panes keep their current size.
+ * tmux draws a one cell border between neighbours.
+ */
+function layoutSizeWith(node, requested) {
+  if (node.type === "pane") {
+    const size = requested.get(node.paneId);
+    return size ? { cols: size.cols, rows: size.rows } : { cols: node.width, rows: node.height };
+  }
+  const sizes = node.children.map((child) => layoutSizeWith(child, requested));
+  const borders = sizes.length - 1;
+  return node.direction === "vertical"
+    ? { cols: sizes.reduce((sum, s) => sum + s.cols, borders), rows: Math.max(...sizes.map((s) => s.rows)) }
+    : { cols: Math.max(...sizes.map((s) => s.cols)), rows: sizes.reduce((sum, s) => sum + s.rows, borders) };
+}
+
+function findPane(node, paneId) {
+  if (!node) return null;
+  if (node.type === "pane") return node.paneId === paneId ? node : null;
+  for (const child of node.children) {
+    const found = findPane(child, paneId);
+    if (found) return found;
+  }
+  return null;
+}
+
+/**
+ * A control mode client over any byte stream pair (an ssh2 exec channel,
+ * or a child process's stdout/stdin).
+ *
+ * Events: "output" (paneId, Buffer), "layout-change" (windowId, layout),
+ * "window-add" (windowId), "window-close" (windowId), "window-renamed"
+ * (windowId, name), "exit" (reason), "close"
+ */
+class TmuxControlClient extends EventEmitter {
+  constructor(readable, writable) {
+    super();
+    this.writable = writable;
+    this.pending = [];
+    this.block = null;
+    this.buffer = Buffer.alloc(0);
+    this.closed = false;
+    // Which refresh-client -C size syntax this server understands
+    this.sizeSyntax = "window";
+    // Server version, and whether send-keys takes -H; set by detectVersion()
+    this.version = null;
+    this.hexKeys = true;
+
+    readable.on("data", (chunk) => this.feed(chunk));
+    readable.on("close", () => this.handleClose());
+    readable.on("end", () => this.handleClose());
+  }
+
+  feed(chunk) {
+    this.buffer = this.buffer.length ? Buffer.concat([this.buffer, chunk]) : chunk;
+    let start = 0;
+    let index;
+    while ((index = this.buffer.indexOf(0x0a, start)) !== -1) {
+      let end = index;
+      if (end > start && this.buffer[end - 1] === 0x0d) end--;
+      this.handleLine(this.buffer.subarray(start, end));
+      start = index + 1;
+    }
+    this.buffer = start < this.buffer.length ? Buffer.from(this.buffer.subarray(start)) : Buffer.alloc(0);
+  }
+
+  handleLine(line) {
+    if (this.block) {
+      const text = line.subarray(0, 8).toString("latin1");
+      if (text.startsWith("%end ") || text.startsWith("%error ")) {
+        const [, , number] = line.toString("latin1").split(" ");
+        if (number === this.block.number) {
+          const block = this.block;
+          this.block = null;
+          this.finishBlock(block, text.startsWith("%error"));
+          return;
+        }
+      }
+      this.block.lines.push(Buffer.from(line));
+      return;
+    }
+
+    let head = line.subarray(0, 64).toString("latin1");
+    if (head.startsWith(DCS_START)) {
+      line = line.subarray(DCS_START.length);
+      head = head.slice(DCS_START.length);
+    }
+    if (!head.startsWith("%")) return;
+
+    if (head.startsWith("%output ")) {
+      const space = line.indexOf(0x20, 8);
+      if (space === -1) return;
+      const paneId = line.subarray(8, space).toString("latin1");
+      this.emit("output", paneId, decodeOutput(line.subarray(space + 1)));
+      return;
+    }
+
+    const text = line.toString("utf8");
+    const [name, ...args] = text.split(" ");
+    switch (name) {
+      case "%begin": {
+        // Flag 1 marks replies to our own commands; the attach itself answers with 0
+        const [, number, flags] = args;
+        this.block = { number, own: (Number(flags) & 1) === 1, lines: [] };
+        break;
+      }
+      case "%layout-change":
+        this.emit("layout-change", args[0], args[1]);
+        break;
+      case "%window-add":
+        this.emit("window-add", args[0]);
+        break;
+      case "%window-close":
+      case "%unlinked-window-close":
+        this.emit("window-close", args[0]);
+        break;
+      case "%window-renamed":
+        this.emit("window-renamed", args[0], args.slice(1).join(" "));
+        break;
+      case "%exit":
+        this.emit("exit", args.join(" ") || null);
+        break;
+      default:
+        this.emit("notification", name.slice(1), args);
+    }
+  }
+
+  finishBlock(block, failed) {
+    if (!block.own) return;
+    const request = this.pending.shift();
+    if (!request) return;
+    request.onReply?.(failed);
+    if (failed) {
+      const error = new Error(block.lines.map((l) => l.toString("utf8")).join("\n") || "tmux command failed");
+      request.reject(error);
+      // tmux skips the rest of a command list after an error; those get no reply
+      while (request.list && this.pending[0]?.list === request.list) this.pending.shift().reject(error);
+    } else {
+      request.resolve(block.lines);
+    }
+  }
+
+  handleClose() {
+    if (this.closed) return;
+    this.closed = true;
+    const pending = this.pending;
+    this.pending = [];
+    for (const request of pending) request.reject(new Error("tmux control channel closed"));
+    this.emit("close");
+  }
+
+  /**
+   * Run a tmux command; resolves with the reply lines (Buffers). `onReply`
+   * runs synchronously when the reply ends, before any later notification
+   * is handled, which a promise continuation cannot guarantee.
+   */
+  command(line, onReply) {
+    return this.commandList([{ line, onReply }])[0];
+  }
+
+  /**
+   * Run commands as one command line, so tmux handles no pane output in
+   * between; one reply promise per command
+   * @param {Array<{ line: string, onReply?: (failed: boolean) => void }>} commands
+   * @returns {Promise<Buffer[]>[]}
+   */
+  commandList(commands) {
+    if (this.closed) return commands.map(() => Promise.reject(new Error("tmux control channel closed")));
+    const list = commands.length > 1 ? {} : null;
+    const replies = commands.map(({ onReply }) => new Promise((resolve, reject) => {
+      this.pending.push({ resolve, reject, onReply, list });
+    }));
+    this.writable.write(`${commands.map(({ line }) => line).join(" ; ")}\n`);
+    return replies;
+  }
+
+  async commandText(line) {
+    const lines = await this.command(line);
+    return lines.map((l) => l.toString("utf8"));
+  }
+
+  /**
+   * @returns {Promise<Array<{ windowId: string, name: string, layout: string, active: boolean }>>}
+   */
+  async listWindows() {
+    const lines = await this.commandText(`list-windows -F ${quoteArg(WINDOW_FORMAT)}`);
+    return lines.filter(Boolean).map((line) => {
+      const [windowId, active, layout, ...name] = line.split("\t");
+      return { windowId, active: active === "1", layout, name: name.join("\t") };
+    });
+  }
+
+  async windowInfo(windowId) {
+    const [line] = await this.commandText(`display-message -p -t ${windowId} ${quoteArg(WINDOW_FORMAT)}`);
+    if (!line) return null;
+    const [id, active, layout, ...name] = line.split("\t");
+    return { windowId: id, active: active === "1", layout, name: name.join("\t") };
+  }
+
+  /**
+   * Ask the server for its version. send-keys -H needs tmux 3.0; older
+   * servers get literal text and key names instead.
+   * @returns {Promise<string|null>}
+   */
+  async detectVersion() {
+    const [line] = await this.commandText(`display-message -p ${quoteArg("#{version}")}`);
+    this.version = line?.trim() || null;
+    this.hexKeys = parseVersion(this.version) >= HEX_KEYS_VERSION;
+    return this.version;
+  }
+
+  /**
+   * Type raw bytes into a pane
+   * @returns {boolean} false when the channel wants the writer to wait for "drain"
+   */
+  sendKeys(paneId, data) {
+    const buf = Buffer.isBuffer(data) ? data : Buffer.from(data, "utf8");
+    const commands = [];
+    if (this.hexKeys) {
+      for (let i = 0; i < buf.length; i += SEND_KEYS_CHUNK) {
+        const hex = [];
+        for (const byte of buf.subarray(i, i + SEND_KEYS_CHUNK)) hex.push(byte.toString(16).padStart(2, "0"));
+        commands.push(`send-keys -t ${paneId} -H ${hex.join(" ")}`);
+      }
+    } else {
+      // Command lines end at a newline, so control bytes go as key names
+      for (const [token] of buf.toString("utf8").matchAll(LITERAL_KEYS_TOKEN)) {
+        const code = token.charCodeAt(0);
+        if (code < 0x20 || code === 0x7f) {
+          const keys = Array.from(token, (ch) => quoteArg(controlKeyName(ch.charCodeAt(0))));
+          commands.push(`send-keys -t ${paneId} ${keys.join(" ")}`);
+        } else {
+          commands.push(`send-keys -t ${paneId} -l -- ${quoteArg(token)}`);
+        }
+      }
+    }
+    let ok = true;
+    for (const line of commands) {
+      // Fire and forget; the reply only confirms the keys were queued
+      this.command(line).catch(() => { });
+      ok = this.writable.writableNeedDrain !== true;
+    }
+    return ok;
+  }
+
+  /**
+   * Size tmux lays a window out for. tmux 3.2+ takes per-window sizes, older
+   * servers only a client size (3.1 "WxH", before that "W,H").
+   */
+  async resizeWindow(windowId, cols, rows) {
+    const attempts = {
+      window: `refresh-client -C ${windowId}:${cols}x${rows}`,
+      client: `refresh-client -C ${cols}x${rows}`,
+      legacy: `refresh-client -C ${cols},${rows}`,
+    };
+    const order = ["window", "client", "legacy"];
+    for (const syntax of order.slice(order.indexOf(this.sizeSyntax))) {
+      try {
+        await this.command(attempts[syntax]);
+        this.sizeSyntax = syntax;
+        return;
+      } catch (err) {
+        if (this.closed || syntax === "legacy") throw err;
+      }
+    }
+  }
+
+  resizePane(paneId, cols, rows) {
+    return this.command(`resize-pane -t ${paneId} -x ${cols} -y ${rows}`);
+  }
+
+  /**
+   * Split a pane; "vertical" puts the new pane to the right, "horizontal" below
+   */
+  splitPane(paneId, direction) {
+    return this.command(`split-window ${direction === "vertical" ? "-h" : "-v"} -t ${paneId}`);
+  }
+
+  killPane(paneId) {
+    return this.command(`kill-pane -t ${paneId}`);
+  }
+
+  newWindow() {
+    return this.command("new-window");
+  }
+
+  /**
+   * Current screen (plus some history) with attributes, and where the cursor is.
+   * Both are read in one command line so they describe the same moment.
+   * `onCaptured` runs as the capture reply ends: %output after that point is
+   * newer than the captured screen.
+   * @returns {Promise<{ lines: Buffer[], cursorX: number, cursorY: number, height: number }>}
+   */
+  async capturePane(paneId, onCaptured) {
+    const [cursorReply, captureReply] = this.commandList([
+      { line: `display-message -p -t ${paneId} ${quoteArg("#{cursor_x},#{cursor_y},#{pane_height}")}` },
+      {
+        line: `capture-pane -p -e -t ${paneId} -S -${CAPTURE_HISTORY_LINES}`,
+        onReply: (failed) => { if (!failed) onCaptured?.(); },
+      },
+    ]);
+    const [cursorLines, lines] = await Promise.all([cursorReply, captureReply]);
+    const cursor = cursorLines[0]?.toString("utf8");
+    const [cursorX, cursorY, height] = (cursor || "0,0,0").split(",").map(Number);
+    return { lines, cursorX, cursorY, height };
+  }
+
+  detach() {
+    if (this.closed) return;
+    this.command("detach-client").catch(() => { });
+  }
+}
+
+module.exports = {
+  TmuxControlClient,
+  decodeOutput,
+  quoteArg,
+  parseLayout,
+  layoutPaneIds,
+  layoutSizeWith,
+  findPane,
+};
@@ -6,7 +6,8 @@
 const fs = require("node:fs");
 const path = require("node:path");
 const os = require("node:os");
-const { encodePathForSession, ensureRemoteDirForSession } = require("./sftpBridge.cjs");
+const { encodePathForSession, ensureRemoteDirForSession, usesAtomicUpload } = require("./sftpBridge.cjs");
+const { pipelinedDownload, pipelinedUploadFile } = require("./sftpPipeline.cjs");
 
 // Shared references
 let sftpClients = null;
@@ -24,134 +25,32 @@ function init(deps) {
 }
 
 /**
- * Upload a local file to SFTP using streams (supports cancellation)
+ * Upload a local file to SFTP with pipelined, server-sized writes (supports cancellation)
  */
-async function uploadWithStreams(localPath, remotePath, client, fileSize, transfer, sendProgress) {
-  return new Promise((resolve, reject) => {
-    const readStream = fs.createReadStream(localPath);
-
-    // Get the underlying sftp object from ssh2-sftp-client
-    const sftp = client.sftp;
-    if (!sftp) {
-      reject(new Error("SFTP client not ready"));
-      return;
-    }
-
-    const writeStream = sftp.createWriteStream(remotePath);
-    let transferred = 0;
-    let finished = false;
-
-    // Store streams for cancellation
-    transfer.readStream = readStream;
-    transfer.writeStream = writeStream;
-
-    const cleanup = (err) => {
-      if (finished) return;
-      finished = true;
-
-      // Remove listeners to prevent memory leaks
-      readStream.removeAllListeners();
-      writeStream.removeAllListeners();
-
-      if (err) {
-        // Destroy streams on error
-        try { readStream.destroy(); } catch {}
-        try { writeStream.destroy(); } catch {}
-        reject(err);
-      } else {
-        resolve();
-      }
-    };
-
-    readStream.on('data', (chunk) => {
-      if (transfer.cancelled) {
-        cleanup(new Error('Transfer cancelled'));
-        return;
-      }
-      transferred += chunk.length;
-      sendProgress(transferred, fileSize);
-    });
-
-    readStream.on('error', (err) => cleanup(err));
-    writeStream.on('error', (err) => cleanup(err));
-    writeStream.on('close', () => {
-      if (transfer.cancelled) {
-        cleanup(new Error('Transfer cancelled'));
-      } else {
-        cleanup(null);
-      }
-    });
-
-    readStream.pipe(writeStream);
+async function uploadToSftp(localPath, remotePath, client, fileSize, transfer, sendProgress, atomic) {
+  // Get the underlying sftp object from ssh2-sftp-client
+  const sftp = client.sftp;
+  if (!sftp) throw new Error("SFTP client not ready");
+
+  // Size comes from the file itself; fileSize may predate local changes
+  await pipelinedUploadFile(sftp, localPath, remotePath, {
+    atomic,
+    isCancelled: () => transfer.cancelled,
+    onProgress: (transferred) => sendProgress(transferred, fileSize),
   });
 }
 
 /**
- * Download from SFTP to local file using streams (supports cancellation)
+ * Download from SFTP to a local file with pipelined, server-sized reads (supports cancellation)
  */
-async function downloadWithStreams(remotePath, localPath, client, fileSize, transfer, sendProgress) {
-  return new Promise((resolve, reject) => {
-    // Get the underlying sftp object from ssh2-sftp-client
-    const sftp = client.sftp;
-    if (!sftp) {
-      reject(new Error("SFTP client not ready"));
-      return;
-    }
-
-    const readStream = sftp.createReadStream(remotePath);
-    const writeStream = fs.createWriteStream(localPath);
-    let transferred = 0;
-    let finished = false;
-
-    // Store streams for cancellation
-    transfer.readStream = readStream;
-    transfer.writeStream = writeStream;
-
-    const cleanup = (err) => {
-      if (finished) return;
-      finished = true;
-
-      // Remove listeners to prevent memory leaks
-      readStream.removeAllListeners();
-      writeStream.removeAllListeners();
-
-      if (err) {
-        // Destroy streams on error
-        try { readStream.destroy(); } catch {}
-        try { writeStream.destroy(); } catch {}
-        reject(err);
-      } else {
-        resolve();
-      }
-    };
-
-    readStream.on('data', (chunk) => {
-      if (transfer.cancelled) {
-        cleanup(new Error('Transfer cancelled'));
-        return;
-      }
-      transferred += chunk.length;
-      sendProgress(transferred, fileSize);
-    });
-
-    readStream.on('error', (err) => cleanup(err));
-    writeStream.on('error', (err) => cleanup(err));
-    // Handle normal completion
-    writeStream.on('finish', () => {
-      if (transfer.cancelled) {
-        cleanup(new Error('Transfer cancelled'));
-      } else {
-        cleanup(null);
-      }
-    });
-    // Handle stream destruction (destroy() emits 'close' but not 'finish')
-    writeStream.on('close', () => {
-      if (transfer.cancelled) {
-        cleanup(new Error('Transfer cancelled'));
-      }
-    });
-
-    readStream.pipe(writeStream);
+async function downloadFromSftp(remotePath, localPath, client, fileSize, transfer, sendProgress) {
+  // Get the underlying sftp object from ssh2-sftp-client
+  const sftp = client.sftp;
+  if (!sftp) throw new Error("SFTP client not ready");
+
+  await pipelinedDownload(sftp, remotePath, localPath, {
+    isCancelled: () => transfer.cancelled,
+    onProgress: (transferred) => sendProgress(transferred, fileSize),
   });
 }
 
@@ -235,7 +134,7 @@ async function startTransfer(event, payload, onProgress) {
 
     // Handle different transfer scenarios
     if (sourceType === 'local' && targetType === 'sftp') {
-      // Upload: Local -> SFTP using streams (supports cancellation)
+      // Upload: Local -> SFTP (supports cancellation)
       const client = sftpClients.get(targetSftpId);
       if (!client) throw new Error("Target SFTP session not found");
 
@@ -243,10 +142,10 @@ async function startTransfer(event, payload, onProgress) {
       try { await ensureRemoteDirForSession(targetSftpId, dir, targetEncoding); } catch {}
 
       const encodedTargetPath = encodePathForSession(targetSftpId, targetPath, targetEncoding);
-      await uploadWithStreams(sourcePath, encodedTargetPath, client, fileSize, transfer, sendProgress);
+      await uploadToSftp(sourcePath, encodedTargetPath, client, fileSize, transfer, sendProgress, usesAtomicUpload(targetSftpId));
 
     } else if (sourceType === 'sftp' && targetType === 'local') {
-      // Download: SFTP -> Local using streams (supports cancellation)
+      // Download: SFTP -> Local (supports cancellation)
       const client = sftpClients.get(sourceSftpId);
       if (!client) throw new Error("Source SFTP session not found");
 
@@ -254,7 +153,7 @@ async function startTransfer(event, payload, onProgress) {
       await fs.promises.mkdir(dir, { recursive: true });
 
       const encodedSourcePath = encodePathForSession(sourceSftpId, sourcePath, sourceEncoding);
-      await downloadWithStreams(encodedSourcePath, targetPath, client, fileSize, transfer, sendProgress);
+      await downloadFromSftp(encodedSourcePath, targetPath, client, fileSize, transfer, sendProgress);
 
     } else if (sourceType === 'local' && targetType === 'local') {
       // Local copy: use streams
@@ -314,7 +213,7 @@ async function startTransfer(event, payload, onProgress) {
       });
 
     } else if (sourceType === 'sftp' && targetType === 'sftp') {
-      // SFTP to SFTP: download to temp then upload using streams
+      // SFTP to SFTP: download to temp then upload
       const tempPath = path.join(os.tmpdir(), `netcatty-transfer-${transferId}`);
 
       const sourceClient = sftpClients.get(sourceSftpId);
@@ -327,7 +226,7 @@ async function startTransfer(event, payload, onProgress) {
       const downloadProgress = (transferred, total) => {
         sendProgress(Math.floor(transferred / 2), fileSize);
       };
-      await downloadWithStreams(encodedSourcePath, tempPath, sourceClient, fileSize, transfer, downloadProgress);
+      await downloadFromSftp(encodedSourcePath, tempPath, sourceClient, fileSize, transfer, downloadProgress);
 
       if (transfer.cancelled) {
         try { await fs.promises.unlink(tempPath); } catch {}
@@ -342,7 +241,7 @@ async function startTransfer(event, payload, onProgress) {
       const uploadProgress = (transferred, total) => {
         sendProgress(Math.floor(fileSize / 2) + Math.floor(transferred / 2), fileSize);
       };
-      await uploadWithStreams(tempPath, encodedTargetPath, targetClient, fileSize, transfer, uploadProgress);
+      await uploadToSftp(tempPath, encodedTargetPath, targetClient, fileSize, transfer, uploadProgress, usesAtomicUpload(targetSftpId));
 
       // Cleanup temp file
       try { await fs.promises.unlink(tempPath); } catch {}
@@ -0,0 +1,333 @@
+/**
+ * trzsz - Client side of the trzsz in-band transfer protocol
+ *
+ * `trz` (upload to the remote) and `tsz` (download from the remote) announce
+ * themselves with a `::TRZSZ:TRANSFER:<mode>:<version>:<id>` line and then
+ * exchange `#TYPE:payload` lines. We always negotiate the base64 (zlib
+ * compressed) encoding, which survives every hop a text terminal does, and
+ * grow the upload chunk size while acknowledgements come back quickly, the
+ * same way the reference clients do. Directory transfers are declined.
+ */
+
+const fs = require("node:fs");
+const path = require("node:path");
+const zlib = require("node:zlib");
+const crypto = require("node:crypto");
+const { sanitizeFileName, uniquePath } = require("./zmodem.cjs");
+
+const TRIGGER_PREFIX = Buffer.from("::TRZSZ:TRANSFER:", "ascii");
+const TRIGGER_PATTERN = /::TRZSZ:TRANSFER:([SRD]):(\d+\.\d+\.\d+)(?::(\d+))?[\r\n]/;
+// Longest trigger line we wait for before deciding it is just text
+const TRIGGER_MAX_LENGTH = 96;
+
+const PROTOCOL_VERSION = 2;
+const CLIENT_VERSION = "1.1.6";
+const MIN_CHUNK = 1024;
+const DEFAULT_MAX_CHUNK = 10 * 1024 * 1024;
+const FAST_ACK_MS = 500;
+const SLOW_ACK_MS = 2000;
+const IDLE_TIMEOUT_MS = 60 * 1000;
+
+const encodeBytes = (buf) => zlib.deflateSync(buf).toString("base64");
+const decodeBytes = (str) => zlib.inflateSync(Buffer.from(str, "base64"));
+const encodeString = (str) => encodeBytes(Buffer.from(str, "utf8"));
+const decodeString = (str) => decodeBytes(str).toString("utf8");
+
+/**
+ * Find a complete trigger line in `buf`. Returns { index, end, mode, version }
+ * or null; `partial` is true when the buffer ends inside a possible trigger.
+ */
+function detect(buf) {
+  const index = buf.indexOf(TRIGGER_PREFIX);
+  if (index < 0) return null;
+  const text = buf.subarray(index, index + TRIGGER_MAX_LENGTH).toString("latin1");
+  const match = TRIGGER_PATTERN.exec(text);
+  if (!match || match.index !== 0) {
+    return { index, partial: buf.length - index < TRIGGER_MAX_LENGTH && !/[\r\n]/.test(text) };
+  }
+  let end = index + match[0].length;
+  if (buf[end - 1] === 0x0d && buf[end] === 0x0a) end++;
+  return { index, end, mode: match[1], version: match[2], uniqueId: match[3] || "" };
+}
+
+class TrzszError extends Error {
+  constructor(message, fromRemote = false) {
+    super(message);
+    this.fromRemote = fromRemote;
+  }
+}
+
+/**
+ * One trzsz session. `files` (upload) or `saveDir` (download) being null
+ * means the user declined, which is reported to the remote as a cancel.
+ *
+ * Events: file-start, progress, file-done, file-skipped.
+ */
+class TrzszClient {
+  constructor(options) {
+    this.mode = options.mode;
+    this.write = options.write;
+    this.files = options.files || null;
+    this.saveDir = options.saveDir || null;
+    this.onEvent = options.onEvent || (() => {});
+    this.onDone = options.onDone || (() => {});
+    this.buffer = Buffer.alloc(0);
+    this.lines = [];
+    this.waiter = null;
+    this.done = false;
+    this.idleTimer = null;
+    this.openFile = null;
+    this.touch();
+  }
+
+  push(buf) {
+    if (this.done) return;
+    this.touch();
+    this.buffer = this.buffer.length ? Buffer.concat([this.buffer, buf]) : buf;
+    let nl;
+    while ((nl = this.buffer.indexOf(0x0a)) >= 0) {
+      const line = this.buffer.subarray(0, nl).toString("latin1").replace(/\r+$/, "");
+      this.buffer = this.buffer.subarray(nl + 1);
+      if (line) this.lines.push(line);
+    }
+    this.flushWaiter();
+  }
+
+  cancel() {
+    if (this.done) return;
+    void this.sendLine("fail", encodeString("Stopped"));
+    this.finish(new Error("Cancelled"));
+  }
+
+  touch() {
+    if (this.idleTimer) clearTimeout(this.idleTimer);
+    this.idleTimer = setTimeout(() => {
+      if (this.done) return;
+      void this.sendLine("fail", encodeString("Timeout"));
+      this.finish(new Error("Timed out waiting for the remote side"));
+    }, IDLE_TIMEOUT_MS);
+  }
+
+  finish(err) {
+    if (this.done) return;
+    this.done = true;
+    if (this.idleTimer) clearTimeout(this.idleTimer);
+    if (this.waiter) {
+      const { reject } = this.waiter;
+      this.waiter = null;
+      reject(err || new Error("Finished"));
+    }
+    const file = this.openFile;
+    this.openFile = null;
+    if (file) {
+      file.stream?.destroy();
+      file.handle?.close().catch(() => {});
+      if (err && file.stream) fs.promises.unlink(file.path).catch(() => {});
+    }
+    // Whatever the remote prints after the exchange goes back to the terminal
+    const leftover = this.lines.length ? Buffer.from(`${this.lines.join("\r\n")}\r\n`, "latin1") : Buffer.alloc(0);
+    this.onDone(err || null, Buffer.concat([leftover, this.buffer]));
+  }
+
+  flushWaiter() {
+    if (!this.waiter || !this.lines.length) return;
+    const { resolve } = this.waiter;
+    this.waiter = null;
+    resolve(this.lines.shift());
+  }
+
+  nextLine() {
+    if (this.done) return Promise.reject(new Error("Finished"));
+    return new Promise((resolve, reject) => {
+      this.waiter = { resolve, reject };
+      this.flushWaiter();
+    });
+  }
+
+  async sendLine(type, payload) {
+    const ok = await this.write(Buffer.from(`#${type}:${payload}\n`, "latin1"));
+    if (!ok && !this.done) throw new Error("Connection closed");
+  }
+
+  async recvCheck(type) {
+    let line = await this.nextLine();
+    // Drop anything a shell or tmux printed in front of the message
+    const tagged = line.lastIndexOf(`#${type}:`);
+    if (tagged > 0) line = line.slice(tagged);
+    else if (tagged < 0 && line.indexOf("#") > 0) line = line.slice(line.indexOf("#"));
+    const colon = line.indexOf(":");
+    if (!line.startsWith("#") || colon < 2) throw new TrzszError(`Unexpected reply: ${line.slice(0, 80)}`);
+    const got = line.slice(1, colon);
+    const payload = line.slice(colon + 1);
+    if (got === "FAIL" || got === "fail") throw new TrzszError(safeDecode(payload), true);
+    if (got !== type) throw new TrzszError(`Expected ${type} but got ${got}`);
+    return payload;
+  }
+
+  async recvInteger(type) {
+    return Number.parseInt(await this.recvCheck(type), 10);
+  }
+
+  async recvString(type) {
+    return decodeString(await this.recvCheck(type));
+  }
+
+  async recvBinary(type) {
+    return decodeBytes(await this.recvCheck(type));
+  }
+
+  async checkInteger(expected) {
+    const got = await this.recvInteger("SUCC");
+    if (got !== expected) throw new TrzszError(`Integer check [${got}] <> [${expected}]`);
+  }
+
+  async checkBinary(expected) {
+    const got = await this.recvBinary("SUCC");
+    if (!got.equals(expected)) throw new TrzszError("Check failed");
+  }
+
+  async run() {
+    try {
+      const confirm = this.mode === "R" ? !!this.files?.length : this.mode === "S" && !!this.saveDir;
+      await this.sendLine("ACT", encodeString(JSON.stringify({
+        lang: "js",
+        confirm,
+        version: CLIENT_VERSION,
+        support_dir: false,
+        binary: false,
+        protocol: PROTOCOL_VERSION,
+      })));
+      if (!confirm) {
+        this.finish(this.mode === "D" ? new Error("Directory transfers are not supported") : new Error("Cancelled"));
+        return;
+      }
+      const config = JSON.parse(await this.recvString("CFG"));
+      if (config.directory) throw new TrzszError("Directory transfers are not supported");
+      this.maxChunk = Number(config.bufsize) > 0 ? Number(config.bufsize) : DEFAULT_MAX_CHUNK;
+
+      const count = this.mode === "R" ? await this.sendFiles() : await this.recvFiles();
+      await this.sendLine("EXIT", encodeString(this.mode === "R"
+        ? `Sent ${count} file(s)`
+        : `Saved ${count} file(s) to ${this.saveDir}`));
+      this.finish(null);
+    } catch (err) {
+      if (this.done) return;
+      // Tell the remote why we stopped unless it was the one failing
+      if (!err.fromRemote) {
+        this.sendLine("fail", encodeString(err.message || String(err))).catch(() => {});
+      }
+      this.finish(err);
+    }
+  }
+
+  async sendFiles() {
+    await this.sendLine("NUM", String(this.files.length));
+    await this.checkInteger(this.files.length);
+    for (const filePath of this.files) {
+      const stat = await fs.promises.stat(filePath);
+      const name = path.basename(filePath);
+      await this.sendLine("NAME", encodeString(name));
+      await this.recvString("SUCC");
+      await this.sendLine("SIZE", String(stat.size));
+      await this.checkInteger(stat.size);
+      this.onEvent({ type: "file-start", name, path: filePath, size: stat.size });
+
+      const handle = await fs.promises.open(filePath, "r");
+      this.openFile = { handle, path: filePath };
+      const md5 = crypto.createHash("md5");
+      let chunkSize = MIN_CHUNK;
+      let sent = 0;
+      try {
+        while (sent < stat.size) {
+          const buffer = Buffer.allocUnsafe(Math.min(chunkSize, stat.size - sent));
+          const { bytesRead } = await handle.read(buffer, 0, buffer.length, sent);
+          if (bytesRead <= 0) throw new TrzszError("File shrank while sending");
+          const data = buffer.subarray(0, bytesRead);
+          const started = Date.now();
+          await this.sendLine("DATA", encodeBytes(data));
+          md5.update(data);
+          await this.checkInteger(bytesRead);
+          sent += bytesRead;
+          this.onEvent({ type: "progress", name, path: filePath, size: stat.size, transferred: sent });
+
+          const elapsed = Date.now() - started;
+          if (bytesRead === chunkSize && elapsed < FAST_ACK_MS && chunkSize < this.maxChunk) {
+            chunkSize = Math.min(chunkSize * 2, this.maxChunk);
+          } else if (elapsed >= SLOW_ACK_MS && chunkSize > MIN_CHUNK) {
+            chunkSize = MIN_CHUNK;
+          }
+        }
+      } finally {
+        this.openFile = null;
+        await handle.close().catch(() => {});
+      }
+      const digest = md5.digest();
+      await this.sendLine("MD5", encodeBytes(digest));
+      await this.checkBinary(digest);
+      this.onEvent({ type: "file-done", name, path: filePath, size: stat.size, transferred: stat.size });
+    }
+    return this.files.length;
+  }
+
+  async recvFiles() {
+    const count = await this.recvInteger("NUM");
+    await this.sendLine("SUCC", String(count));
+    for (let i = 0; i < count; i++) {
+      const name = sanitizeFileName(await this.recvString("NAME"));
+      const filePath = uniquePath(this.saveDir, name);
+      const stream = fs.createWriteStream(filePath);
+      this.openFile = { stream, path: filePath };
+      await new Promise((resolve, reject) => {
+        stream.once("open", resolve);
+        stream.once("error", reject);
+      });
+      stream.on("error", (err) => this.finish(err));
+      await this.sendLine("SUCC", encodeString(path.basename(filePath)));
+
+      const size = await this.recvInteger("SIZE");
+      await this.sendLine("SUCC", String(size));
+      this.onEvent({ type: "file-start", name, path: filePath, size });
+
+      const md5 = crypto.createHash("md5");
+      let received = 0;
+      while (received < size) {
+        const data = await this.recvBinary("DATA");
+        md5.update(data);
+        received += data.length;
+        if (!stream.write(data)) await new Promise((resolve) => stream.once("drain", resolve));
+        await this.sendLine("SUCC", String(data.length));
+        this.onEvent({ type: "progress", name, path: filePath, size, transferred: received });
+      }
+      await new Promise((resolve) => stream.end(resolve));
+      this.openFile = null;
+
+      const expected = await this.recvBinary("MD5");
+      const digest = md5.digest();
+      if (!expected.equals(digest)) {
+        await fs.promises.unlink(filePath).catch(() => {});
+        throw new TrzszError("Check MD5 failed");
+      }
+      await this.sendLine("SUCC", encodeBytes(digest));
+      this.onEvent({ type: "file-done", name, path: filePath, size, transferred: size });
+    }
+    return count;
+  }
+}
+
+function safeDecode(payload) {
+  try {
+    return decodeString(payload);
+  } catch {
+    return payload;
+  }
+}
+
+module.exports = {
+  TRIGGER_PREFIX,
+  TrzszClient,
+  detect,
+  encodeString,
+  decodeString,
+  encodeBytes,
+  decodeBytes,
+};
@@ -0,0 +1,212 @@
+/**
+ * WAN Emulator - Local TCP shaping proxy for reproducing slow links
+ *
+ * Adds round-trip latency, jitter, a bandwidth cap and packet loss to a TCP
+ * connection on localhost. Loss is modelled the way TCP experiences it: the
+ * affected segment (and everything queued behind it) arrives one
+ * retransmission timeout late, so the byte stream is never corrupted.
+ *
+ * Used by proxyUtils.createProxySocket for hosts whose proxy type is "wan",
+ * and standalone via startWanEmulator (see scripts/wan-proxy.cjs).
+ */
+
+const net = require("node:net");
+
+// Segments are shaped individually so large writes do not arrive in one burst
+const SEGMENT_BYTES = 16 * 1024;
+// Linux minimum retransmission timeout
+const MIN_RTO_MS = 200;
+// Pause the sender once this much data is in flight on an unlimited link
+const MIN_QUEUE_BYTES = 1024 * 1024;
+
+/**
+ * Clamp a user supplied config into sane ranges
+ * @param {Object} [config]
+ * @param {number} [config.latencyMs] - Added round-trip time
+ * @param {number} [config.jitterMs] - Random +/- variation per segment and direction
+ * @param {number} [config.bandwidthKbps] - Per-direction cap in kbit/s (0 = unlimited)
+ * @param {number} [config.lossPercent] - Chance a segment needs a retransmission
+ * @param {number} [config.seed] - Seed for reproducible jitter and loss
+ */
+function normalizeWanConfig(config = {}) {
+  const num = (value, min, max) => {
+    const n = Number(value);
+    if (!Number.isFinite(n)) return min;
+    return Math.min(max, Math.max(min, n));
+  };
+  return {
+    latencyMs: num(config.latencyMs, 0, 10000),
+    jitterMs: num(config.jitterMs, 0, 5000),
+    bandwidthKbps: num(config.bandwidthKbps, 0, 10000000),
+    lossPercent: num(config.lossPercent, 0, 50),
+    seed: Number.isFinite(Number(config.seed)) ? Number(config.seed) >>> 0 : null,
+  };
+}
+
+// mulberry32: small seeded PRNG so a given seed reproduces the same link
+function createRandom(seed) {
+  if (seed === null) return Math.random;
+  let state = seed;
+  return () => {
+    state = (state + 0x6d2b79f5) >>> 0;
+    let t = state;
+    t = Math.imul(t ^ (t >>> 15), t | 1);
+    t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+    return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+  };
+}
+
+/**
+ * Shape one direction of a connection
+ * @returns {() => void} Disposer that drops queued data and timers
+ */
+function shapeDirection(from, to, config, random) {
+  const oneWayMs = config.latencyMs / 2;
+  const bytesPerMs = config.bandwidthKbps > 0 ? config.bandwidthKbps / 8 : 0;
+  const rtoMs = Math.max(MIN_RTO_MS, config.latencyMs * 2);
+  const maxQueuedBytes = Math.max(MIN_QUEUE_BYTES, bytesPerMs * config.latencyMs * 2);
+
+  const queue = [];
+  let queuedBytes = 0;
+  let linkFreeAt = 0;
+  let lastDeliverAt = 0;
+  let timer = null;
+  let ended = false;
+
+  const schedule = () => {
+    if (timer || queue.length === 0) return;
+    timer = setTimeout(flush, Math.max(0, queue[0].at - Date.now()));
+  };
+
+  const flush = () => {
+    timer = null;
+    const now = Date.now();
+    while (queue.length > 0 && queue[0].at <= now) {
+      const segment = queue.shift();
+      queuedBytes -= segment.data.length;
+      if (!to.destroyed) to.write(segment.data);
+    }
+    if (from.isPaused() && queuedBytes < maxQueuedBytes / 2) from.resume();
+    if (queue.length === 0 && ended && !to.destroyed) to.end();
+    schedule();
+  };
+
+  from.on("data", (chunk) => {
+    for (let offset = 0; offset < chunk.length; offset += SEGMENT_BYTES) {
+      const data = chunk.subarray(offset, offset + SEGMENT_BYTES);
+      const now = Date.now();
+      let departAt = now;
+      if (bytesPerMs > 0) {
+        linkFreeAt = Math.max(linkFreeAt, now) + data.length / bytesPerMs;
+        departAt = linkFreeAt;
+      }
+      let at = departAt + oneWayMs;
+      if (config.jitterMs > 0) at += (random() * 2 - 1) * config.jitterMs;
+      if (config.lossPercent > 0 && random() * 100 < config.lossPercent) at += rtoMs;
+      // TCP delivers in order: a late segment holds back the ones behind it
+      at = Math.max(at, lastDeliverAt);
+      lastDeliverAt = at;
+      queue.push({ data, at });
+      queuedBytes += data.length;
+    }
+    if (queuedBytes >= maxQueuedBytes) from.pause();
+    schedule();
+  });
+
+  from.on("end", () => {
+    ended = true;
+    if (queue.length === 0 && !to.destroyed) to.end();
+  });
+
+  return () => {
+    if (timer) clearTimeout(timer);
+    timer = null;
+    queue.length = 0;
+    queuedBytes = 0;
+  };
+}
+
+/**
+ * Shape traffic between an accepted client socket and a new upstream connection
+ */
+function bridgeConnection(client, targetHost, targetPort, config, random) {
+  // Half-open on both sides so an end is only forwarded once its queue drains
+  const upstream = net.connect({ port: targetPort, host: targetHost, allowHalfOpen: true });
+  client.pause();
+  client.setNoDelay(true);
+  upstream.setNoDelay(true);
+
+  const disposers = [];
+  const teardown = () => {
+    for (const dispose of disposers.splice(0)) dispose();
+    client.destroy();
+    upstream.destroy();
+  };
+
+  upstream.once("connect", () => {
+    disposers.push(shapeDirection(client, upstream, config, random));
+    disposers.push(shapeDirection(upstream, client, config, random));
+    client.resume();
+  });
+  // Clean ends propagate through the shaped queues; only errors tear down early
+  client.on("error", teardown);
+  upstream.on("error", teardown);
+}
+
+/**
+ * Start a shaping proxy that forwards every accepted connection to a target
+ * @param {Object} options - WAN config plus targetHost, targetPort, listenHost, listenPort
+ * @param {number} [options.maxConnections] - Stop listening after this many connections
+ * @returns {Promise<{ port: number, close: () => Promise<void> }>}
+ */
+function startWanEmulator(options) {
+  const config = normalizeWanConfig(options);
+  const random = createRandom(config.seed);
+  const { targetHost, targetPort, listenHost = "127.0.0.1", listenPort = 0, maxConnections } = options;
+
+  return new Promise((resolve, reject) => {
+    let accepted = 0;
+    const server = net.createServer({ allowHalfOpen: true }, (client) => {
+      accepted++;
+      if (maxConnections && accepted >= maxConnections) server.close();
+      bridgeConnection(client, targetHost, targetPort, config, random);
+    });
+    server.once("error", reject);
+    server.listen(listenPort, listenHost, () => {
+      server.removeListener("error", reject);
+      resolve({
+        port: server.address().port,
+        close: () => new Promise((done) => server.close(() => done())),
+      });
+    });
+  });
+}
+
+/**
+ * Open a socket to targetHost:targetPort through a private single-use emulator
+ * @returns {Promise<net.Socket>} Connected socket
+ */
+async function createWanSocket(config, targetHost, targetPort) {
+  const emulator = await startWanEmulator({
+    ...config,
+    targetHost,
+    targetPort,
+    maxConnections: 1,
+  });
+  return new Promise((resolve, reject) => {
+    const socket = net.connect(emulator.port, "127.0.0.1", () => {
+      socket.removeListener("error", reject);
+      resolve(socket);
+    });
+    socket.once("error", (err) => {
+      void emulator.close();
+      reject(err);
+    });
+  });
+}
+
+module.exports = {
+  normalizeWanConfig,
+  startWanEmulator,
+  createWanSocket,
+};
@@ -0,0 +1,974 @@
+/**
+ * ZMODEM - In-band file transfer engine for terminal streams
+ *
+ * Implements the parts of ZMODEM that `lrzsz` and compatible tools use:
+ * hex/binary (CRC16 and CRC32) headers, ZDLE escaped data subpackets and the
+ * receive (remote `sz`) and send (remote `rz`) session flows. Transport and
+ * UI are left to the caller: engines get raw bytes through `push()` and write
+ * through the `write` callback, which resolves once the transport drained.
+ *
+ * Sending streams with ZCRCG subpackets inside a sliding window that is
+ * acknowledged through ZCRCQ, so throughput is bounded by the window rather
+ * than by a round trip per block. Receivers that advertise a fixed buffer
+ * size get ZCRCW blocks of that size instead.
+ */
+
+const fs = require("node:fs");
+const path = require("node:path");
+
+const ZPAD = 0x2a;
+const ZDLE = 0x18;
+const ZBIN = 0x41;
+const ZHEX = 0x42;
+const ZBIN32 = 0x43;
+const XON = 0x11;
+
+// Subpacket terminators
+const ZCRCE = 0x68;
+const ZCRCG = 0x69;
+const ZCRCQ = 0x6a;
+const ZCRCW = 0x6b;
+const ZRUB0 = 0x6c;
+const ZRUB1 = 0x6d;
+
+const FRAME = {
+  ZRQINIT: 0,
+  ZRINIT: 1,
+  ZSINIT: 2,
+  ZACK: 3,
+  ZFILE: 4,
+  ZSKIP: 5,
+  ZNAK: 6,
+  ZABORT: 7,
+  ZFIN: 8,
+  ZRPOS: 9,
+  ZDATA: 10,
+  ZEOF: 11,
+  ZFERR: 12,
+  ZCRC: 13,
+  ZCHALLENGE: 14,
+  ZCOMPL: 15,
+  ZCAN: 16,
+  ZFREECNT: 17,
+  ZCOMMAND: 18,
+  ZSTDERR: 19,
+};
+
+// ZRINIT capability flags (ZF0)
+const CANFDX = 0x01;
+const CANOVIO = 0x02;
+const CANFC32 = 0x20;
+const ESCCTL = 0x40;
+
+// Frames followed by data subpackets
+const FRAMES_WITH_DATA = new Set([FRAME.ZSINIT, FRAME.ZFILE, FRAME.ZDATA, FRAME.ZCOMMAND]);
+
+// What `sz` and `rz` print when they start; the hex header type tells which.
+// Matched from the last ZPAD so a pad split off into an earlier packet and
+// already shown as text does not hide the header.
+const ZRQINIT_TRIGGER = Buffer.from([ZPAD, ZDLE, ZHEX, 0x30, 0x30]);
+const ZRINIT_TRIGGER = Buffer.from([ZPAD, ZDLE, ZHEX, 0x30, 0x31]);
+
+// Eight CANs abort the remote side, the backspaces erase them from a shell
+const ABORT_SEQUENCE = Buffer.from([...Array(8).fill(ZDLE), ...Array(10).fill(0x08)]);
+const OVER_AND_OUT = Buffer.from("OO", "ascii");
+
+const MAX_BLOCK = 8 * 1024;
+const MIN_BLOCK = 1024;
+// Unacknowledged bytes allowed in flight when streaming
+const STREAM_WINDOW = 1024 * 1024;
+// Ask for an acknowledgement this often so the window keeps sliding
+const ACK_INTERVAL = 64 * 1024;
+const IDLE_TIMEOUT_MS = 60 * 1000;
+// How long to wait for the "OO" after the final ZFIN
+const OVER_TIMEOUT_MS = 500;
+
+const CRC16_TABLE = new Uint16Array(256);
+const CRC32_TABLE = new Uint32Array(256);
+for (let i = 0; i < 256; i++) {
+  let c16 = i << 8;
+  let c32 = i;
+  for (let k = 0; k < 8; k++) {
+    c16 = c16 & 0x8000 ? (c16 << 1) ^ 0x1021 : c16 << 1;
+    c32 = c32 & 1 ? (c32 >>> 1) ^ 0xedb88320 : c32 >>> 1;
+  }
+  CRC16_TABLE[i] = c16 & 0xffff;
+  CRC32_TABLE[i] = c32 >>> 0;
+}
+
+function crc16(buf, crc = 0) {
+  for (let i = 0; i < buf.length; i++) {
+    crc = ((crc << 8) ^ CRC16_TABLE[((crc >> 8) ^ buf[i]) & 0xff]) & 0xffff;
+  }
+  return crc;
+}
+
+// Raw (not inverted) CRC32 state so it can be continued across buffers
+function crc32Update(buf, crc = 0xffffffff) {
+  for (let i = 0; i < buf.length; i++) {
+    crc = CRC32_TABLE[(crc ^ buf[i]) & 0xff] ^ (crc >>> 8);
+  }
+  return crc >>> 0;
+}
+
+// Bytes that must always be escaped, plus all control bytes when the
+// receiver asked for ESCCTL. CR is always escaped so `CR @` never reaches
+// a telnet or rlogin hop, and telnet servers never see a bare CR.
+const ESCAPE = new Uint8Array(256);
+const ESCAPE_CTL = new Uint8Array(256);
+for (const b of [ZDLE, 0x10, 0x90, 0x11, 0x91, 0x13, 0x93, 0x0d, 0x8d]) ESCAPE[b] = 1;
+for (let b = 0; b < 256; b++) ESCAPE_CTL[b] = ESCAPE[b] || (b & 0x60) === 0 ? 1 : 0;
+
+function zdleEscape(src, escapeCtl) {
+  const table = escapeCtl ? ESCAPE_CTL : ESCAPE;
+  let extra = 0;
+  for (let i = 0; i < src.length; i++) extra += table[src[i]];
+  if (!extra) return src;
+  const out = Buffer.allocUnsafe(src.length + extra);
+  let o = 0;
+  for (let i = 0; i < src.length; i++) {
+    const b = src[i];
+    if (table[b]) {
+      out[o++] = ZDLE;
+      out[o++] = b ^ 0x40;
+    } else {
+      out[o++] = b;
+    }
+  }
+  return out;
+}
+
+function positionBytes(pos) {
+  return Buffer.from([pos & 0xff, (pos >>> 8) & 0xff, (pos >>> 16) & 0xff, (pos >>> 24) & 0xff]);
+}
+
+function readPosition(p) {
+  return (p[0] | (p[1] << 8) | (p[2] << 16) | (p[3] << 24)) >>> 0;
+}
+
+function encodeHexHeader(type, p) {
+  const raw = Buffer.from([type, p[0], p[1], p[2], p[3]]);
+  const crc = crc16(raw);
+  const hex = raw.toString("hex") + Buffer.from([crc >> 8, crc & 0xff]).toString("hex");
+  const tail = type === FRAME.ZFIN || type === FRAME.ZACK ? [0x0d, 0x8a] : [0x0d, 0x8a, XON];
+  return Buffer.concat([Buffer.from([ZPAD, ZPAD, ZDLE, ZHEX]), Buffer.from(hex, "ascii"), Buffer.from(tail)]);
+}
+
+function encodeBinHeader(type, p, useCrc32, escapeCtl) {
+  const raw = Buffer.from([type, p[0], p[1], p[2], p[3]]);
+  let crcBytes;
+  if (useCrc32) {
+    crcBytes = Buffer.alloc(4);
+    crcBytes.writeUInt32LE(~crc32Update(raw) >>> 0);
+  } else {
+    const crc = crc16(raw);
+    crcBytes = Buffer.from([crc >> 8, crc & 0xff]);
+  }
+  return Buffer.concat([
+    Buffer.from([ZPAD, ZDLE, useCrc32 ? ZBIN32 : ZBIN]),
+    zdleEscape(Buffer.concat([raw, crcBytes]), escapeCtl),
+  ]);
+}
+
+function encodeSubpacket(data, end, useCrc32, escapeCtl) {
+  let crcBytes;
+  if (useCrc32) {
+    crcBytes = Buffer.alloc(4);
+    crcBytes.writeUInt32LE(~crc32Update(Buffer.from([end]), crc32Update(data)) >>> 0);
+  } else {
+    const crc = crc16(Buffer.from([end]), crc16(data));
+    crcBytes = Buffer.from([crc >> 8, crc & 0xff]);
+  }
+  return Buffer.concat([zdleEscape(data, escapeCtl), Buffer.from([ZDLE, end]), zdleEscape(crcBytes, escapeCtl)]);
+}
+
+const S_SEEK = 0;
+const S_PAD = 1;
+const S_PAD_ZDLE = 2;
+const S_HEX = 3;
+const S_BIN = 4;
+const S_DATA = 5;
+const S_DATA_CRC = 6;
+
+const DECODE_NONE = -1;
+const DECODE_ERROR = -2;
+const HEX_HEADER_CHARS = 14;
+const MAX_SUBPACKET = 16 * 1024;
+
+/**
+ * Incremental header/subpacket decoder. Calls `onHeader(type, p, useCrc32)`,
+ * `onData(data, end)`, `onError(reason)` and `onCancel()`; a handler may call
+ * `stop()` to leave the rest of the current chunk unparsed.
+ */
+class FrameReader {
+  constructor(handlers) {
+    this.handlers = handlers;
+    this.state = S_SEEK;
+    this.escaped = false;
+    this.cans = 0;
+    this.hex = "";
+    this.header = [];
+    this.headerLen = 0;
+    this.useCrc32 = false;
+    this.data = Buffer.allocUnsafe(MAX_SUBPACKET);
+    this.dataLen = 0;
+    this.end = 0;
+    this.crc = [];
+    this.stopped = false;
+  }
+
+  stop() {
+    this.stopped = true;
+  }
+
+  /** Returns the offset parsing stopped at (buf.length when consumed) */
+  push(buf) {
+    this.stopped = false;
+    for (let i = 0; i < buf.length; i++) {
+      this.step(buf[i]);
+      if (this.stopped) return i + 1;
+    }
+    return buf.length;
+  }
+
+  unescape(b) {
+    if (this.escaped) {
+      if (b === XON || b === 0x13 || b === 0x91 || b === 0x93) return DECODE_NONE;
+      if (b === ZDLE) return DECODE_NONE;
+      this.escaped = false;
+      if (b >= ZCRCE && b <= ZCRCW) return 0x100 | b;
+      if (b === ZRUB0) return 0x7f;
+      if (b === ZRUB1) return 0xff;
+      if ((b & 0x60) === 0x40) return b ^ 0x40;
+      return DECODE_ERROR;
+    }
+    if (b === ZDLE) {
+      this.escaped = true;
+      return DECODE_NONE;
+    }
+    if (b === XON || b === 0x13 || b === 0x91 || b === 0x93) return DECODE_NONE;
+    return b;
+  }
+
+  fail(reason) {
+    this.state = S_SEEK;
+    this.escaped = false;
+    this.handlers.onError?.(reason);
+  }
+
+  step(b) {
+    // Five CANs in a row cancel the session whatever state we are in
+    if (b === ZDLE) {
+      if (++this.cans >= 5) {
+        this.cans = 0;
+        this.state = S_SEEK;
+        this.escaped = false;
+        this.handlers.onCancel?.();
+        return;
+      }
+    } else {
+      this.cans = 0;
+    }
+
+    switch (this.state) {
+      case S_SEEK:
+        if (b === ZPAD) this.state = S_PAD;
+        return;
+      case S_PAD:
+        if (b === ZDLE) this.state = S_PAD_ZDLE;
+        else if (b !== ZPAD) this.state = S_SEEK;
+        return;
+      case S_PAD_ZDLE:
+        this.escaped = false;
+        this.header = [];
+        if (b === ZHEX) {
+          this.hex = "";
+          this.state = S_HEX;
+        } else if (b === ZBIN || b === ZBIN32) {
+          this.useCrc32 = b === ZBIN32;
+          this.headerLen = this.useCrc32 ? 9 : 7;
+          this.state = S_BIN;
+        } else if (b === ZDLE) {
+          // Part of a CAN run; stay put until it resolves
+        } else {
+          this.state = S_SEEK;
+        }
+        return;
+      case S_HEX: {
+        const ch = String.fromCharCode(b);
+        if (!/[0-9a-fA-F]/.test(ch)) {
+          this.fail("bad hex header");
+          return;
+        }
+        this.hex += ch;
+        if (this.hex.length === HEX_HEADER_CHARS) {
+          const bytes = Buffer.from(this.hex, "hex");
+          const crc = crc16(bytes.subarray(0, 5));
+          if (crc !== ((bytes[5] << 8) | bytes[6])) {
+            this.fail("hex header crc");
+            return;
+          }
+          this.useCrc32 = false;
+          this.emitHeader(bytes[0], bytes.subarray(1, 5));
+        }
+        return;
+      }
+      case S_BIN: {
+        const v = this.unescape(b);
+        if (v === DECODE_NONE) return;
+        if (v === DECODE_ERROR || v > 0xff) {
+          this.fail("bad binary header");
+          return;
+        }
+        this.header.push(v);
+        if (this.header.length === this.headerLen) {
+          const bytes = Buffer.from(this.header);
+          const raw = bytes.subarray(0, 5);
+          const ok = this.useCrc32
+            ? (~crc32Update(raw) >>> 0) === bytes.readUInt32LE(5)
+            : crc16(raw) === ((bytes[5] << 8) | bytes[6]);
+          if (!ok) {
+            this.fail("binary header crc");
+            return;
+          }
+          this.emitHeader(bytes[0], raw.subarray(1, 5));
+        }
+        return;
+      }
+      case S_DATA: {
+        const v = this.unescape(b);
+        if (v === DECODE_NONE) return;
+        if (v === DECODE_ERROR) {
+          this.fail("bad escape in data");
+          return;
+        }
+        if (v > 0xff) {
+          this.end = v & 0xff;
+          this.crc = [];
+          this.state = S_DATA_CRC;
+          return;
+        }
+        if (this.dataLen >= MAX_SUBPACKET) {
+          this.fail("subpacket too long");
+          return;
+        }
+        this.data[this.dataLen++] = v;
+        return;
+      }
+      case S_DATA_CRC: {
+        const v = this.unescape(b);
+        if (v === DECODE_NONE) return;
+        if (v === DECODE_ERROR || v > 0xff) {
+          this.fail("bad subpacket crc");
+          return;
+        }
+        this.crc.push(v);
+        if (this.crc.length < (this.useCrc32 ? 4 : 2)) return;
+        const data = this.data.subarray(0, this.dataLen);
+        const endByte = Buffer.from([this.end]);
+        const crcBytes = Buffer.from(this.crc);
+        const ok = this.useCrc32
+          ? (~crc32Update(endByte, crc32Update(data)) >>> 0) === crcBytes.readUInt32LE(0)
+          : crc16(endByte, crc16(data)) === ((crcBytes[0] << 8) | crcBytes[1]);
+        if (!ok) {
+          this.fail("subpacket crc");
+          return;
+        }
+        const end = this.end;
+        this.state = end === ZCRCG || end === ZCRCQ ? S_DATA : S_SEEK;
+        this.dataLen = 0;
+        this.handlers.onData?.(Buffer.from(data), end);
+        return;
+      }
+      default:
+        this.state = S_SEEK;
+    }
+  }
+
+  emitHeader(type, p) {
+    this.state = FRAMES_WITH_DATA.has(type) ? S_DATA : S_SEEK;
+    this.dataLen = 0;
+    this.escaped = false;
+    this.handlers.onHeader?.(type, Buffer.from(p), this.useCrc32);
+  }
+}
+
+/**
+ * Shared plumbing: frame reader, idle timeout, the "OO" trailer and a
+ * single completion callback
+ */
+class ZmodemEngine {
+  constructor(options) {
+    this.write = options.write;
+    this.onEvent = options.onEvent || (() => {});
+    this.onDone = options.onDone || (() => {});
+    this.done = false;
+    this.inPush = false;
+    this.pendingEnd = undefined;
+    this.awaitingOver = false;
+    this.overTimer = null;
+    this.idleTimer = null;
+    this.reader = new FrameReader({
+      onHeader: (type, p, useCrc32) => this.handleHeader(type, p, useCrc32),
+      onData: (data, end) => this.handleData(data, end),
+      onError: (reason) => this.handleError(reason),
+      onCancel: () => this.end(new Error("Cancelled by remote")),
+    });
+    this.touch();
+  }
+
+  push(buf) {
+    if (this.done) return;
+    this.touch();
+    let offset = 0;
+    if (!this.awaitingOver) {
+      this.inPush = true;
+      try {
+        offset = this.reader.push(buf);
+      } finally {
+        this.inPush = false;
+      }
+      if (this.pendingEnd !== undefined) {
+        this.finish(this.pendingEnd, skipHeaderTail(buf, offset));
+        return;
+      }
+      if (this.done || !this.awaitingOver) return;
+    }
+    // After the closing ZFIN only its line end and the "OO" trailer belong to us
+    offset = skipHeaderTail(buf, offset, true);
+    while (offset < buf.length && buf[offset] === 0x4f && this.overSeen < 2) {
+      offset++;
+      this.overSeen++;
+    }
+    if (offset < buf.length || this.overSeen >= 2) {
+      this.finish(null, buf.subarray(offset));
+    }
+  }
+
+  /**
+   * Finish from inside a frame handler; bytes after the current frame go
+   * back to the terminal
+   */
+  end(err = null) {
+    if (!this.inPush) {
+      this.finish(err);
+      return;
+    }
+    this.pendingEnd = err;
+    this.reader.stop();
+  }
+
+  cancel() {
+    if (this.done) return;
+    void this.write(ABORT_SEQUENCE);
+    this.finish(new Error("Cancelled"));
+  }
+
+  touch() {
+    if (this.idleTimer) clearTimeout(this.idleTimer);
+    this.idleTimer = setTimeout(() => {
+      if (this.done) return;
+      void this.write(ABORT_SEQUENCE);
+      this.finish(new Error("Timed out waiting for the remote side"));
+    }, IDLE_TIMEOUT_MS);
+  }
+
+  sendHex(type, p = [0, 0, 0, 0]) {
+    return this.write(encodeHexHeader(type, p));
+  }
+
+  // Stop parsing and pass whatever follows the final ZFIN back to the terminal
+  expectOverAndOut() {
+    this.awaitingOver = true;
+    this.overSeen = 0;
+    this.reader.stop();
+    this.overTimer = setTimeout(() => this.finish(null), OVER_TIMEOUT_MS);
+  }
+
+  handleError() {}
+
+  finish(err, leftover = Buffer.alloc(0)) {
+    if (this.done) return;
+    this.done = true;
+    this.reader.stop();
+    if (this.idleTimer) clearTimeout(this.idleTimer);
+    if (this.overTimer) clearTimeout(this.overTimer);
+    this.cleanup?.(err);
+    this.onDone(err || null, leftover);
+  }
+}
+
+/**
+ * Offset past the CR/LF/XON that trail a hex header
+ */
+function skipHeaderTail(buf, offset, asOffset = false) {
+  let i = offset;
+  while (i < buf.length && (buf[i] === 0x0d || buf[i] === 0x0a || buf[i] === 0x8a || buf[i] === XON)) i++;
+  return asOffset ? i : buf.subarray(i);
+}
+
+function uniquePath(dir, name) {
+  const ext = path.extname(name);
+  const base = name.slice(0, name.length - ext.length);
+  let candidate = path.join(dir, name);
+  for (let i = 1; fs.existsSync(candidate); i++) {
+    candidate = path.join(dir, `${base} (${i})${ext}`);
+  }
+  return candidate;
+}
+
+function sanitizeFileName(name) {
+  const base = String(name || "").split(/[\\/]/).pop().replace(/[\x00-\x1f]/g, "").trim();
+  return !base || base === "." || base === ".." ? "download" : base;
+}
+
+/**
+ * Receives files from a remote `sz` into `saveDir`
+ *
+ * Events: file-start, progress, file-done, file-skipped.
+ * `pauseInput`/`resumeInput` let the caller stop reading the transport
+ * while the disk catches up.
+ */
+class ZmodemReceiver extends ZmodemEngine {
+  constructor(options) {
+    super(options);
+    this.saveDir = options.saveDir;
+    this.pauseInput = options.pauseInput || (() => {});
+    this.resumeInput = options.resumeInput || (() => {});
+    this.file = null;
+    this.pendingHeader = null;
+    this.acceptData = false;
+    this.inputPaused = false;
+  }
+
+  sendZrinit() {
+    return this.sendHex(FRAME.ZRINIT, [0, 0, 0, CANFDX | CANOVIO | CANFC32]);
+  }
+
+  sendPosition(type, pos) {
+    return this.sendHex(type, positionBytes(pos));
+  }
+
+  handleHeader(type, p) {
+    this.pendingHeader = type;
+    switch (type) {
+      case FRAME.ZRQINIT:
+        void this.sendZrinit();
+        break;
+      case FRAME.ZSINIT:
+      case FRAME.ZFILE:
+        // Answered once the data subpacket arrived
+        break;
+      case FRAME.ZDATA: {
+        const pos = readPosition(p);
+        this.acceptData = !!this.file && pos === this.file.received;
+        if (this.file && !this.acceptData) void this.sendPosition(FRAME.ZRPOS, this.file.received);
+        break;
+      }
+      case FRAME.ZEOF:
+        if (this.file && readPosition(p) === this.file.received) void this.completeFile();
+        break;
+      case FRAME.ZFIN:
+        void this.sendHex(FRAME.ZFIN);
+        this.expectOverAndOut();
+        break;
+      case FRAME.ZCOMMAND:
+        // Never run commands on behalf of the remote
+        void this.write(ABORT_SEQUENCE);
+        this.end(new Error("Remote requested command execution"));
+        break;
+      case FRAME.ZABORT:
+      case FRAME.ZCAN:
+        this.end(new Error("Cancelled by remote"));
+        break;
+      default:
+        break;
+    }
+  }
+
+  handleData(data, end) {
+    const header = this.pendingHeader;
+    if (header === FRAME.ZSINIT) {
+      void this.sendHex(FRAME.ZACK);
+      return;
+    }
+    if (header === FRAME.ZFILE) {
+      this.pendingHeader = null;
+      void this.openFile(data);
+      return;
+    }
+    if (header !== FRAME.ZDATA || !this.acceptData || !this.file) return;
+
+    const file = this.file;
+    file.received += data.length;
+    if (!file.stream.write(data) && !this.inputPaused) {
+      this.inputPaused = true;
+      this.pauseInput();
+      file.stream.once("drain", () => {
+        this.inputPaused = false;
+        this.resumeInput();
+      });
+    }
+    this.onEvent({ type: "progress", name: file.name, path: file.path, size: file.size, transferred: file.received });
+    if (end === ZCRCQ || end === ZCRCW) void this.sendPosition(FRAME.ZACK, file.received);
+  }
+
+  handleError() {
+    // Ask the sender to resume from the last byte we stored
+    if (this.file) {
+      this.acceptData = false;
+      void this.sendPosition(FRAME.ZRPOS, this.file.received);
+    }
+  }
+
+  async openFile(info) {
+    if (this.file) await this.closeFile();
+    const nul = info.indexOf(0);
+    const rawName = info.subarray(0, nul < 0 ? info.length : nul).toString("utf8");
+    const fields = nul < 0 ? [] : info.subarray(nul + 1).toString("ascii").replace(/\0.*$/s, "").trim().split(/\s+/);
+    const size = Number.parseInt(fields[0], 10);
+    const mtime = Number.parseInt(fields[1] || "0", 8);
+    const name = sanitizeFileName(rawName);
+
+    let filePath;
+    let stream;
+    try {
+      filePath = uniquePath(this.saveDir, name);
+      stream = fs.createWriteStream(filePath);
+      await new Promise((resolve, reject) => {
+        stream.once("open", resolve);
+        stream.once("error", reject);
+      });
+    } catch (err) {
+      this.onEvent({ type: "file-skipped", name, error: err.message });
+      void this.sendHex(FRAME.ZSKIP);
+      return;
+    }
+    stream.on("error", (err) => {
+      void this.write(ABORT_SEQUENCE);
+      this.finish(err);
+    });
+    this.file = {
+      name,
+      path: filePath,
+      size: Number.isFinite(size) ? size : 0,
+      mtime: Number.isFinite(mtime) ? mtime : 0,
+      received: 0,
+      stream,
+    };
+    this.onEvent({ type: "file-start", name, path: filePath, size: this.file.size });
+    void this.sendPosition(FRAME.ZRPOS, 0);
+  }
+
+  async closeFile() {
+    const file = this.file;
+    this.file = null;
+    this.acceptData = false;
+    if (!file) return null;
+    await new Promise((resolve) => file.stream.end(resolve));
+    if (this.inputPaused) {
+      this.inputPaused = false;
+      this.resumeInput();
+    }
+    if (file.mtime > 0) {
+      await fs.promises.utimes(file.path, file.mtime, file.mtime).catch(() => {});
+    }
+    return file;
+  }
+
+  async completeFile() {
+    const file = await this.closeFile();
+    if (this.done) return;
+    if (file) {
+      this.onEvent({ type: "file-done", name: file.name, path: file.path, size: file.received, transferred: file.received });
+    }
+    void this.sendZrinit();
+  }
+
+  cleanup(err) {
+    const file = this.file;
+    this.file = null;
+    if (!file) return;
+    file.stream.destroy();
+    // Do not leave a truncated file behind
+    if (err) fs.promises.unlink(file.path).catch(() => {});
+  }
+}
+
+/**
+ * Sends local files to a remote `rz`
+ *
+ * Events: file-start, progress, file-done, file-skipped.
+ */
+class ZmodemSender extends ZmodemEngine {
+  constructor(options) {
+    super(options);
+    this.files = [...options.files];
+    this.totalBytes = 0;
+    this.state = "wait-rinit";
+    this.current = null;
+    this.useCrc32 = false;
+    this.escapeCtl = false;
+    this.rxBufLen = 0;
+    this.blockSize = MAX_BLOCK;
+    this.ackedPos = 0;
+    this.restartPos = null;
+    this.pumping = false;
+    this.wake = null;
+  }
+
+  handleHeader(type, p) {
+    switch (type) {
+      case FRAME.ZRINIT:
+        this.rxFlags = p[3];
+        this.useCrc32 = (p[3] & CANFC32) !== 0;
+        this.escapeCtl = (p[3] & ESCCTL) !== 0;
+        this.rxBufLen = p[0] | (p[1] << 8);
+        if (this.rxBufLen > 0) this.blockSize = Math.min(MAX_BLOCK, this.rxBufLen);
+        if (this.state === "wait-rinit") {
+          void this.nextFile();
+        } else if (this.state === "wait-rpos") {
+          // Our ZFILE got lost; offer it again
+          void this.sendFileHeader();
+        } else if (this.state === "eof") {
+          this.fileDone();
+          void this.nextFile();
+        }
+        break;
+      case FRAME.ZRPOS: {
+        const pos = readPosition(p);
+        if (this.state === "wait-rpos" || this.state === "eof") {
+          void this.startData(pos);
+        } else if (this.state === "data") {
+          // Corrupted block: shrink blocks and resend from there
+          this.blockSize = Math.max(Math.min(MIN_BLOCK, this.blockSize), this.blockSize >> 1);
+          this.restartPos = pos;
+          this.wakeUp();
+        }
+        break;
+      }
+      case FRAME.ZACK:
+        this.ackedPos = Math.max(this.ackedPos, readPosition(p));
+        this.wakeUp();
+        break;
+      case FRAME.ZSKIP:
+        if (this.current) {
+          this.onEvent({ type: "file-skipped", name: this.current.name, path: this.current.path });
+          this.restartPos = null;
+          this.state = "skipped";
+          this.wakeUp();
+          void this.closeCurrent().then(() => this.nextFile());
+        }
+        break;
+      case FRAME.ZFIN:
+        if (this.state === "fin") {
+          void this.write(OVER_AND_OUT);
+          this.end(null);
+        }
+        break;
+      case FRAME.ZABORT:
+      case FRAME.ZFERR:
+      case FRAME.ZCAN:
+        this.end(new Error("Cancelled by remote"));
+        break;
+      case FRAME.ZNAK:
+        if (this.state === "wait-rpos") void this.sendFileHeader();
+        if (this.state === "fin") void this.sendHex(FRAME.ZFIN);
+        break;
+      default:
+        break;
+    }
+  }
+
+  handleData() {}
+
+  wakeUp() {
+    const wake = this.wake;
+    this.wake = null;
+    wake?.();
+  }
+
+  async nextFile() {
+    this.state = "opening";
+    const filePath = this.files.shift();
+    if (!filePath) {
+      this.state = "fin";
+      void this.sendHex(FRAME.ZFIN);
+      return;
+    }
+    try {
+      const stat = await fs.promises.stat(filePath);
+      const handle = await fs.promises.open(filePath, "r");
+      this.current = {
+        name: path.basename(filePath),
+        path: filePath,
+        size: stat.size,
+        mtime: Math.floor(stat.mtimeMs / 1000),
+        mode: stat.mode,
+        handle,
+        sent: 0,
+      };
+    } catch (err) {
+      this.onEvent({ type: "file-skipped", name: path.basename(filePath), path: filePath, error: err.message });
+      return this.nextFile();
+    }
+    this.onEvent({ type: "file-start", name: this.current.name, path: filePath, size: this.current.size });
+    return this.sendFileHeader();
+  }
+
+  sendFileHeader() {
+    const file = this.current;
+    if (!file || this.done) return Promise.resolve();
+    this.state = "wait-rpos";
+    const remaining = this.files.length;
+    const info = Buffer.concat([
+      Buffer.from(file.name, "utf8"),
+      Buffer.from([0]),
+      Buffer.from(`${file.size} ${file.mtime.toString(8)} ${file.mode.toString(8)} 0 ${remaining + 1} ${file.size}`, "ascii"),
+      Buffer.from([0]),
+    ]);
+    return this.write(Buffer.concat([
+      encodeBinHeader(FRAME.ZFILE, [0, 0, 0, 0], this.useCrc32, this.escapeCtl),
+      encodeSubpacket(info, ZCRCW, this.useCrc32, this.escapeCtl),
+    ]));
+  }
+
+  async startData(pos) {
+    this.restartPos = pos;
+    this.state = "data";
+    if (this.pumping) {
+      this.wakeUp();
+      return;
+    }
+    const file = this.current;
+    this.pumping = true;
+    try {
+      await this.pump();
+    } catch (err) {
+      // A skipped file closes its handle under a pending read
+      if (this.current !== file || this.done) return;
+      void this.write(ABORT_SEQUENCE);
+      this.finish(err);
+    } finally {
+      this.pumping = false;
+    }
+  }
+
+  waitForAck() {
+    return new Promise((resolve) => {
+      this.wake = resolve;
+    });
+  }
+
+  async pump() {
+    const file = this.current;
+    const buffer = Buffer.allocUnsafe(MAX_BLOCK);
+    let pos = 0;
+    let sinceAck = 0;
+    let needHeader = true;
+
+    while (!this.done && this.state === "data" && this.current === file) {
+      if (this.restartPos !== null) {
+        pos = this.restartPos;
+        this.ackedPos = pos;
+        this.restartPos = null;
+        needHeader = true;
+      }
+      if (needHeader) {
+        sinceAck = 0;
+        needHeader = false;
+        if (!(await this.write(encodeBinHeader(FRAME.ZDATA, positionBytes(pos), this.useCrc32, this.escapeCtl)))) {
+          throw new Error("Connection closed");
+        }
+      }
+      if (this.current !== file) return;
+
+      const { bytesRead } = await file.handle.read(buffer, 0, Math.min(this.blockSize, Math.max(file.size - pos, 0)), pos);
+      const chunk = buffer.subarray(0, bytesRead);
+      const last = pos + bytesRead >= file.size;
+      sinceAck += bytesRead;
+
+      let end = ZCRCG;
+      if (last) end = ZCRCE;
+      else if (this.rxBufLen > 0 && sinceAck + this.blockSize > this.rxBufLen) end = ZCRCW;
+      else if (sinceAck >= ACK_INTERVAL) end = ZCRCQ;
+
+      if (!(await this.write(encodeSubpacket(chunk, end, this.useCrc32, this.escapeCtl)))) {
+        throw new Error("Connection closed");
+      }
+      // Slow links can go a long time between acknowledgements
+      this.touch();
+      pos += bytesRead;
+      file.sent = pos;
+      this.onEvent({ type: "progress", name: file.name, path: file.path, size: file.size, transferred: pos });
+
+      if (last) {
+        if (this.restartPos !== null) continue;
+        this.state = "eof";
+        await this.write(encodeBinHeader(FRAME.ZEOF, positionBytes(pos), this.useCrc32, this.escapeCtl));
+        return;
+      }
+      if (end === ZCRCQ) sinceAck = 0;
+      if (end === ZCRCW) {
+        needHeader = true;
+        while (!this.done && this.restartPos === null && this.ackedPos < pos && this.current === file) {
+          await this.waitForAck();
+        }
+      }
+      // Keep at most one window of unacknowledged data in flight
+      while (!this.done && this.restartPos === null && pos - this.ackedPos > STREAM_WINDOW && this.current === file) {
+        await this.waitForAck();
+      }
+    }
+  }
+
+  fileDone() {
+    const file = this.current;
+    if (!file) return;
+    this.onEvent({ type: "file-done", name: file.name, path: file.path, size: file.size, transferred: file.size });
+    void this.closeCurrent();
+  }
+
+  async closeCurrent() {
+    const file = this.current;
+    this.current = null;
+    await file?.handle.close().catch(() => {});
+  }
+
+  cleanup() {
+    this.wakeUp();
+    void this.closeCurrent();
+  }
+}
+
+/**
+ * Find a ZMODEM start in `buf`. Returns { index, direction } where
+ * direction is "download" for a remote `sz` and "upload" for a remote `rz`.
+ */
+function detect(buf) {
+  const rq = buf.indexOf(ZRQINIT_TRIGGER);
+  const ri = buf.indexOf(ZRINIT_TRIGGER);
+  if (rq < 0 && ri < 0) return null;
+  const download = ri < 0 || (rq >= 0 && rq < ri);
+  let index = download ? rq : ri;
+  // Keep the whole "**" with the header
+  while (index > 0 && buf[index - 1] === ZPAD) index--;
+  return { index, direction: download ? "download" : "upload" };
+}
+
+module.exports = {
+  FRAME,
+  ZRQINIT_TRIGGER,
+  ZRINIT_TRIGGER,
+  ABORT_SEQUENCE,
+  FrameReader,
+  ZmodemReceiver,
+  ZmodemSender,
+  encodeHexHeader,
+  encodeBinHeader,
+  encodeSubpacket,
+  crc16,
+  detect,
+  sanitizeFileName,
+  uniquePath,
+};
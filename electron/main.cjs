@@ -10,6 +10,9 @@
  * - transferBridge.cjs: File transfers with progress
  * - portForwardingBridge.cjs: SSH port forwarding tunnels
  * - terminalBridge.cjs: Local shell, telnet, and mosh sessions
+ * - inbandTransferBridge.cjs: ZMODEM/trzsz transfers over the terminal stream
+ * - tmuxBridge.cjs: tmux control mode, remote panes as native tabs and splits
+ * - sessionMetricsBridge.cjs: Per-session traffic and keystroke echo latency
  * - windowManager.cjs: Electron window management
  */
 
@@ -25,6 +28,11 @@ process.on('uncaughtException', (err) => {
     return;
   }
   console.error('Uncaught exception:', err);
+  try {
+    require("./bridges/logBridge.cjs").dumpCrash("uncaughtException", err);
+  } catch {
+    // Never mask the original error
+  }
   throw err;
 });
 
@@ -71,6 +79,9 @@ const localFsBridge = require("./bridges/localFsBridge.cjs");
 const transferBridge = require("./bridges/transferBridge.cjs");
 const portForwardingBridge = require("./bridges/portForwardingBridge.cjs");
 const terminalBridge = require("./bridges/terminalBridge.cjs");
+const inbandTransferBridge = require("./bridges/inbandTransferBridge.cjs");
+const tmuxBridge = require("./bridges/tmuxBridge.cjs");
+const sessionMetricsBridge = require("./bridges/sessionMetricsBridge.cjs");
 const oauthBridge = require("./bridges/oauthBridge.cjs");
 const githubAuthBridge = require("./bridges/githubAuthBridge.cjs");
 const googleAuthBridge = require("./bridges/googleAuthBridge.cjs");
@@ -80,8 +91,19 @@ const fileWatcherBridge = require("./bridges/fileWatcherBridge.cjs");
 const tempDirBridge = require("./bridges/tempDirBridge.cjs");
 const sessionLogsBridge = require("./bridges/sessionLogsBridge.cjs");
 const compressUploadBridge = require("./bridges/compressUploadBridge.cjs");
+const reachabilityBridge = require("./bridges/reachabilityBridge.cjs");
+const remoteCapabilities = require("./bridges/remoteCapabilities.cjs");
+const ipcStatsBridge = require("./bridges/ipcStatsBridge.cjs");
+const ipcBatchBridge = require("./bridges/ipcBatchBridge.cjs");
+const logBridge = require("./bridges/logBridge.cjs");
+const { getFastTransferOptions } = require("./bridges/sftpPipeline.cjs");
 const windowManager = require("./bridges/windowManager.cjs");
 
+// Time and size every IPC channel; must run before any handler is registered
+ipcStatsBridge.instrument(electronModule);
+// Load log levels and hook crash dumps before anything starts logging
+logBridge.init({ electronModule });
+
 // GPU settings
 // NOTE: Do not disable Chromium sandbox by default.
 // If you need to debug with sandbox disabled, set NETCATTY_NO_SANDBOX=1.
@@ -293,6 +315,49 @@ const writeKeyToDisk = (keyId, privateKey) => {
 // Track if bridges are registered
 let bridgesRegistered = false;
 
+// Small files next to a file opened with an external app are likely opened
+// next (logs, configs); pull a few into the content cache in the background.
+const PREFETCH_MAX_FILES = 8;
+const PREFETCH_MAX_FILE_BYTES = 256 * 1024;
+
+// Encoded directories are Buffers for non-ASCII paths in non-UTF-8 encodings;
+// `name` is ASCII, so its bytes are the same in every encoding
+function joinEncodedPath(encodedDir, name) {
+  if (!Buffer.isBuffer(encodedDir)) return path.posix.join(encodedDir, name);
+  const separator = encodedDir[encodedDir.length - 1] === 0x2f ? "" : "/";
+  return Buffer.concat([encodedDir, Buffer.from(`${separator}${name}`, "latin1")]);
+}
+
+async function prefetchSiblingsToContentCache(sftpClient, hostKey, remotePath, sftpId, encoding) {
+  try {
+    const sftpBridge = require("./bridges/sftpBridge.cjs");
+    const dir = path.posix.dirname(remotePath);
+    const encodedDir = sftpBridge.encodePathForSession(sftpId, dir, encoding);
+    const entries = await sftpClient.list(encodedDir);
+    const candidates = entries
+      .filter((entry) =>
+        entry.type === "-" &&
+        entry.size > 0 &&
+        entry.size <= PREFETCH_MAX_FILE_BYTES &&
+        // ASCII names encode identically in every supported filename encoding
+        /^[\x20-\x7E]+$/.test(entry.name) &&
+        path.posix.join(dir, entry.name) !== remotePath)
+      .sort((a, b) => b.modifyTime - a.modifyTime)
+      .slice(0, PREFETCH_MAX_FILES);
+
+    for (const entry of candidates) {
+      if (!sftpClients.has(sftpId)) return;
+      // Keyed by the decoded path like downloadToTemp; fetched by the encoded one
+      const key = tempDirBridge.makeContentCacheKey(hostKey, path.posix.join(dir, entry.name), entry.size, entry.modifyTime);
+      if (await tempDirBridge.hasContentCacheEntry(key)) continue;
+      const encodedPath = joinEncodedPath(encodedDir, entry.name);
+      await tempDirBridge.fillContentCacheEntry(key, (filePath) => sftpClient.fastGet(encodedPath, filePath));
+    }
+  } catch (err) {
+    console.warn(`[Main] Sibling prefetch failed: ${err.message}`);
+  }
+}
+
 /**
  * Register all IPC bridges with Electron
  */
@@ -359,16 +424,22 @@ const registerBridges = (win) => {
     electronModule,
   };
 
+  remoteCapabilities.init(deps);
+  reachabilityBridge.init(deps);
   sshBridge.init(deps);
   sftpBridge.init(deps);
   transferBridge.init(deps);
   terminalBridge.init(deps);
+  inbandTransferBridge.init(deps);
+  tmuxBridge.init(deps);
+  sessionMetricsBridge.init(deps);
   fileWatcherBridge.init(deps);
   
   // Initialize compress upload bridge with transferBridge dependency
   compressUploadBridge.init({
     ...deps,
     transferBridge,
+    sftpBridge,
   });
 
   // Initialize temp directory (synchronously)
@@ -381,6 +452,9 @@ const registerBridges = (win) => {
   transferBridge.registerHandlers(ipcMain);
   portForwardingBridge.registerHandlers(ipcMain);
   terminalBridge.registerHandlers(ipcMain);
+  inbandTransferBridge.registerHandlers(ipcMain);
+  tmuxBridge.registerHandlers(ipcMain);
+  sessionMetricsBridge.registerHandlers(ipcMain);
   oauthBridge.setupOAuthBridge(ipcMain);
   githubAuthBridge.registerHandlers(ipcMain);
   googleAuthBridge.registerHandlers(ipcMain, electronModule);
@@ -390,6 +464,10 @@ const registerBridges = (win) => {
   tempDirBridge.registerHandlers(ipcMain, shell);
   sessionLogsBridge.registerHandlers(ipcMain);
   compressUploadBridge.registerHandlers(ipcMain);
+  reachabilityBridge.registerHandlers(ipcMain);
+  ipcStatsBridge.registerHandlers(ipcMain);
+  ipcBatchBridge.registerHandlers(ipcMain);
+  logBridge.registerHandlers(ipcMain);
 
   // Settings window handler
   ipcMain.handle("netcatty:settings:open", async () => {
@@ -612,7 +690,44 @@ const registerBridges = (win) => {
     const encodedPath = client.encodePathForSession
       ? client.encodePathForSession(sftpId, remotePath, encoding)
       : remotePath;
-    await sftpClient.fastGet(encodedPath, localPath);
+
+    // Reuse a cached copy when the remote size/mtime are unchanged
+    const hostKey = client.getSessionHostKey ? client.getSessionHostKey(sftpId) : null;
+    let cacheKey = null;
+    if (hostKey) {
+      try {
+        const stat = await sftpClient.stat(encodedPath);
+        // Files larger than the whole cache skip it and go straight to a temp file
+        if (tempDirBridge.fitsContentCache(stat.size)) {
+          cacheKey = tempDirBridge.makeContentCacheKey(hostKey, remotePath, stat.size, stat.modifyTime);
+        }
+        const cachedPath = cacheKey && await tempDirBridge.openContentCacheEntry(cacheKey, fileName);
+        if (cachedPath) {
+          console.log(`[Main]   Served from content cache: ${cachedPath}`);
+          return cachedPath;
+        }
+      } catch (err) {
+        console.warn(`[Main]   Content cache lookup failed: ${err.message}`);
+        cacheKey = null;
+      }
+    }
+
+    const fastGetOptions = getFastTransferOptions(sftpClient.sftp);
+    if (!cacheKey) {
+      await sftpClient.fastGet(encodedPath, localPath, fastGetOptions);
+      console.log(`[Main]   File downloaded successfully`);
+      return localPath;
+    }
+
+    await tempDirBridge.fillContentCacheEntry(cacheKey, (filePath) => sftpClient.fastGet(encodedPath, filePath, fastGetOptions));
+    void prefetchSiblingsToContentCache(sftpClient, hostKey, remotePath, sftpId, encoding);
+    const cachedPath = await tempDirBridge.openContentCacheEntry(cacheKey, fileName);
+    if (cachedPath) {
+      console.log(`[Main]   File downloaded successfully (cached)`);
+      return cachedPath;
+    }
+    // The entry went away before it could be opened; download directly
+    await sftpClient.fastGet(encodedPath, localPath, fastGetOptions);
     console.log(`[Main]   File downloaded successfully`);
     return localPath;
   });
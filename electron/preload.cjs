@@ -7,11 +7,17 @@ const transferCompleteListeners = new Map();
 const transferErrorListeners = new Map();
 const chainProgressListeners = new Map();
 const authFailedListeners = new Map();
+const inbandTransferListeners = new Map();
 const languageChangeListeners = new Set();
 const fullscreenChangeListeners = new Set();
 const keyboardInteractiveListeners = new Set();
 const passphraseListeners = new Set();
 const passphraseTimeoutListeners = new Set();
+const reachabilityListeners = new Set();
+const connectTimingListeners = new Set();
+const tmuxEventListeners = new Set();
+const sessionMetricsListeners = new Set();
+const logConfigListeners = new Set();
 
 ipcRenderer.on("netcatty:data", (_event, payload) => {
   const set = dataListeners.get(payload.sessionId);
@@ -40,6 +46,19 @@ ipcRenderer.on("netcatty:exit", (_event, payload) => {
   exitListeners.delete(payload.sessionId);
 });
 
+// ZMODEM/trzsz transfers running inside a terminal session
+ipcRenderer.on("netcatty:inband:transfer", (_event, payload) => {
+  const set = inbandTransferListeners.get(payload.sessionId);
+  if (!set) return;
+  set.forEach((cb) => {
+    try {
+      cb(payload);
+    } catch (err) {
+      console.error("In-band transfer callback failed", err);
+    }
+  });
+});
+
 // Chain progress events (for jump host connections)
 ipcRenderer.on("netcatty:chain:progress", (_event, payload) => {
   const { hop, total, label, status } = payload;
@@ -53,6 +72,68 @@ ipcRenderer.on("netcatty:chain:progress", (_event, payload) => {
   });
 });
 
+// Log level changes (broadcast to every window)
+ipcRenderer.on("netcatty:log:config", (_event, payload) => {
+  logConfigListeners.forEach((cb) => {
+    try {
+      cb(payload);
+    } catch (err) {
+      console.error("Log config callback failed", err);
+    }
+  });
+});
+
+// Reachability scan results (batched by the main process)
+ipcRenderer.on("netcatty:reachability:update", (_event, payload) => {
+  reachabilityListeners.forEach((cb) => {
+    try {
+      cb({ type: "update", results: payload.results });
+    } catch (err) {
+      console.error("Reachability callback failed", err);
+    }
+  });
+});
+
+ipcRenderer.on("netcatty:reachability:done", (_event, payload) => {
+  reachabilityListeners.forEach((cb) => {
+    try {
+      cb({ type: "done", cancelled: payload.cancelled });
+    } catch (err) {
+      console.error("Reachability callback failed", err);
+    }
+  });
+});
+
+ipcRenderer.on("netcatty:connect:timing", (_event, payload) => {
+  connectTimingListeners.forEach((cb) => {
+    try {
+      cb(payload);
+    } catch (err) {
+      console.error("Connect timing callback failed", err);
+    }
+  });
+});
+
+ipcRenderer.on("netcatty:tmux:event", (_event, payload) => {
+  tmuxEventListeners.forEach((cb) => {
+    try {
+      cb(payload);
+    } catch (err) {
+      console.error("tmux event callback failed", err);
+    }
+  });
+});
+
+ipcRenderer.on("netcatty:session:metrics", (_event, payload) => {
+  sessionMetricsListeners.forEach((cb) => {
+    try {
+      cb(payload.metrics);
+    } catch (err) {
+      console.error("Session metrics callback failed", err);
+    }
+  });
+});
+
 ipcRenderer.on("netcatty:languageChanged", (_event, language) => {
   languageChangeListeners.forEach((cb) => {
     try {
@@ -312,6 +393,49 @@ ipcRenderer.on("netcatty:filewatch:error", (_event, payload) => {
   });
 });
 
+// Batched invokes: calls issued in the same tick share one IPC message.
+// Must stay below MAX_BATCH_CALLS in ipcBatchBridge.cjs
+const BATCH_MAX_CALLS = 1000;
+let pendingBatch = null;
+
+const flushBatch = () => {
+  const calls = pendingBatch;
+  pendingBatch = null;
+  if (!calls || calls.length === 0) return;
+
+  // A lone call goes out on its own channel, exactly as before
+  if (calls.length === 1) {
+    const [call] = calls;
+    ipcRenderer.invoke(call.channel, call.payload).then(call.resolve, call.reject);
+    return;
+  }
+
+  ipcRenderer
+    .invoke("netcatty:batch:invoke", {
+      calls: calls.map(({ channel, payload }) => ({ channel, payload })),
+    })
+    .then(
+      (results) => {
+        calls.forEach((call, index) => {
+          const result = results[index];
+          if (result?.ok) call.resolve(result.value);
+          else call.reject(new Error(result?.error || "Batched call failed"));
+        });
+      },
+      (err) => calls.forEach((call) => call.reject(err)),
+    );
+};
+
+const batchedInvoke = (channel, payload) =>
+  new Promise((resolve, reject) => {
+    if (!pendingBatch) {
+      pendingBatch = [];
+      queueMicrotask(flushBatch);
+    }
+    pendingBatch.push({ channel, payload, resolve, reject });
+    if (pendingBatch.length >= BATCH_MAX_CALLS) flushBatch();
+  });
+
 const api = {
   startSSHSession: async (options) => {
     const result = await ipcRenderer.invoke("netcatty:start", options);
@@ -345,15 +469,48 @@ const api = {
   writeToSession: (sessionId, data) => {
     ipcRenderer.send("netcatty:write", { sessionId, data });
   },
+  writeToSessionDrained: async (sessionId, data) => {
+    const result = await ipcRenderer.invoke("netcatty:writeDrained", { sessionId, data });
+    return !!result?.ok;
+  },
   execCommand: async (options) => {
     return ipcRenderer.invoke("netcatty:ssh:exec", options);
   },
+  tuneSshTransport: async (options) => {
+    return ipcRenderer.invoke("netcatty:ssh:tuneTransport", options);
+  },
   getSessionPwd: async (sessionId) => {
     return ipcRenderer.invoke("netcatty:ssh:pwd", { sessionId });
   },
+  tmuxAttach: async (options) => {
+    return ipcRenderer.invoke("netcatty:tmux:attach", options);
+  },
+  tmuxAttachPane: async (sessionId) => {
+    return ipcRenderer.invoke("netcatty:tmux:attachPane", { sessionId });
+  },
+  tmuxCommand: async (options) => {
+    return ipcRenderer.invoke("netcatty:tmux:command", options);
+  },
+  tmuxDetach: async (controlId) => {
+    return ipcRenderer.invoke("netcatty:tmux:detach", { controlId });
+  },
+  onTmuxEvent: (cb) => {
+    tmuxEventListeners.add(cb);
+    return () => tmuxEventListeners.delete(cb);
+  },
+  getSessionMetrics: async () => {
+    return ipcRenderer.invoke("netcatty:session:metrics:get");
+  },
+  onSessionMetrics: (cb) => {
+    sessionMetricsListeners.add(cb);
+    return () => sessionMetricsListeners.delete(cb);
+  },
   getServerStats: async (sessionId) => {
     return ipcRenderer.invoke("netcatty:ssh:stats", { sessionId });
   },
+  getSessionCapabilities: async (sessionId, force) => {
+    return ipcRenderer.invoke("netcatty:ssh:capabilities", { sessionId, force });
+  },
   generateKeyPair: async (options) => {
     return ipcRenderer.invoke("netcatty:key:generate", options);
   },
@@ -379,6 +536,17 @@ const api = {
     exitListeners.get(sessionId).add(cb);
     return () => exitListeners.get(sessionId)?.delete(cb);
   },
+  onInbandTransfer: (sessionId, cb) => {
+    if (!inbandTransferListeners.has(sessionId)) inbandTransferListeners.set(sessionId, new Set());
+    inbandTransferListeners.get(sessionId).add(cb);
+    return () => {
+      inbandTransferListeners.get(sessionId)?.delete(cb);
+      if (inbandTransferListeners.get(sessionId)?.size === 0) {
+        inbandTransferListeners.delete(sessionId);
+      }
+    };
+  },
+  cancelInbandTransfer: (sessionId) => ipcRenderer.invoke("netcatty:inband:cancel", { sessionId }),
   onAuthFailed: (sessionId, cb) => {
     if (!authFailedListeners.has(sessionId)) authFailedListeners.set(sessionId, new Set());
     authFailedListeners.get(sessionId).add(cb);
@@ -442,19 +610,19 @@ const api = {
     return ipcRenderer.invoke("netcatty:sftp:close", { sftpId });
   },
   mkdirSftp: async (sftpId, path, encoding) => {
-    return ipcRenderer.invoke("netcatty:sftp:mkdir", { sftpId, path, encoding });
+    return batchedInvoke("netcatty:sftp:mkdir", { sftpId, path, encoding });
   },
   deleteSftp: async (sftpId, path, encoding) => {
-    return ipcRenderer.invoke("netcatty:sftp:delete", { sftpId, path, encoding });
+    return batchedInvoke("netcatty:sftp:delete", { sftpId, path, encoding });
   },
   renameSftp: async (sftpId, oldPath, newPath, encoding) => {
-    return ipcRenderer.invoke("netcatty:sftp:rename", { sftpId, oldPath, newPath, encoding });
+    return batchedInvoke("netcatty:sftp:rename", { sftpId, oldPath, newPath, encoding });
   },
   statSftp: async (sftpId, path, encoding) => {
-    return ipcRenderer.invoke("netcatty:sftp:stat", { sftpId, path, encoding });
+    return batchedInvoke("netcatty:sftp:stat", { sftpId, path, encoding });
   },
   chmodSftp: async (sftpId, path, mode, encoding) => {
-    return ipcRenderer.invoke("netcatty:sftp:chmod", { sftpId, path, mode, encoding });
+    return batchedInvoke("netcatty:sftp:chmod", { sftpId, path, mode, encoding });
   },
   // Write binary with real-time progress callback
   writeSftpBinaryWithProgress: async (sftpId, path, content, transferId, encoding, onProgress, onComplete, onError) => {
@@ -483,6 +651,9 @@ const api = {
   listLocalDir: async (path) => {
     return ipcRenderer.invoke("netcatty:local:list", { path });
   },
+  listLocalDirPage: async (path, offset, limit, force, generation) => {
+    return ipcRenderer.invoke("netcatty:local:listPage", { path, offset, limit, force, generation });
+  },
   readLocalFile: async (path) => {
     return ipcRenderer.invoke("netcatty:local:read", { path });
   },
@@ -599,6 +770,8 @@ const api = {
     ipcRenderer.invoke("netcatty:cloudSync:webdav:upload", { config, syncedFile }),
   cloudSyncWebdavDownload: (config) =>
     ipcRenderer.invoke("netcatty:cloudSync:webdav:download", { config }),
+  cloudSyncWebdavRevision: (config) =>
+    ipcRenderer.invoke("netcatty:cloudSync:webdav:revision", { config }),
   cloudSyncWebdavDelete: (config) =>
     ipcRenderer.invoke("netcatty:cloudSync:webdav:delete", { config }),
 
@@ -608,6 +781,8 @@ const api = {
     ipcRenderer.invoke("netcatty:cloudSync:s3:upload", { config, syncedFile }),
   cloudSyncS3Download: (config) =>
     ipcRenderer.invoke("netcatty:cloudSync:s3:download", { config }),
+  cloudSyncS3Revision: (config) =>
+    ipcRenderer.invoke("netcatty:cloudSync:s3:revision", { config }),
   cloudSyncS3Delete: (config) =>
     ipcRenderer.invoke("netcatty:cloudSync:s3:delete", { config }),
   
@@ -654,6 +829,37 @@ const api = {
     };
   },
 
+  onConnectTiming: (cb) => {
+    connectTimingListeners.add(cb);
+    return () => connectTimingListeners.delete(cb);
+  },
+
+  // Vault reachability scanner
+  startReachabilityScan: (options) => ipcRenderer.invoke("netcatty:reachability:scan", options),
+  cancelReachabilityScan: () => ipcRenderer.invoke("netcatty:reachability:cancel"),
+  getReachabilityResults: () => ipcRenderer.invoke("netcatty:reachability:results"),
+  onReachabilityEvent: (cb) => {
+    reachabilityListeners.add(cb);
+    return () => reachabilityListeners.delete(cb);
+  },
+
+  // IPC instrumentation
+  getIpcStats: () => ipcRenderer.invoke("netcatty:ipcStats:get"),
+  resetIpcStats: () => ipcRenderer.invoke("netcatty:ipcStats:reset"),
+  exportIpcStats: (filePath) => ipcRenderer.invoke("netcatty:ipcStats:export", { filePath }),
+
+  // Structured logging
+  getLogConfig: () => ipcRenderer.invoke("netcatty:log:getConfig"),
+  setLogConfig: (config) => ipcRenderer.invoke("netcatty:log:setConfig", config),
+  getRecentLogs: (limit) => ipcRenderer.invoke("netcatty:log:getRecent", { limit }),
+  appendLogs: (entries) => ipcRenderer.send("netcatty:log:append", entries),
+  exportDiagnosticsBundle: (filePath, renderer) =>
+    ipcRenderer.invoke("netcatty:log:exportBundle", { filePath, renderer }),
+  onLogConfigChanged: (cb) => {
+    logConfigListeners.add(cb);
+    return () => logConfigListeners.delete(cb);
+  },
+
   // OAuth callback server
   startOAuthCallback: (expectedState) => ipcRenderer.invoke("oauth:startCallback", expectedState),
   cancelOAuthCallback: () => ipcRenderer.invoke("oauth:cancelCallback"),
@@ -679,6 +885,8 @@ const api = {
     ipcRenderer.invoke("netcatty:google:drive:updateSyncFile", options),
   googleDriveDownloadSyncFile: (options) =>
     ipcRenderer.invoke("netcatty:google:drive:downloadSyncFile", options),
+  googleDriveGetSyncFileRevision: (options) =>
+    ipcRenderer.invoke("netcatty:google:drive:getSyncFileRevision", options),
   googleDriveDeleteSyncFile: (options) =>
     ipcRenderer.invoke("netcatty:google:drive:deleteSyncFile", options),
 
@@ -695,6 +903,8 @@ const api = {
     ipcRenderer.invoke("netcatty:onedrive:drive:uploadSyncFile", options),
   onedriveDownloadSyncFile: (options) =>
     ipcRenderer.invoke("netcatty:onedrive:drive:downloadSyncFile", options),
+  onedriveGetSyncFileRevision: (options) =>
+    ipcRenderer.invoke("netcatty:onedrive:drive:getSyncFileRevision", options),
   onedriveDeleteSyncFile: (options) =>
     ipcRenderer.invoke("netcatty:onedrive:drive:deleteSyncFile", options),
 
@@ -13,11 +13,75 @@ declare global {
 
   // Proxy configuration for SSH connections
   interface NetcattyProxyConfig {
-    type: 'http' | 'socks5';
+    type: 'http' | 'socks5' | 'wan';
     host: string;
     port: number;
     username?: string;
     password?: string;
+    // Link shaping when type is 'wan'
+    wan?: {
+      latencyMs?: number;
+      jitterMs?: number;
+      bandwidthKbps?: number;
+      lossPercent?: number;
+    };
+  }
+
+  // SSH connect-time breakdown reported once a session is ready (milliseconds)
+  interface NetcattyConnectTiming {
+    dnsMs: number;
+    tcpMs: number;
+    kexMs: number;
+    authMs: number;
+    totalMs: number;
+    address?: string;
+    dnsCached?: boolean;
+    tunneled?: boolean;
+  }
+
+  // tmux control mode: a window's pane tree. Splits use Netcatty's naming
+  // ('vertical' = side by side); sizes are in cells.
+  type NetcattyTmuxLayoutNode =
+    | { type: 'pane'; paneId: string; sessionId: string; width: number; height: number }
+    | { type: 'split'; direction: 'horizontal' | 'vertical'; width: number; height: number; children: NetcattyTmuxLayoutNode[] };
+
+  interface NetcattyTmuxWindow {
+    windowId: string; // "@3"
+    name: string;
+    active: boolean;
+    layout: NetcattyTmuxLayoutNode;
+  }
+
+  type NetcattyTmuxEvent =
+    | { controlId: string; type: 'window'; window: NetcattyTmuxWindow }
+    | { controlId: string; type: 'window-close'; windowId: string }
+    | { controlId: string; type: 'exit'; reason: string | null };
+
+  // Per-session traffic (bytes, bytes/s) and smoothed keystroke-to-echo RTT
+  interface NetcattySessionMetrics {
+    sessionId: string;
+    bytesIn: number;
+    bytesOut: number;
+    rateIn: number;
+    rateOut: number;
+    rttMs: number | null;
+    startedAt: number;
+  }
+
+  // Per-host SSH transport choices picked by the "tune" throughput test
+  interface NetcattyTransportProfile {
+    cipher: 'aes-gcm' | 'chacha20';
+    compression: boolean;
+    windowSize: number; // channel receive window in bytes (ssh2 default 2 MB)
+    throughput?: number; // bytes/s measured with this profile
+    tunedAt?: number;
+  }
+
+  interface NetcattyTransportTuneResult {
+    success: boolean;
+    error?: string;
+    profile?: NetcattyTransportProfile;
+    results?: Array<{ profile: NetcattyTransportProfile; bytesPerSecond?: number; error?: string }>;
   }
 
   // Jump host configuration for SSH tunneling
@@ -72,8 +136,12 @@ declare global {
     jumpHosts?: NetcattyJumpHost[];
     // SSH-level keepalive interval in seconds (0 = disabled)
     keepaliveInterval?: number;
+    // Cipher/compression/window profile for this host
+    transportProfile?: NetcattyTransportProfile;
     // Use sudo for SFTP server
     sudo?: boolean;
+    // Upload to a temp file, then rename over the target (posix-rename)
+    atomicUpload?: boolean;
   }
 
   interface SftpStatResult {
@@ -86,6 +154,114 @@ declare global {
     group?: string;
   }
 
+  /**
+   * One page of a local directory listing as parallel columns.
+   * kinds: 0 file, 1 directory, 2 symlink; linkTargets: 0 none/broken, 1 file, 2 directory
+   */
+  interface LocalDirPage {
+    names: string[];
+    kinds: Uint8Array;
+    linkTargets: Uint8Array;
+    sizes: Float64Array;
+    mtimes: Float64Array; // ms since epoch
+    hidden: Uint8Array;
+    total: number;
+    nextOffset: number | null;
+    // Identifies the listing the page was cut from; pass it back for later pages
+    generation: number;
+    // The directory changed since `generation`; list again from offset 0
+    restart?: boolean;
+  }
+
+  /** A known host key: the full base64 blob, or its SHA256 fingerprint */
+  interface ReachabilityKnownKey {
+    keyType?: string;
+    blob?: string;
+    fingerprint?: string;
+  }
+
+  interface ReachabilityTarget {
+    hostId: string;
+    hostname: string;
+    port: number;
+    proxy?: NetcattyProxyConfig;
+    jumpHosts?: NetcattyJumpHost[];
+    /** Comparable host keys from known hosts */
+    knownKeys?: ReachabilityKnownKey[];
+  }
+
+  interface HostReachability {
+    hostId: string;
+    status: 'up' | 'down' | 'unknown';
+    rttMs: number | null;
+    lastSeen: number | null;
+    banner: string | null;
+    hostKey: 'match' | 'mismatch' | 'unknown' | null;
+    checkedAt: number | null;
+    error: string | null;
+  }
+
+  /** Per-channel IPC instrumentation recorded in the main process */
+  interface IpcChannelStats {
+    channel: string;
+    /** handle = invoke, on = renderer send, event = main -> renderer send */
+    kind: 'handle' | 'on' | 'event';
+    calls: number;
+    errors: number;
+    inFlight: number;
+    maxInFlight: number;
+    latency: { totalMs: number; meanMs: number; p50Ms: number; p90Ms: number; p99Ms: number; maxMs: number };
+    request: { totalBytes: number; meanBytes: number; maxBytes: number };
+    response: { totalBytes: number; meanBytes: number; maxBytes: number };
+    /** Non-empty histogram buckets as [upperBoundMs, count] */
+    histogram: Array<[number, number]>;
+  }
+
+  interface IpcStatsSnapshot {
+    startedAt: number;
+    uptimeMs: number;
+    channels: IpcChannelStats[];
+  }
+
+  type LogLevel = 'debug' | 'info' | 'warn' | 'error' | 'off';
+
+  interface LogConfig {
+    level: LogLevel;
+    /** Per-category overrides, e.g. { Telnet: 'debug' } */
+    categories: Record<string, LogLevel>;
+    /** True when NETCATTY_LOG overrides the saved levels */
+    envOverride?: boolean;
+  }
+
+  interface LogEntry {
+    time: number;
+    level: Exclude<LogLevel, 'off'>;
+    category: string;
+    source?: 'main' | 'renderer';
+    message: string;
+  }
+
+  /** Per-host capabilities, probed once over an open connection and cached by host key fingerprint */
+  interface RemoteCapabilities {
+    probedAt: number;
+    os: string | null;
+    arch: string | null;
+    distro: string | null;
+    distroVersion: string | null;
+    shell: string | null;
+    tools: Record<'tar' | 'zstd' | 'rsync' | 'sha256sum', boolean>;
+    sftpServerPath: string | null;
+    sftp?: {
+      extensions: Record<string, string>;
+      limits: {
+        maxPacketLength?: number;
+        maxReadLength?: number;
+        maxWriteLength?: number;
+        maxOpenHandles?: number;
+      };
+    };
+  }
+
   interface SftpTransferProgress {
     transferId: string;
     bytesTransferred: number;
@@ -93,6 +269,24 @@ declare global {
     speed: number; // bytes per second
   }
 
+  /** A file moving over ZMODEM or trzsz inside a terminal session */
+  interface InbandTransferUpdate {
+    sessionId: string;
+    id: string;
+    protocol: 'zmodem' | 'trzsz';
+    fileName: string;
+    sourcePath: string;
+    targetPath: string;
+    direction: 'upload' | 'download';
+    status: 'transferring' | 'completed' | 'failed' | 'cancelled';
+    totalBytes: number;
+    transferredBytes: number;
+    speed: number;
+    error?: string;
+    startTime: number;
+    endTime?: number;
+  }
+
   // Port Forwarding Types
   interface PortForwardOptions {
     tunnelId: string;
@@ -107,6 +301,9 @@ declare global {
     username: string;
     password?: string;
     privateKey?: string;
+    transportProfile?: NetcattyTransportProfile;
+    // Connect only while the listener has clients (local/dynamic)
+    onDemand?: boolean;
   }
 
   interface PortForwardResult {
@@ -183,8 +380,36 @@ declare global {
       command: string;
       timeout?: number;
     }): Promise<{ stdout: string; stderr: string; code: number | null }>;
+    /** Benchmark cipher/compression/window candidates against a host and return the fastest */
+    tuneSshTransport?(options: NetcattySSHOptions): Promise<NetcattyTransportTuneResult>;
+    /** Run tmux in control mode on an SSH session's connection; panes become sessions */
+    tmuxAttach?(options: { sessionId: string; sessionName?: string }): Promise<{
+      controlId: string;
+      sessionName: string;
+      windows: NetcattyTmuxWindow[];
+    }>;
+    /** Start streaming a tmux pane; returns its current screen */
+    tmuxAttachPane?(sessionId: string): Promise<{ snapshot: string }>;
+    tmuxCommand?(options: {
+      controlId: string;
+      action: 'split' | 'newWindow';
+      sessionId?: string;
+      direction?: 'horizontal' | 'vertical';
+    }): Promise<{ success: boolean; error?: string }>;
+    tmuxDetach?(controlId: string): Promise<{ success: boolean }>;
+    onTmuxEvent?(cb: (event: NetcattyTmuxEvent) => void): () => void;
+    /** Traffic and latency of this window's sessions */
+    getSessionMetrics?(): Promise<NetcattySessionMetrics[]>;
+    /** Throttled metrics updates (about once a second, only while something changes) */
+    onSessionMetrics?(cb: (metrics: NetcattySessionMetrics[]) => void): () => void;
     /** Get current working directory from an active SSH session */
     getSessionPwd?(sessionId: string): Promise<{ success: boolean; cwd?: string; error?: string }>;
+    /** Get cached remote capabilities (OS, shell, tools, sftp-server) of an active SSH session */
+    getSessionCapabilities?(sessionId: string, force?: boolean): Promise<{
+      success: boolean;
+      capabilities?: RemoteCapabilities;
+      error?: string;
+    }>;
     /** Get server stats (CPU, Memory, Disk, Network) from an active SSH session - Linux only */
     getServerStats?(sessionId: string): Promise<{
       success: boolean;
@@ -224,6 +449,8 @@ declare global {
       };
     }>;
     writeToSession(sessionId: string, data: string): void;
+    /** Resolves once the transport accepts more data; false if the session is gone */
+    writeToSessionDrained?(sessionId: string, data: string): Promise<boolean>;
     resizeSession(sessionId: string, cols: number, rows: number): void;
     closeSession(sessionId: string): void;
     onSessionData(sessionId: string, cb: (data: string) => void): () => void;
@@ -231,6 +458,8 @@ declare global {
       sessionId: string,
       cb: (evt: { exitCode?: number; signal?: number }) => void
     ): () => void;
+    onInbandTransfer?(sessionId: string, cb: (update: InbandTransferUpdate) => void): () => void;
+    cancelInbandTransfer?(sessionId: string): Promise<{ ok: boolean }>;
     onAuthFailed?(
       sessionId: string,
       cb: (evt: { sessionId: string; error: string; hostname: string }) => void
@@ -353,6 +582,7 @@ declare global {
 
     // Local filesystem operations
     listLocalDir?(path: string): Promise<RemoteFile[]>;
+    listLocalDirPage?(path: string, offset?: number, limit?: number, force?: boolean, generation?: number): Promise<LocalDirPage>;
     readLocalFile?(path: string): Promise<ArrayBuffer>;
     writeLocalFile?(path: string, content: ArrayBuffer): Promise<void>;
     deleteLocalFile?(path: string): Promise<void>;
@@ -391,16 +621,18 @@ declare global {
     cloudSyncWebdavUpload?(
       config: WebDAVConfig,
       syncedFile: SyncedFile
-    ): Promise<{ resourceId: string }>;
+    ): Promise<{ resourceId: string; revision?: string | null }>;
     cloudSyncWebdavDownload?(config: WebDAVConfig): Promise<{ syncedFile: SyncedFile | null }>;
+    cloudSyncWebdavRevision?(config: WebDAVConfig): Promise<{ revision: string | null }>;
     cloudSyncWebdavDelete?(config: WebDAVConfig): Promise<{ ok: true }>;
 
     cloudSyncS3Initialize?(config: S3Config): Promise<{ resourceId: string | null }>;
     cloudSyncS3Upload?(
       config: S3Config,
       syncedFile: SyncedFile
-    ): Promise<{ resourceId: string }>;
+    ): Promise<{ resourceId: string; revision?: string | null }>;
     cloudSyncS3Download?(config: S3Config): Promise<{ syncedFile: SyncedFile | null }>;
+    cloudSyncS3Revision?(config: S3Config): Promise<{ revision: string | null }>;
     cloudSyncS3Delete?(config: S3Config): Promise<{ ok: true }>;
 
     cloudSyncSmbInitialize?(config: SMBConfig): Promise<{ resourceId: string | null }>;
@@ -436,6 +668,39 @@ declare global {
     // Callback receives: (currentHop: number, totalHops: number, hostLabel: string, status: string)
     onChainProgress?(cb: (hop: number, total: number, label: string, status: string) => void): () => void;
 
+    // DNS / TCP / KEX / auth timing of each SSH session connect
+    onConnectTiming?(
+      cb: (event: { sessionId: string; hostname: string; timing: NetcattyConnectTiming }) => void,
+    ): () => void;
+
+    // Vault reachability scanner
+    startReachabilityScan?(options: {
+      targets: ReachabilityTarget[];
+      concurrency?: number;
+      verifyHostKeys?: boolean;
+    }): Promise<{ total: number }>;
+    cancelReachabilityScan?(): Promise<{ success: boolean }>;
+    getReachabilityResults?(): Promise<HostReachability[]>;
+    onReachabilityEvent?(
+      cb: (event: { type: 'update'; results: HostReachability[] } | { type: 'done'; cancelled: boolean }) => void,
+    ): () => void;
+
+    // IPC instrumentation
+    getIpcStats?(): Promise<IpcStatsSnapshot>;
+    resetIpcStats?(): Promise<boolean>;
+    exportIpcStats?(filePath: string): Promise<{ success: boolean }>;
+
+    // Structured logging
+    getLogConfig?(): Promise<LogConfig>;
+    setLogConfig?(config: Pick<LogConfig, 'level' | 'categories'>): Promise<LogConfig>;
+    getRecentLogs?(limit?: number): Promise<LogEntry[]>;
+    appendLogs?(entries: LogEntry[]): void;
+    exportDiagnosticsBundle?(
+      filePath: string,
+      renderer: { entries: LogEntry[]; perf: Record<string, unknown> },
+    ): Promise<{ success: boolean }>;
+    onLogConfigChanged?(cb: (config: LogConfig) => void): () => void;
+
     // OAuth callback server for cloud sync
     startOAuthCallback?(expectedState?: string): Promise<{ code: string; state?: string }>;
     cancelOAuthCallback?(): Promise<void>;
@@ -490,9 +755,10 @@ declare global {
 
     // Google Drive API (cloud sync) - proxied via main process to avoid CORS/COEP issues
     googleDriveFindSyncFile?(options: { accessToken: string; fileName?: string }): Promise<{ fileId: string | null }>;
-    googleDriveCreateSyncFile?(options: { accessToken: string; fileName?: string; syncedFile: unknown }): Promise<{ fileId: string }>;
-    googleDriveUpdateSyncFile?(options: { accessToken: string; fileId: string; syncedFile: unknown }): Promise<{ ok: true }>;
+    googleDriveCreateSyncFile?(options: { accessToken: string; fileName?: string; syncedFile: unknown }): Promise<{ fileId: string; revision?: string | null }>;
+    googleDriveUpdateSyncFile?(options: { accessToken: string; fileId: string; syncedFile: unknown }): Promise<{ ok: true; revision?: string | null }>;
     googleDriveDownloadSyncFile?(options: { accessToken: string; fileId: string }): Promise<{ syncedFile: unknown | null }>;
+    googleDriveGetSyncFileRevision?(options: { accessToken: string; fileId: string }): Promise<{ revision: string | null }>;
     googleDriveDeleteSyncFile?(options: { accessToken: string; fileId: string }): Promise<{ ok: true }>;
 
     // OneDrive OAuth + Graph (cloud sync) - proxied via main process to avoid CORS
@@ -527,8 +793,9 @@ declare global {
       avatarDataUrl?: string;
     }>;
     onedriveFindSyncFile?(options: { accessToken: string; fileName?: string }): Promise<{ fileId: string | null }>;
-    onedriveUploadSyncFile?(options: { accessToken: string; fileName?: string; syncedFile: unknown }): Promise<{ fileId: string | null }>;
+    onedriveUploadSyncFile?(options: { accessToken: string; fileName?: string; syncedFile: unknown }): Promise<{ fileId: string | null; revision?: string | null }>;
     onedriveDownloadSyncFile?(options: { accessToken: string; fileId?: string; fileName?: string }): Promise<{ syncedFile: unknown | null }>;
+    onedriveGetSyncFileRevision?(options: { accessToken: string; fileId?: string; fileName?: string }): Promise<{ revision: string | null }>;
     onedriveDeleteSyncFile?(options: { accessToken: string; fileId: string }): Promise<{ ok: true }>;
 
     // File opener helpers (for "Open With" feature)
@@ -40,6 +40,42 @@ export const withCjkFallback = (family: string) => {
   return `${trimmed}, ${CJK_FALLBACK_STACK}`;
 };
 
+/**
+ * Measured properties of an installed font family (see lib/fontMetrics.ts).
+ * Coverage flags are conservative: false means "not detected", so the
+ * fallback chain is kept.
+ */
+export interface FontMetrics {
+  family: string;
+  /** Font is installed and resolvable by name */
+  available: boolean;
+  /** Latin glyphs share one advance width */
+  monospace: boolean;
+  /** Advance width of a cell as a fraction of the font size */
+  cellWidth: number;
+  cjk: boolean;
+  powerline: boolean;
+  nerdFont: boolean;
+}
+
+/** First family name of a CSS font-family stack, without quotes. */
+export const getPrimaryFontFamily = (family: string) =>
+  family.split(',')[0].trim().replace(/^["']|["']$/g, '');
+
+/**
+ * Build the shortest usable stack for a font: the CJK fallback list is only
+ * appended when the primary font is not known to cover CJK itself, which
+ * keeps xterm from walking ten fallback fonts for every missing glyph.
+ */
+export const withMinimalFallback = (family: string, metrics?: FontMetrics | null) => {
+  const trimmed = family.trim();
+  const base = trimmed.endsWith(`, ${CJK_FALLBACK_STACK}`)
+    ? trimmed.slice(0, -(CJK_FALLBACK_STACK.length + 2))
+    : trimmed;
+  if (metrics?.available && metrics.cjk) return base;
+  return withCjkFallback(base);
+};
+
 const BASE_TERMINAL_FONTS: TerminalFont[] = [
   {
     id: 'menlo',
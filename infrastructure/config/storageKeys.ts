@@ -15,6 +15,7 @@ export const STORAGE_KEY_TERM_THEME = 'netcatty_term_theme_v1';
 export const STORAGE_KEY_TERM_FONT_FAMILY = 'netcatty_term_font_family_v1';
 export const STORAGE_KEY_TERM_FONT_SIZE = 'netcatty_term_font_size_v1';
 export const STORAGE_KEY_TERM_SETTINGS = 'netcatty_term_settings_v1';
+export const STORAGE_KEY_TERM_FONT_CATALOG = 'netcatty_term_font_catalog_v1';
 export const STORAGE_KEY_HOTKEY_SCHEME = 'netcatty_hotkey_scheme_v1';
 export const STORAGE_KEY_CUSTOM_KEY_BINDINGS = 'netcatty_custom_key_bindings_v1';
 export const STORAGE_KEY_HOTKEY_RECORDING = 'netcatty_hotkey_recording_v1';
@@ -56,3 +57,13 @@ export const STORAGE_KEY_LEGACY_KEYS = 'netcatty_legacy_keys_v1';
 
 // Managed Sources - external files that manage groups of hosts (e.g., ~/.ssh/config)
 export const STORAGE_KEY_MANAGED_SOURCES = 'netcatty_managed_sources_v1';
+
+// Diagnostics - render profiler overlay toggle
+export const STORAGE_KEY_RENDER_PROFILER = 'netcatty_render_profiler_v1';
+
+// Session restore - tab/workspace layout and compressed screen snapshots from the last run
+export const STORAGE_KEY_SESSION_RESTORE_ENABLED = 'netcatty_session_restore_enabled_v1';
+export const STORAGE_KEY_SESSION_RESTORE_BACKGROUND = 'netcatty_session_restore_background_v1';
+export const STORAGE_KEY_SESSION_RESTORE_LAYOUT = 'netcatty_session_restore_layout_v1';
+export const STORAGE_KEY_SESSION_RESTORE_SCREENS = 'netcatty_session_restore_screens_v1';
+export const STORAGE_KEY_SESSION_RESTORE_SCREENS_ENABLED = 'netcatty_session_restore_screens_enabled_v1';
@@ -1679,3 +1679,87 @@ export const TERMINAL_THEMES: TerminalTheme[] = [
     }
   }
 ];
+
+/**
+ * xterm.js theme object derived from a TerminalTheme.
+ * Frozen so the same reference can be handed to every terminal: xterm skips
+ * its theme/glyph-atlas rebuild when `options.theme` is set to the object it
+ * already holds.
+ */
+export type XTermThemePalette = Readonly<{
+  background: string;
+  foreground: string;
+  cursor: string;
+  selectionBackground: string;
+  black: string;
+  red: string;
+  green: string;
+  yellow: string;
+  blue: string;
+  magenta: string;
+  cyan: string;
+  white: string;
+  brightBlack: string;
+  brightRed: string;
+  brightGreen: string;
+  brightYellow: string;
+  brightBlue: string;
+  brightMagenta: string;
+  brightCyan: string;
+  brightWhite: string;
+}>;
+
+const PALETTE_KEYS = [
+  'background', 'foreground', 'cursor', 'selection',
+  'black', 'red', 'green', 'yellow', 'blue', 'magenta', 'cyan', 'white',
+  'brightBlack', 'brightRed', 'brightGreen', 'brightYellow',
+  'brightBlue', 'brightMagenta', 'brightCyan', 'brightWhite',
+] as const;
+
+// Palettes keyed by theme id; `signature` is the joined color list so custom
+// or edited themes that reuse an id are detected without deep comparisons.
+const paletteCache = new Map<string, { signature: string; palette: XTermThemePalette }>();
+
+const paletteSignature = (colors: TerminalTheme['colors']): string =>
+  PALETTE_KEYS.map((key) => colors[key]).join('|');
+
+const buildPalette = (colors: TerminalTheme['colors']): XTermThemePalette =>
+  Object.freeze({
+    background: colors.background,
+    foreground: colors.foreground,
+    cursor: colors.cursor,
+    selectionBackground: colors.selection,
+    black: colors.black,
+    red: colors.red,
+    green: colors.green,
+    yellow: colors.yellow,
+    blue: colors.blue,
+    magenta: colors.magenta,
+    cyan: colors.cyan,
+    white: colors.white,
+    brightBlack: colors.brightBlack,
+    brightRed: colors.brightRed,
+    brightGreen: colors.brightGreen,
+    brightYellow: colors.brightYellow,
+    brightBlue: colors.brightBlue,
+    brightMagenta: colors.brightMagenta,
+    brightCyan: colors.brightCyan,
+    brightWhite: colors.brightWhite,
+  });
+
+/**
+ * Get the cached xterm palette for a theme.
+ * Returns the same object for the same colors, so repeated assignments to
+ * `term.options.theme` are no-ops.
+ */
+export const getXTermThemePalette = (theme: TerminalTheme): XTermThemePalette => {
+  const signature = paletteSignature(theme.colors);
+  const cached = paletteCache.get(theme.id);
+  if (cached && cached.signature === signature) return cached.palette;
+  const palette = buildPalette(theme.colors);
+  paletteCache.set(theme.id, { signature, palette });
+  return palette;
+};
+
+// Built-in themes are precomputed once at load so switching never allocates.
+TERMINAL_THEMES.forEach((theme) => getXTermThemePalette(theme));
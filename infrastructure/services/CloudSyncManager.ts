@@ -31,7 +31,7 @@ import {
   generateDeviceId,
   getDefaultDeviceName,
 } from '../../domain/sync';
-import { EncryptionService } from './EncryptionService';
+import { EncryptionService, type MasterKeyOptions } from './EncryptionService';
 import { createAdapter, type CloudAdapter } from './adapters';
 import type { GitHubAdapter } from './adapters/GitHubAdapter';
 import type { GoogleDriveAdapter } from './adapters/GoogleDriveAdapter';
@@ -506,6 +506,7 @@ export class CloudSyncManager {
     // Clear sensitive data from memory
     this.state.unlockedKey = null;
     this.masterPassword = null;
+    EncryptionService.clearDerivedKeyCache();
     this.state.securityState = 'LOCKED';
 
     // Stop auto-sync
@@ -517,7 +518,11 @@ export class CloudSyncManager {
   /**
    * Change master password
    */
-  async changeMasterKey(oldPassword: string, newPassword: string): Promise<boolean> {
+  async changeMasterKey(
+    oldPassword: string,
+    newPassword: string,
+    options: MasterKeyOptions = {}
+  ): Promise<boolean> {
     if (!this.state.masterKeyConfig) {
       throw new Error('No master key configured');
     }
@@ -525,7 +530,8 @@ export class CloudSyncManager {
     const newConfig = await EncryptionService.changeMasterPassword(
       oldPassword,
       newPassword,
-      this.state.masterKeyConfig
+      this.state.masterKeyConfig,
+      options
     );
 
     if (!newConfig) {
@@ -536,7 +542,7 @@ export class CloudSyncManager {
     this.state.securityState = 'UNLOCKED';
     this.masterPassword = newPassword;
     
-    // Re-derive key with new password
+    // Unlock with the new password (the key was cached while creating the config)
     this.state.unlockedKey = await EncryptionService.unlockMasterKey(
       newPassword,
       newConfig
@@ -855,8 +861,13 @@ export class CloudSyncManager {
     this.emit({ type: 'SYNC_STARTED', provider });
 
     try {
-      // Check for remote version first
-      const remoteFile = await adapter.download();
+      // Check for remote version first; skip the download (and decrypt) when
+      // the remote revision is still the one we last synced
+      const knownRevision = this.state.providers[provider].lastSyncRevision;
+      const revision = await this.probeRemoteRevision(adapter);
+      const remoteFile = revision && revision === knownRevision
+        ? null
+        : await adapter.download();
 
       if (remoteFile) {
         // Compare versions
@@ -894,7 +905,9 @@ export class CloudSyncManager {
         this.state.localVersion
       );
 
-      await adapter.upload(syncedFile);
+      // Take the revision from the upload response: probing again afterwards
+      // could pick up another device's upload and mark it as already synced
+      const { revision: uploadedRevision } = await adapter.upload(syncedFile);
 
       // Update local state
       this.state.localVersion = syncedFile.meta.version;
@@ -903,6 +916,7 @@ export class CloudSyncManager {
       this.state.remoteUpdatedAt = syncedFile.meta.updatedAt;
       this.state.providers[provider].lastSync = Date.now();
       this.state.providers[provider].lastSyncVersion = syncedFile.meta.version;
+      this.state.providers[provider].lastSyncRevision = uploadedRevision || undefined;
 
       this.saveSyncConfig();
       this.saveProviderConnection(provider, this.state.providers[provider]);
@@ -970,6 +984,9 @@ export class CloudSyncManager {
     const adapter = await this.getConnectedAdapter(provider);
 
     try {
+      // Probe before downloading: if the file changes in between, the stale
+      // revision only costs one extra download later
+      const revision = await this.probeRemoteRevision(adapter);
       const remoteFile = await adapter.download();
       if (!remoteFile) {
         return null;
@@ -983,7 +1000,9 @@ export class CloudSyncManager {
       this.state.localUpdatedAt = remoteFile.meta.updatedAt;
       this.state.remoteVersion = remoteFile.meta.version;
       this.state.remoteUpdatedAt = remoteFile.meta.updatedAt;
+      this.state.providers[provider].lastSyncRevision = revision || undefined;
       this.saveSyncConfig();
+      this.saveProviderConnection(provider, this.state.providers[provider]);
       this.notifyStateChange(); // Notify UI of state change
 
       // Add to sync history
@@ -1012,6 +1031,25 @@ export class CloudSyncManager {
     }
   }
 
+  /**
+   * Whether the remote file may have changed since the last sync with this
+   * provider. Only reads metadata; answers true whenever it cannot tell.
+   */
+  async hasRemoteChanged(provider: CloudProvider): Promise<boolean> {
+    const adapter = await this.getConnectedAdapter(provider);
+    const revision = await this.probeRemoteRevision(adapter);
+    return !revision || revision !== this.state.providers[provider].lastSyncRevision;
+  }
+
+  private async probeRemoteRevision(adapter: CloudAdapter): Promise<string | null> {
+    try {
+      return await adapter.getRemoteRevision();
+    } catch (error) {
+      console.warn('[CloudSync] Remote revision probe failed, falling back to download:', error);
+      return null;
+    }
+  }
+
   /**
    * Resolve a sync conflict
    */
@@ -1146,6 +1184,12 @@ export class CloudSyncManager {
     this.state.localVersion = 0;
     this.state.localUpdatedAt = 0;
     this.state.syncHistory = [];
+    // Force the next sync to fetch the remote file again
+    for (const provider of Object.keys(this.state.providers) as CloudProvider[]) {
+      if (!this.state.providers[provider].lastSyncRevision) continue;
+      this.state.providers[provider] = { ...this.state.providers[provider], lastSyncRevision: undefined };
+      this.saveProviderConnection(provider, this.state.providers[provider]);
+    }
     this.saveSyncConfig();
     this.saveToStorage(SYNC_HISTORY_STORAGE_KEY, []);
     this.notifyStateChange();
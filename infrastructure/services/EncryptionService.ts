@@ -6,8 +6,13 @@
  * 
  * Security Model:
  * - Master password → PBKDF2 (600k iterations) → AES-256 key
- * - Each sync file has unique IV and salt
+ * - The local master key can opt into Argon2id, calibrated per machine
+ * - Each encryption has a unique IV; sync files carry their KDF salt
  * - Key verification via hash comparison (not by storing the key)
+ *
+ * Derivation runs in a worker (kdfClient) and each (password, salt, params)
+ * is derived once per session: unlock, verification and repeat decrypts of
+ * the same file reuse the cached key.
  */
 
 import {
@@ -20,6 +25,8 @@ import {
   type SyncFileMeta,
   type SyncPayload,
 } from '../../domain/sync';
+import type { Argon2idParams, KdfParams } from './kdf';
+import { calibrateArgon2idOffThread, deriveKeyBytesOffThread } from './kdfClient';
 
 // ============================================================================
 // Utility Functions
@@ -90,6 +97,114 @@ const bytesToString = (bytes: Uint8Array): string => {
 // Key Derivation
 // ============================================================================
 
+interface DerivedKeyMaterial {
+  key: CryptoKey;
+  verificationHash: string; // Base64 of SHA-256(raw key)
+}
+
+type KdfSource = Pick<MasterKeyConfig, 'kdf' | 'kdfIterations' | 'kdfMemoryKiB' | 'kdfParallelism'>;
+
+const MAX_CACHED_KEYS = 8;
+
+// Derived keys for this session keyed by KDF parameters and salt. The password
+// is kept with each entry (CloudSyncManager holds it while unlocked anyway) so
+// a different password can never be served a cached key.
+const derivedKeyCache = new Map<string, { password: string; material: Promise<DerivedKeyMaterial> }>();
+
+/**
+ * KDF parameters recorded in a master key config or sync file header
+ */
+const kdfParamsFrom = (source: KdfSource): KdfParams =>
+  source.kdf === 'Argon2id'
+    ? {
+      kdf: 'Argon2id',
+      iterations: source.kdfIterations || SYNC_CONSTANTS.ARGON2_ITERATIONS,
+      memoryKiB: source.kdfMemoryKiB || SYNC_CONSTANTS.ARGON2_MIN_MEMORY_KIB,
+      parallelism: source.kdfParallelism || 1,
+    }
+    : { kdf: 'PBKDF2', iterations: source.kdfIterations || SYNC_CONSTANTS.PBKDF2_ITERATIONS };
+
+const kdfCacheKey = (salt: Uint8Array, params: KdfParams) =>
+  params.kdf === 'Argon2id'
+    ? `argon2id:${params.memoryKiB}:${params.iterations}:${params.parallelism}:${arrayBufferToBase64(salt)}`
+    : `pbkdf2:${params.iterations}:${arrayBufferToBase64(salt)}`;
+
+/**
+ * Derive the AES-256 key and its verification hash in one KDF run.
+ * Results are cached for the session; failed derivations are not.
+ */
+const deriveKeyMaterial = (
+  password: string,
+  salt: Uint8Array,
+  params: KdfParams
+): Promise<DerivedKeyMaterial> => {
+  const cacheKey = kdfCacheKey(salt, params);
+  const cached = derivedKeyCache.get(cacheKey);
+  if (cached && cached.password === password) {
+    // Keep recently used entries at the end for eviction order
+    derivedKeyCache.delete(cacheKey);
+    derivedKeyCache.set(cacheKey, cached);
+    return cached.material;
+  }
+
+  const material = (async () => {
+    const keyBytes = await deriveKeyBytesOffThread(password, salt, params);
+    const [key, hash] = await Promise.all([
+      crypto.subtle.importKey(
+        'raw',
+        toArrayBuffer(keyBytes),
+        { name: 'AES-GCM', length: SYNC_CONSTANTS.AES_KEY_LENGTH },
+        true, // extractable for verification
+        ['encrypt', 'decrypt']
+      ),
+      sha256(keyBytes),
+    ]);
+    keyBytes.fill(0);
+    return { key, verificationHash: arrayBufferToBase64(hash) };
+  })();
+
+  derivedKeyCache.delete(cacheKey);
+  derivedKeyCache.set(cacheKey, { password, material });
+  while (derivedKeyCache.size > MAX_CACHED_KEYS) {
+    derivedKeyCache.delete(derivedKeyCache.keys().next().value as string);
+  }
+  material.catch(() => {
+    if (derivedKeyCache.get(cacheKey)?.material === material) derivedKeyCache.delete(cacheKey);
+  });
+  return material;
+};
+
+// One upload salt per password and session, so repeat uploads reuse the
+// cached key; every encryption still gets a fresh random IV
+let uploadSalt: { password: string; salt: Uint8Array } | null = null;
+let argon2Calibration: Promise<Argon2idParams> | null = null;
+
+/**
+ * Forget all derived keys (on lock or password change)
+ */
+export const clearDerivedKeyCache = (): void => {
+  derivedKeyCache.clear();
+  uploadSalt = null;
+};
+
+/**
+ * Argon2id parameters for this machine, measured once per session
+ */
+const getArgon2Params = (): Promise<Argon2idParams> => {
+  if (!argon2Calibration) {
+    argon2Calibration = calibrateArgon2idOffThread({
+      targetMs: SYNC_CONSTANTS.ARGON2_TARGET_UNLOCK_MS,
+      iterations: SYNC_CONSTANTS.ARGON2_ITERATIONS,
+      minMemoryKiB: SYNC_CONSTANTS.ARGON2_MIN_MEMORY_KIB,
+      maxMemoryKiB: SYNC_CONSTANTS.ARGON2_MAX_MEMORY_KIB,
+    });
+    argon2Calibration.catch(() => {
+      argon2Calibration = null;
+    });
+  }
+  return argon2Calibration;
+};
+
 /**
  * Derive an AES-256 key from password using PBKDF2
  * 
@@ -103,33 +218,8 @@ export const deriveKey = async (
   salt: Uint8Array,
   iterations: number = SYNC_CONSTANTS.PBKDF2_ITERATIONS
 ): Promise<CryptoKey> => {
-  // Import password as key material
-  const passwordKey = await crypto.subtle.importKey(
-    'raw',
-    toArrayBuffer(stringToBytes(password)),
-    'PBKDF2',
-    false,
-    ['deriveBits', 'deriveKey']
-  );
-
-  // Derive AES key using PBKDF2
-  const derivedKey = await crypto.subtle.deriveKey(
-    {
-      name: 'PBKDF2',
-      salt: toArrayBuffer(salt),
-      iterations: iterations,
-      hash: SYNC_CONSTANTS.PBKDF2_HASH,
-    },
-    passwordKey,
-    {
-      name: 'AES-GCM',
-      length: SYNC_CONSTANTS.AES_KEY_LENGTH,
-    },
-    true, // extractable for verification
-    ['encrypt', 'decrypt']
-  );
-
-  return derivedKey;
+  const { key } = await deriveKeyMaterial(password, salt, { kdf: 'PBKDF2', iterations });
+  return key;
 };
 
 /**
@@ -159,13 +249,8 @@ export const verifyPassword = async (
 ): Promise<boolean> => {
   try {
     const salt = base64ToUint8Array(config.salt);
-    const derivedKey = await deriveKey(
-      password,
-      salt,
-      config.kdfIterations || SYNC_CONSTANTS.PBKDF2_ITERATIONS
-    );
-    const hash = await createVerificationHash(derivedKey);
-    return hash === config.verificationHash;
+    const { verificationHash } = await deriveKeyMaterial(password, salt, kdfParamsFrom(config));
+    return verificationHash === config.verificationHash;
   } catch {
     return false;
   }
@@ -257,8 +342,11 @@ export const encryptPayload = async (
   appVersion: string,
   existingVersion?: number
 ): Promise<SyncedFile> => {
-  // Generate new salt for each encryption
-  const salt = generateRandomBytes(SYNC_CONSTANTS.SALT_LENGTH);
+  // Reuse this session's salt so the derived key comes from cache
+  if (!uploadSalt || uploadSalt.password !== password) {
+    uploadSalt = { password, salt: generateRandomBytes(SYNC_CONSTANTS.SALT_LENGTH) };
+  }
+  const salt = uploadSalt.salt;
   
   // Derive key from password
   const key = await deriveKey(password, salt);
@@ -305,12 +393,8 @@ export const decryptPayload = async (
   const iv = base64ToUint8Array(meta.iv);
   const ciphertext = base64ToUint8Array(payload);
   
-  // Derive key from password
-  const key = await deriveKey(
-    password,
-    salt,
-    meta.kdfIterations || SYNC_CONSTANTS.PBKDF2_ITERATIONS
-  );
+  // Derive key from password (cached when this file was seen before)
+  const { key } = await deriveKeyMaterial(password, salt, kdfParamsFrom(meta));
   
   // Decrypt
   const decrypted = await decrypt(
@@ -341,24 +425,38 @@ export const verifySyncedFile = async (
 // Master Key Management
 // ============================================================================
 
+export interface MasterKeyOptions {
+  // Argon2id is opt-in; its memory cost is calibrated on this machine
+  kdf?: MasterKeyConfig['kdf'];
+}
+
 /**
  * Create a new master key configuration
  * 
  * @param password - User's master password
+ * @param options - KDF selection
  * @returns Configuration to store (contains verification hash, not the key)
  */
 export const createMasterKeyConfig = async (
-  password: string
+  password: string,
+  options: MasterKeyOptions = {}
 ): Promise<MasterKeyConfig> => {
   const salt = generateRandomBytes(SYNC_CONSTANTS.SALT_LENGTH);
-  const key = await deriveKey(password, salt);
-  const verificationHash = await createVerificationHash(key);
+  const params: KdfParams = options.kdf === 'Argon2id'
+    ? await getArgon2Params()
+    : { kdf: 'PBKDF2', iterations: SYNC_CONSTANTS.PBKDF2_ITERATIONS };
+  // Also primes the cache, so the unlock that follows setup is instant
+  const { verificationHash } = await deriveKeyMaterial(password, salt, params);
 
   return {
+    version: SYNC_CONSTANTS.MASTER_KEY_CONFIG_VERSION,
     verificationHash,
     salt: arrayBufferToBase64(salt),
-    kdf: 'PBKDF2',
-    kdfIterations: SYNC_CONSTANTS.PBKDF2_ITERATIONS,
+    kdf: params.kdf,
+    kdfIterations: params.iterations,
+    ...(params.kdf === 'Argon2id'
+      ? { kdfMemoryKiB: params.memoryKiB, kdfParallelism: params.parallelism }
+      : {}),
     createdAt: Date.now(),
   };
 };
@@ -374,18 +472,18 @@ export const unlockMasterKey = async (
   password: string,
   config: MasterKeyConfig
 ): Promise<UnlockedMasterKey | null> => {
-  const isValid = await verifyPassword(password, config);
-  if (!isValid) return null;
-
+  // One derivation yields both the key and the hash to check it against
   const salt = base64ToUint8Array(config.salt);
-  const derivedKey = await deriveKey(
-    password,
-    salt,
-    config.kdfIterations || SYNC_CONSTANTS.PBKDF2_ITERATIONS
-  );
+  let material: DerivedKeyMaterial;
+  try {
+    material = await deriveKeyMaterial(password, salt, kdfParamsFrom(config));
+  } catch {
+    return null;
+  }
+  if (material.verificationHash !== config.verificationHash) return null;
 
   return {
-    derivedKey,
+    derivedKey: material.key,
     salt,
     unlockedAt: Date.now(),
   };
@@ -398,19 +496,21 @@ export const unlockMasterKey = async (
  * @param oldPassword - Current master password
  * @param newPassword - New master password
  * @param config - Current master key configuration
+ * @param options - KDF for the new configuration (defaults to the current one)
  * @returns New configuration, or null if old password is wrong
  */
 export const changeMasterPassword = async (
   oldPassword: string,
   newPassword: string,
-  config: MasterKeyConfig
+  config: MasterKeyConfig,
+  options: MasterKeyOptions = {}
 ): Promise<MasterKeyConfig | null> => {
-  // Verify old password first
+  // Verify old password first (served from cache while unlocked)
   const isValid = await verifyPassword(oldPassword, config);
   if (!isValid) return null;
 
   // Create new configuration with new password
-  return createMasterKeyConfig(newPassword);
+  return createMasterKeyConfig(newPassword, { kdf: options.kdf ?? config.kdf });
 };
 
 // ============================================================================
@@ -431,6 +531,7 @@ export class EncryptionService {
   static changeMasterPassword = changeMasterPassword;
   static verifyPassword = verifyPassword;
   static createVerificationHash = createVerificationHash;
+  static clearDerivedKeyCache = clearDerivedKeyCache;
   static generateRandomBytes = generateRandomBytes;
   static arrayBufferToBase64 = arrayBufferToBase64;
   static base64ToUint8Array = base64ToUint8Array;
@@ -16,6 +16,7 @@ import {
   type OAuthTokens,
   type ProviderAccount,
   type SyncedFile,
+  type SyncUploadResult,
   type GitHubDeviceCodeResponse,
 } from '../../../domain/sync';
 import { netcattyBridge } from '../netcattyBridge';
@@ -257,13 +258,18 @@ export const findSyncGist = async (accessToken: string): Promise<string | null>
   return syncGist?.id || null;
 };
 
+/**
+ * Latest revision in a gist API response (history is newest first)
+ */
+const latestGistVersion = (gist: GitHubGist): string | null => gist.history?.[0]?.version || null;
+
 /**
  * Create a new sync gist
  */
 export const createSyncGist = async (
   accessToken: string,
   syncedFile: SyncedFile
-): Promise<string> => {
+): Promise<SyncUploadResult> => {
   const response = await fetch(`${SYNC_CONSTANTS.GITHUB_API_BASE}/gists`, {
     method: 'POST',
     headers: {
@@ -287,7 +293,7 @@ export const createSyncGist = async (
   }
 
   const gist: GitHubGist = await response.json();
-  return gist.id;
+  return { resourceId: gist.id, revision: latestGistVersion(gist) };
 };
 
 /**
@@ -297,7 +303,7 @@ export const updateSyncGist = async (
   accessToken: string,
   gistId: string,
   syncedFile: SyncedFile
-): Promise<void> => {
+): Promise<SyncUploadResult> => {
   const response = await fetch(`${SYNC_CONSTANTS.GITHUB_API_BASE}/gists/${gistId}`, {
     method: 'PATCH',
     headers: {
@@ -317,6 +323,9 @@ export const updateSyncGist = async (
   if (!response.ok) {
     throw new Error(`Failed to update gist: ${response.statusText}`);
   }
+
+  const gist: GitHubGist = await response.json();
+  return { resourceId: gist.id || gistId, revision: latestGistVersion(gist) };
 };
 
 /**
@@ -350,6 +359,31 @@ export const downloadSyncGist = async (
   return JSON.parse(file.content) as SyncedFile;
 };
 
+/**
+ * Get the latest gist revision without fetching file contents
+ */
+export const getSyncGistRevision = async (
+  accessToken: string,
+  gistId: string
+): Promise<string | null> => {
+  const response = await fetch(`${SYNC_CONSTANTS.GITHUB_API_BASE}/gists/${gistId}/commits?per_page=1`, {
+    headers: {
+      'Authorization': `Bearer ${accessToken}`,
+      'Accept': 'application/vnd.github.v3+json',
+    },
+  });
+
+  if (!response.ok) {
+    if (response.status === 404) {
+      return null;
+    }
+    throw new Error(`Failed to get gist revision: ${response.statusText}`);
+  }
+
+  const commits: Array<{ version: string; committed_at: string }> = await response.json();
+  return commits[0]?.version || null;
+};
+
 /**
  * Delete sync gist
  */
@@ -488,18 +522,16 @@ export class GitHubAdapter {
   /**
    * Upload sync file
    */
-  async upload(syncedFile: SyncedFile): Promise<string> {
+  async upload(syncedFile: SyncedFile): Promise<SyncUploadResult> {
     if (!this.accessToken) {
       throw new Error('Not authenticated');
     }
 
-    if (this.gistId) {
-      await updateSyncGist(this.accessToken, this.gistId, syncedFile);
-      return this.gistId;
-    } else {
-      this.gistId = await createSyncGist(this.accessToken, syncedFile);
-      return this.gistId;
-    }
+    const result = this.gistId
+      ? await updateSyncGist(this.accessToken, this.gistId, syncedFile)
+      : await createSyncGist(this.accessToken, syncedFile);
+    this.gistId = result.resourceId;
+    return result;
   }
 
   /**
@@ -521,6 +553,25 @@ export class GitHubAdapter {
     return downloadSyncGist(this.accessToken, this.gistId);
   }
 
+  /**
+   * Current remote revision (latest gist commit), null if there is no gist
+   */
+  async getRemoteRevision(): Promise<string | null> {
+    if (!this.accessToken) {
+      throw new Error('Not authenticated');
+    }
+
+    if (!this.gistId) {
+      this.gistId = await findSyncGist(this.accessToken);
+    }
+
+    if (!this.gistId) {
+      return null;
+    }
+
+    return getSyncGistRevision(this.accessToken, this.gistId);
+  }
+
   /**
    * Delete sync data
    */
@@ -17,6 +17,7 @@ import {
   type OAuthTokens,
   type ProviderAccount,
   type SyncedFile,
+  type SyncUploadResult,
   type PKCEChallenge,
 } from '../../../domain/sync';
 import { arrayBufferToBase64, generateRandomBytes } from '../EncryptionService';
@@ -281,22 +282,28 @@ export const findSyncFile = async (accessToken: string): Promise<string | null>
   return data.files?.[0]?.id || null;
 };
 
+// Metadata fields that make up a revision; see getSyncFileRevision
+const REVISION_FIELDS = 'version,md5Checksum,modifiedTime';
+
+const toRevision = (data: { version?: string; md5Checksum?: string; modifiedTime?: string } | null) =>
+  data?.version || data?.md5Checksum || data?.modifiedTime || null;
+
 /**
  * Create sync file in appDataFolder
  */
 export const createSyncFile = async (
   accessToken: string,
   syncedFile: SyncedFile
-): Promise<string> => {
+): Promise<SyncUploadResult> => {
   const bridge = netcattyBridge.get();
   const createViaMain = bridge?.googleDriveCreateSyncFile;
   if (createViaMain) {
-    const { fileId } = await createViaMain({
+    const { fileId, revision } = await createViaMain({
       accessToken,
       fileName: SYNC_CONSTANTS.SYNC_FILE_NAME,
       syncedFile,
     });
-    return fileId;
+    return { resourceId: fileId, revision: revision ?? null };
   }
 
   const metadata = {
@@ -317,7 +324,7 @@ export const createSyncFile = async (
   let response: Response;
   try {
     response = await fetch(
-      `${SYNC_CONSTANTS.GOOGLE_DRIVE_API.replace('/v3', '/upload/v3')}/files?uploadType=multipart`,
+      `${SYNC_CONSTANTS.GOOGLE_DRIVE_API.replace('/v3', '/upload/v3')}/files?uploadType=multipart&fields=id,${REVISION_FIELDS}`,
       {
         method: 'POST',
         headers: {
@@ -343,7 +350,7 @@ export const createSyncFile = async (
   }
 
   const data = await response.json();
-  return data.id;
+  return { resourceId: data.id, revision: toRevision(data) };
 };
 
 /**
@@ -353,18 +360,18 @@ export const updateSyncFile = async (
   accessToken: string,
   fileId: string,
   syncedFile: SyncedFile
-): Promise<void> => {
+): Promise<SyncUploadResult> => {
   const bridge = netcattyBridge.get();
   const updateViaMain = bridge?.googleDriveUpdateSyncFile;
   if (updateViaMain) {
-    await updateViaMain({ accessToken, fileId, syncedFile });
-    return;
+    const { revision } = await updateViaMain({ accessToken, fileId, syncedFile });
+    return { resourceId: fileId, revision: revision ?? null };
   }
 
   let response: Response;
   try {
     response = await fetch(
-      `${SYNC_CONSTANTS.GOOGLE_DRIVE_API.replace('/v3', '/upload/v3')}/files/${fileId}?uploadType=media`,
+      `${SYNC_CONSTANTS.GOOGLE_DRIVE_API.replace('/v3', '/upload/v3')}/files/${fileId}?uploadType=media&fields=${REVISION_FIELDS}`,
       {
         method: 'PATCH',
         headers: {
@@ -389,6 +396,9 @@ export const updateSyncFile = async (
     }
     throw new Error(`Failed to update file: ${errorData.error?.message || response.status}`);
   }
+
+  const data = await response.json().catch(() => null);
+  return { resourceId: fileId, revision: toRevision(data) };
 };
 
 /**
@@ -437,6 +447,49 @@ export const downloadSyncFile = async (
   return response.json();
 };
 
+/**
+ * Get sync file revision (Drive file version) without downloading the content
+ */
+export const getSyncFileRevision = async (
+  accessToken: string,
+  fileId: string
+): Promise<string | null> => {
+  const bridge = netcattyBridge.get();
+  const revisionViaMain = bridge?.googleDriveGetSyncFileRevision;
+  if (revisionViaMain) {
+    const { revision } = await revisionViaMain({ accessToken, fileId });
+    return revision || null;
+  }
+
+  let response: Response;
+  try {
+    response = await fetch(
+      `${SYNC_CONSTANTS.GOOGLE_DRIVE_API}/files/${fileId}?fields=${REVISION_FIELDS}`,
+      {
+        headers: {
+          'Authorization': `Bearer ${accessToken}`,
+        },
+      }
+    );
+  } catch (fetchError) {
+    console.error('[GoogleDrive] Network error:', fetchError);
+    throw new Error(`Network error: ${fetchError instanceof Error ? fetchError.message : 'Failed to fetch'}`);
+  }
+
+  if (!response.ok) {
+    if (response.status === 404) {
+      return null;
+    }
+    const errorData = await response.json().catch(() => ({}));
+    if (response.status === 401) {
+      throw new Error('Token expired or invalid. Please reconnect.');
+    }
+    throw new Error(`Failed to get file metadata: ${errorData.error?.message || response.status}`);
+  }
+
+  return toRevision(await response.json());
+};
+
 /**
  * Delete sync file
  */
@@ -604,16 +657,14 @@ export class GoogleDriveAdapter {
   /**
    * Upload sync file
    */
-  async upload(syncedFile: SyncedFile): Promise<string> {
+  async upload(syncedFile: SyncedFile): Promise<SyncUploadResult> {
     const accessToken = await this.ensureValidToken();
 
-    if (this.fileId) {
-      await updateSyncFile(accessToken, this.fileId, syncedFile);
-      return this.fileId;
-    } else {
-      this.fileId = await createSyncFile(accessToken, syncedFile);
-      return this.fileId;
-    }
+    const result = this.fileId
+      ? await updateSyncFile(accessToken, this.fileId, syncedFile)
+      : await createSyncFile(accessToken, syncedFile);
+    this.fileId = result.resourceId;
+    return result;
   }
 
   /**
@@ -633,6 +684,23 @@ export class GoogleDriveAdapter {
     return downloadSyncFile(accessToken, this.fileId);
   }
 
+  /**
+   * Current remote revision (file version), null if there is no sync file
+   */
+  async getRemoteRevision(): Promise<string | null> {
+    const accessToken = await this.ensureValidToken();
+
+    if (!this.fileId) {
+      this.fileId = await findSyncFile(accessToken);
+    }
+
+    if (!this.fileId) {
+      return null;
+    }
+
+    return getSyncFileRevision(accessToken, this.fileId);
+  }
+
   /**
    * Delete sync data
    */
@@ -17,6 +17,7 @@ import {
   type OAuthTokens,
   type ProviderAccount,
   type SyncedFile,
+  type SyncUploadResult,
   type PKCEChallenge,
 } from '../../../domain/sync';
 import { netcattyBridge } from '../netcattyBridge';
@@ -38,6 +39,8 @@ export interface DriveItem {
   name: string;
   lastModifiedDateTime: string;
   size?: number;
+  cTag?: string;
+  eTag?: string;
   '@microsoft.graph.downloadUrl'?: string;
 }
 
@@ -352,7 +355,7 @@ export const findSyncFile = async (accessToken: string): Promise<string | null>
 export const uploadSyncFile = async (
   accessToken: string,
   syncedFile: SyncedFile
-): Promise<string> => {
+): Promise<SyncUploadResult> => {
   const bridge = netcattyBridge.get();
   if (bridge?.onedriveUploadSyncFile) {
     const result = await bridge.onedriveUploadSyncFile({
@@ -363,7 +366,7 @@ export const uploadSyncFile = async (
     if (!result.fileId) {
       throw new Error('Failed to upload sync file');
     }
-    return result.fileId;
+    return { resourceId: result.fileId, revision: result.revision ?? null };
   }
   const content = JSON.stringify(syncedFile, null, 2);
 
@@ -384,7 +387,7 @@ export const uploadSyncFile = async (
   }
 
   const item: DriveItem = await response.json();
-  return item.id;
+  return { resourceId: item.id, revision: item.cTag || item.eTag || null };
 };
 
 /**
@@ -429,6 +432,44 @@ export const downloadSyncFile = async (
   }
 };
 
+/**
+ * Get sync file revision (cTag) without downloading the content
+ */
+export const getSyncFileRevision = async (
+  accessToken: string,
+  fileId?: string
+): Promise<string | null> => {
+  const bridge = netcattyBridge.get();
+  if (bridge?.onedriveGetSyncFileRevision) {
+    const result = await bridge.onedriveGetSyncFileRevision({
+      accessToken,
+      fileId,
+      fileName: SYNC_CONSTANTS.SYNC_FILE_NAME,
+    });
+    return result.revision || null;
+  }
+  const url = fileId
+    ? `${SYNC_CONSTANTS.ONEDRIVE_GRAPH_API}/me/drive/items/${fileId}`
+    : `${SYNC_CONSTANTS.ONEDRIVE_GRAPH_API}/me${APP_FOLDER_PATH}:/${SYNC_CONSTANTS.SYNC_FILE_NAME}`;
+
+  const response = await fetch(`${url}?$select=id,cTag,eTag`, {
+    headers: {
+      'Authorization': `Bearer ${accessToken}`,
+    },
+  });
+
+  if (response.status === 404) {
+    return null;
+  }
+
+  if (!response.ok) {
+    throw new Error('Failed to get sync file revision');
+  }
+
+  const item: { cTag?: string; eTag?: string } = await response.json();
+  return item.cTag || item.eTag || null;
+};
+
 /**
  * Delete sync file
  */
@@ -602,10 +643,11 @@ export class OneDriveAdapter {
   /**
    * Upload sync file
    */
-  async upload(syncedFile: SyncedFile): Promise<string> {
+  async upload(syncedFile: SyncedFile): Promise<SyncUploadResult> {
     return this.runWithAuthRetry('upload', async (accessToken) => {
-      this.fileId = await uploadSyncFile(accessToken, syncedFile);
-      return this.fileId;
+      const result = await uploadSyncFile(accessToken, syncedFile);
+      this.fileId = result.resourceId;
+      return result;
     });
   }
 
@@ -621,6 +663,15 @@ export class OneDriveAdapter {
     });
   }
 
+  /**
+   * Current remote revision (content tag), null if there is no sync file
+   */
+  async getRemoteRevision(): Promise<string | null> {
+    return this.runWithAuthRetry('getRemoteRevision', async (accessToken) => {
+      return getSyncFileRevision(accessToken, this.fileId || undefined);
+    });
+  }
+
   /**
    * Delete sync data
    */
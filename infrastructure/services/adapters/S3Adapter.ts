@@ -13,6 +13,7 @@ import {
   SYNC_CONSTANTS,
   type S3Config,
   type SyncedFile,
+  type SyncUploadResult,
   type ProviderAccount,
   type OAuthTokens,
 } from '../../../domain/sync';
@@ -107,7 +108,7 @@ export class S3Adapter {
     return this.resource;
   }
 
-  async upload(syncedFile: SyncedFile): Promise<string> {
+  async upload(syncedFile: SyncedFile): Promise<SyncUploadResult> {
     if (!this.config) {
       throw new Error('Missing S3 config');
     }
@@ -115,18 +116,18 @@ export class S3Adapter {
     if (bridge?.cloudSyncS3Upload) {
       const result = await bridge.cloudSyncS3Upload(this.config, syncedFile);
       this.resource = result?.resourceId || this.getObjectKey();
-      return this.resource;
+      return { resourceId: this.resource, revision: result?.revision ?? null };
     }
     const body = JSON.stringify(syncedFile);
     const client = this.getClient();
-    await client.send(new PutObjectCommand({
+    const response = await client.send(new PutObjectCommand({
       Bucket: this.config.bucket,
       Key: this.getObjectKey(),
       Body: body,
       ContentType: 'application/json',
     }));
     this.resource = this.getObjectKey();
-    return this.resource;
+    return { resourceId: this.resource, revision: response.ETag ?? null };
   }
 
   async download(): Promise<SyncedFile | null> {
@@ -155,6 +156,33 @@ export class S3Adapter {
     }
   }
 
+  /**
+   * Current remote revision (HeadObject ETag), null if the object is missing
+   */
+  async getRemoteRevision(): Promise<string | null> {
+    if (!this.config) {
+      throw new Error('Missing S3 config');
+    }
+    const bridge = netcattyBridge.get();
+    if (bridge?.cloudSyncS3Revision) {
+      const result = await bridge.cloudSyncS3Revision(this.config);
+      return result?.revision ?? null;
+    }
+    const client = this.getClient();
+    try {
+      const response = await client.send(new HeadObjectCommand({
+        Bucket: this.config.bucket,
+        Key: this.getObjectKey(),
+      }));
+      return response.ETag || response.LastModified?.toISOString() || null;
+    } catch (error) {
+      if (this.isNotFound(error)) {
+        return null;
+      }
+      throw error;
+    }
+  }
+
   async deleteSync(): Promise<void> {
     if (!this.config) {
       return;
@@ -7,6 +7,7 @@ import {
   SYNC_CONSTANTS,
   type WebDAVConfig,
   type SyncedFile,
+  type SyncUploadResult,
   type ProviderAccount,
   type OAuthTokens,
 } from '../../../domain/sync';
@@ -78,7 +79,7 @@ export class WebDAVAdapter {
     });
   }
 
-  async upload(syncedFile: SyncedFile): Promise<string> {
+  async upload(syncedFile: SyncedFile): Promise<SyncUploadResult> {
     return this.withWebdavErrorContext('upload', async () => {
       if (!this.config) {
         throw new Error('Missing WebDAV config');
@@ -87,13 +88,14 @@ export class WebDAVAdapter {
       if (bridge?.cloudSyncWebdavUpload) {
         const result = await bridge.cloudSyncWebdavUpload(this.config, syncedFile);
         this.resource = result?.resourceId || this.getSyncPath();
-        return this.resource;
+        return { resourceId: this.resource, revision: result?.revision ?? null };
       }
       const client = this.getClient();
       const path = this.getSyncPath();
+      // putFileContents does not expose the response ETag; the next sync probes
       await client.putFileContents(path, JSON.stringify(syncedFile), { overwrite: true });
       this.resource = path;
-      return path;
+      return { resourceId: path, revision: null };
     });
   }
 
@@ -117,6 +119,30 @@ export class WebDAVAdapter {
     });
   }
 
+  /**
+   * Current remote revision (PROPFIND ETag), null if the file is missing
+   */
+  async getRemoteRevision(): Promise<string | null> {
+    return this.withWebdavErrorContext('revision', async () => {
+      if (!this.config) {
+        throw new Error('Missing WebDAV config');
+      }
+      const bridge = netcattyBridge.get();
+      if (bridge?.cloudSyncWebdavRevision) {
+        const result = await bridge.cloudSyncWebdavRevision(this.config);
+        return result?.revision ?? null;
+      }
+      const client = this.getClient();
+      try {
+        const stat = await client.stat(this.getSyncPath()) as { etag?: string | null; lastmod?: string; size?: number };
+        return stat.etag || (stat.lastmod ? `${stat.lastmod}:${stat.size}` : null);
+      } catch (error) {
+        if ((error as { status?: number })?.status === 404) return null;
+        throw error;
+      }
+    });
+  }
+
   async deleteSync(): Promise<void> {
     return this.withWebdavErrorContext('delete', async () => {
       if (!this.config) {
@@ -5,6 +5,7 @@
 import type {
   CloudProvider,
   SyncedFile,
+  SyncUploadResult,
   OAuthTokens,
   ProviderAccount,
   WebDAVConfig,
@@ -21,8 +22,10 @@ export interface CloudAdapter {
   
   signOut(): void;
   initializeSync(): Promise<string | null>;
-  upload(syncedFile: SyncedFile): Promise<string>;
+  upload(syncedFile: SyncedFile): Promise<SyncUploadResult>;
   download(): Promise<SyncedFile | null>;
+  /** Cheap metadata probe; changes whenever the remote file does, null if it is missing */
+  getRemoteRevision(): Promise<string | null>;
   deleteSync(): Promise<void>;
   getTokens(): OAuthTokens | null;
 }
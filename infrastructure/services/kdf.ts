@@ -0,0 +1,477 @@
+/**
+ * Key derivation functions used by EncryptionService
+ *
+ * Everything here is synchronous or Web Crypto based and has no DOM
+ * dependency, so it runs unchanged inside kdf.worker.ts. Argon2id is
+ * implemented in plain TypeScript (RFC 9106, version 0x13) on 32-bit word
+ * pairs; it is slower than native code, which calibrateArgon2id accounts for
+ * by measuring the local machine.
+ */
+
+export interface Pbkdf2Params {
+  kdf: 'PBKDF2';
+  iterations: number;
+}
+
+export interface Argon2idParams {
+  kdf: 'Argon2id';
+  memoryKiB: number;
+  iterations: number;
+  parallelism: number;
+}
+
+export type KdfParams = Pbkdf2Params | Argon2idParams;
+
+interface Argon2Options {
+  memoryKiB: number;
+  iterations: number;
+  parallelism: number;
+  hashLength: number;
+  secret?: Uint8Array;
+  associatedData?: Uint8Array;
+}
+
+// AES-256 key length in bytes
+const KEY_BYTES = 32;
+
+const toArrayBuffer = (bytes: Uint8Array): ArrayBuffer =>
+  bytes.buffer.slice(bytes.byteOffset, bytes.byteOffset + bytes.byteLength) as ArrayBuffer;
+
+// ============================================================================
+// BLAKE2b (RFC 7693), 64-bit words stored as little-endian uint32 pairs
+// ============================================================================
+
+const BLAKE2B_IV = new Uint32Array([
+  0xf3bcc908, 0x6a09e667, 0x84caa73b, 0xbb67ae85, 0xfe94f82b, 0x3c6ef372, 0x5f1d36f1, 0xa54ff53a,
+  0xade682d1, 0x510e527f, 0x2b3e6c1f, 0x9b05688c, 0xfb41bd6b, 0x1f83d9ab, 0x137e2179, 0x5be0cd19,
+]);
+
+// Message schedule, pre-doubled to index uint32 pairs; rounds 10 and 11 repeat 0 and 1
+const SIGMA = [
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3,
+  11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4,
+  7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8,
+  9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13,
+  2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9,
+  12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11,
+  13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10,
+  6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5,
+  10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3,
+].map((x) => x * 2);
+
+const b2v = new Uint32Array(32);
+const b2m = new Uint32Array(32);
+
+// v[a] += v[b]
+const add64 = (v: Uint32Array, a: number, b: number) => {
+  const lo = v[a] + v[b];
+  v[a + 1] = v[a + 1] + v[b + 1] + (lo >= 0x100000000 ? 1 : 0);
+  v[a] = lo;
+};
+
+// v[a] += (lo, hi)
+const add64c = (v: Uint32Array, a: number, lo: number, hi: number) => {
+  const sum = v[a] + lo;
+  v[a + 1] = v[a + 1] + hi + (sum >= 0x100000000 ? 1 : 0);
+  v[a] = sum;
+};
+
+const blake2bMix = (a: number, b: number, c: number, d: number, ix: number, iy: number) => {
+  const v = b2v;
+  add64(v, a, b);
+  add64c(v, a, b2m[ix], b2m[ix + 1]);
+  let x0 = v[d] ^ v[a];
+  let x1 = v[d + 1] ^ v[a + 1];
+  v[d] = x1;
+  v[d + 1] = x0;
+  add64(v, c, d);
+  x0 = v[b] ^ v[c];
+  x1 = v[b + 1] ^ v[c + 1];
+  v[b] = (x0 >>> 24) ^ (x1 << 8);
+  v[b + 1] = (x1 >>> 24) ^ (x0 << 8);
+  add64(v, a, b);
+  add64c(v, a, b2m[iy], b2m[iy + 1]);
+  x0 = v[d] ^ v[a];
+  x1 = v[d + 1] ^ v[a + 1];
+  v[d] = (x0 >>> 16) ^ (x1 << 16);
+  v[d + 1] = (x1 >>> 16) ^ (x0 << 16);
+  add64(v, c, d);
+  x0 = v[b] ^ v[c];
+  x1 = v[b + 1] ^ v[c + 1];
+  v[b] = (x1 >>> 31) ^ (x0 << 1);
+  v[b + 1] = (x0 >>> 31) ^ (x1 << 1);
+};
+
+const blake2bCompress = (h: Uint32Array, block: Uint8Array, counter: number, last: boolean) => {
+  for (let i = 0; i < 16; i++) {
+    b2v[i] = h[i];
+    b2v[i + 16] = BLAKE2B_IV[i];
+  }
+  b2v[24] ^= counter >>> 0;
+  b2v[25] ^= Math.floor(counter / 0x100000000);
+  if (last) {
+    b2v[28] = ~b2v[28];
+    b2v[29] = ~b2v[29];
+  }
+  for (let i = 0; i < 32; i++) {
+    b2m[i] = block[i * 4] | (block[i * 4 + 1] << 8) | (block[i * 4 + 2] << 16) | (block[i * 4 + 3] << 24);
+  }
+  for (let r = 0; r < 12; r++) {
+    const s = r * 16;
+    blakeRound(s);
+  }
+  for (let i = 0; i < 16; i++) h[i] ^= b2v[i] ^ b2v[i + 16];
+};
+
+const blakeRound = (s: number) => {
+  blake2bMix(0, 8, 16, 24, SIGMA[s], SIGMA[s + 1]);
+  blake2bMix(2, 10, 18, 26, SIGMA[s + 2], SIGMA[s + 3]);
+  blake2bMix(4, 12, 20, 28, SIGMA[s + 4], SIGMA[s + 5]);
+  blake2bMix(6, 14, 22, 30, SIGMA[s + 6], SIGMA[s + 7]);
+  blake2bMix(0, 10, 20, 30, SIGMA[s + 8], SIGMA[s + 9]);
+  blake2bMix(2, 12, 22, 24, SIGMA[s + 10], SIGMA[s + 11]);
+  blake2bMix(4, 14, 16, 26, SIGMA[s + 12], SIGMA[s + 13]);
+  blake2bMix(6, 8, 18, 28, SIGMA[s + 14], SIGMA[s + 15]);
+};
+
+/**
+ * Unkeyed BLAKE2b with 1..64 bytes of output
+ */
+export const blake2b = (input: Uint8Array, outLength: number): Uint8Array => {
+  const h = new Uint32Array(BLAKE2B_IV);
+  h[0] ^= 0x01010000 ^ outLength;
+  const block = new Uint8Array(128);
+  let offset = 0;
+  while (input.length - offset > 128) {
+    block.set(input.subarray(offset, offset + 128));
+    offset += 128;
+    blake2bCompress(h, block, offset, false);
+  }
+  block.fill(0);
+  block.set(input.subarray(offset));
+  blake2bCompress(h, block, input.length, true);
+
+  const out = new Uint8Array(outLength);
+  for (let i = 0; i < outLength; i++) out[i] = h[i >> 2] >>> (8 * (i & 3));
+  return out;
+};
+
+// ============================================================================
+// Argon2id (RFC 9106)
+// ============================================================================
+
+const ARGON2_VERSION = 0x13;
+const ARGON2_TYPE_ID = 2;
+const SYNC_POINTS = 4;
+// Block = 1024 bytes = 128 64-bit words = 256 uint32
+const BLOCK_WORDS = 256;
+
+const le32 = (value: number) => new Uint8Array([value, value >>> 8, value >>> 16, value >>> 24]);
+
+const concatBytes = (...parts: Uint8Array[]) => {
+  const out = new Uint8Array(parts.reduce((n, p) => n + p.length, 0));
+  let offset = 0;
+  for (const part of parts) {
+    out.set(part, offset);
+    offset += part.length;
+  }
+  return out;
+};
+
+/**
+ * Variable-length hash H' from RFC 9106 section 3.3
+ */
+const blake2bLong = (input: Uint8Array, outLength: number): Uint8Array => {
+  const prefixed = concatBytes(le32(outLength), input);
+  if (outLength <= 64) return blake2b(prefixed, outLength);
+  const out = new Uint8Array(outLength);
+  const rounds = Math.ceil(outLength / 32) - 2;
+  let v = blake2b(prefixed, 64);
+  out.set(v.subarray(0, 32), 0);
+  for (let i = 1; i < rounds; i++) {
+    v = blake2b(v, 64);
+    out.set(v.subarray(0, 32), i * 32);
+  }
+  out.set(blake2b(v, outLength - 32 * rounds), rounds * 32);
+  return out;
+};
+
+// High 32 bits of the 64-bit product of two uint32 values
+const mulHi = (x: number, y: number) => {
+  const xl = x & 0xffff;
+  const xh = x >>> 16;
+  const yl = y & 0xffff;
+  const yh = y >>> 16;
+  const b = xh * yl + ((xl * yl) >>> 16);
+  const c = xl * yh + (b % 65536);
+  return (xh * yh + Math.floor(b / 65536) + Math.floor(c / 65536)) >>> 0;
+};
+
+// Lo-word positions of the 16 words each permutation call works on
+const ROW_INDEX: Int32Array[] = [];
+const COLUMN_INDEX: Int32Array[] = [];
+for (let i = 0; i < 8; i++) {
+  const row = new Int32Array(16);
+  const column = new Int32Array(16);
+  for (let j = 0; j < 16; j++) {
+    row[j] = (16 * i + j) * 2;
+    column[j] = (2 * i + (j & 1) + 16 * (j >> 1)) * 2;
+  }
+  ROW_INDEX.push(row);
+  COLUMN_INDEX.push(column);
+}
+
+// BlaMka: a = a + b + 2 * lo32(a) * lo32(b)
+const blaMka = (v: Uint32Array, a: number, b: number) => {
+  const al = v[a];
+  const bl = v[b];
+  const pLo = Math.imul(al, bl) >>> 0;
+  const pHi = mulHi(al, bl);
+  const lo = al + bl + ((pLo << 1) >>> 0);
+  v[a + 1] = v[a + 1] + v[b + 1] + ((pHi << 1) | (pLo >>> 31)) + Math.floor(lo / 0x100000000);
+  v[a] = lo;
+};
+
+const mixRotate = (v: Uint32Array, d: number, a: number, bits: number) => {
+  const x0 = v[d] ^ v[a];
+  const x1 = v[d + 1] ^ v[a + 1];
+  if (bits === 32) {
+    v[d] = x1;
+    v[d + 1] = x0;
+  } else if (bits === 63) {
+    v[d] = (x1 >>> 31) ^ (x0 << 1);
+    v[d + 1] = (x0 >>> 31) ^ (x1 << 1);
+  } else {
+    v[d] = (x0 >>> bits) ^ (x1 << (32 - bits));
+    v[d + 1] = (x1 >>> bits) ^ (x0 << (32 - bits));
+  }
+};
+
+const gb = (v: Uint32Array, a: number, b: number, c: number, d: number) => {
+  blaMka(v, a, b);
+  mixRotate(v, d, a, 32);
+  blaMka(v, c, d);
+  mixRotate(v, b, c, 24);
+  blaMka(v, a, b);
+  mixRotate(v, d, a, 16);
+  blaMka(v, c, d);
+  mixRotate(v, b, c, 63);
+};
+
+const permute = (v: Uint32Array, w: Int32Array) => {
+  gb(v, w[0], w[4], w[8], w[12]);
+  gb(v, w[1], w[5], w[9], w[13]);
+  gb(v, w[2], w[6], w[10], w[14]);
+  gb(v, w[3], w[7], w[11], w[15]);
+  gb(v, w[0], w[5], w[10], w[15]);
+  gb(v, w[1], w[6], w[11], w[12]);
+  gb(v, w[2], w[7], w[8], w[13]);
+  gb(v, w[3], w[4], w[9], w[14]);
+};
+
+const blockR = new Uint32Array(BLOCK_WORDS);
+const blockZ = new Uint32Array(BLOCK_WORDS);
+
+/**
+ * Compression function G: out (^)= P(x ^ y) ^ x ^ y
+ */
+const compress = (
+  x: Uint32Array, xOff: number,
+  y: Uint32Array, yOff: number,
+  out: Uint32Array, outOff: number,
+  withXor: boolean,
+) => {
+  for (let i = 0; i < BLOCK_WORDS; i++) {
+    const r = x[xOff + i] ^ y[yOff + i];
+    blockR[i] = r;
+    blockZ[i] = r;
+  }
+  for (let i = 0; i < 8; i++) permute(blockZ, ROW_INDEX[i]);
+  for (let i = 0; i < 8; i++) permute(blockZ, COLUMN_INDEX[i]);
+  if (withXor) {
+    for (let i = 0; i < BLOCK_WORDS; i++) out[outOff + i] ^= blockZ[i] ^ blockR[i];
+  } else {
+    for (let i = 0; i < BLOCK_WORDS; i++) out[outOff + i] = blockZ[i] ^ blockR[i];
+  }
+};
+
+const bytesToWords = (bytes: Uint8Array, out: Uint32Array, outOff: number) => {
+  for (let i = 0; i < BLOCK_WORDS; i++) {
+    const j = i * 4;
+    out[outOff + i] = (bytes[j] | (bytes[j + 1] << 8) | (bytes[j + 2] << 16) | (bytes[j + 3] << 24)) >>> 0;
+  }
+};
+
+/**
+ * Argon2id raw hash
+ */
+export const argon2id = (password: Uint8Array, salt: Uint8Array, options: Argon2Options): Uint8Array => {
+  const { iterations, parallelism: lanes, hashLength } = options;
+  const secret = options.secret ?? new Uint8Array(0);
+  const ad = options.associatedData ?? new Uint8Array(0);
+  if (iterations < 1 || lanes < 1 || options.memoryKiB < 8 * lanes) {
+    throw new Error('Invalid Argon2id parameters');
+  }
+
+  const h0 = blake2b(concatBytes(
+    le32(lanes), le32(hashLength), le32(options.memoryKiB), le32(iterations),
+    le32(ARGON2_VERSION), le32(ARGON2_TYPE_ID),
+    le32(password.length), password,
+    le32(salt.length), salt,
+    le32(secret.length), secret,
+    le32(ad.length), ad,
+  ), 64);
+
+  const segmentLength = Math.floor(options.memoryKiB / (SYNC_POINTS * lanes));
+  const laneLength = segmentLength * SYNC_POINTS;
+  const blockCount = laneLength * lanes;
+  const memory = new Uint32Array(blockCount * BLOCK_WORDS);
+
+  for (let lane = 0; lane < lanes; lane++) {
+    for (let k = 0; k < 2; k++) {
+      const seed = blake2bLong(concatBytes(h0, le32(k), le32(lane)), 1024);
+      bytesToWords(seed, memory, (lane * laneLength + k) * BLOCK_WORDS);
+    }
+  }
+
+  const zero = new Uint32Array(BLOCK_WORDS);
+  const addressInput = new Uint32Array(BLOCK_WORDS);
+  const addressTmp = new Uint32Array(BLOCK_WORDS);
+  const addresses = new Uint32Array(BLOCK_WORDS);
+
+  for (let pass = 0; pass < iterations; pass++) {
+    for (let slice = 0; slice < SYNC_POINTS; slice++) {
+      for (let lane = 0; lane < lanes; lane++) {
+        const dataIndependent = pass === 0 && slice < SYNC_POINTS / 2;
+        if (dataIndependent) {
+          addressInput.fill(0);
+          addressInput[0] = pass;
+          addressInput[2] = lane;
+          addressInput[4] = slice;
+          addressInput[6] = blockCount;
+          addressInput[8] = iterations;
+          addressInput[10] = ARGON2_TYPE_ID;
+        }
+        const nextAddresses = () => {
+          addressInput[12]++;
+          compress(zero, 0, addressInput, 0, addressTmp, 0, false);
+          compress(zero, 0, addressTmp, 0, addresses, 0, false);
+        };
+
+        const startIndex = pass === 0 && slice === 0 ? 2 : 0;
+        if (dataIndependent && startIndex !== 0) nextAddresses();
+
+        let current = lane * laneLength + slice * segmentLength + startIndex;
+        let previous = current % laneLength === 0 ? current + laneLength - 1 : current - 1;
+
+        for (let index = startIndex; index < segmentLength; index++, current++, previous++) {
+          if (current % laneLength === 1) previous = current - 1;
+
+          let j1: number;
+          let j2: number;
+          if (dataIndependent) {
+            if (index % 128 === 0) nextAddresses();
+            j1 = addresses[(index % 128) * 2];
+            j2 = addresses[(index % 128) * 2 + 1];
+          } else {
+            j1 = memory[previous * BLOCK_WORDS];
+            j2 = memory[previous * BLOCK_WORDS + 1];
+          }
+
+          const refLane = pass === 0 && slice === 0 ? lane : j2 % lanes;
+          const sameLane = refLane === lane;
+          let areaSize: number;
+          if (pass === 0) {
+            if (slice === 0) areaSize = index - 1;
+            else areaSize = slice * segmentLength + (sameLane ? index - 1 : index === 0 ? -1 : 0);
+          } else {
+            areaSize = laneLength - segmentLength + (sameLane ? index - 1 : index === 0 ? -1 : 0);
+          }
+          const x = mulHi(j1, j1);
+          const relative = areaSize - 1 - mulHi(areaSize, x);
+          const start = pass !== 0 && slice !== SYNC_POINTS - 1 ? (slice + 1) * segmentLength : 0;
+          const refIndex = (start + relative) % laneLength;
+
+          compress(
+            memory, previous * BLOCK_WORDS,
+            memory, (refLane * laneLength + refIndex) * BLOCK_WORDS,
+            memory, current * BLOCK_WORDS,
+            pass > 0,
+          );
+        }
+      }
+    }
+  }
+
+  const final = new Uint32Array(BLOCK_WORDS);
+  for (let lane = 0; lane < lanes; lane++) {
+    const offset = (lane * laneLength + laneLength - 1) * BLOCK_WORDS;
+    for (let i = 0; i < BLOCK_WORDS; i++) final[i] ^= memory[offset + i];
+  }
+  const finalBytes = new Uint8Array(BLOCK_WORDS * 4);
+  for (let i = 0; i < BLOCK_WORDS; i++) {
+    finalBytes[i * 4] = final[i];
+    finalBytes[i * 4 + 1] = final[i] >>> 8;
+    finalBytes[i * 4 + 2] = final[i] >>> 16;
+    finalBytes[i * 4 + 3] = final[i] >>> 24;
+  }
+  return blake2bLong(finalBytes, hashLength);
+};
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+/**
+ * Derive raw AES-256 key bytes from a password
+ */
+export const deriveKeyBytes = async (
+  password: string,
+  salt: Uint8Array,
+  params: KdfParams,
+): Promise<Uint8Array> => {
+  const passwordBytes = new TextEncoder().encode(password);
+  if (params.kdf === 'Argon2id') {
+    return argon2id(passwordBytes, salt, {
+      memoryKiB: params.memoryKiB,
+      iterations: params.iterations,
+      parallelism: params.parallelism,
+      hashLength: KEY_BYTES,
+    });
+  }
+  const passwordKey = await crypto.subtle.importKey('raw', toArrayBuffer(passwordBytes), 'PBKDF2', false, ['deriveBits']);
+  const bits = await crypto.subtle.deriveBits(
+    { name: 'PBKDF2', salt: toArrayBuffer(salt), iterations: params.iterations, hash: 'SHA-256' },
+    passwordKey,
+    KEY_BYTES * 8,
+  );
+  return new Uint8Array(bits);
+};
+
+export interface Argon2CalibrationLimits {
+  targetMs: number;
+  iterations: number;
+  minMemoryKiB: number;
+  maxMemoryKiB: number;
+}
+
+/**
+ * Pick the Argon2id memory cost that takes about targetMs on this machine.
+ * Never goes below minMemoryKiB, so slow machines get a slower unlock rather
+ * than weaker parameters.
+ */
+export const calibrateArgon2id = (limits: Argon2CalibrationLimits): Argon2idParams => {
+  const sampleKiB = 8192;
+  const sampleSalt = new Uint8Array(16);
+  const started = performance.now();
+  argon2id(new Uint8Array(8), sampleSalt, { memoryKiB: sampleKiB, iterations: 1, parallelism: 1, hashLength: KEY_BYTES });
+  const msPerKiBPass = Math.max(1e-6, (performance.now() - started) / sampleKiB);
+
+  const fitted = limits.targetMs / (msPerKiBPass * limits.iterations);
+  // Whole MiB keeps the stored parameters readable
+  const memoryKiB = Math.min(limits.maxMemoryKiB, Math.max(limits.minMemoryKiB, Math.floor(fitted / 1024) * 1024));
+  return { kdf: 'Argon2id', memoryKiB, iterations: limits.iterations, parallelism: 1 };
+};
@@ -0,0 +1,25 @@
+import { calibrateArgon2id, deriveKeyBytes, type Argon2CalibrationLimits, type KdfParams } from "./kdf";
+
+/**
+ * KDF worker: runs PBKDF2 and Argon2id off the UI thread. Requests:
+ * { id, op: "derive", password, salt, params } -> { id, key }
+ * { id, op: "calibrate", limits } -> { id, params }
+ * Failures reply { id, error }.
+ */
+type KdfRequest =
+    | { id: number; op: "derive"; password: string; salt: Uint8Array; params: KdfParams }
+    | { id: number; op: "calibrate"; limits: Argon2CalibrationLimits };
+
+self.onmessage = async (event: MessageEvent<KdfRequest>) => {
+    const request = event.data;
+    try {
+        if (request.op === "derive") {
+            const key = await deriveKeyBytes(request.password, request.salt, request.params);
+            (self as unknown as Worker).postMessage({ id: request.id, key }, [key.buffer]);
+        } else {
+            self.postMessage({ id: request.id, params: calibrateArgon2id(request.limits) });
+        }
+    } catch (error) {
+        self.postMessage({ id: request.id, error: error instanceof Error ? error.message : String(error) });
+    }
+};
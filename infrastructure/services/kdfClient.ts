@@ -0,0 +1,98 @@
+import {
+  calibrateArgon2id,
+  deriveKeyBytes,
+  type Argon2CalibrationLimits,
+  type Argon2idParams,
+  type KdfParams,
+} from './kdf';
+
+/**
+ * Runs key derivation in kdf.worker.ts so unlocking never blocks the UI.
+ * Requests are multiplexed over one long-lived worker; where workers are
+ * unavailable the same code runs in-thread.
+ */
+
+type KdfResponse = { id: number; key?: Uint8Array; params?: Argon2idParams; error?: string };
+
+let kdfWorker: Worker | null = null;
+let workerFailed = false;
+let nextRequestId = 0;
+type PendingRequest = {
+  resolve: (value: KdfResponse) => void;
+  reject: (error: Error) => void;
+  // In-thread equivalent, used when the worker dies before answering
+  runInThread: () => Promise<KdfResponse>;
+};
+const pending = new Map<number, PendingRequest>();
+
+const getWorker = (): Worker | null => {
+  if (workerFailed || typeof Worker === 'undefined') return null;
+  if (!kdfWorker) {
+    try {
+      kdfWorker = new Worker(new URL('./kdf.worker.ts', import.meta.url), { type: 'module' });
+    } catch {
+      workerFailed = true;
+      return null;
+    }
+    kdfWorker.addEventListener('message', (event: MessageEvent<KdfResponse>) => {
+      const entry = pending.get(event.data.id);
+      if (!entry) return;
+      pending.delete(event.data.id);
+      if (event.data.error) entry.reject(new Error(event.data.error));
+      else entry.resolve(event.data);
+    });
+    kdfWorker.addEventListener('error', (event: ErrorEvent) => {
+      // A worker that fails to load or crashes says nothing about the password,
+      // so in-flight requests are re-run in-thread, as are all later calls
+      console.warn('[KDF] Worker failed, deriving in-thread', event.message);
+      workerFailed = true;
+      kdfWorker?.terminate();
+      kdfWorker = null;
+      const orphaned = [...pending.values()];
+      pending.clear();
+      for (const entry of orphaned) entry.runInThread().then(entry.resolve, entry.reject);
+    });
+  }
+  return kdfWorker;
+};
+
+const request = (
+  message: Record<string, unknown>,
+  runInThread: () => Promise<KdfResponse>,
+): Promise<KdfResponse> => {
+  const worker = getWorker();
+  if (!worker) return runInThread();
+  const id = ++nextRequestId;
+  return new Promise((resolve, reject) => {
+    pending.set(id, { resolve, reject, runInThread });
+    worker.postMessage({ ...message, id });
+  });
+};
+
+/**
+ * Derive raw AES-256 key bytes off the UI thread
+ */
+export const deriveKeyBytesOffThread = async (
+  password: string,
+  salt: Uint8Array,
+  params: KdfParams,
+): Promise<Uint8Array> => {
+  const { key } = await request(
+    { op: 'derive', password, salt, params },
+    async () => ({ id: 0, key: await deriveKeyBytes(password, salt, params) }),
+  );
+  if (!key) throw new Error('KDF worker returned no key');
+  return key;
+};
+
+/**
+ * Measure Argon2id on this machine and return parameters for the target time
+ */
+export const calibrateArgon2idOffThread = async (limits: Argon2CalibrationLimits): Promise<Argon2idParams> => {
+  const { params } = await request(
+    { op: 'calibrate', limits },
+    async () => ({ id: 0, params: await calibrateArgon2id(limits) }),
+  );
+  if (!params) throw new Error('KDF worker returned no parameters');
+  return params;
+};
@@ -256,6 +256,8 @@ export const startPortForward = async (
       username: host.username,
       password: host.password,
       privateKey,
+      transportProfile: host.transportProfile,
+      onDemand: rule.onDemand && rule.type !== 'remote',
     });
     
     if (!result.success) {
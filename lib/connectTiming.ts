@@ -0,0 +1,15 @@
+import type { I18nContextValue } from "../application/i18n/I18nProvider";
+import type { ConnectTiming } from "../domain/models";
+
+/**
+ * Connect-time breakdown for display, e.g. "DNS 2 ms, TCP 31 ms, ... (2001:db8::1)"
+ */
+export const formatConnectTiming = (timing: ConnectTiming, t: I18nContextValue["t"]): string => {
+  const text = t("logs.connectTiming", {
+    dns: timing.dnsMs,
+    tcp: timing.tcpMs,
+    kex: timing.kexMs,
+    auth: timing.authMs,
+  });
+  return timing.address ? `${text} (${timing.address})` : text;
+};
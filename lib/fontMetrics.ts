@@ -0,0 +1,72 @@
+import type { FontMetrics } from "../infrastructure/config/fonts";
+
+/**
+ * Canvas-based font measurement shared by the font metrics worker and the
+ * main-thread fallback. Only needs `font` + `measureText`, which both
+ * CanvasRenderingContext2D and OffscreenCanvasRenderingContext2D provide.
+ */
+export interface MeasureContext {
+    font: string;
+    measureText(text: string): { width: number };
+}
+
+const MEASURE_SIZE = 32;
+const EPSILON = 0.05;
+
+const PROBES = {
+    latin: "mmmmmmmmmmlli",
+    cjk: "中文字體の한",
+    // Powerline separators (U+E0B0..U+E0B3)
+    powerline: "\uE0B0\uE0B1\uE0B2\uE0B3",
+    // Nerd Font icons: nf-custom-folder, nf-fa-folder_open, nf-dev-git
+    nerdFont: "\uE5FF\uF115\uE702",
+};
+
+const quote = (family: string) => `"${family.replace(/"/g, '\\"')}"`;
+
+const width = (ctx: MeasureContext, font: string, text: string): number => {
+    ctx.font = font;
+    return ctx.measureText(text).width;
+};
+
+const same = (a: number, b: number) => Math.abs(a - b) < EPSILON;
+
+/**
+ * A probe is covered when the font renders it independently of the generic
+ * fallback. If both generic fallbacks happen to agree (e.g. both draw tofu),
+ * the result must also differ from the plain fallback to count as covered.
+ */
+const covers = (ctx: MeasureContext, family: string, text: string): boolean => {
+    const withMono = width(ctx, `${MEASURE_SIZE}px ${quote(family)}, monospace`, text);
+    const withSerif = width(ctx, `${MEASURE_SIZE}px ${quote(family)}, serif`, text);
+    if (!same(withMono, withSerif)) return false;
+    const fallbackMono = width(ctx, `${MEASURE_SIZE}px monospace`, text);
+    const fallbackSerif = width(ctx, `${MEASURE_SIZE}px serif`, text);
+    if (!same(fallbackMono, fallbackSerif)) return true;
+    return !same(withMono, fallbackMono);
+};
+
+export function measureFontFamily(ctx: MeasureContext, family: string): FontMetrics {
+    const available = covers(ctx, family, PROBES.latin);
+    if (!available) {
+        return { family, available, monospace: false, cellWidth: 0, cjk: false, powerline: false, nerdFont: false };
+    }
+
+    const font = `${MEASURE_SIZE}px ${quote(family)}, monospace`;
+    const cell = width(ctx, font, "M");
+    const monospace = ["i", "W", ".", "0"].every(ch => same(width(ctx, font, ch), cell));
+
+    return {
+        family,
+        available,
+        monospace,
+        cellWidth: Math.round((cell / MEASURE_SIZE) * 1000) / 1000,
+        cjk: covers(ctx, family, PROBES.cjk),
+        powerline: covers(ctx, family, PROBES.powerline),
+        nerdFont: covers(ctx, family, PROBES.nerdFont),
+    };
+}
+
+export function measureFontFamilies(ctx: MeasureContext, families: string[]): FontMetrics[] {
+    return families.map(family => measureFontFamily(ctx, family));
+}
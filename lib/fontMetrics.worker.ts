@@ -0,0 +1,27 @@
+import { measureFontFamilies } from "./fontMetrics";
+
+/**
+ * Font metrics worker: measures cell width and glyph coverage off the UI
+ * thread using an OffscreenCanvas. Request: { id, families }, response:
+ * { id, metrics } or { id, error }.
+ */
+interface MeasureRequest {
+    id: number;
+    families: string[];
+}
+
+const canvas = new OffscreenCanvas(16, 16);
+const ctx = canvas.getContext("2d");
+
+self.onmessage = (event: MessageEvent<MeasureRequest>) => {
+    const { id, families } = event.data;
+    if (!ctx) {
+        self.postMessage({ id, error: "OffscreenCanvas 2d context unavailable" });
+        return;
+    }
+    try {
+        self.postMessage({ id, metrics: measureFontFamilies(ctx, families) });
+    } catch (error) {
+        self.postMessage({ id, error: error instanceof Error ? error.message : String(error) });
+    }
+};
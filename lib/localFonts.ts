@@ -1,4 +1,5 @@
-import { TerminalFont, withCjkFallback } from "../infrastructure/config/fonts"
+import { type FontMetrics, type TerminalFont, withMinimalFallback } from "../infrastructure/config/fonts"
+import { measureFontFamilies } from "./fontMetrics"
 
 /**
  * Type definition for Local Font Access API
@@ -87,10 +88,11 @@ function isMonospaceFont(familyName: string): boolean {
 }
 
 /**
- * Queries local monospace fonts from the system using the Font Access API.
- * Returns an empty array if the API is not available or permission is denied.
+ * Enumerates installed font families using the Font Access API, deduplicated
+ * (the API returns one entry per face). Returns an empty array if the API is
+ * not available or permission is denied.
  */
-export async function getMonospaceFonts(): Promise<TerminalFont[]> {
+export async function queryLocalFontFamilies(): Promise<string[]> {
     // Check if the Font Access API is available
     if (typeof window === "undefined" || !("queryLocalFonts" in window)) {
         return [];
@@ -99,29 +101,114 @@ export async function getMonospaceFonts(): Promise<TerminalFont[]> {
     try {
         const queryLocalFonts = (window as unknown as { queryLocalFonts: () => Promise<LocalFontData[]> }).queryLocalFonts;
         const fonts = await queryLocalFonts();
-
-        // Filter monospace fonts using robust word boundary matching
-        const monoFonts = fonts.filter(f => isMonospaceFont(f.family));
-
-        // Deduplicate by family name (API may return multiple entries per family)
-        const uniqueFamilies = new Set<string>();
-        const dedupedFonts = monoFonts.filter(f => {
-            if (uniqueFamilies.has(f.family)) return false;
-            uniqueFamilies.add(f.family);
-            return true;
-        });
-
-        // Map to TerminalFont structure with CJK fallback applied
-        return dedupedFonts.map(f => ({
-            id: f.family,
-            name: f.family,
-            family: withCjkFallback(f.family + ', monospace'),
-            description: `Local font: ${f.family}`,
-            category: 'monospace' as const,
-        }));
+        return Array.from(new Set(fonts.map(f => f.family))).sort();
     } catch (error) {
         // Handle permission denied or other errors gracefully
         console.warn('Failed to query local fonts:', error);
         return [];
     }
-}
\ No newline at end of file
+}
+
+let metricsWorker: Worker | null = null;
+let metricsWorkerFailed = false;
+let nextRequestId = 0;
+
+const measureOnMainThread = async (families: string[]): Promise<FontMetrics[]> => {
+    const canvas = document.createElement('canvas');
+    const ctx = canvas.getContext('2d');
+    if (!ctx) return [];
+    const results: FontMetrics[] = [];
+    // Small slices so a large font list never blocks a frame for long
+    for (let i = 0; i < families.length; i += 20) {
+        results.push(...measureFontFamilies(ctx, families.slice(i, i + 20)));
+        await new Promise(resolve => setTimeout(resolve, 0));
+    }
+    return results;
+};
+
+const measureInWorker = (families: string[]): Promise<FontMetrics[]> => {
+    if (!metricsWorker) {
+        metricsWorker = new Worker(new URL('./fontMetrics.worker.ts', import.meta.url), { type: 'module' });
+    }
+    const worker = metricsWorker;
+    const id = ++nextRequestId;
+    return new Promise((resolve, reject) => {
+        const cleanup = () => {
+            worker.removeEventListener('message', onMessage);
+            worker.removeEventListener('error', onError);
+        };
+        const onMessage = (event: MessageEvent<{ id: number; metrics?: FontMetrics[]; error?: string }>) => {
+            if (event.data.id !== id) return;
+            cleanup();
+            if (event.data.metrics) resolve(event.data.metrics);
+            else reject(new Error(event.data.error || 'Font measurement failed'));
+        };
+        const onError = (event: ErrorEvent) => {
+            cleanup();
+            reject(new Error(event.message || 'Font metrics worker failed'));
+        };
+        worker.addEventListener('message', onMessage);
+        worker.addEventListener('error', onError);
+        worker.postMessage({ id, families });
+    });
+};
+
+/**
+ * Measures cell width and glyph coverage (CJK, Powerline, Nerd Font) for the
+ * given families. Runs in a worker; falls back to sliced main-thread
+ * measurement where OffscreenCanvas workers are unavailable.
+ */
+export async function measureLocalFonts(families: string[]): Promise<Record<string, FontMetrics>> {
+    if (families.length === 0) return {};
+
+    let metrics: FontMetrics[] | null = null;
+    if (!metricsWorkerFailed && typeof Worker !== "undefined" && typeof OffscreenCanvas !== "undefined") {
+        try {
+            metrics = await measureInWorker(families);
+        } catch (error) {
+            console.warn('Font metrics worker unavailable, measuring on main thread:', error);
+            metricsWorkerFailed = true;
+            metricsWorker?.terminate();
+            metricsWorker = null;
+        }
+    }
+    if (!metrics) {
+        metrics = typeof document === "undefined" ? [] : await measureOnMainThread(families);
+    }
+
+    const byFamily: Record<string, FontMetrics> = {};
+    metrics.forEach(m => {
+        byFamily[m.family] = m;
+    });
+    return byFamily;
+}
+
+/**
+ * Maps installed families to terminal fonts. A family qualifies when it was
+ * measured as monospace or matches the name heuristics; its stack only gets
+ * the CJK fallback chain when it does not cover CJK itself.
+ */
+export function toMonospaceTerminalFonts(
+    families: string[],
+    metrics: Record<string, FontMetrics>,
+): TerminalFont[] {
+    return families
+        .filter(family => {
+            const m = metrics[family];
+            if (m && !m.available) return false;
+            return m?.monospace || isMonospaceFont(family);
+        })
+        .map(family => {
+            const m = metrics[family];
+            const glyphs = [m?.cjk && 'CJK', m?.powerline && 'Powerline', m?.nerdFont && 'Nerd Font']
+                .filter(Boolean)
+                .join(', ');
+            return {
+                id: family,
+                name: family,
+                family: withMinimalFallback(`"${family}", monospace`, m),
+                description: glyphs ? `Local font: ${family} (${glyphs})` : `Local font: ${family}`,
+                category: 'monospace' as const,
+            };
+        });
+}
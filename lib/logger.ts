@@ -1,24 +1,113 @@
+import { netcattyBridge } from "../infrastructure/services/netcattyBridge";
+
 type LogArgs = unknown[];
+type Level = Exclude<LogLevel, "off">;
+
+const LEVELS: Record<LogLevel, number> = { debug: 10, info: 20, warn: 30, error: 40, off: 100 };
+const RING_SIZE = 2000;
+const MAX_MESSAGE_CHARS = 4096;
 
 const isDev =
   typeof import.meta !== "undefined" &&
   typeof import.meta.env !== "undefined" &&
   !!import.meta.env.DEV;
 
-export const logger = {
-  debug: (...args: LogArgs) => {
-    if (!isDev) return;
-    console.debug(...args);
-  },
-  info: (...args: LogArgs) => {
-    if (!isDev) return;
-    console.info(...args);
-  },
-  warn: (...args: LogArgs) => {
-    console.warn(...args);
-  },
-  error: (...args: LogArgs) => {
-    console.error(...args);
-  },
+// Until the main process answers, dev logs everything and production stays at info
+let config: LogConfig = { level: isDev ? "debug" : "info", categories: {} };
+
+const thresholds = new Map<string, { value: number }>();
+const ring: LogEntry[] = new Array(RING_SIZE);
+let ringNext = 0;
+let ringCount = 0;
+
+const thresholdFor = (category: string) => LEVELS[config.categories[category] || config.level];
+
+const applyConfig = (next: LogConfig) => {
+  config = next;
+  for (const [category, threshold] of thresholds) threshold.value = thresholdFor(category);
+};
+
+const stringify = (arg: unknown): string => {
+  if (typeof arg === "string") return arg;
+  if (arg instanceof Error) return arg.stack || `${arg.name}: ${arg.message}`;
+  if (arg === undefined) return "undefined";
+  try {
+    return JSON.stringify(arg) ?? String(arg);
+  } catch {
+    return String(arg);
+  }
 };
 
+const CONSOLE_METHODS: Record<Level, "debug" | "info" | "warn" | "error"> = {
+  debug: "debug",
+  info: "info",
+  warn: "warn",
+  error: "error",
+};
+
+function write(category: string, level: Level, args: LogArgs) {
+  const resolved = args.map((arg) => (typeof arg === "function" ? (arg as () => unknown)() : arg));
+  let message = resolved.map(stringify).join(" ");
+  if (message.length > MAX_MESSAGE_CHARS) message = `${message.slice(0, MAX_MESSAGE_CHARS)}…`;
+  const entry: LogEntry = { time: Date.now(), level, category, source: "renderer", message };
+
+  ring[ringNext] = entry;
+  ringNext = (ringNext + 1) % RING_SIZE;
+  if (ringCount < RING_SIZE) ringCount++;
+
+  // Production consoles only ever showed warnings and errors
+  if (isDev || LEVELS[level] >= LEVELS.warn) {
+    const prefix = category === "App" ? [] : [`[${category}]`];
+    console[CONSOLE_METHODS[level]](...prefix, ...resolved);
+  }
+  // Forward problems so main-process crash dumps include them
+  if (LEVELS[level] >= LEVELS.warn) {
+    netcattyBridge.get()?.appendLogs?.([entry]);
+  }
+}
+
+/**
+ * Category logger. A disabled level costs one comparison; arguments may be
+ * thunks (`log.debug(() => expensive())`) so they are only built when enabled.
+ */
+export function createLogger(category: string) {
+  let threshold = thresholds.get(category);
+  if (!threshold) {
+    threshold = { value: thresholdFor(category) };
+    thresholds.set(category, threshold);
+  }
+  const t = threshold;
+  return {
+    debug: (...args: LogArgs) => {
+      if (t.value <= LEVELS.debug) write(category, "debug", args);
+    },
+    info: (...args: LogArgs) => {
+      if (t.value <= LEVELS.info) write(category, "info", args);
+    },
+    warn: (...args: LogArgs) => {
+      if (t.value <= LEVELS.warn) write(category, "warn", args);
+    },
+    error: (...args: LogArgs) => {
+      if (t.value <= LEVELS.error) write(category, "error", args);
+    },
+    isEnabled: (level: Level) => t.value <= LEVELS[level],
+  };
+}
+
+export const logger = createLogger("App");
+
+/** Most recent renderer entries, oldest first */
+export function getRecentLogs(limit = RING_SIZE): LogEntry[] {
+  const count = Math.min(ringCount, Math.max(0, limit));
+  const start = (ringNext - count + RING_SIZE) % RING_SIZE;
+  const out: LogEntry[] = [];
+  for (let i = 0; i < count; i++) out.push(ring[(start + i) % RING_SIZE]);
+  return out;
+}
+
+// Follow the levels configured in the main process
+if (typeof window !== "undefined") {
+  const bridge = netcattyBridge.get();
+  bridge?.getLogConfig?.().then(applyConfig).catch(() => {});
+  bridge?.onLogConfigChanged?.(applyConfig);
+}
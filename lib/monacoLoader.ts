@@ -0,0 +1,105 @@
+/**
+ * Monaco loading and large-file guards shared by all editor instances.
+ *
+ * Monaco is fetched from the local copy (scripts/copy-monaco.cjs) on first
+ * use and reused afterwards; `prewarmMonaco` loads it during idle time after
+ * startup so the first editor opens without the AMD bootstrap delay.
+ */
+import { loader } from '@monaco-editor/react';
+import type * as Monaco from 'monaco-editor';
+
+// Configure Monaco to use local files instead of CDN
+const monacoBasePath = import.meta.env.DEV
+  ? './node_modules/monaco-editor/min/vs'
+  : `${import.meta.env.BASE_URL}monaco/vs`;
+loader.config({ paths: { vs: monacoBasePath } });
+
+let monacoPromise: Promise<typeof Monaco> | null = null;
+
+/**
+ * Load Monaco once; every editor instance shares the same Monaco runtime and
+ * therefore the same per-language worker clients.
+ */
+export const loadMonaco = (): Promise<typeof Monaco> => {
+  if (!monacoPromise) {
+    monacoPromise = Promise.resolve(loader.init()).catch((err) => {
+      monacoPromise = null;
+      throw err;
+    });
+  }
+  return monacoPromise;
+};
+
+type IdleWindow = Window & {
+  requestIdleCallback?: (cb: () => void, opts?: { timeout: number }) => number;
+};
+
+/**
+ * Load Monaco in idle time after startup. Safe to call repeatedly.
+ */
+export const prewarmMonaco = (delayMs = 3000): void => {
+  if (typeof window === 'undefined' || monacoPromise) return;
+  setTimeout(() => {
+    const run = () => {
+      loadMonaco().catch((err) => console.warn('[Monaco] prewarm failed', err));
+    };
+    const idleWindow = window as IdleWindow;
+    if (typeof idleWindow.requestIdleCallback === 'function') {
+      idleWindow.requestIdleCallback(run, { timeout: 10000 });
+    } else {
+      run();
+    }
+  }, delayMs);
+};
+
+// Above these limits tokenization, the minimap and language services are
+// switched off so opening big logs or minified bundles cannot lock the UI.
+export const LARGE_FILE_BYTES = 2 * 1024 * 1024;
+export const LONG_LINE_CHARS = 10000;
+
+export interface EditorContentProfile {
+  isLarge: boolean;
+  hasLongLines: boolean;
+}
+
+/**
+ * Classify content without splitting it (splitting a 30 MB string allocates
+ * millions of substrings).
+ */
+export const profileEditorContent = (content: string): EditorContentProfile => {
+  const isLarge = content.length > LARGE_FILE_BYTES;
+  let hasLongLines = false;
+  let lineStart = 0;
+  while (lineStart <= content.length) {
+    let lineEnd = content.indexOf('\n', lineStart);
+    if (lineEnd === -1) lineEnd = content.length;
+    if (lineEnd - lineStart > LONG_LINE_CHARS) {
+      hasLongLines = true;
+      break;
+    }
+    lineStart = lineEnd + 1;
+  }
+  return { isLarge, hasLongLines };
+};
+
+/**
+ * Editor option overrides for heavy content.
+ */
+export const getLargeContentEditorOptions = (
+  profile: EditorContentProfile,
+): Monaco.editor.IStandaloneEditorConstructionOptions => {
+  if (!profile.isLarge && !profile.hasLongLines) return {};
+  return {
+    minimap: { enabled: false },
+    folding: false,
+    bracketPairColorization: { enabled: false },
+    occurrencesHighlight: 'off',
+    selectionHighlight: false,
+    renderWhitespace: 'none',
+    wordBasedSuggestions: 'off',
+    quickSuggestions: false,
+    maxTokenizationLineLength: profile.hasLongLines ? 1000 : 20000,
+    stopRenderingLineAfter: profile.hasLongLines ? 5000 : 10000,
+    largeFileOptimizations: true,
+  };
+};
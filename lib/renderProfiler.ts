@@ -0,0 +1,236 @@
+import { useSyncExternalStore } from "react";
+import type { ProfilerOnRenderCallback } from "react";
+import { STORAGE_KEY_RENDER_PROFILER } from "../infrastructure/config/storageKeys";
+
+/**
+ * Render profiler - singleton store behind the render profiler overlay
+ *
+ * Collects per-component render counts and changed-prop attribution (from
+ * useRenderTracker) plus commit durations (from React.Profiler via
+ * RenderProfiler). Every recorder returns after one branch while disabled.
+ * The toggle lives in localStorage so flipping it in the settings window
+ * reaches the main window through the storage event.
+ *
+ * Commit durations are only reported by development and profiling builds of
+ * React; production builds still get render counts and prop attribution.
+ *
+ * Terminals also report synchronized output (DEC mode 2026) frames here:
+ * each frame is one xterm write that stands in for several partial ones.
+ */
+
+type Listener = () => void;
+
+export type RenderPhase = "mount" | "update" | "nested-update";
+
+export interface ComponentRenderStats {
+  id: string;
+  /** Renders seen by useRenderTracker */
+  renders: number;
+  /** Commits reported by React.Profiler, split by phase */
+  commits: Record<RenderPhase, number>;
+  /** Actual (subtree) commit time per phase */
+  durationMs: Record<RenderPhase, number>;
+  maxMs: number;
+  lastMs: number;
+  /** How often each prop was the reason for a re-render */
+  changedProps: Record<string, number>;
+  lastRenderAt: number;
+}
+
+export interface RenderEvent {
+  time: number;
+  id: string;
+  phase: RenderPhase | "render";
+  durationMs: number | null;
+  changedProps?: string[];
+}
+
+export interface SyncOutputStats {
+  /** Synchronized updates written as one frame */
+  frames: number;
+  /** Partial writes that never reached the screen on their own */
+  skippedWrites: number;
+  /** Updates flushed because the end marker did not arrive in time */
+  timeouts: number;
+  maxHeldMs: number;
+}
+
+export interface RenderProfilerSnapshot {
+  enabled: boolean;
+  startedAt: number;
+  components: ComponentRenderStats[];
+  recent: RenderEvent[];
+  syncOutput: SyncOutputStats;
+}
+
+const RING_SIZE = 500;
+// Overlay updates are throttled so the profiler does not cause a render storm itself
+const NOTIFY_INTERVAL_MS = 500;
+
+const readEnabled = (): boolean => {
+  try {
+    return typeof localStorage !== "undefined" && localStorage.getItem(STORAGE_KEY_RENDER_PROFILER) === "1";
+  } catch {
+    return false;
+  }
+};
+
+let enabled = readEnabled();
+let startedAt = Date.now();
+const stats = new Map<string, ComponentRenderStats>();
+const ring: RenderEvent[] = [];
+let ringNext = 0;
+const emptySyncOutput = (): SyncOutputStats => ({ frames: 0, skippedWrites: 0, timeouts: 0, maxHeldMs: 0 });
+let syncOutput = emptySyncOutput();
+
+const listeners = new Set<Listener>();
+let snapshot: RenderProfilerSnapshot | null = null;
+let notifyTimer: ReturnType<typeof setTimeout> | null = null;
+
+const emit = () => {
+  snapshot = null;
+  listeners.forEach((listener) => listener());
+};
+
+const scheduleNotify = () => {
+  if (notifyTimer) return;
+  notifyTimer = setTimeout(() => {
+    notifyTimer = null;
+    emit();
+  }, NOTIFY_INTERVAL_MS);
+};
+
+const getStats = (id: string): ComponentRenderStats => {
+  let entry = stats.get(id);
+  if (!entry) {
+    entry = {
+      id,
+      renders: 0,
+      commits: { mount: 0, update: 0, "nested-update": 0 },
+      durationMs: { mount: 0, update: 0, "nested-update": 0 },
+      maxMs: 0,
+      lastMs: 0,
+      changedProps: {},
+      lastRenderAt: 0,
+    };
+    stats.set(id, entry);
+  }
+  return entry;
+};
+
+const pushEvent = (event: RenderEvent) => {
+  if (ring.length < RING_SIZE) ring.push(event);
+  else ring[ringNext] = event;
+  ringNext = (ringNext + 1) % RING_SIZE;
+};
+
+export const isRenderProfilerEnabled = () => enabled;
+
+/**
+ * Record a render and the props that changed since the previous one
+ */
+export function recordRender(id: string, changedProps: string[]): void {
+  if (!enabled) return;
+  const entry = getStats(id);
+  entry.renders++;
+  entry.lastRenderAt = Date.now();
+  for (const key of changedProps) {
+    entry.changedProps[key] = (entry.changedProps[key] || 0) + 1;
+  }
+  pushEvent({ time: entry.lastRenderAt, id, phase: "render", durationMs: null, changedProps });
+  scheduleNotify();
+}
+
+/**
+ * React.Profiler onRender callback
+ */
+export const recordCommit: ProfilerOnRenderCallback = (id, phase, actualDuration) => {
+  if (!enabled) return;
+  const entry = getStats(id);
+  entry.commits[phase]++;
+  entry.durationMs[phase] += actualDuration;
+  entry.lastMs = actualDuration;
+  if (actualDuration > entry.maxMs) entry.maxMs = actualDuration;
+  pushEvent({ time: Date.now(), id, phase, durationMs: actualDuration });
+  scheduleNotify();
+};
+
+/**
+ * A synchronized output frame written by a terminal
+ */
+export function recordSyncFrame(frame: { writes: number; chars: number; heldMs: number; timedOut: boolean }): void {
+  if (!enabled) return;
+  syncOutput.frames++;
+  syncOutput.skippedWrites += frame.writes - 1;
+  if (frame.timedOut) syncOutput.timeouts++;
+  if (frame.heldMs > syncOutput.maxHeldMs) syncOutput.maxHeldMs = frame.heldMs;
+  scheduleNotify();
+}
+
+export const totalDurationMs = (entry: ComponentRenderStats) =>
+  entry.durationMs.mount + entry.durationMs.update + entry.durationMs["nested-update"];
+
+export const totalCommits = (entry: ComponentRenderStats) =>
+  entry.commits.mount + entry.commits.update + entry.commits["nested-update"];
+
+export const renderProfilerStore = {
+  subscribe: (listener: Listener) => {
+    listeners.add(listener);
+    return () => listeners.delete(listener);
+  },
+
+  getSnapshot: (): RenderProfilerSnapshot => {
+    if (!snapshot) {
+      const recent = ring.length < RING_SIZE
+        ? ring.slice()
+        : [...ring.slice(ringNext), ...ring.slice(0, ringNext)];
+      snapshot = {
+        enabled,
+        startedAt,
+        components: Array.from(stats.values(), (entry) => ({
+          ...entry,
+          commits: { ...entry.commits },
+          durationMs: { ...entry.durationMs },
+          changedProps: { ...entry.changedProps },
+        })),
+        recent,
+        syncOutput: { ...syncOutput },
+      };
+    }
+    return snapshot;
+  },
+
+  setEnabled: (next: boolean) => {
+    if (enabled === next) return;
+    enabled = next;
+    try {
+      localStorage.setItem(STORAGE_KEY_RENDER_PROFILER, next ? "1" : "0");
+    } catch {
+      // ignore
+    }
+    emit();
+  },
+
+  reset: () => {
+    stats.clear();
+    ring.length = 0;
+    ringNext = 0;
+    syncOutput = emptySyncOutput();
+    startedAt = Date.now();
+    emit();
+  },
+};
+
+// Follow toggles made in other windows (e.g. the settings window)
+if (typeof window !== "undefined") {
+  window.addEventListener("storage", (event) => {
+    if (event.key !== STORAGE_KEY_RENDER_PROFILER) return;
+    const next = event.newValue === "1";
+    if (next === enabled) return;
+    enabled = next;
+    emit();
+  });
+}
+
+export const useRenderProfiler = () =>
+  useSyncExternalStore(renderProfilerStore.subscribe, renderProfilerStore.getSnapshot);
@@ -580,6 +580,22 @@ async function uploadEntries(
   };
 
   try {
+    // Create every remote directory up front: issued together, the mkdirs share
+    // one batched IPC message instead of one round trip per folder
+    if (!isLocal && sftpId) {
+      const dirPaths = new Set<string>();
+      for (const entry of sortedEntries) {
+        const pathParts = entry.relativePath.split('/');
+        const depth = entry.isDirectory ? pathParts.length : pathParts.length - 1;
+        let dirPath = targetPath;
+        for (let i = 0; i < depth; i++) {
+          dirPath = joinPath(dirPath, pathParts[i]);
+          dirPaths.add(dirPath);
+        }
+      }
+      await Promise.all([...dirPaths].map(ensureDirectory));
+    }
+
     for (const entry of sortedEntries) {
       await yieldToMain();
 
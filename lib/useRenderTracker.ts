@@ -1,5 +1,6 @@
-import { useRef } from "react";
+import React, { createElement, Profiler, useRef } from "react";
 import { logger } from "./logger";
+import { isRenderProfilerEnabled, recordCommit, recordRender } from "./renderProfiler";
 
 // Set to true to enable render tracking logs (for debugging only)
 const DEBUG_RENDER_TRACKING = false;
@@ -19,10 +20,17 @@ export function useRenderTracker(
 ): void {
   const renderCountRef = useRef(0);
   const prevPropsRef = useRef<Record<string, unknown>>({});
+  // 上一次渲染是否做过比较；刚开启时 prevProps 已过期，不能用来归因
+  const trackedRef = useRef(false);
 
   renderCountRef.current += 1;
 
-  if (!enabled) return;
+  // 渲染分析器开启时记录渲染次数和变化的 props（运行时开关，见 renderProfiler.ts）
+  const profiling = isRenderProfilerEnabled();
+  if (!enabled && !profiling) {
+    trackedRef.current = false;
+    return;
+  }
 
   const renderCount = renderCountRef.current;
   const prevProps = prevPropsRef.current;
@@ -37,6 +45,16 @@ export function useRenderTracker(
     }
   }
 
+  if (profiling) {
+    recordRender(componentName, trackedRef.current ? changedProps : []);
+  }
+  trackedRef.current = true;
+
+  // 更新 prevProps
+  prevPropsRef.current = { ...props };
+
+  if (!enabled) return;
+
   // 只在有变化时打印（减少日志噪音）
   if (renderCount === 1) {
     logger.info(`[Render] ${componentName} - 首次渲染`);
@@ -53,9 +71,25 @@ export function useRenderTracker(
     });
   }
   // 不再打印 "props未变化" 的警告 - 这是正常的 React 行为
+}
 
-  // 更新 prevProps
-  prevPropsRef.current = { ...props };
+/**
+ * 包装组件：记录 props 变化并用 React.Profiler 统计提交耗时
+ * Profiler 始终挂载，开关渲染分析器不会导致子树重新挂载
+ *
+ * @param componentName 在渲染分析器中显示的名称
+ * @param Component 被包装的组件
+ */
+export function withRenderProfiler<P extends object>(
+  componentName: string,
+  Component: React.ComponentType<P>,
+): React.FC<P> {
+  const Profiled: React.FC<P> = (props) => {
+    useRenderTracker(componentName, props as Record<string, unknown>);
+    return createElement(Profiler, { id: componentName, onRender: recordCommit }, createElement(Component, props));
+  };
+  Profiled.displayName = `Profiled(${componentName})`;
+  return Profiled;
 }
 
 /**
@@ -0,0 +1,545 @@
+/**
+ * Headless end-to-end benchmark for the SSH, SFTP, transfer and port
+ * forwarding bridges.
+ *
+ * Starts the in-process ssh2 server from scripts/bench-server.cjs on
+ * 127.0.0.1 and drives the bridge handlers directly with a fake IPC event, so
+ * no window, network or remote host is needed. Results are written as JSON and
+ * compared against a stored baseline; any metric worse than the tolerance is
+ * reported as a regression and the process exits with code 1.
+ *
+ * Numbers depend on the machine, so no baseline is checked in. The first run
+ * without one records scripts/bench-baseline.json (git-ignored) and later
+ * runs compare against it; `npm run bench:baseline` re-records it.
+ *
+ * Usage:
+ *   npm run bench [-- --quick] [-- --out results.json] [-- --baseline file]
+ *                 [-- --tolerance 15] [-- --update-baseline] [-- --verbose]
+ *                 [-- --wan latency=200,jitter=20,bandwidth=10000,loss=0.5,seed=1]
+ *
+ * --wan puts the WAN emulator (electron/bridges/wanEmulator.cjs) in front of
+ * the server so every path runs over a shaped link; keep a separate baseline
+ * per link profile.
+ *
+ * Sizes can be overridden with NETCATTY_BENCH_TERMINAL_MB, NETCATTY_BENCH_TRANSFER_MB,
+ * NETCATTY_BENCH_FORWARD_MB, NETCATTY_BENCH_FORWARD_CONCURRENCY and NETCATTY_BENCH_LIST_ENTRIES.
+ */
+const fs = require('fs');
+const os = require('os');
+const net = require('net');
+const path = require('path');
+const crypto = require('crypto');
+const { EventEmitter, once } = require('events');
+const { FLOOD_DONE, startBenchServer } = require('./bench-server.cjs');
+const { normalizeWanConfig, startWanEmulator } = require('../electron/bridges/wanEmulator.cjs');
+
+const RESULTS_VERSION = 1;
+const DEFAULT_BASELINE = path.join(__dirname, 'bench-baseline.json');
+const DEFAULT_TOLERANCE_PCT = 15;
+// Latency changes smaller than this are noise on a loaded machine
+const MIN_LATENCY_DELTA_MS = 2;
+const MB = 1048576;
+
+const USERNAME = 'bench';
+const PASSWORD = crypto.randomBytes(12).toString('hex');
+
+// ── Arguments ──
+
+const args = process.argv.slice(2);
+const hasFlag = (name) => args.includes(name);
+const getArg = (name, fallback) => {
+  const index = args.indexOf(name);
+  return index >= 0 && index + 1 < args.length ? args[index + 1] : fallback;
+};
+
+const quick = hasFlag('--quick');
+const verbose = hasFlag('--verbose');
+const updateBaseline = hasFlag('--update-baseline');
+const outFile = getArg('--out', null);
+const baselineFile = path.resolve(getArg('--baseline', DEFAULT_BASELINE));
+const tolerancePct = Number(getArg('--tolerance', DEFAULT_TOLERANCE_PCT));
+
+// "latency=200,jitter=20" -> { latencyMs: 200, jitterMs: 20 }
+const parseWanArg = (value) => {
+  if (!value) return null;
+  const keys = { latency: 'latencyMs', jitter: 'jitterMs', bandwidth: 'bandwidthKbps', loss: 'lossPercent', seed: 'seed' };
+  const config = {};
+  for (const part of value.split(',')) {
+    const [key, raw] = part.split('=');
+    if (!keys[key]) throw new Error(`Unknown --wan setting: ${key}`);
+    config[keys[key]] = Number(raw);
+  }
+  return normalizeWanConfig(config);
+};
+const wan = parseWanArg(getArg('--wan', null));
+
+const envNumber = (name, fallback) => {
+  const value = Number(process.env[name]);
+  return Number.isFinite(value) && value > 0 ? value : fallback;
+};
+
+const config = {
+  connectIterations: quick ? 3 : 5,
+  echoSamples: quick ? 50 : 200,
+  terminalMb: envNumber('NETCATTY_BENCH_TERMINAL_MB', quick ? 8 : 32),
+  listEntries: envNumber('NETCATTY_BENCH_LIST_ENTRIES', quick ? 500 : 2000),
+  transferMb: envNumber('NETCATTY_BENCH_TRANSFER_MB', quick ? 16 : 64),
+  forwardMb: envNumber('NETCATTY_BENCH_FORWARD_MB', quick ? 16 : 64),
+  forwardConcurrency: envNumber('NETCATTY_BENCH_FORWARD_CONCURRENCY', quick ? 8 : 32),
+  forwardConcurrentMb: 1,
+  wan,
+};
+
+// ── Helpers ──
+
+const log = (msg) => process.stderr.write(`[bench] ${msg}\n`);
+
+const now = () => Number(process.hrtime.bigint()) / 1e6;
+
+const percentile = (values, p) => {
+  if (values.length === 0) return 0;
+  const sorted = [...values].sort((a, b) => a - b);
+  const index = Math.min(sorted.length - 1, Math.ceil((p / 100) * sorted.length) - 1);
+  return sorted[Math.max(0, index)];
+};
+
+const round = (value, digits = 2) => Number(value.toFixed(digits));
+
+const metrics = {};
+const record = (name, value, unit, better) => {
+  metrics[name] = { value: round(value), unit, better };
+  log(`${name.padEnd(28)} ${String(round(value)).padStart(10)} ${unit}`);
+};
+
+const withTimeout = (promise, ms, label) => {
+  let timer;
+  return Promise.race([
+    promise,
+    new Promise((_, reject) => {
+      timer = setTimeout(() => reject(new Error(`${label} timed out after ${ms} ms`)), ms);
+    }),
+  ]).finally(() => clearTimeout(timer));
+};
+
+const hashFile = (filePath) => new Promise((resolve, reject) => {
+  const hash = crypto.createHash('sha256');
+  fs.createReadStream(filePath)
+    .on('data', (chunk) => hash.update(chunk))
+    .on('end', () => resolve(hash.digest('hex')))
+    .on('error', reject);
+});
+
+const writeRandomFile = async (filePath, bytes) => {
+  const handle = await fs.promises.open(filePath, 'w');
+  try {
+    const block = crypto.randomBytes(MB);
+    for (let written = 0; written < bytes; written += block.length) {
+      await handle.write(block, 0, Math.min(block.length, bytes - written));
+    }
+  } finally {
+    await handle.close();
+  }
+};
+
+const getFreePort = () => new Promise((resolve, reject) => {
+  const server = net.createServer();
+  server.once('error', reject);
+  server.listen(0, '127.0.0.1', () => {
+    const { port } = server.address();
+    server.close(() => resolve(port));
+  });
+});
+
+// Fake IPC event; bridge messages to the renderer land on the bus instead
+const createIpcEvent = (bus) => ({
+  sender: {
+    id: 1,
+    isDestroyed: () => false,
+    send: (channel, payload) => bus.emit(channel, payload),
+  },
+});
+
+// ── Benchmarks ──
+
+async function benchConnect(ctx) {
+  const { sshBridge, event, target, sessions } = ctx;
+  const samples = [];
+  for (let i = 0; i < config.connectIterations; i++) {
+    const sessionId = `bench-connect-${i}`;
+    const start = now();
+    await sshBridge.startSSHSession(event, { ...target, sessionId, cols: 120, rows: 40 });
+    samples.push(now() - start);
+    closeSession(sessions, sessionId);
+  }
+  record('sshConnectP50Ms', percentile(samples, 50), 'ms', 'lower');
+  record('sshConnectMaxMs', Math.max(...samples), 'ms', 'lower');
+}
+
+function closeSession(sessions, sessionId) {
+  // Mirrors terminalBridge.closeSession for SSH sessions
+  const session = sessions.get(sessionId);
+  if (!session) return;
+  try {
+    session.stream?.close();
+    session.conn?.end();
+  } catch {
+    // Already closed
+  }
+  sessions.delete(sessionId);
+}
+
+async function benchTerminal(ctx) {
+  const { sshBridge, event, target, sessions, bus } = ctx;
+  const sessionId = 'bench-terminal';
+  await sshBridge.startSSHSession(event, { ...target, sessionId, cols: 120, rows: 40 });
+  const session = sessions.get(sessionId);
+
+  const waitForData = (predicate, label) => withTimeout(new Promise((resolve) => {
+    const onData = (payload) => {
+      if (payload.sessionId !== sessionId || !predicate(payload.data)) return;
+      bus.off('netcatty:data', onData);
+      resolve();
+    };
+    bus.on('netcatty:data', onData);
+  }), 30000, label);
+
+  try {
+    const ready = waitForData((data) => data.includes('$ '), 'Shell prompt');
+    session.stream.write('\r');
+    await ready;
+
+    // Keystroke echo round trip, including the bridge's output coalescing
+    const echoSamples = [];
+    for (let i = 0; i < config.echoSamples; i++) {
+      const echoed = waitForData((data) => data.includes('x'), 'Keystroke echo');
+      const start = now();
+      session.stream.write('x');
+      await echoed;
+      echoSamples.push(now() - start);
+    }
+    const prompt = waitForData((data) => data.includes('$ '), 'Shell prompt');
+    session.stream.write('\r');
+    await prompt;
+    record('terminalEchoP50Ms', percentile(echoSamples, 50), 'ms', 'lower');
+    record('terminalEchoP95Ms', percentile(echoSamples, 95), 'ms', 'lower');
+
+    // Bulk output, as delivered to the renderer
+    const bytes = config.terminalMb * MB;
+    let received = 0;
+    let tail = '';
+    const flooded = withTimeout(new Promise((resolve) => {
+      const onData = (payload) => {
+        if (payload.sessionId !== sessionId) return;
+        received += payload.data.length;
+        tail = (tail + payload.data).slice(-FLOOD_DONE.length * 2);
+        if (!tail.includes(FLOOD_DONE)) return;
+        bus.off('netcatty:data', onData);
+        resolve();
+      };
+      bus.on('netcatty:data', onData);
+    }), 120000, 'Terminal flood');
+    const start = now();
+    session.stream.write(`flood ${bytes}\r`);
+    await flooded;
+    const seconds = (now() - start) / 1000;
+    if (received < bytes) throw new Error(`Terminal flood delivered ${received} of ${bytes} bytes`);
+    record('terminalThroughputMBps', bytes / MB / seconds, 'MB/s', 'higher');
+  } finally {
+    closeSession(sessions, sessionId);
+  }
+}
+
+async function benchSftp(ctx) {
+  const { sftpBridge, transferBridge, event, target, rootDir, localDir, bus } = ctx;
+
+  const connectStart = now();
+  const { sftpId } = await sftpBridge.openSftp(event, { ...target, sessionId: 'bench-sftp' });
+  record('sftpConnectMs', now() - connectStart, 'ms', 'lower');
+
+  try {
+    // Directory listing
+    const listDir = path.join(rootDir, 'list');
+    await fs.promises.mkdir(listDir, { recursive: true });
+    await Promise.all(Array.from({ length: config.listEntries }, (_, i) =>
+      fs.promises.writeFile(path.join(listDir, `file-${String(i).padStart(6, '0')}.txt`), 'netcatty')));
+    const listSamples = [];
+    for (let i = 0; i < 3; i++) {
+      const start = now();
+      const items = await sftpBridge.listSftp(event, { sftpId, path: listDir });
+      listSamples.push(now() - start);
+      if (items.length !== config.listEntries) {
+        throw new Error(`Listing returned ${items.length} of ${config.listEntries} entries`);
+      }
+    }
+    record('sftpListP50Ms', percentile(listSamples, 50), 'ms', 'lower');
+
+    // Upload and download through the transfer bridge
+    const bytes = config.transferMb * MB;
+    const localSource = path.join(localDir, 'source.bin');
+    const localTarget = path.join(localDir, 'target.bin');
+    const remotePath = path.join(rootDir, 'transfer', 'upload.bin');
+    await writeRandomFile(localSource, bytes);
+
+    const runTransfer = async (payload) => {
+      const transferId = crypto.randomUUID();
+      const start = now();
+      const result = await transferBridge.startTransfer(event, { transferId, totalBytes: bytes, ...payload });
+      if (result.error) throw new Error(`Transfer failed: ${result.error}`);
+      return (now() - start) / 1000;
+    };
+
+    let progressEvents = 0;
+    const onProgress = () => { progressEvents++; };
+    bus.on('netcatty:transfer:progress', onProgress);
+    try {
+      const uploadSeconds = await runTransfer({
+        sourcePath: localSource,
+        targetPath: remotePath,
+        sourceType: 'local',
+        targetType: 'sftp',
+        targetSftpId: sftpId,
+      });
+      record('sftpUploadMBps', bytes / MB / uploadSeconds, 'MB/s', 'higher');
+
+      const downloadSeconds = await runTransfer({
+        sourcePath: remotePath,
+        targetPath: localTarget,
+        sourceType: 'sftp',
+        targetType: 'local',
+        sourceSftpId: sftpId,
+      });
+      record('sftpDownloadMBps', bytes / MB / downloadSeconds, 'MB/s', 'higher');
+    } finally {
+      bus.off('netcatty:transfer:progress', onProgress);
+    }
+    if (verbose) log(`transfer progress events: ${progressEvents}`);
+
+    const [sourceHash, targetHash] = await Promise.all([hashFile(localSource), hashFile(localTarget)]);
+    if (sourceHash !== targetHash) throw new Error('Downloaded file does not match the uploaded file');
+  } finally {
+    await sftpBridge.closeSftp(event, { sftpId });
+  }
+}
+
+// Upstream for forwarded connections: reads "<bytes>\n", sends that many bytes
+async function startSourceServer() {
+  const block = crypto.randomBytes(MB);
+  const server = net.createServer((socket) => {
+    socket.on('error', () => {});
+    let request = '';
+    socket.on('data', async function onRequest(chunk) {
+      request += chunk.toString('ascii');
+      if (!request.includes('\n')) return;
+      socket.off('data', onRequest);
+      let remaining = Number(request.trim());
+      while (remaining > 0 && !socket.destroyed) {
+        const piece = remaining >= block.length ? block : block.subarray(0, remaining);
+        remaining -= piece.length;
+        if (!socket.write(piece)) await once(socket, 'drain');
+      }
+      socket.end();
+    });
+  });
+  server.listen(0, '127.0.0.1');
+  await once(server, 'listening');
+  return server;
+}
+
+const fetchThroughForward = (port, bytes) => new Promise((resolve, reject) => {
+  const start = now();
+  let firstByteMs = null;
+  let received = 0;
+  const socket = net.connect(port, '127.0.0.1', () => socket.write(`${bytes}\n`));
+  socket.on('data', (chunk) => {
+    if (firstByteMs === null) firstByteMs = now() - start;
+    received += chunk.length;
+  });
+  socket.on('error', reject);
+  socket.on('end', () => {
+    if (received !== bytes) {
+      reject(new Error(`Forward delivered ${received} of ${bytes} bytes`));
+      return;
+    }
+    resolve({ firstByteMs, totalMs: now() - start });
+  });
+});
+
+async function benchForward(ctx) {
+  const { portForwardingBridge, event, target } = ctx;
+  const sourceServer = await startSourceServer();
+  const localPort = await getFreePort();
+  const tunnelId = 'bench-forward';
+
+  try {
+    await portForwardingBridge.startPortForward(event, {
+      tunnelId,
+      type: 'local',
+      localPort,
+      bindAddress: '127.0.0.1',
+      remoteHost: '127.0.0.1',
+      remotePort: sourceServer.address().port,
+      hostname: target.hostname,
+      port: target.port,
+      username: target.username,
+      password: target.password,
+    });
+
+    const bytes = config.forwardMb * MB;
+    const single = await withTimeout(fetchThroughForward(localPort, bytes), 120000, 'Forward transfer');
+    record('forwardThroughputMBps', bytes / MB / (single.totalMs / 1000), 'MB/s', 'higher');
+
+    const perConnection = config.forwardConcurrentMb * MB;
+    const start = now();
+    const results = await withTimeout(Promise.all(
+      Array.from({ length: config.forwardConcurrency }, () => fetchThroughForward(localPort, perConnection)),
+    ), 120000, 'Concurrent forwards');
+    const seconds = (now() - start) / 1000;
+    record('forwardConcurrentMBps', (perConnection * config.forwardConcurrency) / MB / seconds, 'MB/s', 'higher');
+    record('forwardFirstByteP95Ms', percentile(results.map((r) => r.firstByteMs), 95), 'ms', 'lower');
+  } finally {
+    await portForwardingBridge.stopPortForward(event, { tunnelId });
+    sourceServer.close();
+  }
+}
+
+// ── Baseline comparison ──
+
+function compareWithBaseline(baseline) {
+  const regressions = [];
+  for (const [name, current] of Object.entries(metrics)) {
+    const base = baseline.metrics?.[name];
+    if (!base || !(base.value > 0)) continue;
+    const change = (current.value - base.value) / base.value;
+    const worse = current.better === 'higher' ? -change : change;
+    if (worse * 100 <= tolerancePct) continue;
+    if (current.unit === 'ms' && Math.abs(current.value - base.value) < MIN_LATENCY_DELTA_MS) continue;
+    regressions.push({
+      metric: name,
+      baseline: base.value,
+      current: current.value,
+      unit: current.unit,
+      changePct: round(change * 100, 1),
+    });
+  }
+  return regressions;
+}
+
+// ── Main ──
+
+async function main() {
+  const tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), 'netcatty-bench-e2e-'));
+  const rootDir = path.join(tmpDir, 'remote');
+  const localDir = path.join(tmpDir, 'local');
+  const homeDir = path.join(tmpDir, 'home');
+  const userDataDir = path.join(tmpDir, 'userData');
+  for (const dir of [rootDir, localDir, homeDir, userDataDir]) fs.mkdirSync(dir, { recursive: true });
+
+  // Keep the run hermetic: no default keys from ~/.ssh and no agent
+  process.env.HOME = homeDir;
+  delete process.env.SSH_AUTH_SOCK;
+
+  const originalConsole = { log: console.log, warn: console.warn, error: console.error };
+  if (!verbose) {
+    console.log = () => {};
+    console.warn = () => {};
+    console.error = () => {};
+  }
+
+  // Required after HOME is replaced so module-level paths point at the sandbox
+  const remoteCapabilities = require('../electron/bridges/remoteCapabilities.cjs');
+  const sshBridge = require('../electron/bridges/sshBridge.cjs');
+  const sftpBridge = require('../electron/bridges/sftpBridge.cjs');
+  const transferBridge = require('../electron/bridges/transferBridge.cjs');
+  const portForwardingBridge = require('../electron/bridges/portForwardingBridge.cjs');
+  const sessionMetrics = require('../electron/bridges/sessionMetricsBridge.cjs');
+
+  const sessions = new Map();
+  const deps = {
+    sessions,
+    sftpClients: new Map(),
+    electronModule: { app: { getPath: () => userDataDir } },
+  };
+  remoteCapabilities.init(deps);
+  sessionMetrics.init(deps);
+  sshBridge.init(deps);
+  sftpBridge.init(deps);
+  transferBridge.init(deps);
+
+  const server = await startBenchServer({ username: USERNAME, password: PASSWORD, rootDir });
+  const link = wan
+    ? await startWanEmulator({ ...wan, targetHost: '127.0.0.1', targetPort: server.port })
+    : null;
+  const bus = new EventEmitter();
+  bus.setMaxListeners(0);
+  const ctx = {
+    sshBridge,
+    sftpBridge,
+    transferBridge,
+    portForwardingBridge,
+    sessions,
+    bus,
+    event: createIpcEvent(bus),
+    rootDir,
+    localDir,
+    target: { hostname: '127.0.0.1', port: link ? link.port : server.port, username: USERNAME, password: PASSWORD },
+  };
+
+  log(`ssh2 server on 127.0.0.1:${server.port}${quick ? ' (quick)' : ''}`);
+  if (wan) log(`WAN emulation ${JSON.stringify(wan)} on 127.0.0.1:${link.port}`);
+  try {
+    await benchConnect(ctx);
+    await benchTerminal(ctx);
+    await benchSftp(ctx);
+    await benchForward(ctx);
+  } finally {
+    await link?.close();
+    await server.close();
+    Object.assign(console, originalConsole);
+    fs.rmSync(tmpDir, { recursive: true, force: true });
+  }
+
+  const results = {
+    version: RESULTS_VERSION,
+    timestamp: new Date().toISOString(),
+    environment: {
+      node: process.version,
+      platform: `${process.platform}-${process.arch}`,
+      cpus: os.cpus().length,
+      cpuModel: os.cpus()[0]?.model || 'unknown',
+    },
+    config,
+    metrics,
+  };
+
+  let regressions = [];
+  if (updateBaseline || !fs.existsSync(baselineFile)) {
+    fs.writeFileSync(baselineFile, `${JSON.stringify(results, null, 2)}\n`);
+    log(`baseline written to ${baselineFile}`);
+  } else {
+    const baseline = JSON.parse(fs.readFileSync(baselineFile, 'utf8'));
+    if (baseline.version !== RESULTS_VERSION || JSON.stringify(baseline.config) !== JSON.stringify(config)) {
+      log('baseline was recorded with a different configuration; skipping comparison');
+    } else {
+      regressions = compareWithBaseline(baseline);
+      results.baseline = { file: baselineFile, timestamp: baseline.timestamp, tolerancePct, regressions };
+      for (const r of regressions) {
+        log(`REGRESSION ${r.metric}: ${r.baseline} -> ${r.current} ${r.unit} (${r.changePct > 0 ? '+' : ''}${r.changePct}%)`);
+      }
+      if (regressions.length === 0) log(`no regressions beyond ${tolerancePct}% against ${baselineFile}`);
+    }
+  }
+
+  const json = `${JSON.stringify(results, null, 2)}\n`;
+  if (outFile) {
+    fs.writeFileSync(outFile, json);
+  } else {
+    process.stdout.write(json);
+  }
+  process.exitCode = regressions.length > 0 ? 1 : 0;
+}
+
+// Exit explicitly; bridge keepalive and cache timers would keep the loop alive
+main().then(() => process.exit(process.exitCode)).catch((err) => {
+  process.stderr.write(`[bench] Failed: ${err.stack || err.message}\n`);
+  process.exit(2);
+});
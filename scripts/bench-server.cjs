@@ -0,0 +1,317 @@
+/**
+ * In-process ssh2 server for the end-to-end benchmark (scripts/bench-e2e.cjs).
+ *
+ * Listens on 127.0.0.1 with a throwaway host key and serves:
+ * - password auth for a single user
+ * - a PTY "shell" that echoes input and answers `flood <bytes>` with that much
+ *   output followed by FLOOD_DONE
+ * - exec via the local `sh`, so capability probes behave like a real host
+ * - an SFTP subsystem backed by the local filesystem (relative paths resolve
+ *   against rootDir)
+ * - direct-tcpip channels for local port forwards
+ */
+const fs = require('fs');
+const net = require('net');
+const path = require('path');
+const { once } = require('events');
+const { spawn } = require('child_process');
+const { Server, utils } = require('ssh2');
+
+const { STATUS_CODE, flagsToString } = utils.sftp;
+
+const FLOOD_DONE = '__NETCATTY_BENCH_FLOOD_DONE__';
+const READDIR_BATCH = 128;
+
+// 64 KB of printable lines, so terminal output looks like real command output
+const FLOOD_BLOCK = (() => {
+  const line = `${'netcatty-bench '.repeat(5)}\r\n`;
+  return Buffer.from(line.repeat(Math.ceil(65536 / line.length)).slice(0, 65536), 'ascii');
+})();
+
+const toStatusCode = (err) => {
+  if (err?.code === 'ENOENT') return STATUS_CODE.NO_SUCH_FILE;
+  if (err?.code === 'EACCES' || err?.code === 'EPERM') return STATUS_CODE.PERMISSION_DENIED;
+  return STATUS_CODE.FAILURE;
+};
+
+const toAttrs = (stats) => ({
+  mode: stats.mode,
+  uid: stats.uid,
+  gid: stats.gid,
+  size: stats.size,
+  atime: Math.floor(stats.atimeMs / 1000),
+  mtime: Math.floor(stats.mtimeMs / 1000),
+});
+
+const PERM_CHARS = 'rwxrwxrwx';
+
+const toLongname = (name, stats) => {
+  const type = stats.isDirectory() ? 'd' : stats.isSymbolicLink() ? 'l' : '-';
+  let perms = '';
+  for (let i = 0; i < 9; i++) {
+    perms += stats.mode & (1 << (8 - i)) ? PERM_CHARS[i] : '-';
+  }
+  const date = stats.mtime.toDateString().slice(4, 10);
+  return `${type}${perms} 1 ${stats.uid} ${stats.gid} ${stats.size} ${date} 00:00 ${name}`;
+};
+
+function serveSftp(sftp, rootDir) {
+  const handles = new Map();
+  let nextHandleId = 0;
+
+  const resolvePath = (p) => path.resolve(rootDir, Buffer.isBuffer(p) ? p.toString('utf8') : p);
+  const addHandle = (entry) => {
+    const handle = Buffer.alloc(4);
+    handle.writeUInt32BE(nextHandleId++);
+    handles.set(handle.readUInt32BE(0), entry);
+    return handle;
+  };
+  const getHandle = (handle) => (handle.length === 4 ? handles.get(handle.readUInt32BE(0)) : undefined);
+  const fail = (reqid, err) => sftp.status(reqid, toStatusCode(err), err?.message);
+  const done = (reqid) => (err) => (err ? fail(reqid, err) : sftp.status(reqid, STATUS_CODE.OK));
+
+  const applyAttrs = (target, attrs, callback) => {
+    const byFd = typeof target === 'number';
+    const steps = [];
+    if (attrs?.mode !== undefined) {
+      steps.push((cb) => (byFd ? fs.fchmod : fs.chmod)(target, attrs.mode & 0o7777, cb));
+    }
+    if (attrs?.size !== undefined) {
+      steps.push((cb) => (byFd ? fs.ftruncate : fs.truncate)(target, attrs.size, cb));
+    }
+    if (attrs?.atime !== undefined && attrs?.mtime !== undefined) {
+      steps.push((cb) => (byFd ? fs.futimes : fs.utimes)(target, attrs.atime, attrs.mtime, cb));
+    }
+    const next = (err) => {
+      if (err || steps.length === 0) return callback(err || null);
+      steps.shift()(next);
+    };
+    next();
+  };
+
+  sftp.on('OPEN', (reqid, filename, flags, attrs) => {
+    const mode = flagsToString(flags);
+    if (!mode) return sftp.status(reqid, STATUS_CODE.OP_UNSUPPORTED);
+    const createMode = attrs?.mode !== undefined ? attrs.mode & 0o7777 : 0o644;
+    fs.open(resolvePath(filename), mode, createMode, (err, fd) => {
+      if (err) return fail(reqid, err);
+      sftp.handle(reqid, addHandle({ fd }));
+    });
+  });
+
+  sftp.on('READ', (reqid, handle, offset, length) => {
+    const entry = getHandle(handle);
+    if (entry?.fd === undefined) return sftp.status(reqid, STATUS_CODE.FAILURE, 'Invalid handle');
+    const buffer = Buffer.allocUnsafe(length);
+    fs.read(entry.fd, buffer, 0, length, offset, (err, bytesRead) => {
+      if (err) return fail(reqid, err);
+      if (bytesRead === 0) return sftp.status(reqid, STATUS_CODE.EOF);
+      sftp.data(reqid, buffer.subarray(0, bytesRead));
+    });
+  });
+
+  sftp.on('WRITE', (reqid, handle, offset, data) => {
+    const entry = getHandle(handle);
+    if (entry?.fd === undefined) return sftp.status(reqid, STATUS_CODE.FAILURE, 'Invalid handle');
+    fs.write(entry.fd, data, 0, data.length, offset, done(reqid));
+  });
+
+  sftp.on('FSTAT', (reqid, handle) => {
+    const entry = getHandle(handle);
+    if (entry?.fd === undefined) return sftp.status(reqid, STATUS_CODE.FAILURE, 'Invalid handle');
+    fs.fstat(entry.fd, (err, stats) => (err ? fail(reqid, err) : sftp.attrs(reqid, toAttrs(stats))));
+  });
+
+  sftp.on('FSETSTAT', (reqid, handle, attrs) => {
+    const entry = getHandle(handle);
+    if (entry?.fd === undefined) return sftp.status(reqid, STATUS_CODE.FAILURE, 'Invalid handle');
+    applyAttrs(entry.fd, attrs, done(reqid));
+  });
+
+  sftp.on('CLOSE', (reqid, handle) => {
+    const entry = getHandle(handle);
+    if (!entry) return sftp.status(reqid, STATUS_CODE.FAILURE, 'Invalid handle');
+    handles.delete(handle.readUInt32BE(0));
+    if (entry.fd === undefined) return sftp.status(reqid, STATUS_CODE.OK);
+    fs.close(entry.fd, done(reqid));
+  });
+
+  sftp.on('OPENDIR', (reqid, dirPath) => {
+    const resolved = resolvePath(dirPath);
+    fs.readdir(resolved, (err, names) => {
+      if (err) return fail(reqid, err);
+      sftp.handle(reqid, addHandle({ dirPath: resolved, names }));
+    });
+  });
+
+  sftp.on('READDIR', (reqid, handle) => {
+    const entry = getHandle(handle);
+    if (!entry?.names) return sftp.status(reqid, STATUS_CODE.FAILURE, 'Invalid handle');
+    if (entry.names.length === 0) return sftp.status(reqid, STATUS_CODE.EOF);
+    const batch = entry.names.splice(0, READDIR_BATCH);
+    Promise.all(batch.map(async (name) => {
+      const stats = await fs.promises.lstat(path.join(entry.dirPath, name));
+      return { filename: name, longname: toLongname(name, stats), attrs: toAttrs(stats) };
+    })).then(
+      (items) => sftp.name(reqid, items),
+      (err) => fail(reqid, err),
+    );
+  });
+
+  sftp.on('LSTAT', (reqid, p) => {
+    fs.lstat(resolvePath(p), (err, stats) => (err ? fail(reqid, err) : sftp.attrs(reqid, toAttrs(stats))));
+  });
+
+  sftp.on('STAT', (reqid, p) => {
+    fs.stat(resolvePath(p), (err, stats) => (err ? fail(reqid, err) : sftp.attrs(reqid, toAttrs(stats))));
+  });
+
+  sftp.on('SETSTAT', (reqid, p, attrs) => applyAttrs(resolvePath(p), attrs, done(reqid)));
+  sftp.on('REMOVE', (reqid, p) => fs.unlink(resolvePath(p), done(reqid)));
+  sftp.on('RMDIR', (reqid, p) => fs.rmdir(resolvePath(p), done(reqid)));
+  sftp.on('MKDIR', (reqid, p, attrs) => {
+    fs.mkdir(resolvePath(p), { mode: attrs?.mode !== undefined ? attrs.mode & 0o7777 : 0o755 }, done(reqid));
+  });
+  sftp.on('RENAME', (reqid, oldPath, newPath) => fs.rename(resolvePath(oldPath), resolvePath(newPath), done(reqid)));
+  sftp.on('SYMLINK', (reqid, linkPath, targetPath) => fs.symlink(targetPath, resolvePath(linkPath), done(reqid)));
+
+  sftp.on('READLINK', (reqid, p) => {
+    fs.readlink(resolvePath(p), (err, target) => {
+      if (err) return fail(reqid, err);
+      sftp.name(reqid, [{ filename: target, longname: target, attrs: {} }]);
+    });
+  });
+
+  sftp.on('REALPATH', (reqid, p) => {
+    const resolved = resolvePath(p);
+    sftp.name(reqid, [{ filename: resolved, longname: resolved, attrs: {} }]);
+  });
+
+  sftp.on('close', () => {
+    for (const entry of handles.values()) {
+      if (entry.fd !== undefined) fs.close(entry.fd, () => {});
+    }
+    handles.clear();
+  });
+}
+
+async function flood(stream, bytes) {
+  let remaining = bytes;
+  while (remaining > 0) {
+    const piece = remaining >= FLOOD_BLOCK.length ? FLOOD_BLOCK : FLOOD_BLOCK.subarray(0, remaining);
+    remaining -= piece.length;
+    if (!stream.write(piece)) await once(stream, 'drain');
+  }
+}
+
+function runShell(stream) {
+  let line = '';
+  stream.write('$ ');
+  stream.on('data', (data) => {
+    for (const ch of data.toString('utf8')) {
+      if (ch !== '\r' && ch !== '\n') {
+        line += ch;
+        stream.write(ch);
+        continue;
+      }
+      const command = line.trim();
+      line = '';
+      stream.write('\r\n');
+      const match = /^flood (\d+)$/.exec(command);
+      if (match) {
+        stream.pause();
+        flood(stream, Number(match[1])).then(() => {
+          stream.write(`${FLOOD_DONE}\r\n$ `);
+          stream.resume();
+        });
+        return;
+      }
+      if (command === 'exit') {
+        stream.exit(0);
+        stream.end();
+        return;
+      }
+      stream.write('$ ');
+    }
+  });
+}
+
+function runExec(stream, command, rootDir) {
+  const child = spawn('sh', ['-c', command], { cwd: rootDir });
+  child.stdout.on('data', (data) => stream.write(data));
+  child.stderr.on('data', (data) => stream.stderr.write(data));
+  stream.on('data', (data) => child.stdin.write(data));
+  stream.on('end', () => child.stdin.end());
+  child.on('error', () => {
+    stream.exit(127);
+    stream.end();
+  });
+  child.on('close', (code) => {
+    stream.exit(code ?? 1);
+    stream.end();
+  });
+}
+
+function forwardTcp(accept, reject, info) {
+  const socket = net.connect(info.destPort, info.destIP);
+  socket.once('error', () => reject());
+  socket.once('connect', () => {
+    const stream = accept();
+    socket.removeAllListeners('error');
+    socket.on('error', () => stream.destroy());
+    stream.on('error', () => socket.destroy());
+    stream.pipe(socket).pipe(stream);
+  });
+}
+
+/**
+ * Start the benchmark server
+ * @returns {Promise<{ port: number, close: () => Promise<void> }>}
+ */
+async function startBenchServer({ username, password, rootDir }) {
+  const hostKey = utils.generateKeyPairSync('ed25519');
+  const connections = new Set();
+
+  const server = new Server({ hostKeys: [hostKey.private] }, (client) => {
+    connections.add(client);
+    client.on('close', () => connections.delete(client));
+    client.on('error', () => {});
+
+    client.on('authentication', (ctx) => {
+      if (ctx.method === 'password' && ctx.username === username && ctx.password === password) {
+        ctx.accept();
+      } else {
+        ctx.reject(['password']);
+      }
+    });
+
+    client.on('ready', () => {
+      client.on('session', (acceptSession) => {
+        const session = acceptSession();
+        session.on('pty', (accept) => accept?.());
+        session.on('window-change', (accept) => accept?.());
+        session.on('env', (accept) => accept?.());
+        session.on('shell', (accept) => runShell(accept()));
+        session.on('exec', (accept, reject, info) => runExec(accept(), info.command, rootDir));
+        session.on('sftp', (accept) => serveSftp(accept(), rootDir));
+      });
+      client.on('tcpip', forwardTcp);
+    });
+  });
+
+  server.listen(0, '127.0.0.1');
+  await once(server, 'listening');
+
+  return {
+    port: server.address().port,
+    close: () => new Promise((resolve) => {
+      for (const client of connections) client.end();
+      server.close(() => resolve());
+    }),
+  };
+}
+
+module.exports = {
+  FLOOD_DONE,
+  startBenchServer,
+};
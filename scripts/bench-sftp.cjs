@@ -0,0 +1,105 @@
+/**
+ * SFTP throughput benchmark: stream transfers (the previous implementation)
+ * vs. the pipelined, server-sized transfers in electron/bridges/sftpPipeline.cjs.
+ *
+ * Usage:
+ *   NETCATTY_BENCH_HOST=host NETCATTY_BENCH_USER=user \
+ *   [NETCATTY_BENCH_PORT=22] [NETCATTY_BENCH_PASSWORD=...] [NETCATTY_BENCH_KEY=~/.ssh/id_ed25519] \
+ *   [NETCATTY_BENCH_MB=64] [NETCATTY_BENCH_DIR=/tmp] npm run bench:sftp
+ */
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const crypto = require('crypto');
+const { Client } = require('ssh2');
+const {
+  getTransferProfile,
+  pipelinedDownload,
+  pipelinedUploadFile,
+} = require('../electron/bridges/sftpPipeline.cjs');
+
+const env = process.env;
+const host = env.NETCATTY_BENCH_HOST;
+const username = env.NETCATTY_BENCH_USER;
+const sizeMb = Number(env.NETCATTY_BENCH_MB || 64);
+const remoteDir = env.NETCATTY_BENCH_DIR || '/tmp';
+
+if (!host || !username) {
+  console.error('[bench-sftp] Set NETCATTY_BENCH_HOST and NETCATTY_BENCH_USER');
+  process.exit(1);
+}
+
+const expandHome = (p) => (p.startsWith('~') ? path.join(os.homedir(), p.slice(1)) : p);
+
+const connect = () => new Promise((resolve, reject) => {
+  const conn = new Client();
+  conn.on('ready', () => {
+    conn.sftp((err, sftp) => (err ? reject(err) : resolve({ conn, sftp })));
+  });
+  conn.on('error', reject);
+  conn.connect({
+    host,
+    port: Number(env.NETCATTY_BENCH_PORT || 22),
+    username,
+    password: env.NETCATTY_BENCH_PASSWORD,
+    privateKey: env.NETCATTY_BENCH_KEY ? fs.readFileSync(expandHome(env.NETCATTY_BENCH_KEY)) : undefined,
+    agent: env.SSH_AUTH_SOCK,
+  });
+});
+
+const pipeStreams = (readStream, writeStream) => new Promise((resolve, reject) => {
+  readStream.on('error', reject);
+  writeStream.on('error', reject);
+  writeStream.on('close', resolve);
+  readStream.pipe(writeStream);
+});
+
+const time = async (label, bytes, fn) => {
+  const start = process.hrtime.bigint();
+  await fn();
+  const seconds = Number(process.hrtime.bigint() - start) / 1e9;
+  const mbps = bytes / 1048576 / seconds;
+  console.log(`${label.padEnd(22)} ${seconds.toFixed(2).padStart(7)} s  ${mbps.toFixed(1).padStart(8)} MB/s`);
+  return mbps;
+};
+
+async function main() {
+  const bytes = sizeMb * 1048576;
+  const tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), 'netcatty-bench-'));
+  const localSource = path.join(tmpDir, 'source.bin');
+  const localTarget = path.join(tmpDir, 'target.bin');
+  const remotePath = path.posix.join(remoteDir, `netcatty-bench-${process.pid}.bin`);
+  fs.writeFileSync(localSource, crypto.randomBytes(bytes));
+
+  const { conn, sftp } = await connect();
+  try {
+    const profile = getTransferProfile(sftp);
+    console.log(`[bench-sftp] ${host}: ${sizeMb} MB, read ${profile.readChunk} B x ${profile.readRequests}, write ${profile.writeChunk} B x ${profile.writeRequests}`);
+    console.log(`[bench-sftp] extensions: ${Object.keys(sftp._extensions || {}).join(', ') || 'none'}`);
+
+    const results = {};
+    results.streamUpload = await time('upload (stream)', bytes, () =>
+      pipeStreams(fs.createReadStream(localSource), sftp.createWriteStream(remotePath)));
+    results.pipelinedUpload = await time('upload (pipelined)', bytes, () =>
+      pipelinedUploadFile(sftp, localSource, remotePath));
+    results.streamDownload = await time('download (stream)', bytes, () =>
+      pipeStreams(sftp.createReadStream(remotePath), fs.createWriteStream(localTarget)));
+    results.pipelinedDownload = await time('download (pipelined)', bytes, () =>
+      pipelinedDownload(sftp, remotePath, localTarget));
+
+    const sourceHash = crypto.createHash('sha256').update(fs.readFileSync(localSource)).digest('hex');
+    const targetHash = crypto.createHash('sha256').update(fs.readFileSync(localTarget)).digest('hex');
+    if (sourceHash !== targetHash) throw new Error('Downloaded file does not match the uploaded file');
+
+    console.log(`[bench-sftp] upload speedup ${(results.pipelinedUpload / results.streamUpload).toFixed(2)}x, download speedup ${(results.pipelinedDownload / results.streamDownload).toFixed(2)}x`);
+    await new Promise((resolve) => sftp.unlink(remotePath, () => resolve()));
+  } finally {
+    conn.end();
+    fs.rmSync(tmpDir, { recursive: true, force: true });
+  }
+}
+
+main().catch((err) => {
+  console.error('[bench-sftp] Failed:', err.message);
+  process.exit(1);
+});
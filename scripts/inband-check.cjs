@@ -0,0 +1,173 @@
+/**
+ * Round-trip check for the in-band (ZMODEM/trzsz) transfer engines against
+ * the real tools running on a local PTY.
+ *
+ * Downloads a set of generated files from `sz` and uploads them back to `rz`
+ * (and does the same with `tsz`/`trz` when trzsz is installed), then compares
+ * MD5 sums and prints the throughput. The PTY comes from node-pty when it
+ * loads under plain Node, otherwise from script(1).
+ *
+ * Usage:
+ *   npm run inband-check [-- --size-mb 16] [-- --keep]
+ */
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const crypto = require('crypto');
+const { spawn, spawnSync } = require('child_process');
+const zmodem = require('../electron/bridges/zmodem.cjs');
+const trzsz = require('../electron/bridges/trzsz.cjs');
+
+const args = process.argv.slice(2);
+const getArg = (name, fallback) => {
+  const index = args.indexOf(name);
+  return index >= 0 && index + 1 < args.length ? args[index + 1] : fallback;
+};
+const sizeMb = Number(getArg('--size-mb', 16));
+const keep = args.includes('--keep');
+
+const hasCommand = (cmd) => spawnSync('sh', ['-c', `command -v ${cmd}`]).status === 0;
+
+const md5 = (file) => crypto.createHash('md5').update(fs.readFileSync(file)).digest('hex');
+
+/**
+ * Run `command` on a PTY in `cwd`; returns { write(buf) -> Promise<boolean>, onData(cb), exited }
+ */
+function spawnPty(command, cwd) {
+  let pty = null;
+  try {
+    pty = require('node-pty');
+  } catch {
+    // Built for Electron's ABI or not installed
+  }
+  if (pty) {
+    const proc = pty.spawn('/bin/sh', ['-c', command], { cwd, cols: 120, rows: 40, encoding: null });
+    return {
+      write: (buf) => {
+        proc.write(buf);
+        return Promise.resolve(true);
+      },
+      onData: (cb) => proc.onData((data) => cb(Buffer.isBuffer(data) ? data : Buffer.from(data, 'utf8'))),
+      exited: new Promise((resolve) => proc.onExit(({ exitCode }) => resolve(exitCode))),
+    };
+  }
+  if (process.platform !== 'linux' || !hasCommand('script')) {
+    throw new Error('Need node-pty or util-linux script(1) for a PTY');
+  }
+  const child = spawn('script', ['-qfec', command, '/dev/null'], { cwd, stdio: ['pipe', 'pipe', 'inherit'] });
+  return {
+    write: (buf) => new Promise((resolve) => {
+      if (child.stdin.write(buf)) resolve(true);
+      else child.stdin.once('drain', () => resolve(true));
+    }),
+    onData: (cb) => child.stdout.on('data', cb),
+    exited: new Promise((resolve) => child.on('exit', resolve)),
+  };
+}
+
+/**
+ * Start `command`, wait for its handshake and hand the stream to the engine
+ * built by `createEngine(detected, write, onDone)`
+ */
+function runTransfer(command, cwd, detect, createEngine) {
+  return new Promise((resolve, reject) => {
+    const term = spawnPty(command, cwd);
+    let engine = null;
+    let seen = Buffer.alloc(0);
+    const started = Date.now();
+    term.onData((data) => {
+      if (engine) {
+        engine.push(data);
+        return;
+      }
+      seen = Buffer.concat([seen, data]);
+      const found = detect(seen);
+      if (!found || found.partial || (found.end === undefined && found.direction === undefined)) return;
+      engine = createEngine(found, term.write, (err) => {
+        if (err) reject(err);
+        else term.exited.then((code) => resolve({ code, seconds: (Date.now() - started) / 1000 }));
+      });
+      const rest = seen.subarray(found.end ?? found.index);
+      seen = null;
+      if (typeof engine.run === 'function') void engine.run();
+      if (rest.length) engine.push(rest);
+    });
+    setTimeout(() => reject(new Error(`${command}: no handshake seen`)), 10000).unref();
+  });
+}
+
+function report(label, files, dir, totalBytes, seconds) {
+  const ok = files.every((file) => md5(file) === md5(path.join(dir, path.basename(file))));
+  const mbps = totalBytes / 1024 / 1024 / Math.max(seconds, 0.001);
+  console.log(`[inband-check] ${label.padEnd(18)} ${ok ? 'OK  ' : 'FAIL'} ${seconds.toFixed(2)}s ${mbps.toFixed(1)} MB/s`);
+  return ok;
+}
+
+async function main() {
+  const root = fs.mkdtempSync(path.join(os.tmpdir(), 'netcatty-inband-'));
+  const source = path.join(root, 'source');
+  fs.mkdirSync(source);
+  const files = [
+    ['empty.bin', 0],
+    ['small.bin', 1000],
+    ['escapes.bin', 64 * 1024],
+    ['large.bin', sizeMb * 1024 * 1024],
+  ].map(([name, size]) => {
+    const file = path.join(source, name);
+    // Make sure every escaped byte value shows up
+    const data = name === 'escapes.bin'
+      ? Buffer.from(Array.from({ length: size }, (_, i) => i & 0xff))
+      : crypto.randomBytes(size);
+    fs.writeFileSync(file, data);
+    return file;
+  });
+  const totalBytes = files.reduce((sum, file) => sum + fs.statSync(file).size, 0);
+  const names = files.map((file) => `'${path.basename(file)}'`).join(' ');
+  let ok = true;
+
+  const zmodemEngine = (saveDir) => ({ direction }, write, onDone) => direction === 'download'
+    ? new zmodem.ZmodemReceiver({ write, saveDir, onDone })
+    : new zmodem.ZmodemSender({ write, files, onDone });
+
+  if (hasCommand('sz') && hasCommand('rz')) {
+    const down = path.join(root, 'zmodem-down');
+    const up = path.join(root, 'zmodem-up');
+    fs.mkdirSync(down);
+    fs.mkdirSync(up);
+    const d = await runTransfer(`sz -b ${names}`, source, zmodem.detect, zmodemEngine(down));
+    ok = report('zmodem download', files, down, totalBytes, d.seconds) && ok;
+    const u = await runTransfer('rz -b', up, zmodem.detect, zmodemEngine(null));
+    ok = report('zmodem upload', files, up, totalBytes, u.seconds) && ok;
+  } else {
+    console.log('[inband-check] lrzsz not installed, skipping ZMODEM');
+  }
+
+  if (hasCommand('tsz') && hasCommand('trz')) {
+    const down = path.join(root, 'trzsz-down');
+    const up = path.join(root, 'trzsz-up');
+    fs.mkdirSync(down);
+    fs.mkdirSync(up);
+    const trzszEngine = ({ mode }, write, onDone) => new trzsz.TrzszClient({
+      mode,
+      write,
+      files: mode === 'R' ? files : null,
+      saveDir: mode === 'S' ? down : null,
+      onDone,
+    });
+    const d = await runTransfer(`tsz ${names}`, source, trzsz.detect, trzszEngine);
+    ok = report('trzsz download', files, down, totalBytes, d.seconds) && ok;
+    const u = await runTransfer('trz', up, trzsz.detect, trzszEngine);
+    ok = report('trzsz upload', files, up, totalBytes, u.seconds) && ok;
+  } else {
+    console.log('[inband-check] trzsz not installed, skipping trzsz');
+  }
+
+  if (keep) console.log(`[inband-check] files kept in ${root}`);
+  else fs.rmSync(root, { recursive: true, force: true });
+  process.exit(ok ? 0 : 1);
+}
+
+main().catch((err) => {
+  console.error('[inband-check]', err.message || err);
+  process.exit(1);
+});
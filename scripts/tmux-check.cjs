@@ -0,0 +1,175 @@
+/**
+ * Check for the tmux control mode bridge against a real local tmux.
+ *
+ * The bridge normally runs `tmux -C` on an SSH exec channel; here a stand-in
+ * connection runs the same command locally (on a private tmux socket) and
+ * the script plays the renderer: it attaches, types into a pane, splits it,
+ * resizes it, kills a pane, then detaches and attaches again to check that
+ * the session and its screen survive, and that a pane printing nonstop loses
+ * no output between its snapshot and the live stream.
+ *
+ * Usage:
+ *   npm run tmux-check [-- --keep]
+ */
+const fs = require('fs');
+const os = require('os');
+const path = require('path');
+const { spawn, spawnSync } = require('child_process');
+const { EventEmitter } = require('events');
+const tmuxBridge = require('../electron/bridges/tmuxBridge.cjs');
+const sessionMetrics = require('../electron/bridges/sessionMetricsBridge.cjs');
+
+const keep = process.argv.includes('--keep');
+const socketDir = fs.mkdtempSync(path.join(os.tmpdir(), 'netcatty-tmux-'));
+const env = { ...process.env, TMUX_TMPDIR: socketDir, TMUX: '', SHELL: '/bin/sh', PS1: '$ ' };
+const sessionName = `netcatty-check-${process.pid}`;
+
+/**
+ * Enough of an ssh2 Client for the bridge: exec() runs the command locally
+ * and hands back a channel-like stream
+ */
+function createLocalConn() {
+  return {
+    exec(command, callback) {
+      const child = spawn('/bin/sh', ['-c', command], { env, stdio: ['pipe', 'pipe', 'pipe'] });
+      const channel = new EventEmitter();
+      channel.stderr = child.stderr;
+      channel.write = (data) => child.stdin.write(data);
+      channel.close = () => child.stdin.end();
+      Object.defineProperty(channel, 'writableNeedDrain', { get: () => child.stdin.writableNeedDrain });
+      child.stdout.on('data', (data) => channel.emit('data', data));
+      child.stdin.on('drain', () => channel.emit('drain'));
+      child.on('close', () => channel.emit('close'));
+      callback(null, channel);
+    },
+  };
+}
+
+const sessions = new Map();
+sessionMetrics.init({ sessions });
+tmuxBridge.init({ sessions });
+
+// Renderer side: data per session id, and tmux events
+const received = new Map();
+const events = [];
+const sender = {
+  id: 1,
+  isDestroyed: () => false,
+  send(channel, payload) {
+    if (channel === 'netcatty:data') {
+      received.set(payload.sessionId, (received.get(payload.sessionId) || '') + payload.data);
+    } else if (channel === 'netcatty:tmux:event') {
+      events.push(payload);
+    }
+  },
+};
+const event = { sender };
+
+const sleep = (ms) => new Promise((resolve) => setTimeout(resolve, ms));
+
+async function waitFor(label, predicate, timeoutMs = 5000) {
+  const started = Date.now();
+  while (Date.now() - started < timeoutMs) {
+    const value = predicate();
+    if (value) return value;
+    await sleep(25);
+  }
+  throw new Error(`Timed out waiting for ${label}`);
+}
+
+const panesOf = (node) => (node.type === 'pane' ? [node] : node.children.flatMap(panesOf));
+
+let failures = 0;
+function check(label, ok, detail) {
+  console.log(`[tmux-check] ${label.padEnd(34)} ${ok ? 'OK' : 'FAIL'}${detail ? `  ${detail}` : ''}`);
+  if (!ok) failures++;
+}
+
+function write(sessionId, data) {
+  sessions.get(sessionId).stream.write(data);
+}
+
+async function main() {
+  const owner = 'ssh-owner';
+  sessions.set(owner, { conn: createLocalConn() });
+
+  const first = await tmuxBridge.attachTmux(event, { sessionId: owner, sessionName });
+  check('attach lists one window', first.windows.length === 1, `${first.windows.length} window(s)`);
+  const [window] = first.windows;
+  const [pane] = panesOf(window.layout);
+  check('pane registered as session', sessions.has(pane.sessionId), pane.sessionId);
+
+  await tmuxBridge.attachPane(event, { sessionId: pane.sessionId });
+  write(pane.sessionId, 'echo netcatty-$((6*7))\r');
+  await waitFor('pane output', () => received.get(pane.sessionId)?.includes('netcatty-42'));
+  check('%output routed to pane', true);
+
+  sessions.get(pane.sessionId).stream.setWindow(30, 100);
+  const resized = await waitFor('window resize', () => events.find((e) => e.type === 'window'
+    && e.window.layout.width === 100 && e.window.layout.height === 30));
+  check('resize sets window size', !!resized, `${resized.window.layout.width}x${resized.window.layout.height}`);
+
+  const split = await tmuxBridge.tmuxCommand(event, {
+    controlId: first.controlId,
+    action: 'split',
+    sessionId: pane.sessionId,
+    direction: 'vertical',
+  });
+  check('split command accepted', split.success, split.error);
+  const splitEvent = await waitFor('split layout', () => events.find((e) => e.type === 'window'
+    && panesOf(e.window.layout).length === 2));
+  check('split becomes a vertical split', splitEvent.window.layout.type === 'split'
+    && splitEvent.window.layout.direction === 'vertical');
+  const newPane = panesOf(splitEvent.window.layout).find((p) => p.sessionId !== pane.sessionId);
+  check('new pane registered as session', sessions.has(newPane.sessionId), newPane.sessionId);
+
+  sessions.get(newPane.sessionId).stream.close();
+  await waitFor('pane removal', () => !sessions.has(newPane.sessionId));
+  check('closing a pane kills it', true);
+
+  const detached = await tmuxBridge.detachTmux(event, { controlId: first.controlId });
+  check('detach', detached.success);
+  await waitFor('detach teardown', () => events.some((e) => e.type === 'exit' && e.controlId === first.controlId));
+  check('pane sessions dropped on detach', !sessions.has(pane.sessionId));
+
+  const second = await tmuxBridge.attachTmux(event, { sessionId: owner, sessionName });
+  const [again] = panesOf(second.windows[0].layout);
+  const { snapshot } = await tmuxBridge.attachPane(event, { sessionId: again.sessionId });
+  check('reattach restores the screen', snapshot.includes('netcatty-42'));
+
+  // Keep the pane printing a counter while it is detached and attached again
+  write(again.sessionId, 'i=0; while :; do i=$((i+1)); echo "c$i"; done\r');
+  await sleep(300);
+  await tmuxBridge.detachTmux(event, { controlId: second.controlId });
+  await waitFor('detach teardown', () => events.some((e) => e.type === 'exit' && e.controlId === second.controlId));
+
+  const third = await tmuxBridge.attachTmux(event, { sessionId: owner, sessionName });
+  const [counting] = panesOf(third.windows[0].layout);
+  const attached = await tmuxBridge.attachPane(event, { sessionId: counting.sessionId });
+  await sleep(500);
+  write(counting.sessionId, '\x03');
+  // The snapshot's cursor move may split a line; drop it and compare the numbers
+  const text = (attached.snapshot + (received.get(counting.sessionId) || '')).replace(/\x1b\[[0-9;]*[A-Za-z]/g, '');
+  const numbers = [...text.matchAll(/^c(\d+)\r?$/gm)].map((m) => Number(m[1]));
+  let missing = 0;
+  for (let i = 1; i < numbers.length; i++) {
+    if (numbers[i] > numbers[i - 1] + 1) missing += numbers[i] - numbers[i - 1] - 1;
+  }
+  check('no output lost after the snapshot', numbers.length > 0 && missing === 0,
+    `${numbers.length} lines, ${missing} missing`);
+
+  await tmuxBridge.detachTmux(event, { controlId: third.controlId });
+  await sleep(1200);
+}
+
+main()
+  .catch((err) => {
+    console.error('[tmux-check]', err.message || err);
+    failures++;
+  })
+  .finally(() => {
+    spawnSync('tmux', ['kill-server'], { env });
+    if (keep) console.log(`[tmux-check] socket dir kept in ${socketDir}`);
+    else fs.rmSync(socketDir, { recursive: true, force: true });
+    process.exit(failures ? 1 : 0);
+  });
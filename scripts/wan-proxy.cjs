@@ -0,0 +1,44 @@
+/**
+ * Standalone WAN emulation proxy: forwards a local port to a target with
+ * added latency, jitter, a bandwidth cap and packet loss.
+ *
+ * Usage:
+ *   npm run wan-proxy -- --target host:22 [--listen 2222] [--latency 200]
+ *                        [--jitter 20] [--bandwidth 10000] [--loss 0.5] [--seed 1]
+ *
+ * --latency is round-trip ms, --bandwidth is kbit/s per direction (0 = unlimited),
+ * --loss is the percentage of segments that need a retransmission.
+ */
+const { startWanEmulator } = require('../electron/bridges/wanEmulator.cjs');
+
+const args = process.argv.slice(2);
+const getArg = (name, fallback) => {
+  const index = args.indexOf(name);
+  return index >= 0 && index + 1 < args.length ? args[index + 1] : fallback;
+};
+
+const target = getArg('--target', null);
+const match = target && /^(.+):(\d+)$/.exec(target);
+if (!match) {
+  console.error('[wan-proxy] Set --target host:port');
+  process.exit(1);
+}
+
+const listenHost = getArg('--listen-host', '127.0.0.1');
+
+startWanEmulator({
+  targetHost: match[1].replace(/^\[(.*)\]$/, '$1'),
+  targetPort: Number(match[2]),
+  listenHost,
+  listenPort: Number(getArg('--listen', 0)),
+  latencyMs: getArg('--latency', 0),
+  jitterMs: getArg('--jitter', 0),
+  bandwidthKbps: getArg('--bandwidth', 0),
+  lossPercent: getArg('--loss', 0),
+  seed: getArg('--seed', undefined),
+}).then(({ port }) => {
+  console.log(`[wan-proxy] ${listenHost}:${port} -> ${target}`);
+}).catch((err) => {
+  console.error('[wan-proxy] Failed:', err.message);
+  process.exit(1);
+});